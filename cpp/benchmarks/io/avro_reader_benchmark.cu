@@ -0,0 +1,169 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <cudf/table/table.hpp>
+
+#include <tests/utilities/base_fixture.hpp>
+
+#include <benchmarks/fixture/benchmark_fixture.hpp>
+#include <benchmarks/synchronization/synchronization.hpp>
+
+#include <cudf/io/functions.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <zlib.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <vector>
+
+// to enable, run cmake with -DBUILD_BENCHMARKS=ON
+
+namespace cudf_io = cudf::io;
+
+class AvroRead : public cudf::benchmark {
+};
+
+enum class avro_codec : int32_t { NONE, DEFLATE };
+
+namespace {
+constexpr int num_long_columns = 8;
+constexpr int rows_per_block   = 16 * 1024;
+
+void put_long(std::vector<uint8_t>& out, int64_t value)
+{
+  auto zigzag = (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63);
+  while (zigzag >= 0x80) {
+    out.push_back(static_cast<uint8_t>(zigzag | 0x80));
+    zigzag >>= 7;
+  }
+  out.push_back(static_cast<uint8_t>(zigzag));
+}
+
+void put_string(std::vector<uint8_t>& out, std::string const& str)
+{
+  put_long(out, str.size());
+  out.insert(out.end(), str.begin(), str.end());
+}
+
+/**
+ * @brief Compresses a block with raw DEFLATE, as stored by the Avro "deflate" codec
+ */
+std::vector<uint8_t> deflate_block(std::vector<uint8_t> const& block)
+{
+  std::vector<uint8_t> compressed(compressBound(block.size()));
+  z_stream strm{};
+  CUDF_EXPECTS(deflateInit2(&strm, 6, Z_DEFLATED, -15, 8, Z_DEFAULT_STRATEGY) == Z_OK,
+               "deflateInit2 failed");
+  strm.next_in   = const_cast<uint8_t*>(block.data());
+  strm.avail_in  = block.size();
+  strm.next_out  = compressed.data();
+  strm.avail_out = compressed.size();
+  CUDF_EXPECTS(deflate(&strm, Z_FINISH) == Z_STREAM_END, "deflate failed");
+  compressed.resize(strm.total_out);
+  deflateEnd(&strm);
+  return compressed;
+}
+
+/**
+ * @brief Writes an Avro container file of roughly `total_bytes` of uncompressed row data, with
+ * eight long columns and one string column
+ */
+void write_synthetic_avro(std::string const& filepath, int64_t total_bytes, avro_codec codec)
+{
+  std::string schema = "{\"type\":\"record\",\"name\":\"bench\",\"fields\":[";
+  for (int c = 0; c < num_long_columns; ++c) {
+    schema += "{\"name\":\"l" + std::to_string(c) + "\",\"type\":\"long\"},";
+  }
+  schema += "{\"name\":\"s\",\"type\":\"string\"}]}";
+
+  std::vector<uint8_t> header{'O', 'b', 'j', 1};
+  put_long(header, 2);
+  put_string(header, "avro.codec");
+  put_string(header, (codec == avro_codec::DEFLATE) ? "deflate" : "null");
+  put_string(header, "avro.schema");
+  put_string(header, schema);
+  put_long(header, 0);
+  std::vector<uint8_t> const sync_marker(16, 0x5a);
+  header.insert(header.end(), sync_marker.begin(), sync_marker.end());
+
+  std::ofstream outfile(filepath, std::ofstream::out | std::ofstream::binary);
+  outfile.write(reinterpret_cast<const char*>(header.data()), header.size());
+
+  std::vector<uint8_t> block;
+  std::vector<uint8_t> block_header;
+  for (int64_t written = 0; written < total_bytes; written += block.size()) {
+    block.clear();
+    for (int r = 0; r < rows_per_block; ++r) {
+      for (int c = 0; c < num_long_columns; ++c) { put_long(block, rand() % (1 << (3 * c + 4))); }
+      put_string(block, "row" + std::to_string(rand() % 100000));
+    }
+    auto const payload = (codec == avro_codec::DEFLATE) ? deflate_block(block) : block;
+    block_header.clear();
+    put_long(block_header, rows_per_block);
+    put_long(block_header, payload.size());
+    outfile.write(reinterpret_cast<const char*>(block_header.data()), block_header.size());
+    outfile.write(reinterpret_cast<const char*>(payload.data()), payload.size());
+    outfile.write(reinterpret_cast<const char*>(sync_marker.data()), sync_marker.size());
+  }
+}
+
+}  // namespace
+
+/**
+ * @brief Reads `total_bytes` of row data split evenly across `num_files` Avro files
+ */
+void Avro_read(benchmark::State& state)
+{
+  int64_t const total_desired_bytes = state.range(0);
+  int const num_files               = state.range(1);
+  auto const codec                  = static_cast<avro_codec>(state.range(2));
+
+  auto const tmpdir = std::getenv("TMPDIR");
+  std::vector<std::string> filepaths;
+  srand(31337);
+  for (int f = 0; f < num_files; ++f) {
+    filepaths.push_back(std::string(tmpdir != nullptr ? tmpdir : "/tmp") +
+                        "/cudf_avro_read_benchmark_" + std::to_string(f) + ".avro");
+    write_synthetic_avro(filepaths.back(), total_desired_bytes / num_files, codec);
+  }
+
+  for (auto _ : state) {
+    cuda_event_timer raii(state, true);  // flush_l2_cache = true, stream = 0
+    cudf_io::read_avro_args args{cudf_io::source_info(filepaths[0])};
+    if (num_files > 1) { args.filepaths = filepaths; }
+    cudf_io::read_avro(args);
+  }
+
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+  for (auto const& filepath : filepaths) { std::remove(filepath.c_str()); }
+}
+
+#define ARBM_BENCHMARK_DEFINE(name, size, num_files, codec)                          \
+  BENCHMARK_DEFINE_F(AvroRead, name)(::benchmark::State & state) { Avro_read(state); } \
+  BENCHMARK_REGISTER_F(AvroRead, name)                                                \
+    ->Args({size, num_files, static_cast<int64_t>(codec)})                            \
+    ->Unit(benchmark::kMillisecond)                                                   \
+    ->UseManualTime()                                                                 \
+    ->Iterations(4)
+
+ARBM_BENCHMARK_DEFINE(1GbUncompressed, (int64_t)1 * 1024 * 1024 * 1024, 1, avro_codec::NONE);
+ARBM_BENCHMARK_DEFINE(1GbDeflate, (int64_t)1 * 1024 * 1024 * 1024, 1, avro_codec::DEFLATE);
+ARBM_BENCHMARK_DEFINE(1GbDeflate16Files, (int64_t)1 * 1024 * 1024 * 1024, 16, avro_codec::DEFLATE);
@@ -0,0 +1,324 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <benchmarks/fixture/benchmark_fixture.hpp>
+#include <benchmarks/synchronization/synchronization.hpp>
+
+#include <io/comp/cpu_comp.h>
+#include <io/comp/gpuinflate.h>
+#include <io/comp/io_uncomp.h>
+
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/device_buffer.hpp>
+
+#include <zlib.h>
+
+#include <string>
+#include <vector>
+
+// to enable, run cmake with -DBUILD_BENCHMARKS=ON
+
+namespace cudf_io = cudf::io;
+
+class Compression : public cudf::benchmark {
+};
+
+class Decompression : public cudf::benchmark {
+};
+
+namespace {
+constexpr size_t total_uncompressed_size = 256 << 20;
+
+/**
+ * @brief Compressed pages and the argument structures to decompress them, in host memory
+ */
+struct compressed_pages {
+  std::vector<uint8_t> uncompressed;
+  std::vector<uint8_t> compressed;
+  std::vector<cudf_io::gpu_inflate_input_s> inputs;
+  size_t compressed_size = 0;
+};
+
+/**
+ * @brief Returns moderately compressible data, similar to a column of text-encoded integers
+ */
+std::vector<uint8_t> create_input_data(size_t size)
+{
+  std::vector<uint8_t> data;
+  data.reserve(size);
+  for (uint32_t i = 0; data.size() < size; i++) {
+    auto const text = std::to_string(i * 2654435761u % 100000) + ",";
+    data.insert(data.end(), text.begin(), text.end());
+  }
+  data.resize(size);
+  return data;
+}
+
+/**
+ * @brief Compresses each page with raw DEFLATE on the host
+ */
+void deflate_pages(compressed_pages &pages, size_t page_size)
+{
+  size_t const num_pages = pages.uncompressed.size() / page_size;
+  size_t const max_page  = compressBound(page_size);
+  pages.compressed.resize(num_pages * max_page);
+  for (size_t i = 0; i < num_pages; i++) {
+    z_stream strm{};
+    CUDF_EXPECTS(deflateInit2(&strm, 6, Z_DEFLATED, -15, 8, Z_DEFAULT_STRATEGY) == Z_OK,
+                 "deflateInit2 failed");
+    strm.next_in   = pages.uncompressed.data() + i * page_size;
+    strm.avail_in  = page_size;
+    strm.next_out  = pages.compressed.data() + i * max_page;
+    strm.avail_out = max_page;
+    CUDF_EXPECTS(deflate(&strm, Z_FINISH) == Z_STREAM_END, "deflate failed");
+    pages.inputs.push_back({pages.compressed.data() + i * max_page,
+                            strm.total_out,
+                            pages.uncompressed.data() + i * page_size,
+                            page_size});
+    pages.compressed_size += strm.total_out;
+    deflateEnd(&strm);
+  }
+}
+
+/**
+ * @brief Compresses each page with Snappy on the GPU
+ */
+void snappy_pages(compressed_pages &pages, size_t page_size)
+{
+  size_t const num_pages = pages.uncompressed.size() / page_size;
+  size_t const max_page  = 32 + page_size + page_size / 6;
+  rmm::device_buffer d_uncompressed(pages.uncompressed.data(), pages.uncompressed.size());
+  rmm::device_buffer d_compressed(num_pages * max_page);
+
+  std::vector<cudf_io::gpu_inflate_input_s> args(num_pages);
+  for (size_t i = 0; i < num_pages; i++) {
+    args[i].srcDevice = static_cast<uint8_t const *>(d_uncompressed.data()) + i * page_size;
+    args[i].srcSize   = page_size;
+    args[i].dstDevice = static_cast<uint8_t *>(d_compressed.data()) + i * max_page;
+    args[i].dstSize   = max_page;
+  }
+  rmm::device_buffer d_args(args.data(), args.size() * sizeof(args[0]));
+  rmm::device_buffer d_stats(num_pages * sizeof(cudf_io::gpu_inflate_status_s));
+  CUDA_TRY(cudf_io::gpu_snap(static_cast<cudf_io::gpu_inflate_input_s *>(d_args.data()),
+                             static_cast<cudf_io::gpu_inflate_status_s *>(d_stats.data()),
+                             num_pages));
+
+  std::vector<cudf_io::gpu_inflate_status_s> stats(num_pages);
+  pages.compressed.resize(d_compressed.size());
+  CUDA_TRY(cudaMemcpy(stats.data(), d_stats.data(), d_stats.size(), cudaMemcpyDeviceToHost));
+  CUDA_TRY(cudaMemcpy(pages.compressed.data(),
+                      d_compressed.data(),
+                      d_compressed.size(),
+                      cudaMemcpyDeviceToHost));
+  for (size_t i = 0; i < num_pages; i++) {
+    CUDF_EXPECTS(stats[i].status == 0, "Snappy compression failed");
+    pages.inputs.push_back({pages.compressed.data() + i * max_page,
+                            stats[i].bytes_written,
+                            pages.uncompressed.data() + i * page_size,
+                            page_size});
+    pages.compressed_size += stats[i].bytes_written;
+  }
+}
+
+/**
+ * @brief Compresses each page with a host codec
+ */
+void host_compress_pages(compressed_pages &pages, size_t page_size, int stream_type)
+{
+  size_t const num_pages = pages.uncompressed.size() / page_size;
+  size_t const max_page  = 32 + page_size + page_size / 6;
+  pages.compressed.resize(num_pages * max_page);
+
+  std::vector<cudf_io::gpu_inflate_input_s> args(num_pages);
+  for (size_t i = 0; i < num_pages; i++) {
+    args[i] = {pages.uncompressed.data() + i * page_size,
+               page_size,
+               pages.compressed.data() + i * max_page,
+               max_page};
+  }
+  std::vector<cudf_io::gpu_inflate_status_s> stats(num_pages);
+  cudf_io::host_compress_batch(stream_type, args.data(), stats.data(), num_pages);
+  for (size_t i = 0; i < num_pages; i++) {
+    CUDF_EXPECTS(stats[i].status == 0, "Host compression failed");
+    pages.inputs.push_back({pages.compressed.data() + i * max_page,
+                            stats[i].bytes_written,
+                            pages.uncompressed.data() + i * page_size,
+                            page_size});
+    pages.compressed_size += stats[i].bytes_written;
+  }
+}
+
+void compress_pages(compressed_pages &pages, size_t page_size, int stream_type)
+{
+  switch (stream_type) {
+    case cudf_io::IO_UNCOMP_STREAM_TYPE_SNAPPY: snappy_pages(pages, page_size); break;
+    case cudf_io::IO_UNCOMP_STREAM_TYPE_INFLATE: deflate_pages(pages, page_size); break;
+    default: host_compress_pages(pages, page_size, stream_type); break;
+  }
+}
+
+}  // namespace
+
+void BM_compression(benchmark::State &state)
+{
+  size_t const page_size = state.range(0);
+  int const stream_type  = state.range(1);
+  bool const use_gpu     = state.range(2) != 0;
+
+  auto const uncompressed = create_input_data(total_uncompressed_size);
+  size_t const num_pages  = uncompressed.size() / page_size;
+  size_t const max_page   = 32 + page_size + page_size / 6;
+  std::vector<cudf_io::gpu_inflate_status_s> stats(num_pages);
+
+  if (use_gpu) {
+    CUDF_EXPECTS(stream_type == cudf_io::IO_UNCOMP_STREAM_TYPE_SNAPPY, "No GPU encoder");
+    rmm::device_buffer d_uncompressed(uncompressed.data(), uncompressed.size());
+    rmm::device_buffer d_compressed(num_pages * max_page);
+    std::vector<cudf_io::gpu_inflate_input_s> args(num_pages);
+    for (size_t i = 0; i < num_pages; i++) {
+      args[i] = {static_cast<uint8_t const *>(d_uncompressed.data()) + i * page_size,
+                 page_size,
+                 static_cast<uint8_t *>(d_compressed.data()) + i * max_page,
+                 max_page};
+    }
+    rmm::device_buffer d_args(args.data(), args.size() * sizeof(args[0]));
+    rmm::device_buffer d_stats(num_pages * sizeof(cudf_io::gpu_inflate_status_s));
+
+    for (auto _ : state) {
+      cuda_event_timer raii(state, true);  // flush_l2_cache = true, stream = 0
+      CUDA_TRY(cudf_io::gpu_snap(static_cast<cudf_io::gpu_inflate_input_s *>(d_args.data()),
+                                 static_cast<cudf_io::gpu_inflate_status_s *>(d_stats.data()),
+                                 num_pages));
+    }
+    CUDA_TRY(cudaMemcpy(stats.data(), d_stats.data(), d_stats.size(), cudaMemcpyDeviceToHost));
+  } else {
+    std::vector<uint8_t> compressed(num_pages * max_page);
+    std::vector<cudf_io::gpu_inflate_input_s> args(num_pages);
+    for (size_t i = 0; i < num_pages; i++) {
+      args[i] = {uncompressed.data() + i * page_size,
+                 page_size,
+                 compressed.data() + i * max_page,
+                 max_page};
+    }
+    for (auto _ : state) {
+      cuda_event_timer raii(state, false);  // flush_l2_cache = false, stream = 0
+      cudf_io::host_compress_batch(stream_type, args.data(), stats.data(), num_pages);
+    }
+  }
+  size_t compressed_size = 0;
+  for (auto const &stat : stats) {
+    CUDF_EXPECTS(stat.status == 0, "Compression failed");
+    compressed_size += stat.bytes_written;
+  }
+
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * num_pages * page_size);
+  state.counters["ratio"] = static_cast<double>(num_pages * page_size) / compressed_size;
+}
+
+void BM_decompression(benchmark::State &state)
+{
+  size_t const page_size = state.range(0);
+  int const stream_type  = state.range(1);
+  bool const use_gpu     = state.range(2) != 0;
+
+  compressed_pages pages;
+  pages.uncompressed = create_input_data(total_uncompressed_size);
+  compress_pages(pages, page_size, stream_type);
+  size_t const num_pages = pages.inputs.size();
+  std::vector<cudf_io::gpu_inflate_status_s> stats(num_pages);
+
+  if (use_gpu) {
+    // Move the compressed pages to the device and point the arguments at device memory
+    rmm::device_buffer d_compressed(pages.compressed.data(), pages.compressed.size());
+    rmm::device_buffer d_uncompressed(pages.uncompressed.size());
+    auto args = pages.inputs;
+    for (size_t i = 0; i < num_pages; i++) {
+      args[i].srcDevice = static_cast<uint8_t const *>(d_compressed.data()) +
+                          (static_cast<uint8_t const *>(args[i].srcDevice) -
+                           pages.compressed.data());
+      args[i].dstDevice = static_cast<uint8_t *>(d_uncompressed.data()) + i * page_size;
+    }
+    rmm::device_buffer d_args(args.data(), args.size() * sizeof(args[0]));
+    rmm::device_buffer d_stats(num_pages * sizeof(cudf_io::gpu_inflate_status_s));
+    auto const d_inputs  = static_cast<cudf_io::gpu_inflate_input_s *>(d_args.data());
+    auto const d_outputs = static_cast<cudf_io::gpu_inflate_status_s *>(d_stats.data());
+
+    for (auto _ : state) {
+      cuda_event_timer raii(state, true);  // flush_l2_cache = true, stream = 0
+      if (stream_type == cudf_io::IO_UNCOMP_STREAM_TYPE_SNAPPY) {
+        CUDA_TRY(cudf_io::gpu_unsnap(d_inputs, d_outputs, num_pages));
+      } else {
+        CUDA_TRY(cudf_io::gpuinflate(d_inputs, d_outputs, num_pages, 0));
+      }
+    }
+    CUDA_TRY(cudaMemcpy(stats.data(), d_stats.data(), d_stats.size(), cudaMemcpyDeviceToHost));
+  } else {
+    for (auto _ : state) {
+      cuda_event_timer raii(state, false);  // flush_l2_cache = false, stream = 0
+      cudf_io::host_decompress_batch(stream_type, pages.inputs.data(), stats.data(), num_pages);
+    }
+  }
+  for (auto const &stat : stats) {
+    CUDF_EXPECTS(stat.status == 0 && stat.bytes_written == page_size, "Decompression failed");
+  }
+
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * num_pages * page_size);
+  state.counters["ratio"] = static_cast<double>(num_pages * page_size) / pages.compressed_size;
+}
+
+#define COMP_BENCHMARK_DEFINE(name, stream_type, use_gpu)            \
+  BENCHMARK_DEFINE_F(Compression, name)(::benchmark::State & state) \
+  {                                                                  \
+    BM_compression(state);                                           \
+  }                                                                  \
+  BENCHMARK_REGISTER_F(Compression, name)                            \
+    ->Args({4 << 10, stream_type, use_gpu})                          \
+    ->Args({64 << 10, stream_type, use_gpu})                         \
+    ->Args({256 << 10, stream_type, use_gpu})                        \
+    ->Args({1 << 20, stream_type, use_gpu})                          \
+    ->Unit(benchmark::kMillisecond)                                  \
+    ->UseManualTime()
+
+COMP_BENCHMARK_DEFINE(SnappyDevice, cudf_io::IO_UNCOMP_STREAM_TYPE_SNAPPY, 1);
+COMP_BENCHMARK_DEFINE(LZ4Host, cudf_io::IO_UNCOMP_STREAM_TYPE_LZ4, 0);
+#ifdef CUDF_WITH_ZSTD
+COMP_BENCHMARK_DEFINE(ZstdHost, cudf_io::IO_UNCOMP_STREAM_TYPE_ZSTD, 0);
+#endif
+
+#define DECOMP_BENCHMARK_DEFINE(name, stream_type, use_gpu)            \
+  BENCHMARK_DEFINE_F(Decompression, name)(::benchmark::State & state) \
+  {                                                                    \
+    BM_decompression(state);                                           \
+  }                                                                    \
+  BENCHMARK_REGISTER_F(Decompression, name)                            \
+    ->Args({4 << 10, stream_type, use_gpu})                            \
+    ->Args({64 << 10, stream_type, use_gpu})                           \
+    ->Args({256 << 10, stream_type, use_gpu})                          \
+    ->Args({1 << 20, stream_type, use_gpu})                            \
+    ->Unit(benchmark::kMillisecond)                                    \
+    ->UseManualTime()
+
+DECOMP_BENCHMARK_DEFINE(SnappyHost, cudf_io::IO_UNCOMP_STREAM_TYPE_SNAPPY, 0);
+DECOMP_BENCHMARK_DEFINE(SnappyDevice, cudf_io::IO_UNCOMP_STREAM_TYPE_SNAPPY, 1);
+DECOMP_BENCHMARK_DEFINE(DeflateHost, cudf_io::IO_UNCOMP_STREAM_TYPE_INFLATE, 0);
+DECOMP_BENCHMARK_DEFINE(DeflateDevice, cudf_io::IO_UNCOMP_STREAM_TYPE_INFLATE, 1);
+DECOMP_BENCHMARK_DEFINE(LZ4Host, cudf_io::IO_UNCOMP_STREAM_TYPE_LZ4, 0);
+#ifdef CUDF_WITH_ZSTD
+DECOMP_BENCHMARK_DEFINE(ZstdHost, cudf_io::IO_UNCOMP_STREAM_TYPE_ZSTD, 0);
+#endif
@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <cudf/table/table.hpp>
+
+#include <tests/utilities/base_fixture.hpp>
+
+#include <benchmarks/fixture/benchmark_fixture.hpp>
+#include <benchmarks/synchronization/synchronization.hpp>
+
+#include <cudf/io/functions.hpp>
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+
+// to enable, run cmake with -DBUILD_BENCHMARKS=ON
+
+namespace cudf_io = cudf::io;
+
+class CsvRead : public cudf::benchmark {
+};
+
+namespace {
+std::string benchmark_file_path()
+{
+  auto const tmpdir = std::getenv("TMPDIR");
+  return std::string(tmpdir != nullptr ? tmpdir : "/tmp") + "/cudf_csv_read_benchmark.csv";
+}
+
+/**
+ * @brief Writes a CSV file of roughly `total_bytes` where every fourth row has a quoted field
+ * with an embedded terminator, so that row boundaries cannot be found without quote context
+ */
+void write_synthetic_csv(std::string const& filepath, int64_t total_bytes)
+{
+  std::ofstream outfile(filepath, std::ofstream::out | std::ofstream::binary);
+  outfile << "id,text,value\n";
+  std::string row;
+  int64_t written = 0;
+  for (int64_t i = 0; written < total_bytes; ++i) {
+    row = std::to_string(i);
+    row += (i % 4 == 0) ? ",\"a,\nb\"," : ",ab,";
+    row += std::to_string(rand() % 100000);
+    row += '\n';
+    outfile.write(row.data(), row.size());
+    written += row.size();
+  }
+}
+
+}  // namespace
+
+void CSV_read(benchmark::State& state)
+{
+  int64_t const total_desired_bytes = state.range(0);
+  cudf::size_type const num_ranges  = state.range(1);
+  auto const filepath               = benchmark_file_path();
+
+  srand(31337);
+  write_synthetic_csv(filepath, total_desired_bytes);
+
+  for (auto _ : state) {
+    cuda_event_timer raii(state, true);  // flush_l2_cache = true, stream = 0
+    cudf_io::read_csv_args args{cudf_io::source_info(filepath)};
+    args.num_byte_ranges = num_ranges;
+    cudf_io::read_csv(args);
+  }
+
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+  std::remove(filepath.c_str());
+}
+
+#define CRBM_BENCHMARK_DEFINE(name, size, num_ranges)                               \
+  BENCHMARK_DEFINE_F(CsvRead, name)(::benchmark::State & state) { CSV_read(state); } \
+  BENCHMARK_REGISTER_F(CsvRead, name)                                               \
+    ->Args({size, num_ranges})                                                      \
+    ->Unit(benchmark::kMillisecond)                                                 \
+    ->UseManualTime()                                                               \
+    ->Iterations(4)
+
+CRBM_BENCHMARK_DEFINE(1GbQuotedNewlines, (int64_t)1 * 1024 * 1024 * 1024, 1);
+CRBM_BENCHMARK_DEFINE(1GbQuotedNewlines8Ranges, (int64_t)1 * 1024 * 1024 * 1024, 8);
+CRBM_BENCHMARK_DEFINE(10GbQuotedNewlines, (int64_t)10 * 1024 * 1024 * 1024, 1);
+CRBM_BENCHMARK_DEFINE(10GbQuotedNewlines8Ranges, (int64_t)10 * 1024 * 1024 * 1024, 8);
@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <cudf/column/column.hpp>
+#include <cudf/table/table.hpp>
+
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+
+#include <benchmarks/fixture/benchmark_fixture.hpp>
+#include <benchmarks/synchronization/synchronization.hpp>
+
+#include <cudf/io/functions.hpp>
+
+#include <cstdio>
+#include <cstdlib>
+
+// to enable, run cmake with -DBUILD_BENCHMARKS=ON
+
+namespace cudf_io = cudf::io;
+
+class CsvWrite : public cudf::benchmark {
+};
+
+enum class sink_kind : int32_t { VOID, FILE };
+
+namespace {
+std::unique_ptr<cudf::table> create_random_int_table(cudf::size_type num_columns,
+                                                     cudf::size_type num_rows)
+{
+  auto valids = cudf::test::make_counting_transform_iterator(
+    0, [](auto i) { return i % 2 == 0 ? true : false; });
+  std::vector<std::unique_ptr<cudf::column>> columns;
+  for (int idx = 0; idx < num_columns; idx++) {
+    auto rand_elements =
+      cudf::test::make_counting_transform_iterator(0, [](int32_t i) { return rand(); });
+    columns.push_back(cudf::test::fixed_width_column_wrapper<int32_t>(
+                        rand_elements, rand_elements + num_rows, valids)
+                        .release());
+  }
+  return std::make_unique<cudf::table>(std::move(columns));
+}
+
+}  // namespace
+
+/**
+ * @brief Writes a table in chunks of `rows_per_chunk` rows, either to a sink that discards the
+ * data (and supports device writes) or to a file through host writes
+ */
+void CSV_write(benchmark::State& state)
+{
+  int64_t total_desired_bytes = state.range(0);
+  cudf::size_type num_cols    = state.range(1);
+  int const rows_per_chunk    = state.range(2);
+  auto const kind             = static_cast<sink_kind>(state.range(3));
+
+  cudf::size_type el_size = 4;
+  int64_t num_rows        = total_desired_bytes / (num_cols * el_size);
+
+  srand(31337);
+  auto tbl              = create_random_int_table(num_cols, num_rows);
+  cudf::table_view view = tbl->view();
+
+  auto const tmpdir   = std::getenv("TMPDIR");
+  auto const filepath = std::string(tmpdir != nullptr ? tmpdir : "/tmp") +
+                        "/cudf_csv_write_benchmark.csv";
+  auto const sink =
+    (kind == sink_kind::FILE) ? cudf_io::sink_info(filepath) : cudf_io::sink_info();
+
+  for (auto _ : state) {
+    cuda_event_timer raii(state, true);  // flush_l2_cache = true, stream = 0
+    cudf_io::write_csv_args args{sink, view, "null", false, rows_per_chunk};
+    cudf_io::write_csv(args);
+  }
+
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+  std::remove(filepath.c_str());
+}
+
+#define CWBM_BENCHMARK_DEFINE(name, size, num_columns, rows_per_chunk, kind)          \
+  BENCHMARK_DEFINE_F(CsvWrite, name)(::benchmark::State & state) { CSV_write(state); } \
+  BENCHMARK_REGISTER_F(CsvWrite, name)                                                \
+    ->Args({size, num_columns, rows_per_chunk, static_cast<int64_t>(kind)})           \
+    ->Unit(benchmark::kMillisecond)                                                   \
+    ->UseManualTime()                                                                 \
+    ->Iterations(4)
+
+CWBM_BENCHMARK_DEFINE(1Gb8ColsVoid, (int64_t)1 * 1024 * 1024 * 1024, 8, 1 << 20, sink_kind::VOID);
+CWBM_BENCHMARK_DEFINE(1Gb8ColsFile, (int64_t)1 * 1024 * 1024 * 1024, 8, 1 << 20, sink_kind::FILE);
+CWBM_BENCHMARK_DEFINE(1Gb8ColsFileSmallChunks,
+                      (int64_t)1 * 1024 * 1024 * 1024,
+                      8,
+                      1 << 16,
+                      sink_kind::FILE);
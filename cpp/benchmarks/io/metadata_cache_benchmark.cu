@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <cudf/column/column.hpp>
+#include <cudf/table/table.hpp>
+
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+
+#include <benchmarks/fixture/benchmark_fixture.hpp>
+#include <benchmarks/synchronization/synchronization.hpp>
+
+#include <cudf/io/functions.hpp>
+#include <cudf/io/metadata_cache.hpp>
+
+#include <cstdio>
+#include <cstdlib>
+
+// to enable, run cmake with -DBUILD_BENCHMARKS=ON
+
+namespace cudf_io = cudf::io;
+
+class MetadataCache : public cudf::benchmark {
+};
+
+enum class file_format : int32_t { PARQUET, ORC };
+
+namespace {
+std::string benchmark_file_path(file_format format)
+{
+  auto const tmpdir = std::getenv("TMPDIR");
+  return std::string(tmpdir != nullptr ? tmpdir : "/tmp") + "/cudf_metadata_cache_benchmark" +
+         (format == file_format::PARQUET ? ".parquet" : ".orc");
+}
+
+std::unique_ptr<cudf::table> create_wide_table(cudf::size_type num_columns,
+                                               cudf::size_type num_rows)
+{
+  auto values = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i; });
+  std::vector<std::unique_ptr<cudf::column>> columns;
+  for (int idx = 0; idx < num_columns; idx++) {
+    columns.push_back(
+      cudf::test::fixed_width_column_wrapper<int32_t>(values, values + num_rows).release());
+  }
+  return std::make_unique<cudf::table>(std::move(columns));
+}
+
+}  // namespace
+
+/**
+ * @brief Repeatedly opens a file with many columns and reads a single one of them, so that the
+ * time is dominated by reading and parsing the footer unless it is cached
+ */
+void MC_open(benchmark::State& state)
+{
+  cudf::size_type const num_cols = state.range(0);
+  auto const format              = static_cast<file_format>(state.range(1));
+  bool const use_cache           = state.range(2) != 0;
+
+  auto const filepath = benchmark_file_path(format);
+  {
+    auto tbl = create_wide_table(num_cols, 64);
+    if (format == file_format::PARQUET) {
+      cudf_io::write_parquet_args args{cudf_io::sink_info(filepath), tbl->view()};
+      cudf_io::write_parquet(args);
+    } else {
+      cudf_io::write_orc_args args{cudf_io::sink_info(filepath), tbl->view()};
+      cudf_io::write_orc(args);
+    }
+  }
+
+  auto cache = use_cache ? std::make_shared<cudf_io::metadata_cache>() : nullptr;
+  for (auto _ : state) {
+    cuda_event_timer raii(state, false);  // flush_l2_cache = false, stream = 0
+    if (format == file_format::PARQUET) {
+      cudf_io::read_parquet_args args{cudf_io::source_info(filepath)};
+      args.columns      = {"_col0"};
+      args.footer_cache = cache;
+      cudf_io::read_parquet(args);
+    } else {
+      cudf_io::read_orc_args args{cudf_io::source_info(filepath)};
+      args.columns      = {"_col0"};
+      args.footer_cache = cache;
+      cudf_io::read_orc(args);
+    }
+  }
+
+  if (cache != nullptr) {
+    state.counters["hits"]   = cache->hits();
+    state.counters["misses"] = cache->misses();
+  }
+  std::remove(filepath.c_str());
+}
+
+#define MCBM_BENCHMARK_DEFINE(name, num_columns, format, use_cache)                       \
+  BENCHMARK_DEFINE_F(MetadataCache, name)(::benchmark::State & state) { MC_open(state); } \
+  BENCHMARK_REGISTER_F(MetadataCache, name)                                               \
+    ->Args({num_columns, static_cast<int64_t>(format), use_cache})                        \
+    ->Unit(benchmark::kMicrosecond)                                                       \
+    ->UseManualTime()                                                                     \
+    ->Iterations(100)
+
+MCBM_BENCHMARK_DEFINE(Parquet2000Cols, 2000, file_format::PARQUET, 0);
+MCBM_BENCHMARK_DEFINE(Parquet2000ColsCached, 2000, file_format::PARQUET, 1);
+MCBM_BENCHMARK_DEFINE(Orc2000Cols, 2000, file_format::ORC, 0);
+MCBM_BENCHMARK_DEFINE(Orc2000ColsCached, 2000, file_format::ORC, 1);
@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <cudf/column/column.hpp>
+#include <cudf/table/table.hpp>
+
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+
+#include <benchmarks/fixture/benchmark_fixture.hpp>
+#include <benchmarks/synchronization/synchronization.hpp>
+
+#include <cudf/io/functions.hpp>
+
+#include <cstdio>
+#include <cstdlib>
+
+// to enable, run cmake with -DBUILD_BENCHMARKS=ON
+
+namespace cudf_io = cudf::io;
+
+class ParquetRead : public cudf::benchmark {
+};
+
+namespace {
+/**
+ * @brief Returns the path of the file used by the benchmark
+ *
+ * Set TMPDIR to a directory on a real disk to measure direct IO; on tmpfs the direct IO source
+ * falls back to buffered reads.
+ */
+std::string benchmark_file_path()
+{
+  auto const tmpdir = std::getenv("TMPDIR");
+  return std::string(tmpdir != nullptr ? tmpdir : "/tmp") + "/cudf_parquet_read_benchmark.parquet";
+}
+
+template <typename T>
+std::unique_ptr<cudf::table> create_random_fixed_table(cudf::size_type num_columns,
+                                                       cudf::size_type num_rows,
+                                                       bool include_validity)
+{
+  auto valids = cudf::test::make_counting_transform_iterator(
+    0, [](auto i) { return i % 2 == 0 ? true : false; });
+  std::vector<cudf::test::fixed_width_column_wrapper<T>> src_cols(num_columns);
+  for (int idx = 0; idx < num_columns; idx++) {
+    auto rand_elements =
+      cudf::test::make_counting_transform_iterator(0, [](T i) { return rand(); });
+    if (include_validity) {
+      src_cols[idx] =
+        cudf::test::fixed_width_column_wrapper<T>(rand_elements, rand_elements + num_rows, valids);
+    } else {
+      src_cols[idx] =
+        cudf::test::fixed_width_column_wrapper<T>(rand_elements, rand_elements + num_rows);
+    }
+  }
+  std::vector<std::unique_ptr<cudf::column>> columns(num_columns);
+  std::transform(src_cols.begin(),
+                 src_cols.end(),
+                 columns.begin(),
+                 [](cudf::test::fixed_width_column_wrapper<T>& in) { return in.release(); });
+  return std::make_unique<cudf::table>(std::move(columns));
+}
+
+}  // namespace
+
+void PQ_read(benchmark::State& state)
+{
+  int64_t total_desired_bytes = state.range(0);
+  cudf::size_type num_cols    = state.range(1);
+  auto const read_method      = static_cast<cudf_io::file_read_method>(state.range(2));
+
+  cudf::size_type el_size = 4;
+  int64_t num_rows        = total_desired_bytes / (num_cols * el_size);
+
+  srand(31337);
+  auto const filepath = benchmark_file_path();
+  {
+    auto tbl = create_random_fixed_table<int>(num_cols, num_rows, true);
+    cudf_io::write_parquet_args args{cudf_io::sink_info(filepath), tbl->view()};
+    args.compression = cudf_io::compression_type::NONE;
+    cudf_io::write_parquet(args);
+  }
+
+  for (auto _ : state) {
+    cuda_event_timer raii(state, true);  // flush_l2_cache = true, stream = 0
+    cudf_io::read_parquet_args args{cudf_io::source_info(filepath)};
+    args.read_method = read_method;
+    cudf_io::read_parquet(args);
+  }
+
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+  std::remove(filepath.c_str());
+}
+
+#define PRBM_BENCHMARK_DEFINE(name, size, num_columns, method)                          \
+  BENCHMARK_DEFINE_F(ParquetRead, name)(::benchmark::State & state) { PQ_read(state); } \
+  BENCHMARK_REGISTER_F(ParquetRead, name)                                               \
+    ->Args({size, num_columns, static_cast<int64_t>(method)})                           \
+    ->Unit(benchmark::kMillisecond)                                                     \
+    ->UseManualTime()                                                                   \
+    ->Iterations(4)
+
+PRBM_BENCHMARK_DEFINE(3Gb8ColsMmap,
+                      (int64_t)3 * 1024 * 1024 * 1024,
+                      8,
+                      cudf_io::file_read_method::MMAP);
+PRBM_BENCHMARK_DEFINE(3Gb8ColsPread,
+                      (int64_t)3 * 1024 * 1024 * 1024,
+                      8,
+                      cudf_io::file_read_method::PREAD);
+PRBM_BENCHMARK_DEFINE(3Gb8ColsDirect,
+                      (int64_t)3 * 1024 * 1024 * 1024,
+                      8,
+                      cudf_io::file_read_method::DIRECT);
@@ -26,8 +26,12 @@
 #include <benchmarks/fixture/benchmark_fixture.hpp>
 #include <benchmarks/synchronization/synchronization.hpp>
 
+#include <cudf/io/data_sink.hpp>
 #include <cudf/io/functions.hpp>
 
+#include <cstdio>
+#include <cstdlib>
+
 // to enable, run cmake with -DBUILD_BENCHMARKS=ON
 
 namespace cudf_io = cudf::io;
@@ -36,6 +40,10 @@ class ParquetWrite : public cudf::benchmark {
 };
 class ParquetWriteChunked : public cudf::benchmark {
 };
+class ParquetWriteFile : public cudf::benchmark {
+};
+class ParquetWriteEncoding : public cudf::benchmark {
+};
 
 template <typename T>
 std::unique_ptr<cudf::table> create_random_fixed_table(cudf::size_type num_columns,
@@ -118,6 +126,84 @@ void PQ_write_chunked(benchmark::State& state)
   state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
 }
 
+void PQ_write_file(benchmark::State& state)
+{
+  int64_t total_desired_bytes = state.range(0);
+  cudf::size_type num_cols    = state.range(1);
+  bool const background_flush = state.range(2) != 0;
+
+  cudf::size_type el_size = 4;
+  int64_t num_rows        = total_desired_bytes / (num_cols * el_size);
+
+  srand(31337);
+  auto tbl              = create_random_fixed_table<int>(num_cols, num_rows, true);
+  cudf::table_view view = tbl->view();
+
+  auto const tmpdir   = std::getenv("TMPDIR");
+  auto const filepath = std::string(tmpdir != nullptr ? tmpdir : "/tmp") +
+                        "/cudf_parquet_write_benchmark.parquet";
+
+  cudf_io::sink_flush_statistics stats;
+  for (auto _ : state) {
+    auto sink = cudf_io::data_sink::create(filepath, background_flush);
+    {
+      cuda_event_timer raii(state, true);  // flush_l2_cache = true, stream = 0
+      cudf_io::write_parquet_args args{cudf_io::sink_info(sink.get()), view};
+      cudf_io::write_parquet(args);
+    }
+    auto const iter_stats = sink->flush_statistics();
+    stats.num_flushes += iter_stats.num_flushes;
+    stats.total_latency_ms += iter_stats.total_latency_ms;
+    stats.max_latency_ms = std::max(stats.max_latency_ms, iter_stats.max_latency_ms);
+  }
+
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+  state.counters["flushes"] =
+    benchmark::Counter(stats.num_flushes, benchmark::Counter::kAvgIterations);
+  state.counters["flush_ms_avg"] =
+    stats.num_flushes != 0 ? stats.total_latency_ms / stats.num_flushes : 0;
+  state.counters["flush_ms_max"] = stats.max_latency_ms;
+  std::remove(filepath.c_str());
+}
+
+/**
+ * @brief Writes sorted 64-bit IDs with a given column encoding, reporting the size of the output
+ * along with the write throughput
+ */
+void PQ_write_encoding(benchmark::State& state)
+{
+  int64_t total_desired_bytes = state.range(0);
+  cudf::size_type num_cols    = state.range(1);
+  auto const encoding         = static_cast<cudf_io::column_encoding>(state.range(2));
+
+  cudf::size_type el_size = 8;
+  int64_t num_rows        = total_desired_bytes / (num_cols * el_size);
+
+  srand(31337);
+  std::vector<std::unique_ptr<cudf::column>> columns;
+  for (int idx = 0; idx < num_cols; idx++) {
+    std::vector<int64_t> ids(num_rows);
+    int64_t id = rand();
+    for (auto& v : ids) { v = (id += 1 + rand() % 16); }
+    columns.push_back(
+      cudf::test::fixed_width_column_wrapper<int64_t>(ids.begin(), ids.end()).release());
+  }
+  cudf::table tbl(std::move(columns));
+
+  std::vector<char> out_buffer;
+  for (auto _ : state) {
+    out_buffer.clear();
+    cuda_event_timer raii(state, true);  // flush_l2_cache = true, stream = 0
+    cudf_io::write_parquet_args args{cudf_io::sink_info(&out_buffer), tbl.view()};
+    args.column_encodings = std::vector<cudf_io::column_encoding>(num_cols, encoding);
+    cudf_io::write_parquet(args);
+  }
+
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+  state.counters["output_bytes"] = out_buffer.size();
+  state.counters["output_ratio"] = static_cast<double>(out_buffer.size()) / state.range(0);
+}
+
 #define PWBM_BENCHMARK_DEFINE(name, size, num_columns)                                    \
   BENCHMARK_DEFINE_F(ParquetWrite, name)(::benchmark::State & state) { PQ_write(state); } \
   BENCHMARK_REGISTER_F(ParquetWrite, name)                                                \
@@ -145,3 +231,43 @@ PWCBM_BENCHMARK_DEFINE(3Gb1024Cols64Chunks, (int64_t)3 * 1024 * 1024 * 1024, 102
 
 PWCBM_BENCHMARK_DEFINE(3Gb8Cols128Chunks, (int64_t)3 * 1024 * 1024 * 1024, 8, 128);
 PWCBM_BENCHMARK_DEFINE(3Gb1024Cols128Chunks, (int64_t)3 * 1024 * 1024 * 1024, 1024, 128);
+
+#define PWFBM_BENCHMARK_DEFINE(name, size, num_columns, background_flush) \
+  BENCHMARK_DEFINE_F(ParquetWriteFile, name)(::benchmark::State & state)  \
+  {                                                                       \
+    PQ_write_file(state);                                                 \
+  }                                                                       \
+  BENCHMARK_REGISTER_F(ParquetWriteFile, name)                            \
+    ->Args({size, num_columns, background_flush})                         \
+    ->Unit(benchmark::kMillisecond)                                       \
+    ->UseManualTime()                                                     \
+    ->Iterations(4)
+
+PWFBM_BENCHMARK_DEFINE(3Gb8ColsBuffered, (int64_t)3 * 1024 * 1024 * 1024, 8, 0);
+PWFBM_BENCHMARK_DEFINE(3Gb8ColsBackgroundFlush, (int64_t)3 * 1024 * 1024 * 1024, 8, 1);
+PWFBM_BENCHMARK_DEFINE(3Gb1024ColsBuffered, (int64_t)3 * 1024 * 1024 * 1024, 1024, 0);
+PWFBM_BENCHMARK_DEFINE(3Gb1024ColsBackgroundFlush, (int64_t)3 * 1024 * 1024 * 1024, 1024, 1);
+
+#define PWEBM_BENCHMARK_DEFINE(name, size, num_columns, encoding)             \
+  BENCHMARK_DEFINE_F(ParquetWriteEncoding, name)(::benchmark::State & state) \
+  {                                                                          \
+    PQ_write_encoding(state);                                                \
+  }                                                                          \
+  BENCHMARK_REGISTER_F(ParquetWriteEncoding, name)                           \
+    ->Args({size, num_columns, static_cast<int64_t>(encoding)})              \
+    ->Unit(benchmark::kMillisecond)                                          \
+    ->UseManualTime()                                                        \
+    ->Iterations(4)
+
+PWEBM_BENCHMARK_DEFINE(1Gb8ColsAuto,
+                       (int64_t)1024 * 1024 * 1024,
+                       8,
+                       cudf_io::column_encoding::AUTO);
+PWEBM_BENCHMARK_DEFINE(1Gb8ColsPlain,
+                       (int64_t)1024 * 1024 * 1024,
+                       8,
+                       cudf_io::column_encoding::PLAIN);
+PWEBM_BENCHMARK_DEFINE(1Gb8ColsDelta,
+                       (int64_t)1024 * 1024 * 1024,
+                       8,
+                       cudf_io::column_encoding::DELTA_BINARY_PACKED);
@@ -17,9 +17,12 @@
 #include <benchmark/benchmark.h>
 
 #include <thrust/iterator/counting_iterator.h>
+#include <thrust/tabulate.h>
 
 #include <cudf/column/column_factories.hpp>
+#include <cudf/copying.hpp>
 #include <cudf/join.hpp>
+#include <cudf/sorting.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/utilities/error.hpp>
@@ -28,6 +31,10 @@
 #include <fixture/benchmark_fixture.hpp>
 #include <synchronization/synchronization.hpp>
 
+#include <rmm/mr/device/device_memory_resource.hpp>
+#include <rmm/mr/device/default_memory_resource.hpp>
+
+#include <algorithm>
 #include <vector>
 
 #include "generate_input_tables.cuh"
@@ -36,11 +43,16 @@ template <typename key_type, typename payload_type>
 class Join : public cudf::benchmark {
 };
 
+/**
+ * @brief Generates a build table with unique keys and a probe table whose keys match the build
+ * keys with a selectivity of 0.3, each with `num_payload_columns` payload columns
+ */
 template <typename key_type, typename payload_type>
-static void BM_join(benchmark::State &state)
+std::pair<std::unique_ptr<cudf::table>, std::unique_ptr<cudf::table>> generate_join_tables(
+  cudf::size_type build_table_size,
+  cudf::size_type probe_table_size,
+  cudf::size_type num_payload_columns = 1)
 {
-  const cudf::size_type build_table_size{(cudf::size_type)state.range(0)};
-  const cudf::size_type probe_table_size{(cudf::size_type)state.range(1)};
   const cudf::size_type rand_max_val{build_table_size * 2};
   const double selectivity             = 0.3;
   const bool is_build_table_key_unique = true;
@@ -61,17 +73,37 @@ static void BM_join(benchmark::State &state)
     rand_max_val,
     is_build_table_key_unique);
 
+  std::vector<std::unique_ptr<cudf::column>> build_columns;
+  build_columns.push_back(std::move(build_key_column));
+  std::vector<std::unique_ptr<cudf::column>> probe_columns;
+  probe_columns.push_back(std::move(probe_key_column));
+
   auto payload_data_it = thrust::make_counting_iterator(0);
-  cudf::test::fixed_width_column_wrapper<payload_type> build_payload_column(
-    payload_data_it, payload_data_it + build_table_size);
+  for (cudf::size_type i = 0; i < num_payload_columns; ++i) {
+    cudf::test::fixed_width_column_wrapper<payload_type> build_payload_column(
+      payload_data_it, payload_data_it + build_table_size);
+    build_columns.push_back(build_payload_column.release());
 
-  cudf::test::fixed_width_column_wrapper<payload_type> probe_payload_column(
-    payload_data_it, payload_data_it + probe_table_size);
+    cudf::test::fixed_width_column_wrapper<payload_type> probe_payload_column(
+      payload_data_it, payload_data_it + probe_table_size);
+    probe_columns.push_back(probe_payload_column.release());
+  }
 
   CHECK_CUDA(0);
 
-  cudf::table_view build_table({build_key_column->view(), build_payload_column});
-  cudf::table_view probe_table({probe_key_column->view(), probe_payload_column});
+  return std::make_pair(std::make_unique<cudf::table>(std::move(build_columns)),
+                        std::make_unique<cudf::table>(std::move(probe_columns)));
+}
+
+template <typename key_type, typename payload_type>
+static void BM_join(benchmark::State &state)
+{
+  const cudf::size_type build_table_size{(cudf::size_type)state.range(0)};
+  const cudf::size_type probe_table_size{(cudf::size_type)state.range(1)};
+
+  auto tables = generate_join_tables<key_type, payload_type>(build_table_size, probe_table_size);
+  cudf::table_view build_table = tables.first->view();
+  cudf::table_view probe_table = tables.second->view();
 
   // Setup join parameters and result table
 
@@ -87,10 +119,267 @@ static void BM_join(benchmark::State &state)
   }
 }
 
+/**
+ * @brief Joins `num_probes` probe batches against the same build table, either through
+ * `cudf::inner_join`, which builds the hash table for every batch, or through a single
+ * `cudf::hash_join`
+ */
+template <typename key_type, typename payload_type>
+static void BM_join_repeated_probes(benchmark::State &state)
+{
+  const cudf::size_type build_table_size{(cudf::size_type)state.range(0)};
+  const cudf::size_type probe_table_size{(cudf::size_type)state.range(1)};
+  const int num_probes{(int)state.range(2)};
+  const bool reuse_hash_table{state.range(3) != 0};
+
+  auto tables = generate_join_tables<key_type, payload_type>(build_table_size, probe_table_size);
+  cudf::table_view build_table = tables.first->view();
+  cudf::table_view probe_table = tables.second->view();
+
+  std::vector<cudf::size_type> columns_to_join = {0};
+
+  for (auto _ : state) {
+    cuda_event_timer raii(state, true, 0);
+
+    if (reuse_hash_table) {
+      cudf::hash_join joiner(build_table, columns_to_join);
+      for (int probe = 0; probe < num_probes; ++probe) {
+        auto indices      = joiner.inner_join_indices(probe_table, columns_to_join);
+        auto result_probe = cudf::gather(probe_table, indices.first->view());
+        auto result_build = cudf::gather(build_table.select({1}), indices.second->view());
+      }
+    } else {
+      for (int probe = 0; probe < num_probes; ++probe) {
+        auto result =
+          cudf::inner_join(probe_table, build_table, columns_to_join, columns_to_join, {{0, 0}});
+      }
+    }
+  }
+}
+
+enum class join_output : int32_t { FULL_TABLE, INDICES, INDICES_AND_ONE_COLUMN };
+
+/**
+ * @brief Joins wide tables, either gathering every column with `cudf::inner_join`, returning only
+ * the join indices, or gathering a single payload column of each side from the join indices
+ */
+template <typename key_type, typename payload_type>
+static void BM_join_wide(benchmark::State &state)
+{
+  const cudf::size_type build_table_size{(cudf::size_type)state.range(0)};
+  const cudf::size_type probe_table_size{(cudf::size_type)state.range(1)};
+  const cudf::size_type num_payload_columns{(cudf::size_type)state.range(2)};
+  const auto output = static_cast<join_output>(state.range(3));
+
+  auto tables = generate_join_tables<key_type, payload_type>(
+    build_table_size, probe_table_size, num_payload_columns);
+  cudf::table_view build_table = tables.first->view();
+  cudf::table_view probe_table = tables.second->view();
+
+  std::vector<cudf::size_type> columns_to_join = {0};
+
+  for (auto _ : state) {
+    cuda_event_timer raii(state, true, 0);
+
+    if (output == join_output::FULL_TABLE) {
+      auto result =
+        cudf::inner_join(probe_table, build_table, columns_to_join, columns_to_join, {{0, 0}});
+    } else {
+      auto indices =
+        cudf::inner_join_indices(probe_table, build_table, columns_to_join, columns_to_join);
+      if (output == join_output::INDICES_AND_ONE_COLUMN) {
+        auto result = cudf::gather_join_columns(
+          probe_table, build_table, *indices.first, *indices.second, {1}, {1});
+      }
+    }
+  }
+}
+
+/**
+ * @brief Device memory resource that forwards to an upstream resource and records the peak number
+ * of bytes allocated through it
+ */
+class peak_memory_resource : public rmm::mr::device_memory_resource {
+ public:
+  explicit peak_memory_resource(rmm::mr::device_memory_resource *upstream) : _upstream{upstream}
+  {
+  }
+
+  bool supports_streams() const noexcept override { return _upstream->supports_streams(); }
+
+  bool supports_get_mem_info() const noexcept override
+  {
+    return _upstream->supports_get_mem_info();
+  }
+
+  size_t peak_bytes() const { return _peak_bytes; }
+
+  void reset_peak() { _peak_bytes = _current_bytes; }
+
+ private:
+  void *do_allocate(std::size_t bytes, cudaStream_t stream) override
+  {
+    void *p = _upstream->allocate(bytes, stream);
+    _current_bytes += bytes;
+    _peak_bytes = std::max(_peak_bytes, _current_bytes);
+    return p;
+  }
+
+  void do_deallocate(void *p, std::size_t bytes, cudaStream_t stream) override
+  {
+    _upstream->deallocate(p, bytes, stream);
+    _current_bytes -= bytes;
+  }
+
+  std::pair<size_t, size_t> do_get_mem_info(cudaStream_t stream) const override
+  {
+    return _upstream->get_mem_info(stream);
+  }
+
+  rmm::mr::device_memory_resource *_upstream;
+  size_t _current_bytes{0};
+  size_t _peak_bytes{0};
+};
+
+enum class key_distribution : int32_t { UNIFORM, DUPLICATE_HEAVY, SKEWED };
+
+/**
+ * @brief Generates the key of a row: rows in `[hot_begin, hot_end)` get the hot key 0, and the
+ * other rows a key in `[1, range]`, either in row order or scattered by a multiplicative hash
+ */
+template <typename key_type>
+struct generated_key {
+  cudf::size_type hot_begin;
+  cudf::size_type hot_end;
+  cudf::size_type range;
+  bool scatter;
+
+  __device__ key_type operator()(cudf::size_type i) const
+  {
+    if (i >= hot_begin && i < hot_end) { return 0; }
+    uint32_t const k = scatter ? static_cast<uint32_t>(i) * 2654435761u : static_cast<uint32_t>(i);
+    return static_cast<key_type>(1 + k % range);
+  }
+};
+
+template <typename key_type>
+std::unique_ptr<cudf::column> generate_key_column(cudf::size_type num_rows,
+                                                  generated_key<key_type> key)
+{
+  auto keys = cudf::make_numeric_column(cudf::data_type(cudf::type_to_id<key_type>()), num_rows);
+  thrust::tabulate(rmm::exec_policy(0)->on(0),
+                   keys->mutable_view().begin<key_type>(),
+                   keys->mutable_view().end<key_type>(),
+                   key);
+  return keys;
+}
+
+/**
+ * @brief Joins tables whose keys are uniform and unique, duplicate-heavy, or skewed, with the
+ * join output either allocated from an estimate or sized exactly, and reports the peak device
+ * memory allocated by the join
+ *
+ * Duplicate-heavy build keys repeat 16 times each. Skewed tables share a hot key that matches 100
+ * build rows and the last tenth of the probe rows, which the sampled size estimate does not see.
+ */
+template <typename key_type, typename payload_type>
+static void BM_join_output_size(benchmark::State &state)
+{
+  const cudf::size_type build_table_size{(cudf::size_type)state.range(0)};
+  const cudf::size_type probe_table_size{(cudf::size_type)state.range(1)};
+  const auto distribution = static_cast<key_distribution>(state.range(2));
+  cudf::join_options options;
+  options.output_size = static_cast<cudf::join_output_size>(state.range(3));
+
+  auto tables = generate_join_tables<key_type, payload_type>(build_table_size, probe_table_size);
+  if (distribution != key_distribution::UNIFORM) {
+    generated_key<key_type> build_key{0, 0, build_table_size / 16, false};
+    generated_key<key_type> probe_key{0, 0, build_table_size / 8, true};
+    if (distribution == key_distribution::SKEWED) {
+      build_key = {0, 100, build_table_size, false};
+      probe_key = {probe_table_size / 10 * 9, probe_table_size, 2 * build_table_size, true};
+    }
+    auto build_columns = tables.first->release();
+    auto probe_columns = tables.second->release();
+    build_columns[0]   = generate_key_column<key_type>(build_table_size, build_key);
+    probe_columns[0]   = generate_key_column<key_type>(probe_table_size, probe_key);
+    tables.first       = std::make_unique<cudf::table>(std::move(build_columns));
+    tables.second      = std::make_unique<cudf::table>(std::move(probe_columns));
+  }
+  cudf::table_view build_table = tables.first->view();
+  cudf::table_view probe_table = tables.second->view();
+
+  std::vector<cudf::size_type> columns_to_join = {0};
+
+  auto upstream = rmm::mr::get_default_resource();
+  peak_memory_resource tracker{upstream};
+  rmm::mr::set_default_resource(&tracker);
+  size_t peak_bytes{0};
+
+  for (auto _ : state) {
+    cuda_event_timer raii(state, true, 0);
+    tracker.reset_peak();
+
+    auto result =
+      cudf::inner_join_indices(probe_table, build_table, columns_to_join, columns_to_join, options);
+
+    peak_bytes = std::max(peak_bytes, tracker.peak_bytes());
+  }
+
+  rmm::mr::set_default_resource(upstream);
+  state.counters["peak_memory_bytes"] = static_cast<double>(peak_bytes);
+}
+
+/**
+ * @brief Joins tables with the hash join or the sort-merge join, with the build keys either
+ * unsorted or sorted ahead of the join and flagged as sorted
+ */
+template <typename key_type, typename payload_type>
+static void BM_join_algorithm(benchmark::State &state)
+{
+  const cudf::size_type build_table_size{(cudf::size_type)state.range(0)};
+  const cudf::size_type probe_table_size{(cudf::size_type)state.range(1)};
+  cudf::join_options options;
+  options.algorithm       = static_cast<cudf::join_algorithm>(state.range(2));
+  options.keys_are_sorted = state.range(3) != 0 ? cudf::sorted::YES : cudf::sorted::NO;
+
+  auto tables = generate_join_tables<key_type, payload_type>(build_table_size, probe_table_size);
+  if (options.keys_are_sorted == cudf::sorted::YES) {
+    tables.first = cudf::sort_by_key(tables.first->view(), tables.first->view().select({0}));
+  }
+  cudf::table_view build_table = tables.first->view();
+  cudf::table_view probe_table = tables.second->view();
+
+  std::vector<cudf::size_type> columns_to_join = {0};
+
+  for (auto _ : state) {
+    cuda_event_timer raii(state, true, 0);
+
+    auto result = cudf::inner_join(
+      probe_table, build_table, columns_to_join, columns_to_join, {{0, 0}}, options);
+  }
+}
+
 #define JOIN_BENCHMARK_DEFINE(name, key_type, payload_type)       \
   BENCHMARK_TEMPLATE_DEFINE_F(Join, name, key_type, payload_type) \
   (::benchmark::State & st) { BM_join<key_type, payload_type>(st); }
 
+#define JOIN_REPEATED_PROBES_BENCHMARK_DEFINE(name, key_type, payload_type) \
+  BENCHMARK_TEMPLATE_DEFINE_F(Join, name, key_type, payload_type)          \
+  (::benchmark::State & st) { BM_join_repeated_probes<key_type, payload_type>(st); }
+
+#define JOIN_WIDE_BENCHMARK_DEFINE(name, key_type, payload_type)  \
+  BENCHMARK_TEMPLATE_DEFINE_F(Join, name, key_type, payload_type) \
+  (::benchmark::State & st) { BM_join_wide<key_type, payload_type>(st); }
+
+#define JOIN_OUTPUT_SIZE_BENCHMARK_DEFINE(name, key_type, payload_type) \
+  BENCHMARK_TEMPLATE_DEFINE_F(Join, name, key_type, payload_type)       \
+  (::benchmark::State & st) { BM_join_output_size<key_type, payload_type>(st); }
+
+#define JOIN_ALGORITHM_BENCHMARK_DEFINE(name, key_type, payload_type) \
+  BENCHMARK_TEMPLATE_DEFINE_F(Join, name, key_type, payload_type)     \
+  (::benchmark::State & st) { BM_join_algorithm<key_type, payload_type>(st); }
+
 JOIN_BENCHMARK_DEFINE(join_32bit, int32_t, int32_t);
 JOIN_BENCHMARK_DEFINE(join_64bit, int64_t, int64_t);
 
@@ -111,3 +400,52 @@ BENCHMARK_REGISTER_F(Join, join_64bit)
   ->Args({50'000'000, 50'000'000})
   ->Args({40'000'000, 120'000'000})
   ->UseManualTime();
+
+JOIN_REPEATED_PROBES_BENCHMARK_DEFINE(join_32bit_repeated_probes, int32_t, int32_t);
+
+// Args: build rows, probe rows per batch, number of probe batches, reuse the hash table
+BENCHMARK_REGISTER_F(Join, join_32bit_repeated_probes)
+  ->Unit(benchmark::kMillisecond)
+  ->Args({1'000'000, 10'000'000, 1, 0})
+  ->Args({1'000'000, 10'000'000, 1, 1})
+  ->Args({1'000'000, 10'000'000, 16, 0})
+  ->Args({1'000'000, 10'000'000, 16, 1})
+  ->Args({1'000'000, 1'000'000, 100, 0})
+  ->Args({1'000'000, 1'000'000, 100, 1})
+  ->UseManualTime();
+
+JOIN_WIDE_BENCHMARK_DEFINE(join_32bit_wide, int32_t, int32_t);
+
+// Args: build rows, probe rows, payload columns per table, join output
+BENCHMARK_REGISTER_F(Join, join_32bit_wide)
+  ->Unit(benchmark::kMillisecond)
+  ->Args({1'000'000, 10'000'000, 16, static_cast<int64_t>(join_output::FULL_TABLE)})
+  ->Args({1'000'000, 10'000'000, 16, static_cast<int64_t>(join_output::INDICES)})
+  ->Args({1'000'000, 10'000'000, 16, static_cast<int64_t>(join_output::INDICES_AND_ONE_COLUMN)})
+  ->UseManualTime();
+
+JOIN_OUTPUT_SIZE_BENCHMARK_DEFINE(join_32bit_output_size, int32_t, int32_t);
+
+// Args: build rows, probe rows, key distribution, join output size (0: estimate, 1: exact)
+BENCHMARK_REGISTER_F(Join, join_32bit_output_size)
+  ->Unit(benchmark::kMillisecond)
+  ->Args({1'000'000, 10'000'000, static_cast<int64_t>(key_distribution::UNIFORM), 0})
+  ->Args({1'000'000, 10'000'000, static_cast<int64_t>(key_distribution::UNIFORM), 1})
+  ->Args({1'000'000, 10'000'000, static_cast<int64_t>(key_distribution::DUPLICATE_HEAVY), 0})
+  ->Args({1'000'000, 10'000'000, static_cast<int64_t>(key_distribution::DUPLICATE_HEAVY), 1})
+  ->Args({1'000'000, 10'000'000, static_cast<int64_t>(key_distribution::SKEWED), 0})
+  ->Args({1'000'000, 10'000'000, static_cast<int64_t>(key_distribution::SKEWED), 1})
+  ->UseManualTime();
+
+JOIN_ALGORITHM_BENCHMARK_DEFINE(join_32bit_algorithm, int32_t, int32_t);
+
+// Args: build rows, probe rows, join algorithm (1: hash, 2: sort-merge), build keys sorted
+BENCHMARK_REGISTER_F(Join, join_32bit_algorithm)
+  ->Unit(benchmark::kMillisecond)
+  ->Args({100'000'000, 100'000'000, static_cast<int64_t>(cudf::join_algorithm::HASH), 0})
+  ->Args({100'000'000, 100'000'000, static_cast<int64_t>(cudf::join_algorithm::SORT_MERGE), 0})
+  ->Args({100'000'000, 100'000'000, static_cast<int64_t>(cudf::join_algorithm::HASH), 1})
+  ->Args({100'000'000, 100'000'000, static_cast<int64_t>(cudf::join_algorithm::SORT_MERGE), 1})
+  ->Args({1'000'000'000, 100'000'000, static_cast<int64_t>(cudf::join_algorithm::HASH), 1})
+  ->Args({1'000'000'000, 100'000'000, static_cast<int64_t>(cudf::join_algorithm::SORT_MERGE), 1})
+  ->UseManualTime();
@@ -26,6 +26,16 @@
 namespace cudf {
 //! IO interfaces
 namespace io {
+/**
+ * @brief Counters describing the writes a sink has issued to its underlying storage
+ **/
+struct sink_flush_statistics {
+  size_t num_flushes      = 0;  ///< Number of write calls issued to the storage
+  size_t bytes_flushed    = 0;  ///< Total bytes written to the storage
+  double total_latency_ms = 0;  ///< Total time spent in write calls, in milliseconds
+  double max_latency_ms   = 0;  ///< Longest single write call, in milliseconds
+};
+
 /**
  * @brief Interface class for storing the output data from the writers
  **/
@@ -34,9 +44,14 @@ class data_sink {
   /**
    * @brief Create a sink from a file path
    *
+   * Small writes are coalesced into large buffers before being written to the file.
+   *
    * @param[in] filepath Path to the file to use
+   * @param[in] background_flush Whether to write full buffers from a background thread, so that
+   * writing to the file overlaps with the caller producing more data
    **/
-  static std::unique_ptr<data_sink> create(const std::string& filepath);
+  static std::unique_ptr<data_sink> create(const std::string& filepath,
+                                           bool background_flush = false);
 
   /**
    * @brief Create a sink from a std::vector
@@ -131,6 +146,15 @@ class data_sink {
    * @return size_t Total number of bytes written into this sink
    **/
   virtual size_t bytes_written() = 0;
+
+  /**
+   * @brief Returns counters describing the writes issued to the underlying storage
+   *
+   * Sinks that don't track these counters return zeroes.
+   *
+   * @return sink_flush_statistics Flush counters for this sink
+   **/
+  virtual sink_flush_statistics flush_statistics() const { return {}; }
 };
 
 }  // namespace io
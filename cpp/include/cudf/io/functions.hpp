@@ -23,6 +23,7 @@
 
 #include "types.hpp"
 
+#include <cudf/io/metadata_cache.hpp>
 #include <cudf/io/writers.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
@@ -44,6 +45,9 @@ namespace io {
  */
 struct read_avro_args {
   source_info source;
+  /// Paths of several files with the same schema, read in order into a single table; used
+  /// instead of `source` when not empty
+  std::vector<std::string> filepaths;
 
   /// Names of column to read; empty is all
   std::vector<std::string> columns;
@@ -53,6 +57,9 @@ struct read_avro_args {
   /// Rows to read; -1 is all
   size_type num_rows = -1;
 
+  /// Number of host threads reading and parsing the `filepaths`; 0 is the hardware concurrency
+  size_t num_threads = 0;
+
   read_avro_args() = default;
 
   explicit read_avro_args(source_info const& src) : source(src) {}
@@ -126,6 +133,10 @@ struct read_json_args {
   /// Whether to parse dates as DD/MM versus MM/DD
   bool dayfirst = false;
 
+  /// Flatten nested objects into columns named by dotted paths (e.g. "a.b"); arrays, and objects
+  /// nested deeper than 16 levels, are read as strings holding their JSON text
+  bool flatten_nested = false;
+
   read_json_args() = default;
 
   explicit read_json_args(const source_info& src) : source(src) {}
@@ -170,6 +181,9 @@ struct read_csv_args {
   size_t byte_range_offset = 0;
   /// Bytes to read; always reads complete rows
   size_t byte_range_size = 0;
+  /// Number of byte ranges to split the whole input into and parse concurrently, with the column
+  /// types inferred from the first range; 1 disables
+  size_type num_byte_ranges = 1;
   /// Names of all the columns; if empty then names are auto-generated
   std::vector<std::string> names;
   /// If there is no header or names, prepend this to the column ID as the name
@@ -284,11 +298,13 @@ struct write_csv_args : detail::csv::writer_options {
                  char delim                     = ',',
                  std::string true_v             = std::string{"true"},
                  std::string false_v            = std::string{"false"},
-                 table_metadata const* metadata = nullptr)
+                 table_metadata const* metadata = nullptr,
+                 bool background_flush          = false)
     : writer_options(na, include_header, rows_per_chunk, line_term, delim, true_v, false_v),
       sink_(snk),
       table_(table),
-      metadata_(metadata)
+      metadata_(metadata),
+      background_flush_(background_flush)
   {
   }
 
@@ -303,6 +319,8 @@ struct write_csv_args : detail::csv::writer_options {
 
   table_metadata const* metadata(void) const { return metadata_; }
 
+  bool background_flush(void) const { return background_flush_; }
+
   // Specify the sink to use for writer output:
   //
   sink_info const sink_;
@@ -314,6 +332,10 @@ struct write_csv_args : detail::csv::writer_options {
   // Optional associated metadata
   //
   table_metadata const* metadata_;
+
+  // Whether a file sink writes its buffers from a background thread
+  //
+  bool const background_flush_;
 };
 
 /**
@@ -374,6 +396,20 @@ struct read_orc_args {
   /// -1 is auto (column scale), >=0: number of fractional digits
   int forced_decimals_scale = -1;
 
+  /// Method used to read file sources
+  file_read_method read_method = file_read_method::MMAP;
+
+  /// Skip stripes, and the leading and trailing row groups of stripes, whose statistics show that
+  /// no row matches; rows are not filtered otherwise
+  filter_expression filter;
+
+  /// Optional cache of parsed file footers shared with other readers; only used for file paths
+  std::shared_ptr<metadata_cache> footer_cache;
+
+  /// Decompress the stripes read together on the host when they hold fewer compressed bytes
+  /// than this, as kernel launches dominate the time of small reads; 0 always uses the GPU
+  size_t host_decompression_threshold = 0;
+
   read_orc_args() = default;
 
   explicit read_orc_args(source_info const& src) : source(src) {}
@@ -401,6 +437,128 @@ struct read_orc_args {
 table_with_metadata read_orc(read_orc_args const& args,
                              rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Settings to use for `read_orc_chunked_begin()`
+ *
+ * @ingroup io_readers
+ */
+struct read_orc_chunked_args {
+  source_info source;
+
+  /// Names of column to read; empty is all
+  std::vector<std::string> columns;
+
+  /// Whether to use row index to speed-up reading
+  bool use_index = true;
+
+  /// Whether to use numpy-compatible dtypes
+  bool use_np_dtypes = true;
+  /// Cast timestamp columns to a specific type
+  data_type timestamp_type{EMPTY};
+
+  /// Whether to convert decimals to float64
+  bool decimals_as_float = true;
+  /// For decimals as int, optional forced decimal scale;
+  /// -1 is auto (column scale), >=0: number of fractional digits
+  int forced_decimals_scale = -1;
+
+  /// Method used to read file sources
+  file_read_method read_method = file_read_method::MMAP;
+
+  /// Skip stripes, and the leading and trailing row groups of stripes, whose statistics show that
+  /// no row matches; rows are not filtered otherwise
+  filter_expression filter;
+
+  /// Optional cache of parsed file footers shared with other readers; only used for file paths
+  std::shared_ptr<metadata_cache> footer_cache;
+
+  /// Decompress the stripes read together on the host when they hold fewer compressed bytes
+  /// than this, as kernel launches dominate the time of small reads; 0 always uses the GPU
+  size_t host_decompression_threshold = 0;
+
+  /// Maximum size in bytes of the device memory used by the reads, counting the stripe data, its
+  /// decompressed streams and the output columns of the table being used and of the tables read
+  /// in the background; 0 is no limit
+  size_t chunk_read_limit = 0;
+
+  read_orc_chunked_args() = default;
+
+  explicit read_orc_chunked_args(source_info const& src) : source(src) {}
+};
+
+namespace detail {
+namespace orc {
+/**
+ * @brief Forward declaration of anonymous chunked-reader state struct.
+ */
+struct orc_chunked_read_state;
+};  // namespace orc
+};  // namespace detail
+
+/**
+ * @brief Begin the process of reading an ORC dataset as a sequence of tables.
+ *
+ * @ingroup io_readers
+ *
+ * The intent of the read_orc_chunked_ path is to allow reading datasets larger than the available
+ * device memory. Each table holds consecutive whole stripes, grouped while the estimated memory
+ * needed to read them stays within half of `chunk_read_limit`, as the next table is read while
+ * one is being used; a stripe that exceeds it on its own is read as a table by itself.
+ *
+ * The following code snippet demonstrates how to read a dataset with a budget of 1GB:
+ * @code
+ *  ...
+ *  cudf::io::read_orc_chunked_args args{cudf::source_info("dataset.orc")};
+ *  args.chunk_read_limit = 1 << 30;
+ *  auto state = cudf::io::read_orc_chunked_begin(args);
+ *  while (cudf::io::read_orc_chunked_has_next(state)) {
+ *    auto result = cudf::io::read_orc_chunked(state);
+ *    ...
+ *  }
+ * @endcode
+ *
+ * @param args Settings for controlling reading behavior
+ * @param mr Optional resource to use for device memory allocation
+ *
+ * @return Pointer to an anonymous state structure storing information about the chunked read,
+ * to pass to all subsequent read_orc_chunked_has_next() and read_orc_chunked() calls
+ */
+std::shared_ptr<detail::orc::orc_chunked_read_state> read_orc_chunked_begin(
+  read_orc_chunked_args const& args,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Returns whether a chunked ORC read has tables left to read.
+ *
+ * @ingroup io_readers
+ *
+ * @param state Opaque state information about the reader process, returned from
+ * read_orc_chunked_begin()
+ *
+ * @return `true` if read_orc_chunked() returns another table
+ */
+bool read_orc_chunked_has_next(std::shared_ptr<detail::orc::orc_chunked_read_state> const& state);
+
+/**
+ * @brief Reads the next table of a chunked ORC read.
+ *
+ * @ingroup io_readers
+ *
+ * While the returned table is being used, the stripes of the next one are read, decompressed and
+ * decoded in the background, and the stripes of the one after it are loaded. The device buffers
+ * holding the stripe data and its decompressed streams are reused from one table to the next
+ * unless they grow beyond the memory allowed for a table.
+ *
+ * @param state Opaque state information about the reader process, returned from
+ * read_orc_chunked_begin()
+ *
+ * @return The set of columns along with metadata
+ *
+ * @throw cudf::logic_error if there is no table left to read
+ */
+table_with_metadata read_orc_chunked(
+  std::shared_ptr<detail::orc::orc_chunked_read_state> const& state);
+
 /**
  * @brief Settings to use for `read_parquet()`
  */
@@ -428,6 +586,19 @@ struct read_parquet_args {
   /// Cast timestamp columns to a specific type
   data_type timestamp_type{EMPTY};
 
+  /// Method used to read file sources
+  file_read_method read_method = file_read_method::MMAP;
+
+  /// Skip row groups whose statistics show that no row matches; rows are not filtered otherwise
+  filter_expression filter;
+
+  /// Optional cache of parsed file footers shared with other readers; only used for file paths
+  std::shared_ptr<metadata_cache> footer_cache;
+
+  /// Decompress the pages of a codec on the host when they hold fewer compressed bytes than
+  /// this, as kernel launches dominate the time of small reads; 0 always uses the GPU
+  size_t host_decompression_threshold = 0;
+
   explicit read_parquet_args() = default;
 
   explicit read_parquet_args(source_info const& src) : source(src) {}
@@ -456,6 +627,198 @@ table_with_metadata read_parquet(
   read_parquet_args const& args,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Settings to use for `read_parquet_chunked_begin()`
+ *
+ * @ingroup io_readers
+ */
+struct read_parquet_chunked_args {
+  source_info source;
+
+  /// Names of column to read; empty is all
+  std::vector<std::string> columns;
+
+  /// Whether to store string data as categorical type
+  bool strings_to_categorical = false;
+  /// Whether to use PANDAS metadata to load columns
+  bool use_pandas_metadata = true;
+  /// Cast timestamp columns to a specific type
+  data_type timestamp_type{EMPTY};
+
+  /// Method used to read file sources
+  file_read_method read_method = file_read_method::MMAP;
+
+  /// Skip row groups whose statistics show that no row matches; rows are not filtered otherwise
+  filter_expression filter;
+
+  /// Optional cache of parsed file footers shared with other readers; only used for file paths
+  std::shared_ptr<metadata_cache> footer_cache;
+
+  /// Decompress the pages of a codec on the host when they hold fewer compressed bytes than
+  /// this, as kernel launches dominate the time of small reads; 0 always uses the GPU
+  size_t host_decompression_threshold = 0;
+
+  /// Maximum size in bytes of the columns of each table read; 0 is no limit
+  size_t chunk_read_limit = 0;
+  /// Maximum size in bytes of the decompressed page data held to read a table; 0 is no limit
+  size_t pass_read_limit = 0;
+
+  explicit read_parquet_chunked_args() = default;
+
+  explicit read_parquet_chunked_args(source_info const& src) : source(src) {}
+};
+
+namespace detail {
+namespace parquet {
+/**
+ * @brief Forward declaration of anonymous chunked-reader state struct.
+ */
+struct pq_chunked_read_state;
+};  // namespace parquet
+};  // namespace detail
+
+/**
+ * @brief Begin the process of reading a Parquet dataset as a sequence of tables.
+ *
+ * @ingroup io_readers
+ *
+ * The intent of the read_parquet_chunked_ path is to allow reading datasets larger than the
+ * available device memory, as tables whose columns fit in `chunk_read_limit` bytes. Each table
+ * holds whole row groups where possible; row groups that exceed a limit are split into ranges of
+ * rows, which only limits the page data read and decompressed if the file has page indexes.
+ *
+ * The following code snippet demonstrates how to read a dataset in tables of at most 1GB:
+ * @code
+ *  ...
+ *  cudf::io::read_parquet_chunked_args args{cudf::source_info("dataset.parquet")};
+ *  args.chunk_read_limit = 1 << 30;
+ *  auto state = cudf::io::read_parquet_chunked_begin(args);
+ *  while (cudf::io::read_parquet_chunked_has_next(state)) {
+ *    auto result = cudf::io::read_parquet_chunked(state);
+ *    ...
+ *  }
+ * @endcode
+ *
+ * @param args Settings for controlling reading behavior
+ * @param mr Optional resource to use for device memory allocation
+ *
+ * @return Pointer to an anonymous state structure storing information about the chunked read,
+ * to pass to all subsequent read_parquet_chunked_has_next() and read_parquet_chunked() calls
+ */
+std::shared_ptr<detail::parquet::pq_chunked_read_state> read_parquet_chunked_begin(
+  read_parquet_chunked_args const& args,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Returns whether a chunked Parquet read has tables left to read.
+ *
+ * @ingroup io_readers
+ *
+ * @param state Opaque state information about the reader process, returned from
+ * read_parquet_chunked_begin()
+ *
+ * @return `true` if read_parquet_chunked() returns another table
+ */
+bool read_parquet_chunked_has_next(
+  std::shared_ptr<detail::parquet::pq_chunked_read_state> const& state);
+
+/**
+ * @brief Reads the next table of a chunked Parquet read.
+ *
+ * @ingroup io_readers
+ *
+ * While the returned table is being used, the next one is read and decoded in the background, so
+ * up to two tables of at most `chunk_read_limit` bytes are held at once.
+ *
+ * @param state Opaque state information about the reader process, returned from
+ * read_parquet_chunked_begin()
+ *
+ * @return The set of columns along with metadata
+ *
+ * @throw cudf::logic_error if there is no table left to read
+ */
+table_with_metadata read_parquet_chunked(
+  std::shared_ptr<detail::parquet::pq_chunked_read_state> const& state);
+
+/**
+ * @brief Settings to use for `read_parquet_dataset()`
+ *
+ * @ingroup io_readers
+ */
+struct read_parquet_dataset_args {
+  /// Paths of the files to read; empty for all the files found under `directory`
+  std::vector<std::string> filepaths;
+  /// Root directory of the dataset, searched recursively if `filepaths` is empty. Files and
+  /// directories whose names start with `_` or `.` are ignored.
+  std::string directory;
+  /// Whether to add a column for each `key=value` directory of the paths below `directory`
+  bool hive_partitioning = true;
+
+  /// Names of column to read, including partition columns; empty is all
+  std::vector<std::string> columns;
+
+  /// Whether to store string data as categorical type
+  bool strings_to_categorical = false;
+  /// Whether to use PANDAS metadata to load columns
+  bool use_pandas_metadata = true;
+  /// Cast timestamp columns to a specific type
+  data_type timestamp_type{EMPTY};
+
+  /// Method used to read file sources
+  file_read_method read_method = file_read_method::MMAP;
+
+  /// Skip files whose partition values, and row groups whose statistics show that no row
+  /// matches; rows are not filtered otherwise. The columns of skipped files are still returned.
+  filter_expression filter;
+
+  /// Optional cache of parsed file footers shared with other readers
+  std::shared_ptr<metadata_cache> footer_cache;
+
+  /// Decompress the pages of a codec on the host when they hold fewer compressed bytes than
+  /// this, as kernel launches dominate the time of small reads; 0 always uses the GPU
+  size_t host_decompression_threshold = 0;
+
+  /// Number of host threads opening the files and parsing their footers; 0 is the hardware
+  /// concurrency
+  size_t num_threads = 0;
+
+  explicit read_parquet_dataset_args() = default;
+
+  explicit read_parquet_dataset_args(std::vector<std::string> const& paths) : filepaths(paths) {}
+};
+
+/**
+ * @brief Reads a set of Parquet files into a single set of columns
+ *
+ * @ingroup io_readers
+ *
+ * The columns of the files are matched by name; a column missing from some files is null for
+ * their rows. With hive partitioning, each `key=value` directory of the file paths adds a
+ * column holding the value for the rows of the file, as an integer if all the values are
+ * integers and as a string otherwise. All the files are decoded into the output columns
+ * directly, without concatenating intermediate tables.
+ *
+ * The following code snippet demonstrates how to read a partitioned dataset:
+ * @code
+ *  ...
+ *  cudf::io::read_parquet_dataset_args args;
+ *  args.directory = "/data/sales";  // e.g. /data/sales/year=2020/part-0.parquet
+ *  args.filter    = {"year", cudf::io::filter_op::GREATER_EQUAL, 2019};
+ *  ...
+ *  auto result = cudf::io::read_parquet_dataset(args);
+ * @endcode
+ *
+ * @param args Settings for controlling reading behavior
+ * @param mr Optional resource to use for device memory allocation
+ *
+ * @return The set of columns along with metadata
+ *
+ * @throw cudf::logic_error if the files have mismatched column types or partitions
+ */
+table_with_metadata read_parquet_dataset(
+  read_parquet_dataset_args const& args,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 /**
  * @brief Settings to use for `write_orc()`
  *
@@ -472,6 +835,9 @@ struct write_orc_args {
   table_view table;
   /// Optional associated metadata
   const table_metadata* metadata;
+  /// Whether a file sink writes its buffers from a background thread, overlapping the file writes
+  /// with encoding
+  bool background_flush = false;
 
   write_orc_args() = default;
 
@@ -523,6 +889,9 @@ struct write_orc_chunked_args {
   bool enable_statistics;
   /// Optional associated metadata
   const table_metadata_with_nullability* metadata;
+  /// Whether a file sink writes its buffers from a background thread; see
+  /// `write_orc_args::background_flush`
+  bool background_flush = false;
 
   explicit write_orc_chunked_args(sink_info const& sink_,
                                   const table_metadata_with_nullability* metadata_ = nullptr,
@@ -620,6 +989,15 @@ struct write_parquet_args {
   bool return_filemetadata = false;
   /// Column chunks file path to be set in the raw output metadata
   std::string metadata_out_file_path;
+  /// Optional encoding of each column by index; integer columns support DELTA_BINARY_PACKED,
+  /// string columns the DELTA_*_BYTE_ARRAY encodings and floating-point columns BYTE_STREAM_SPLIT
+  std::vector<column_encoding> column_encodings;
+  /// Whether to write V2 data page headers, whose levels are stored uncompressed so that readers
+  /// can skip decompressing pages without values
+  bool write_v2_headers = false;
+  /// Whether a file sink writes its buffers from a background thread, overlapping the file writes
+  /// with encoding
+  bool background_flush = false;
 
   write_parquet_args() = default;
 
@@ -687,6 +1065,13 @@ struct write_parquet_chunked_args {
   statistics_freq stats_level = statistics_freq::STATISTICS_ROWGROUP;
   /// Optional associated metadata.
   const table_metadata_with_nullability* metadata;
+  /// Optional encoding of each column by index; see `write_parquet_args::column_encodings`
+  std::vector<column_encoding> column_encodings;
+  /// Whether to write V2 data page headers; see `write_parquet_args::write_v2_headers`
+  bool write_v2_headers = false;
+  /// Whether a file sink writes its buffers from a background thread; see
+  /// `write_parquet_args::background_flush`
+  bool background_flush = false;
 
   write_parquet_chunked_args() = default;
 
@@ -767,5 +1152,105 @@ void write_parquet_chunked(table_view const& table,
  */
 void write_parquet_chunked_end(std::shared_ptr<detail::parquet::pq_chunked_state>& state);
 
+/**
+ * @brief Settings to use for `write_parquet_dataset_begin()`
+ *
+ * @ingroup io_writers
+ */
+struct write_parquet_dataset_args {
+  /// Root directory of the dataset; created if needed
+  std::string directory;
+  /// Indices of the columns whose values select the `key=value` directories of each row; these
+  /// columns are not written to the files
+  std::vector<size_type> partition_cols;
+  /// Specify the compression format to use
+  compression_type compression = compression_type::AUTO;
+  /// Specify the level of statistics in the output files
+  statistics_freq stats_level = statistics_freq::STATISTICS_ROWGROUP;
+  /// Optional names and nullability of all the columns, including partition columns
+  const table_metadata_with_nullability* metadata = nullptr;
+  /// Optional encoding of each column by index in the table; see
+  /// `write_parquet_args::column_encodings`
+  std::vector<column_encoding> column_encodings;
+  /// Whether to write V2 data page headers; see `write_parquet_args::write_v2_headers`
+  bool write_v2_headers = false;
+  /// Maximum number of files open at once; 0 is no limit. When the limit is reached, the least
+  /// recently written file is closed, and later rows of its partition go to a new file.
+  size_t max_open_files = 0;
+  /// Whether to write a `_metadata` file holding the row groups of all the files
+  bool write_metadata_file = true;
+
+  write_parquet_dataset_args() = default;
+
+  explicit write_parquet_dataset_args(std::string const& directory_,
+                                      std::vector<size_type> const& partition_cols_)
+    : directory(directory_), partition_cols(partition_cols_)
+  {
+  }
+};
+
+namespace detail {
+namespace parquet {
+/**
+ * @brief Forward declaration of anonymous dataset-writer state struct.
+ */
+struct pq_dataset_state;
+};  // namespace parquet
+};  // namespace detail
+
+/**
+ * @brief Begin the process of writing tables as a hive-partitioned Parquet dataset.
+ *
+ * @ingroup io_writers
+ *
+ * The rows of each table are grouped by the values of the partition columns on the device, and
+ * each group is appended to a `key=value/part-N.parquet` file. Null partition values are written
+ * to `key=__HIVE_DEFAULT_PARTITION__` directories, and characters other than letters, digits,
+ * `-`, `_`, `.` and `~` are percent-encoded.
+ *
+ * The following code snippet demonstrates how to write a dataset partitioned by its first column:
+ * @code
+ *  ...
+ *  cudf::io::write_parquet_dataset_args args{"/data/sales", {0}};
+ *  auto state = cudf::io::write_parquet_dataset_begin(args);
+ *    cudf::io::write_parquet_dataset(table0, state);
+ *    cudf::io::write_parquet_dataset(table1, state);
+ *    ...
+ *  cudf::io::write_parquet_dataset_end(state);
+ * @endcode
+ *
+ * @param[in] args Settings for controlling writing behavior
+ * @param[in] mr Optional resource to use for device memory allocation
+ *
+ * @returns pointer to an anonymous state structure storing information about the dataset being
+ * written. this pointer must be passed to all subsequent write_parquet_dataset() and
+ * write_parquet_dataset_end() calls.
+ */
+std::shared_ptr<detail::parquet::pq_dataset_state> write_parquet_dataset_begin(
+  write_parquet_dataset_args const& args,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Write the rows of a table to the files of their partitions.
+ *
+ * @ingroup io_writers
+ *
+ * @param[in] table The table to be written, including the partition columns
+ * @param[in] state Opaque state information about the dataset being written. Required to be the
+ * state returned from write_parquet_dataset_begin()
+ */
+void write_parquet_dataset(table_view const& table,
+                           std::shared_ptr<detail::parquet::pq_dataset_state> state);
+
+/**
+ * @brief Finish writing a dataset: close all its files and write its `_metadata` file.
+ *
+ * @ingroup io_writers
+ *
+ * @param[in] state Opaque state information about the dataset being written. Required to be the
+ * state returned from write_parquet_dataset_begin()
+ */
+void write_parquet_dataset_end(std::shared_ptr<detail::parquet::pq_dataset_state>& state);
+
 }  // namespace io
 }  // namespace cudf
@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+namespace cudf {
+//! IO interfaces
+namespace io {
+namespace detail {
+struct metadata_cache_access;
+}  // namespace detail
+
+/**
+ * @brief Cache of the parsed footers of Parquet and ORC files, shared between readers
+ *
+ * Readers of a file path given a cache look up the file's footer by path, size and modification
+ * time before reading and parsing it, so that repeatedly opening the same file only pays for the
+ * footer once; a modified file is parsed again. The least recently used footers are evicted when
+ * the cache grows past its byte budget. The cache is thread-safe; a single instance is typically
+ * shared by all the readers of a process.
+ *
+ * The following code snippet reuses the footer of a file across reads:
+ * @code
+ *  auto cache = std::make_shared<cudf::io::metadata_cache>();
+ *  cudf::io::read_parquet_args args{cudf::io::source_info{"dataset.parquet"}};
+ *  args.footer_cache = cache;
+ *  auto first  = cudf::io::read_parquet(args);  // cache miss
+ *  auto second = cudf::io::read_parquet(args);  // cache hit
+ * @endcode
+ **/
+class metadata_cache {
+ public:
+  static constexpr size_t default_max_bytes = 64 * 1024 * 1024;
+
+  /**
+   * @brief Constructs an empty cache
+   *
+   * @param max_bytes Budget for the approximate size of the cached footers, in bytes
+   **/
+  explicit metadata_cache(size_t max_bytes = default_max_bytes);
+
+  ~metadata_cache();
+
+  /**
+   * @brief Removes all cached footers; the hit and miss counters are kept
+   **/
+  void clear();
+
+  size_t hits() const;         ///< Number of lookups that found their footer
+  size_t misses() const;       ///< Number of lookups that did not find their footer
+  size_t num_entries() const;  ///< Number of cached footers
+  size_t size_bytes() const;   ///< Approximate size of the cached footers, in bytes
+  size_t max_bytes() const;    ///< Budget for the size of the cached footers, in bytes
+
+ private:
+  friend struct detail::metadata_cache_access;
+
+  /**
+   * @brief Returns the cached footer stored under a key, counting a hit or a miss
+   *
+   * Keys are built by the readers from the format, path, size and modification time.
+   *
+   * @param key Key of the footer
+   *
+   * @return The parsed footer, or nullptr if it is not cached
+   **/
+  std::shared_ptr<void const> find(std::string const& key);
+
+  /**
+   * @brief Caches a parsed footer under a key, evicting the least recently used footers
+   *
+   * Footers larger than the whole budget are not cached.
+   *
+   * @param key Key of the footer
+   * @param value Parsed footer
+   * @param size Approximate size of the footer, in bytes
+   **/
+  void insert(std::string const& key, std::shared_ptr<void const> value, size_t size);
+
+  class impl;
+  std::unique_ptr<impl> _impl;
+};
+
+}  // namespace io
+}  // namespace cudf
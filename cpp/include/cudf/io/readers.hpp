@@ -23,6 +23,7 @@
 
 #include "types.hpp"
 
+#include <cudf/io/metadata_cache.hpp>
 #include <cudf/types.hpp>
 
 #include <memory>
@@ -49,6 +50,9 @@ namespace avro {
  */
 struct reader_options {
   std::vector<std::string> columns;
+  /// Number of host threads reading and parsing the files of a multi-file read; 0 is the
+  /// hardware concurrency
+  size_t num_threads = 0;
 
   reader_options()                       = default;
   reader_options(reader_options const &) = default;
@@ -105,6 +109,20 @@ class reader {
                   reader_options const &options,
                   rmm::mr::device_memory_resource *mr = rmm::mr::get_default_resource());
 
+  /**
+   * @brief Constructor for a set of files with the same schema, read as a single dataset.
+   *
+   * The rows of the files follow each other in the given order. The blocks of all the files are
+   * decompressed and decoded together.
+   *
+   * @param filepaths Paths of the files
+   * @param options Settings for controlling reading behavior
+   * @param mr Optional resource to use for device memory allocation
+   */
+  explicit reader(std::vector<std::string> const &filepaths,
+                  reader_options const &options,
+                  rmm::mr::device_memory_resource *mr = rmm::mr::get_default_resource());
+
   /**
    * @brief Destructor explicitly-declared to avoid inlined in header
    */
@@ -145,6 +163,8 @@ struct reader_options {
   /// Per-column types; disables type inference on those columns
   std::vector<std::string> dtype;
   bool dayfirst = false;
+  /// Flatten nested objects into columns named by the dotted path of each member
+  bool flatten_nested = false;
 
   reader_options()                       = default;
   reader_options(reader_options const &) = default;
@@ -399,6 +419,20 @@ class reader {
    */
   table_with_metadata read_byte_range(size_t offset, size_t size, cudaStream_t stream = 0);
 
+  /**
+   * @brief Reads the entire dataset as a set of byte ranges parsed independently.
+   *
+   * The data is split into ranges at quote-aware row boundaries, which are found on host threads,
+   * and the ranges after the first one are parsed concurrently. Unless `dtype` is set, column
+   * types are inferred from the first range only, as from a sample of the data.
+   *
+   * @param num_ranges Number of byte ranges to split the data into
+   * @param stream Optional stream to use for device memory alloc and kernels
+   *
+   * @return The set of columns along with table metadata
+   */
+  table_with_metadata read_split(size_type num_ranges, cudaStream_t stream = 0);
+
   /**
    * @brief Reads a range of rows.
    *
@@ -426,8 +460,12 @@ struct reader_options {
   bool use_index     = true;
   bool use_np_dtypes = true;
   data_type timestamp_type{EMPTY};
-  bool decimals_as_float    = true;
-  int forced_decimals_scale = -1;
+  bool decimals_as_float       = true;
+  int forced_decimals_scale    = -1;
+  file_read_method read_method = file_read_method::MMAP;
+  filter_expression filter;
+  std::shared_ptr<metadata_cache> footer_cache;
+  size_t host_decompression_threshold = 0;
 
   reader_options()                       = default;
   reader_options(reader_options const &) = default;
@@ -552,6 +590,34 @@ class reader {
    * @return The set of columns along with table metadata
    */
   table_with_metadata read_rows(size_type skip_rows, size_type num_rows, cudaStream_t stream = 0);
+
+  /**
+   * @brief Starts reading the dataset as a sequence of tables, each within a memory budget.
+   *
+   * Consecutive stripes are read together while the estimated device memory needed for their
+   * stripe data, decompressed streams and decoded columns stays within half of the limit, as the
+   * next table is decoded, and the stripes of the one after it are loaded, while one is used.
+   *
+   * @param chunk_read_limit Maximum size in bytes of the memory used by the reads; 0 is no limit
+   * @param stream Optional stream to use for device memory alloc and kernels
+   */
+  void read_chunked_begin(size_t chunk_read_limit, cudaStream_t stream = 0);
+
+  /**
+   * @brief Returns whether there are tables left to read with `read_chunk()`.
+   */
+  bool has_next() const;
+
+  /**
+   * @brief Reads the next table of a read started with `read_chunked_begin()`.
+   *
+   * The following table is read in the background while this one is being used.
+   *
+   * @return The set of columns along with table metadata
+   *
+   * @throw cudf::logic_error if there is no table left to read
+   */
+  table_with_metadata read_chunk();
 };
 
 }  // namespace orc
@@ -565,6 +631,10 @@ struct reader_options {
   bool strings_to_categorical = false;
   bool use_pandas_metadata    = false;
   data_type timestamp_type{EMPTY};
+  file_read_method read_method = file_read_method::MMAP;
+  filter_expression filter;
+  std::shared_ptr<metadata_cache> footer_cache;
+  size_t host_decompression_threshold = 0;
 
   reader_options()                       = default;
   reader_options(reader_options const &) = default;
@@ -597,6 +667,8 @@ class reader {
   class impl;
   std::unique_ptr<impl> _impl;
 
+  friend class dataset_reader;
+
  public:
   /**
    * @brief Constructor for a filepath to dataset.
@@ -685,6 +757,94 @@ class reader {
    * @return The set of columns along with table metadata
    */
   table_with_metadata read_rows(size_type skip_rows, size_type num_rows, cudaStream_t stream = 0);
+
+  /**
+   * @brief Starts reading the dataset as a sequence of tables, each within a size limit.
+   *
+   * Consecutive row groups are read together while the estimated size of their decoded columns
+   * and of their decompressed page data stay within the limits; larger row groups are read as
+   * several ranges of rows.
+   *
+   * @param chunk_read_limit Maximum size in bytes of the columns of each table; 0 is no limit
+   * @param pass_read_limit Maximum size in bytes of the decompressed page data; 0 is no limit
+   * @param stream Optional stream to use for device memory alloc and kernels
+   */
+  void read_chunked_begin(size_t chunk_read_limit,
+                          size_t pass_read_limit,
+                          cudaStream_t stream = 0);
+
+  /**
+   * @brief Returns whether there are tables left to read with `read_chunk()`.
+   */
+  bool has_next() const;
+
+  /**
+   * @brief Reads the next table of a read started with `read_chunked_begin()`.
+   *
+   * The following table is read in the background while this one is being used.
+   *
+   * @return The set of columns along with table metadata
+   *
+   * @throw cudf::logic_error if there is no table left to read
+   */
+  table_with_metadata read_chunk();
+};
+
+/**
+ * @brief Options for reading a set of Parquet files as a single dataset.
+ */
+struct dataset_options {
+  /// Directory searched recursively for files if none are listed, below which the hive
+  /// partitions of the files are found
+  std::string directory;
+  /// Whether to add a column for each `key=value` directory of the file paths
+  bool hive_partitioning = true;
+  /// Number of host threads opening the files; 0 is the hardware concurrency
+  size_t num_threads = 0;
+};
+
+/**
+ * @brief Class to read a set of Parquet files into a single table.
+ */
+class dataset_reader {
+ private:
+  class impl;
+  std::unique_ptr<impl> _impl;
+
+ public:
+  /**
+   * @brief Constructor for a list of files, or for the files of a directory.
+   *
+   * The files are opened and their footers parsed concurrently.
+   *
+   * @param filepaths Paths of the files; empty for all the files of the dataset directory
+   * @param dataset Settings for finding the files and their partitions
+   * @param options Settings for controlling reading behavior of each file
+   * @param mr Optional resource to use for device memory allocation
+   */
+  explicit dataset_reader(std::vector<std::string> filepaths,
+                          dataset_options const &dataset,
+                          reader_options const &options,
+                          rmm::mr::device_memory_resource *mr = rmm::mr::get_default_resource());
+
+  /**
+   * @brief Destructor explicitly-declared to avoid inlined in header
+   */
+  ~dataset_reader();
+
+  /**
+   * @brief Reads all the files into a single table.
+   *
+   * The columns of the files are unified by name, and each file is decoded directly into its
+   * rows of the output columns. Rows of a file missing a column are null.
+   *
+   * @param stream Optional stream to use for device memory alloc and kernels
+   *
+   * @return The set of columns along with table metadata
+   *
+   * @throw cudf::logic_error if the files have mismatched column types or partitions
+   */
+  table_with_metadata read_all(cudaStream_t stream = 0);
 };
 
 }  // namespace parquet
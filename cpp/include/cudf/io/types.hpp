@@ -25,6 +25,7 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <type_traits>
 #include <vector>
 
 // Forward declarations
@@ -57,7 +58,9 @@ enum class compression_type {
   BZIP2,   ///< BZIP2 format, using Burrows-Wheeler transform
   BROTLI,  ///< BROTLI format, using LZ77 + Huffman + 2nd order context modeling
   ZIP,     ///< ZIP format, using DEFLATE algorithm
-  XZ       ///< XZ format, using LZMA(2) algorithm
+  XZ,      ///< XZ format, using LZMA(2) algorithm
+  ZSTD,    ///< Zstandard format, using LZ77 + entropy coding
+  LZ4      ///< LZ4 format, using byte-oriented LZ77
 };
 
 /**
@@ -71,6 +74,15 @@ enum class io_type {
   USER_SINK,                 ///< Input/output is handled by a custom user class
 };
 
+/**
+ * @brief Methods for reading data from a file source
+ */
+enum class file_read_method {
+  MMAP,    ///< Memory-map the file; data is paged in through the page cache
+  PREAD,   ///< Buffered `pread()` through the page cache
+  DIRECT,  ///< `O_DIRECT` reads into pinned bounce buffers, bypassing the page cache
+};
+
 /**
  * @brief Behavior when handling quotations in field data
  */
@@ -90,6 +102,147 @@ enum statistics_freq {
   STATISTICS_PAGE     = 2,  //!< Per-page column statistics
 };
 
+/**
+ * @brief Encodings of the column values in parquet output
+ */
+enum class column_encoding {
+  AUTO,                     ///< Dictionary encoding when smaller than PLAIN, PLAIN otherwise
+  PLAIN,                    ///< Values stored as-is
+  DELTA_BINARY_PACKED,      ///< Bit-packed differences between consecutive integers
+  DELTA_LENGTH_BYTE_ARRAY,  ///< Delta-encoded string lengths, followed by the string bytes
+  DELTA_BYTE_ARRAY,         ///< Delta-encoded lengths of prefixes shared with the previous string
+                            ///< and of the remaining suffixes, followed by the suffix bytes
+  BYTE_STREAM_SPLIT,        ///< Bytes of floating-point values split into one stream per byte
+};
+
+/**
+ * @brief Operators of a reader filter expression
+ */
+enum class filter_op {
+  EQUAL,          ///< Column value equals the literal
+  NOT_EQUAL,      ///< Column value differs from the literal
+  LESS,           ///< Column value is less than the literal
+  LESS_EQUAL,     ///< Column value is less than or equal to the literal
+  GREATER,        ///< Column value is greater than the literal
+  GREATER_EQUAL,  ///< Column value is greater than or equal to the literal
+  IS_NULL,        ///< Column value is null
+  IS_NOT_NULL,    ///< Column value is not null
+  AND,            ///< Both sub-expressions are true
+  OR,             ///< Either sub-expression is true
+};
+
+/**
+ * @brief Literal value compared against a column in a filter expression
+ *
+ * Integers compare against integer, boolean, date and timestamp columns in their stored units (days
+ * for dates, and the file's resolution for timestamps). Floating-point values compare against any
+ * numeric column, and strings against string columns, byte-wise.
+ */
+class filter_literal {
+ public:
+  enum class kind { NONE, INTEGER, FLOAT, STRING };
+
+  filter_literal() = default;
+
+  template <typename T, std::enable_if_t<std::is_integral<T>::value>* = nullptr>
+  filter_literal(T value) : _kind(kind::INTEGER), _int_value(static_cast<int64_t>(value))
+  {
+  }
+
+  template <typename T, std::enable_if_t<std::is_floating_point<T>::value>* = nullptr>
+  filter_literal(T value) : _kind(kind::FLOAT), _float_value(static_cast<double>(value))
+  {
+  }
+
+  filter_literal(std::string value) : _kind(kind::STRING), _string_value(std::move(value)) {}
+
+  filter_literal(const char* value) : filter_literal(std::string(value)) {}
+
+  kind type() const noexcept { return _kind; }
+  int64_t int_value() const noexcept { return _int_value; }
+  double float_value() const noexcept { return _float_value; }
+  std::string const& string_value() const noexcept { return _string_value; }
+
+ private:
+  kind _kind          = kind::NONE;
+  int64_t _int_value  = 0;
+  double _float_value = 0;
+  std::string _string_value;
+};
+
+/**
+ * @brief Filter expression used by readers to skip row groups or stripes
+ *
+ * Readers evaluate the expression against the min/max/null-count statistics stored in the file
+ * and skip the row groups (or stripes) in which no row can match. Rows of the remaining row groups
+ * are returned unfiltered. A default-constructed expression matches everything.
+ *
+ * The following code snippet selects row groups that may contain rows with `a > 10 AND b == "x"`:
+ * @code
+ *  cudf::io::filter_expression filter{
+ *    {"a", cudf::io::filter_op::GREATER, 10},
+ *    cudf::io::filter_op::AND,
+ *    {"b", cudf::io::filter_op::EQUAL, "x"}};
+ * @endcode
+ */
+class filter_expression {
+ public:
+  filter_expression() = default;
+
+  /**
+   * @brief Compares a column against a literal
+   *
+   * @param column Name of the column
+   * @param op Comparison operator, from `EQUAL` to `GREATER_EQUAL`
+   * @param value Literal to compare against
+   */
+  filter_expression(std::string column, filter_op op, filter_literal value)
+    : _op(op), _column(std::move(column)), _value(std::move(value)), _empty(false)
+  {
+  }
+
+  /**
+   * @brief Tests a column for nulls
+   *
+   * @param column Name of the column
+   * @param op `IS_NULL` or `IS_NOT_NULL`
+   */
+  filter_expression(std::string column, filter_op op)
+    : _op(op), _column(std::move(column)), _empty(false)
+  {
+  }
+
+  /**
+   * @brief Combines two expressions
+   *
+   * @param lhs Left sub-expression
+   * @param op `AND` or `OR`
+   * @param rhs Right sub-expression
+   */
+  filter_expression(filter_expression const& lhs, filter_op op, filter_expression const& rhs)
+    : _op(op),
+      _lhs(std::make_shared<filter_expression>(lhs)),
+      _rhs(std::make_shared<filter_expression>(rhs)),
+      _empty(false)
+  {
+  }
+
+  bool empty() const noexcept { return _empty; }
+  filter_op op() const noexcept { return _op; }
+  std::string const& column() const noexcept { return _column; }
+  filter_literal const& value() const noexcept { return _value; }
+  filter_expression const* lhs() const noexcept { return _lhs.get(); }
+  filter_expression const* rhs() const noexcept { return _rhs.get(); }
+
+ private:
+  filter_op _op = filter_op::AND;
+  std::string _column;
+  filter_literal _value;
+  std::shared_ptr<filter_expression const> _lhs;
+  std::shared_ptr<filter_expression const> _rhs;
+  bool _empty = true;
+};
+
 /**
  * @brief Table metadata for io readers/writers (primarily column names)
  * For nested types (structs, maps, unions), the ordering of names in the column_names vector
@@ -108,6 +261,9 @@ enum statistics_freq {
 struct table_metadata {
   std::vector<std::string> column_names;         //!< Names of columns contained in the table
   std::map<std::string, std::string> user_data;  //!< Format-dependent metadata as key-values pairs
+  size_type num_filtered_row_groups = 0;  //!< Row groups (or stripes) skipped by a reader filter
+  size_t num_filtered_rows          = 0;  //!< Rows of the row groups skipped by a reader filter
+  size_t num_filtered_bytes         = 0;  //!< Bytes of the selected columns that were not read
 };
 
 /**
@@ -30,6 +30,7 @@
 
 #include <memory>
 #include <utility>
+#include <vector>
 
 //! cuDF interfaces
 namespace cudf {
@@ -132,6 +133,10 @@ struct writer_options {
   compression_type compression = compression_type::AUTO;
   /// Select the statistics level to generate in the parquet file
   statistics_freq stats_granularity = statistics_freq::STATISTICS_ROWGROUP;
+  /// Encoding of each column by index; columns without an entry use `column_encoding::AUTO`
+  std::vector<column_encoding> column_encodings;
+  /// Write data pages with V2 headers
+  bool write_v2_headers = false;
 
   writer_options()                      = default;
   writer_options(writer_options const&) = default;
@@ -209,8 +214,13 @@ class writer {
    *
    * @param[in] pq_chunked_state State information that crosses _begin() / write_chunked() / _end()
    * boundaries.
+   * @param return_filemetadata If true, return the raw file metadata
+   * @param metadata_out_file_path Column chunks file path to be set in the raw output metadata
    */
-  void write_chunked_end(struct pq_chunked_state& state);
+  std::unique_ptr<std::vector<uint8_t>> write_chunked_end(
+    struct pq_chunked_state& state,
+    bool return_filemetadata                  = false,
+    const std::string& metadata_out_file_path = "");
 
   /**
    * @brief Merges multiple metadata blobs returned by write_all into a single metadata blob
@@ -222,6 +232,71 @@ class writer {
     const std::vector<std::unique_ptr<std::vector<uint8_t>>>& metadata_list);
 };
 
+/**
+ * @brief Options for writing a table as a hive-partitioned set of Parquet files.
+ */
+struct dataset_writer_options {
+  /// Root directory of the dataset; created if needed
+  std::string directory;
+  /// Indices of the columns whose values select the directory of each row
+  std::vector<size_type> partition_cols;
+  /// Maximum number of files open at once; 0 is no limit
+  size_t max_open_files = 0;
+  /// Whether to write a `_metadata` file holding the row groups of all the files
+  bool write_metadata_file = true;
+  /// Settings of the writer of each file
+  writer_options file_options;
+};
+
+/**
+ * @brief Class to write tables as a hive-partitioned set of Parquet files.
+ *
+ * Rows are grouped by the values of the partition columns, and each group is appended to a
+ * `key=value/.../part-N.parquet` file below the dataset directory, without the partition columns.
+ * Files stay open across calls to `write()` so that the rows of a partition accumulate in the
+ * same file, until more than `max_open_files` files would be open: the least recently written file
+ * is then closed, and later rows of its partition go to a new file.
+ */
+class dataset_writer {
+ private:
+  class impl;
+  std::unique_ptr<impl> _impl;
+
+ public:
+  /**
+   * @brief Constructor for output to a directory.
+   *
+   * @param options Settings for controlling writing behavior
+   * @param metadata Optional names and nullability of all the columns, including partition columns
+   * @param mr Optional resource to use for device memory allocation
+   */
+  explicit dataset_writer(dataset_writer_options const& options,
+                          table_metadata_with_nullability const* metadata = nullptr,
+                          rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+  /**
+   * @brief Destructor explicitly-declared to avoid inlined in header
+   */
+  ~dataset_writer();
+
+  /**
+   * @brief Appends the rows of a table to the files of their partitions.
+   *
+   * @param table Set of columns to output, including the partition columns
+   * @param stream Optional stream to use for device memory alloc and kernels
+   *
+   * @throw cudf::logic_error if a partition column is not an integer, boolean or string column
+   */
+  void write(table_view const& table, cudaStream_t stream = 0);
+
+  /**
+   * @brief Closes all the files, and writes the `_metadata` file if requested.
+   *
+   * @param stream Optional stream to use for device memory alloc and kernels
+   */
+  void close(cudaStream_t stream = 0);
+};
+
 }  // namespace parquet
 
 namespace csv {
@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include <cudf/types.hpp>
+
 #include <memory>
 #include <type_traits>
 #include <utility>
@@ -27,6 +29,37 @@ namespace cudf {
  * @{
  */
 
+/**
+ * @brief How the output of an equality join is allocated.
+ */
+enum class join_output_size : bool {
+  ESTIMATE,  ///< Allocate from a sampled estimate, probing again with a larger buffer if too small
+  EXACT      ///< Count the matches of every row first, then write every match at its offset
+};
+
+/**
+ * @brief Algorithm used by an equality join.
+ */
+enum class join_algorithm : int32_t {
+  AUTO,       ///< Sort-merge join if the right keys are flagged sorted, hash join otherwise
+  HASH,       ///< Build a hash table of the right keys and probe it with the left keys
+  SORT_MERGE  ///< Sort the right keys, unless flagged sorted, and binary search the left keys
+};
+
+/**
+ * @brief Options of an equality join.
+ */
+struct join_options {
+  /// Whether the output is allocated from an estimate of its size or from an exact count of the
+  /// matches. Only used by the hash join.
+  join_output_size output_size = join_output_size::ESTIMATE;
+  /// The join algorithm to use
+  join_algorithm algorithm = join_algorithm::AUTO;
+  /// Whether the right key columns are sorted in ascending order with nulls first, as produced by
+  /// `cudf::sort` with its default arguments
+  sorted keys_are_sorted = sorted::NO;
+};
+
 /**
  * @brief  Performs an inner join on the specified columns of two
  * tables (`left`, `right`)
@@ -76,6 +109,8 @@ namespace cudf {
  * from `left_on` columns. Else, for every column in `left_on` and `right_on`,
  * an output column will be produced.  For each of these pairs (L, R), L
  * should exist in `left_on` and R should exist in `right_on`.
+ * @param[in] options The join algorithm, how its output is allocated, and
+ * whether the `right_on` columns of `right` are sorted
  * @param mr Memory resource used to allocate the returned table and columns
  *
  * @returns Result of joining `left` and `right` tables on the columns
@@ -88,6 +123,7 @@ std::unique_ptr<cudf::table> inner_join(
   std::vector<cudf::size_type> const& left_on,
   std::vector<cudf::size_type> const& right_on,
   std::vector<std::pair<cudf::size_type, cudf::size_type>> const& columns_in_common,
+  join_options const& options         = join_options{},
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
 /**
@@ -141,6 +177,8 @@ std::unique_ptr<cudf::table> inner_join(
  * from `left_on` columns. Else, for every column in `left_on` and `right_on`,
  * an output column will be produced.  For each of these pairs (L, R), L
  * should exist in `left_on` and R should exist in `right_on`.
+ * @param[in] options The join algorithm, how its output is allocated, and
+ * whether the `right_on` columns of `right` are sorted
  * @param mr Memory resource used to allocate the returned table and columns
  *
  * @returns Result of joining `left` and `right` tables on the columns
@@ -153,6 +191,7 @@ std::unique_ptr<cudf::table> left_join(
   std::vector<cudf::size_type> const& left_on,
   std::vector<cudf::size_type> const& right_on,
   std::vector<std::pair<cudf::size_type, cudf::size_type>> const& columns_in_common,
+  join_options const& options         = join_options{},
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
 /**
@@ -206,6 +245,8 @@ std::unique_ptr<cudf::table> left_join(
  * from `left_on` columns. Else, for every column in `left_on` and `right_on`,
  * an output column will be produced.  For each of these pairs (L, R), L
  * should exist in `left_on` and R should exist in `right_on`.
+ * @param[in] options The join algorithm, how its output is allocated, and
+ * whether the `right_on` columns of `right` are sorted
  * @param mr Memory resource used to allocate the returned table and columns
  *
  * @returns Result of joining `left` and `right` tables on the columns
@@ -218,7 +259,342 @@ std::unique_ptr<cudf::table> full_join(
   std::vector<cudf::size_type> const& left_on,
   std::vector<cudf::size_type> const& right_on,
   std::vector<std::pair<cudf::size_type, cudf::size_type>> const& columns_in_common,
+  join_options const& options         = join_options{},
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+/**
+ * @brief  Returns the row indices of an inner join on the specified columns
+ * of two tables (`left`, `right`).
+ *
+ * Unlike `inner_join`, no columns are gathered; the returned index columns can
+ * be passed to `gather_join_columns` to gather only the columns that are
+ * needed, or used directly to filter, aggregate or join again.
+ *
+ * @code{.pseudo}
+ *          Left a: {0, 1, 2}
+ *          Right b: {1, 2, 3}
+ *          left_on: {0}
+ *          right_on: {0}
+ * Result: { {1, 2}, {0, 1} }
+ * @endcode
+ *
+ * @throws cudf::logic_error if number of elements in `left_on` or `right_on`
+ * mismatch.
+ * @throws cudf::logic_error if number of columns in either `left` or `right`
+ * table is 0 or exceeds MAX_JOIN_SIZE
+ * @throws std::out_of_range if element of `left_on` or `right_on` exceed the
+ * number of columns in the left or right table.
+ *
+ * @param[in] left The left table
+ * @param[in] right The right table
+ * @param[in] left_on The column indices from `left` to join on.
+ * The column from `left` indicated by `left_on[i]` will be compared against the column
+ * from `right` indicated by `right_on[i]`.
+ * @param[in] right_on The column indices from `right` to join on.
+ * The column from `right` indicated by `right_on[i]` will be compared against the column
+ * from `left` indicated by `left_on[i]`.
+ * @param[in] options The join algorithm, how its output is allocated, and
+ * whether the `right_on` columns of `right` are sorted
+ * @param mr Memory resource used to allocate the returned columns
+ *
+ * @returns Pair of columns of `left` and `right` row indices of the joined rows
+ */
+std::pair<std::unique_ptr<cudf::column>, std::unique_ptr<cudf::column>> inner_join_indices(
+  cudf::table_view const& left,
+  cudf::table_view const& right,
+  std::vector<cudf::size_type> const& left_on,
+  std::vector<cudf::size_type> const& right_on,
+  join_options const& options         = join_options{},
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief  Returns the row indices of a left join on the specified columns of
+ * two tables (`left`, `right`).
+ *
+ * Rows of `left` without a match have a right index of `-1`.
+ *
+ * @code{.pseudo}
+ *          Left a: {0, 1, 2}
+ *          Right b: {1, 2, 3}
+ *          left_on: {0}
+ *          right_on: {0}
+ * Result: { {0, 1, 2}, {-1, 0, 1} }
+ * @endcode
+ *
+ * @throws cudf::logic_error if number of elements in `left_on` or `right_on`
+ * mismatch.
+ * @throws cudf::logic_error if number of columns in either `left` or `right`
+ * table is 0 or exceeds MAX_JOIN_SIZE
+ * @throws std::out_of_range if element of `left_on` or `right_on` exceed the
+ * number of columns in the left or right table.
+ *
+ * @param[in] left The left table
+ * @param[in] right The right table
+ * @param[in] left_on The column indices from `left` to join on.
+ * @param[in] right_on The column indices from `right` to join on.
+ * @param[in] options The join algorithm, how its output is allocated, and
+ * whether the `right_on` columns of `right` are sorted
+ * @param mr Memory resource used to allocate the returned columns
+ *
+ * @returns Pair of columns of `left` and `right` row indices of the joined rows
+ */
+std::pair<std::unique_ptr<cudf::column>, std::unique_ptr<cudf::column>> left_join_indices(
+  cudf::table_view const& left,
+  cudf::table_view const& right,
+  std::vector<cudf::size_type> const& left_on,
+  std::vector<cudf::size_type> const& right_on,
+  join_options const& options         = join_options{},
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief  Returns the row indices of a full join on the specified columns of
+ * two tables (`left`, `right`).
+ *
+ * Rows of `left` without a match have a right index of `-1`, and rows of
+ * `right` without a match have a left index of `-1`.
+ *
+ * @code{.pseudo}
+ *          Left a: {0, 1, 2}
+ *          Right b: {1, 2, 3}
+ *          left_on: {0}
+ *          right_on: {0}
+ * Result: { {0, 1, 2, -1}, {-1, 0, 1, 2} }
+ * @endcode
+ *
+ * @throws cudf::logic_error if number of elements in `left_on` or `right_on`
+ * mismatch.
+ * @throws cudf::logic_error if number of columns in either `left` or `right`
+ * table is 0 or exceeds MAX_JOIN_SIZE
+ * @throws std::out_of_range if element of `left_on` or `right_on` exceed the
+ * number of columns in the left or right table.
+ *
+ * @param[in] left The left table
+ * @param[in] right The right table
+ * @param[in] left_on The column indices from `left` to join on.
+ * @param[in] right_on The column indices from `right` to join on.
+ * @param[in] options The join algorithm, how its output is allocated, and
+ * whether the `right_on` columns of `right` are sorted
+ * @param mr Memory resource used to allocate the returned columns
+ *
+ * @returns Pair of columns of `left` and `right` row indices of the joined rows
+ */
+std::pair<std::unique_ptr<cudf::column>, std::unique_ptr<cudf::column>> full_join_indices(
+  cudf::table_view const& left,
+  cudf::table_view const& right,
+  std::vector<cudf::size_type> const& left_on,
+  std::vector<cudf::size_type> const& right_on,
+  join_options const& options         = join_options{},
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief  Gathers the requested columns of `left` and `right` with the row
+ * indices returned by one of the `*_join_indices` functions.
+ *
+ * Only the columns listed in `left_columns` and `right_columns` are gathered.
+ * Rows with an index of `-1` are null in the gathered columns.
+ *
+ * @code{.pseudo}
+ *          Left a: {0, 1, 2}, c: {5, 6, 7}
+ *          Right b: {1, 2, 3}, d: {8, 9, 10}
+ *          left_indices: {0, 1, 2}
+ *          right_indices: {-1, 0, 1}
+ *          left_columns: {1}
+ *          right_columns: {1}
+ * Result: { c: {5, 6, 7}, d: {NULL, 8, 9} }
+ * @endcode
+ *
+ * @throws cudf::logic_error if `left_indices` and `right_indices` differ in size
+ * @throws std::out_of_range if element of `left_columns` or `right_columns`
+ * exceed the number of columns in the left or right table.
+ *
+ * @param[in] left The left table
+ * @param[in] right The right table
+ * @param[in] left_indices Row indices into `left`
+ * @param[in] right_indices Row indices into `right`
+ * @param[in] left_columns The column indices from `left` to gather
+ * @param[in] right_columns The column indices from `right` to gather
+ * @param mr Memory resource used to allocate the returned table and columns
+ *
+ * @returns Table of the gathered `left_columns` followed by the gathered
+ * `right_columns`
+ */
+std::unique_ptr<cudf::table> gather_join_columns(
+  cudf::table_view const& left,
+  cudf::table_view const& right,
+  cudf::column_view const& left_indices,
+  cudf::column_view const& right_indices,
+  std::vector<cudf::size_type> const& left_columns,
+  std::vector<cudf::size_type> const& right_columns,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief Comparison of a column of `left` with a column of `right` in a join predicate.
+ */
+enum class join_comparator : int32_t {
+  EQUAL,         ///< left == right + offset
+  NOT_EQUAL,     ///< left != right + offset
+  LESS,          ///< left < right + offset
+  LESS_EQUAL,    ///< left <= right + offset
+  GREATER,       ///< left > right + offset
+  GREATER_EQUAL  ///< left >= right + offset
+};
+
+/**
+ * @brief A predicate over a row of the `left` table and a row of the `right`
+ * table of a conditional join.
+ *
+ * A predicate is a tree whose leaves compare a column of `left` with a column
+ * of `right` plus a constant offset, and whose inner nodes combine two
+ * predicates with AND or OR. A comparison involving a null element is false.
+ *
+ * Both columns of a comparison must have the same numeric or timestamp type.
+ * The offset is truncated to an integer for integral columns, and is a number
+ * of ticks of the timestamp resolution for timestamp columns.
+ *
+ * @code{.pseudo}
+ * // left[0] BETWEEN right[1] - 5 AND right[1] + 5
+ * join_predicate::band(0, 1, -5, 5)
+ * // left[0] == right[0] AND left[1] < right[2]
+ * join_predicate::logical_and(join_predicate::compare(0, join_comparator::EQUAL, 0),
+ *                             join_predicate::compare(1, join_comparator::LESS, 2))
+ * @endcode
+ */
+class join_predicate {
+ public:
+  /// Kind of a node of a predicate
+  enum class node_kind : int32_t { COMPARE, AND, OR };
+
+  /// Node of a predicate. AND and OR nodes only use `kind`.
+  struct node {
+    node_kind kind;
+    size_type left_column;
+    join_comparator op;
+    size_type right_column;
+    double offset;
+  };
+
+  /**
+   * @brief Returns the predicate `left[left_column] <op> right[right_column] + offset`
+   */
+  static join_predicate compare(size_type left_column,
+                                join_comparator op,
+                                size_type right_column,
+                                double offset = 0.0);
+
+  /**
+   * @brief Returns the band predicate
+   * `right[right_column] + lower_offset <= left[left_column] <= right[right_column] + upper_offset`
+   */
+  static join_predicate band(size_type left_column,
+                             size_type right_column,
+                             double lower_offset,
+                             double upper_offset);
+
+  /**
+   * @brief Returns the predicate that holds if both `lhs` and `rhs` hold
+   */
+  static join_predicate logical_and(join_predicate const& lhs, join_predicate const& rhs);
+
+  /**
+   * @brief Returns the predicate that holds if `lhs` or `rhs` holds
+   */
+  static join_predicate logical_or(join_predicate const& lhs, join_predicate const& rhs);
+
+  /**
+   * @brief Returns the nodes of the predicate in postfix order, every AND and
+   * OR node following the nodes of its two operands
+   */
+  std::vector<node> const& nodes() const { return _nodes; }
+
+ private:
+  std::vector<node> _nodes;
+};
+
+/**
+ * @brief  Returns the row indices of an inner join of two tables (`left`,
+ * `right`) on an arbitrary predicate over their rows.
+ *
+ * Every pair of rows for which `predicate` holds is joined. Single comparisons
+ * other than NOT_EQUAL, and band predicates, are answered by sorting the
+ * compared column of `right` and binary searching the values of `left`.
+ * Other predicates are evaluated on every pair of rows, without materializing
+ * the cross product.
+ *
+ * Use `gather_join_columns` to gather the columns of the joined rows.
+ *
+ * @code{.pseudo}
+ *          Left a: {0, 10, 20}
+ *          Right b: {1, 12, 30}
+ *          predicate: join_predicate::band(0, 0, -2, 2)
+ * Result: left indices: {0, 1}, right indices: {0, 1}
+ * @endcode
+ *
+ * @throws cudf::logic_error if `predicate` refers to a column that does not
+ * exist, or compares columns of different or unsupported types
+ * @throws cudf::logic_error if the join output size exceeds MAX_JOIN_SIZE
+ *
+ * @param[in] left The left table
+ * @param[in] right The right table
+ * @param[in] predicate The predicate over a row of `left` and a row of `right`
+ * @param mr Memory resource used to allocate the returned columns
+ *
+ * @returns Pair of columns of `left` and `right` row indices of the joined rows
+ */
+std::pair<std::unique_ptr<cudf::column>, std::unique_ptr<cudf::column>>
+conditional_inner_join_indices(
+  cudf::table_view const& left,
+  cudf::table_view const& right,
+  join_predicate const& predicate,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief  Returns the row indices of a left join of two tables (`left`,
+ * `right`) on an arbitrary predicate over their rows.
+ *
+ * Rows of `left` without a match have a right index of `-1`.
+ *
+ * @throws cudf::logic_error if `predicate` refers to a column that does not
+ * exist, or compares columns of different or unsupported types
+ * @throws cudf::logic_error if the join output size exceeds MAX_JOIN_SIZE
+ *
+ * @param[in] left The left table
+ * @param[in] right The right table
+ * @param[in] predicate The predicate over a row of `left` and a row of `right`
+ * @param mr Memory resource used to allocate the returned columns
+ *
+ * @returns Pair of columns of `left` and `right` row indices of the joined rows
+ */
+std::pair<std::unique_ptr<cudf::column>, std::unique_ptr<cudf::column>>
+conditional_left_join_indices(
+  cudf::table_view const& left,
+  cudf::table_view const& right,
+  join_predicate const& predicate,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
+/**
+ * @brief  Returns the row indices of a full join of two tables (`left`,
+ * `right`) on an arbitrary predicate over their rows.
+ *
+ * Rows of `left` without a match have a right index of `-1`, and rows of
+ * `right` without a match have a left index of `-1`.
+ *
+ * @throws cudf::logic_error if `predicate` refers to a column that does not
+ * exist, or compares columns of different or unsupported types
+ * @throws cudf::logic_error if the join output size exceeds MAX_JOIN_SIZE
+ *
+ * @param[in] left The left table
+ * @param[in] right The right table
+ * @param[in] predicate The predicate over a row of `left` and a row of `right`
+ * @param mr Memory resource used to allocate the returned columns
+ *
+ * @returns Pair of columns of `left` and `right` row indices of the joined rows
+ */
+std::pair<std::unique_ptr<cudf::column>, std::unique_ptr<cudf::column>>
+conditional_full_join_indices(
+  cudf::table_view const& left,
+  cudf::table_view const& right,
+  join_predicate const& predicate,
+  rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
+
 /**
  * @brief  Performs a left semi join on the specified columns of two
  * tables (`left`, `right`)
@@ -325,5 +701,155 @@ std::unique_ptr<cudf::table> left_anti_join(
   std::vector<cudf::size_type> const& return_columns,
   rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource());
 
+/**
+ * @brief Hash join that builds the hash table of a build table once and probes it with any
+ * number of probe tables.
+ *
+ * Joining the same build table against many probe tables with `inner_join`, `left_join` or
+ * `full_join` rebuilds the hash table on every call. This class builds it on construction and
+ * reuses it for every probe. The build table must outlive the `hash_join` object.
+ *
+ * The `*_join_indices` members return row indices rather than joined tables; the first column
+ * indexes rows of the probe table and the second column indexes rows of the build table. Rows
+ * without a match are represented by the index `-1`. Gather the joined columns with
+ * `gather_join_columns`, which turns these indices into nulls. Do not pass the indices of a left
+ * or full join to `cudf::gather`, which reads an index of `-1` as the last row.
+ *
+ * @code{.pseudo}
+ *          Build b: {1, 2, 3}
+ *          Probe a: {0, 1, 2}
+ *          hash_join joiner(build, {0})
+ *          joiner.inner_join_indices(probe, {0}): { {1, 2}, {0, 1} }
+ *          joiner.left_join_indices(probe, {0}): { {0, 1, 2}, {-1, 0, 1} }
+ *          joiner.full_join_indices(probe, {0}): { {0, 1, 2, -1}, {-1, 0, 1, 2} }
+ *          joiner.left_semi_join_indices(probe, {0}): {1, 2}
+ *          joiner.left_anti_join_indices(probe, {0}): {0}
+ * @endcode
+ */
+class hash_join {
+ private:
+  class impl;
+  std::unique_ptr<impl const> _impl;
+
+ public:
+  /**
+   * @brief Builds the hash table of the `build_on` columns of `build`.
+   *
+   * @throws cudf::logic_error if `build` or `build_on` is empty
+   * @throws cudf::logic_error if the number of rows in `build` exceeds MAX_JOIN_SIZE
+   * @throws std::out_of_range if an element of `build_on` exceeds the number of columns in
+   * `build`
+   *
+   * @param build The build table
+   * @param build_on The column indices from `build` to join on
+   */
+  hash_join(cudf::table_view const& build, std::vector<cudf::size_type> const& build_on);
+
+  ~hash_join();
+
+  hash_join(hash_join const&) = delete;
+  hash_join& operator=(hash_join const&) = delete;
+
+  /**
+   * @brief Returns the row indices of an inner join of `probe` with the build table.
+   *
+   * @throws cudf::logic_error if the number of elements in `probe_on` and `build_on` mismatch
+   * @throws cudf::logic_error if the types of the joining columns mismatch
+   *
+   * @param probe The probe table
+   * @param probe_on The column indices from `probe` to join on. The column indicated by
+   * `probe_on[i]` is compared against the column of the build table indicated by `build_on[i]`.
+   * @param options How the output is allocated; the build table is always hashed, so the
+   * algorithm and sorted flag are ignored
+   * @param mr Memory resource used to allocate the returned columns
+   *
+   * @returns Pair of columns of probe and build row indices of the matching rows
+   */
+  std::pair<std::unique_ptr<cudf::column>, std::unique_ptr<cudf::column>> inner_join_indices(
+    cudf::table_view const& probe,
+    std::vector<cudf::size_type> const& probe_on,
+    join_options const& options         = join_options{},
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource()) const;
+
+  /**
+   * @brief Returns the row indices of a left join of `probe` with the build table.
+   *
+   * Every row of `probe` appears at least once; rows without a match have a build index of `-1`.
+   *
+   * @throws cudf::logic_error if the number of elements in `probe_on` and `build_on` mismatch
+   * @throws cudf::logic_error if the types of the joining columns mismatch
+   *
+   * @param probe The probe table
+   * @param probe_on The column indices from `probe` to join on
+   * @param options How the output is allocated; the build table is always hashed, so the
+   * algorithm and sorted flag are ignored
+   * @param mr Memory resource used to allocate the returned columns
+   *
+   * @returns Pair of columns of probe and build row indices
+   */
+  std::pair<std::unique_ptr<cudf::column>, std::unique_ptr<cudf::column>> left_join_indices(
+    cudf::table_view const& probe,
+    std::vector<cudf::size_type> const& probe_on,
+    join_options const& options         = join_options{},
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource()) const;
+
+  /**
+   * @brief Returns the row indices of a full join of `probe` with the build table.
+   *
+   * The left join indices are followed by the build rows that match no probe row, which have a
+   * probe index of `-1`.
+   *
+   * @throws cudf::logic_error if the number of elements in `probe_on` and `build_on` mismatch
+   * @throws cudf::logic_error if the types of the joining columns mismatch
+   *
+   * @param probe The probe table
+   * @param probe_on The column indices from `probe` to join on
+   * @param options How the output is allocated; the build table is always hashed, so the
+   * algorithm and sorted flag are ignored
+   * @param mr Memory resource used to allocate the returned columns
+   *
+   * @returns Pair of columns of probe and build row indices
+   */
+  std::pair<std::unique_ptr<cudf::column>, std::unique_ptr<cudf::column>> full_join_indices(
+    cudf::table_view const& probe,
+    std::vector<cudf::size_type> const& probe_on,
+    join_options const& options         = join_options{},
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource()) const;
+
+  /**
+   * @brief Returns the indices of the rows of `probe` that match a row of the build table.
+   *
+   * @throws cudf::logic_error if the number of elements in `probe_on` and `build_on` mismatch
+   * @throws cudf::logic_error if the types of the joining columns mismatch
+   *
+   * @param probe The probe table
+   * @param probe_on The column indices from `probe` to join on
+   * @param mr Memory resource used to allocate the returned column
+   *
+   * @returns Column of probe row indices in ascending order
+   */
+  std::unique_ptr<cudf::column> left_semi_join_indices(
+    cudf::table_view const& probe,
+    std::vector<cudf::size_type> const& probe_on,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource()) const;
+
+  /**
+   * @brief Returns the indices of the rows of `probe` that match no row of the build table.
+   *
+   * @throws cudf::logic_error if the number of elements in `probe_on` and `build_on` mismatch
+   * @throws cudf::logic_error if the types of the joining columns mismatch
+   *
+   * @param probe The probe table
+   * @param probe_on The column indices from `probe` to join on
+   * @param mr Memory resource used to allocate the returned column
+   *
+   * @returns Column of probe row indices in ascending order
+   */
+  std::unique_ptr<cudf::column> left_anti_join_indices(
+    cudf::table_view const& probe,
+    std::vector<cudf::size_type> const& probe_on,
+    rmm::mr::device_memory_resource* mr = rmm::mr::get_default_resource()) const;
+};
+
 /** @} */  // end of group
 }  // namespace cudf
@@ -30,6 +30,10 @@
 #include <rmm/thrust_rmm_allocator.h>
 #include <rmm/device_buffer.hpp>
 
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
 namespace cudf {
 namespace io {
 namespace detail {
@@ -57,6 +61,21 @@ type_id to_type_id(const avro::schema_entry *col)
   }
 }
 
+/**
+ * @brief Returns whether two files have the same schema, and can be read as one dataset
+ **/
+bool same_schema(file_metadata const &lhs, file_metadata const &rhs)
+{
+  return std::equal(lhs.schema.begin(),
+                    lhs.schema.end(),
+                    rhs.schema.begin(),
+                    rhs.schema.end(),
+                    [](schema_entry const &a, schema_entry const &b) {
+                      return a.kind == b.kind && a.name == b.name && a.parent_idx == b.parent_idx &&
+                             a.num_children == b.num_children && a.symbols == b.symbols;
+                    });
+}
+
 }  // namespace
 
 /**
@@ -134,7 +153,100 @@ class metadata : public file_metadata {
   datasource *const source;
 };
 
-rmm::device_buffer reader::impl::decompress_data(const rmm::device_buffer &comp_block_data,
+std::vector<reader::impl::file_data_range> reader::impl::select_rows(thread_pool &pool,
+                                                                     int &skip_rows,
+                                                                     int &num_rows)
+{
+  if (_sources.size() == 1) {
+    _metadata->init_and_select_rows(skip_rows, num_rows);
+    if (_metadata->block_list.empty()) {
+      _metadata->total_data_size = 0;
+      return {};
+    }
+    return {{_sources[0].get(), _metadata->block_list[0].offset, _metadata->total_data_size}};
+  }
+
+  // Parse the headers and block lists of all the files concurrently
+  std::vector<std::unique_ptr<metadata>> files(_sources.size());
+  parallel_for(
+    pool,
+    files.size(),
+    [] { return 0; },
+    [&](int, size_t i) {
+      int file_skip_rows = 0;
+      int file_num_rows  = -1;
+      files[i]           = std::make_unique<metadata>(_sources[i].get());
+      files[i]->init_and_select_rows(file_skip_rows, file_num_rows);
+    });
+
+  std::vector<file_data_range> ranges;
+  size_t const first_row = std::max(skip_rows, 0);
+  size_t rows_remaining  = (num_rows < 0) ? std::numeric_limits<size_t>::max() : num_rows;
+  size_t rows_before     = 0;
+  size_t selected_rows   = 0;
+  size_t data_offset     = 0;
+  for (size_t i = 0; i < files.size() && rows_remaining > 0; ++i) {
+    auto const file_rows = files[i]->num_rows;
+    rows_before += file_rows;
+    if (rows_before <= first_row) { continue; }
+    auto const file_skip_rows = (first_row > rows_before - file_rows)
+                                  ? first_row - (rows_before - file_rows)
+                                  : size_t{0};
+    auto const file_num_rows = std::min(file_rows - file_skip_rows, rows_remaining);
+    if (file_skip_rows != 0 || file_num_rows != file_rows) {
+      // Parse again to drop the blocks outside of the selected rows
+      int file_skip = static_cast<int>(file_skip_rows);
+      int file_num  = static_cast<int>(file_num_rows);
+      files[i]      = std::make_unique<metadata>(_sources[i].get());
+      files[i]->init_and_select_rows(file_skip, file_num);
+    }
+    rows_remaining -= file_num_rows;
+
+    auto &file        = *files[i];
+    auto const blocks = std::move(file.block_list);
+    file.block_list.clear();
+    if (blocks.empty()) { continue; }
+    auto const base_offset = blocks.front().offset;
+    auto const data_size   = blocks.back().offset + blocks.back().size - base_offset;
+    ranges.push_back({_sources[i].get(), base_offset, data_size});
+
+    if (selected_rows == 0) {
+      // The first file with selected rows holds the merged metadata
+      _metadata                  = std::move(files[i]);
+      _metadata->total_data_size = 0;
+    } else {
+      CUDF_EXPECTS(same_schema(*_metadata, file), "Avro files have mismatched schemas");
+      CUDF_EXPECTS(_metadata->codec == file.codec, "Avro files use different codecs");
+    }
+    // Place the rows after the ones of the previous files, relative to the rows skipped in the
+    // first block of the first file
+    auto const row_offset = (selected_rows == 0) ? 0 : selected_rows + _metadata->skip_rows;
+    for (auto const &block : blocks) {
+      _metadata->block_list.emplace_back(data_offset + block.offset - base_offset,
+                                         block.size,
+                                         static_cast<uint32_t>(block.first_row + row_offset),
+                                         block.num_rows);
+    }
+    _metadata->max_block_size = std::max(_metadata->max_block_size, file.max_block_size);
+    _metadata->total_data_size += data_size;
+    data_offset += data_size;
+    selected_rows += std::min(file.num_rows, file_num_rows);
+  }
+  if (ranges.empty()) {
+    // No rows are selected; return the columns of the first file without data
+    _metadata = std::move(files[0]);
+    _metadata->block_list.clear();
+    _metadata->total_data_size = 0;
+  }
+  _metadata->num_rows = selected_rows;
+
+  skip_rows = _metadata->skip_rows;
+  num_rows  = selected_rows;
+  return ranges;
+}
+
+rmm::device_buffer reader::impl::decompress_data(const uint8_t *h_block_data,
+                                                 const rmm::device_buffer &comp_block_data,
                                                  cudaStream_t stream)
 {
   size_t uncompressed_data_size = 0;
@@ -148,9 +260,9 @@ rmm::device_buffer reader::impl::decompress_data(const rmm::device_buffer &comp_
     for (size_t i = 0; i < inflate_in.size(); ++i) { inflate_in[i].dstSize = initial_blk_len; }
   } else if (_metadata->codec == "snappy") {
     // Extract the uncompressed length from the snappy stream
+    const auto base_offset = _metadata->block_list[0].offset;
     for (size_t i = 0; i < _metadata->block_list.size(); i++) {
-      const auto buffer  = _source->get_buffer(_metadata->block_list[i].offset, 4);
-      const uint8_t *blk = buffer->data();
+      const uint8_t *blk = h_block_data + (_metadata->block_list[i].offset - base_offset);
       uint32_t blk_len   = blk[0];
       if (blk_len > 0x7f) {
         blk_len = (blk_len & 0x7f) | (blk[1] << 7);
@@ -347,13 +459,34 @@ void reader::impl::decode_data(const rmm::device_buffer &block_data,
   }
 }
 
+namespace {
+std::vector<std::unique_ptr<datasource>> single_source(std::unique_ptr<datasource> source)
+{
+  std::vector<std::unique_ptr<datasource>> sources;
+  sources.emplace_back(std::move(source));
+  return sources;
+}
+
+}  // namespace
+
 reader::impl::impl(std::unique_ptr<datasource> source,
                    reader_options const &options,
                    rmm::mr::device_memory_resource *mr)
-  : _source(std::move(source)), _mr(mr), _columns(options.columns)
+  : impl(single_source(std::move(source)), options, mr)
+{
+}
+
+reader::impl::impl(std::vector<std::unique_ptr<datasource>> &&sources,
+                   reader_options const &options,
+                   rmm::mr::device_memory_resource *mr)
+  : _mr(mr),
+    _sources(std::move(sources)),
+    _columns(options.columns),
+    _num_threads(options.num_threads)
 {
+  CUDF_EXPECTS(!_sources.empty(), "No Avro sources to read");
   // Open the source Avro dataset metadata
-  _metadata = std::make_unique<metadata>(_source.get());
+  _metadata = std::make_unique<metadata>(_sources[0].get());
 }
 
 table_with_metadata reader::impl::read(int skip_rows, int num_rows, cudaStream_t stream)
@@ -362,7 +495,8 @@ table_with_metadata reader::impl::read(int skip_rows, int num_rows, cudaStream_t
   table_metadata metadata_out;
 
   // Select and read partial metadata / schema within the subset of rows
-  _metadata->init_and_select_rows(skip_rows, num_rows);
+  thread_pool pool(_num_threads);
+  const auto data_ranges = select_rows(pool, skip_rows, num_rows);
 
   // Select only columns required by the options
   auto selected_columns = _metadata->select_columns(_columns);
@@ -378,12 +512,40 @@ table_with_metadata reader::impl::read(int skip_rows, int num_rows, cudaStream_t
     }
 
     if (_metadata->total_data_size > 0) {
-      const auto buffer =
-        _source->get_buffer(_metadata->block_list[0].offset, _metadata->total_data_size);
-      rmm::device_buffer block_data(buffer->data(), buffer->size(), stream);
+      std::shared_ptr<arrow::Buffer> buffer;
+      std::unique_ptr<uint8_t, decltype(&cudaFreeHost)> staging(nullptr, cudaFreeHost);
+      const uint8_t *h_block_data = nullptr;
+      rmm::device_buffer block_data;
+      if (data_ranges.size() == 1) {
+        const auto &range = data_ranges[0];
+        buffer            = range.source->get_buffer(range.offset, range.size);
+        h_block_data      = buffer->data();
+        block_data        = rmm::device_buffer(buffer->data(), buffer->size(), stream);
+      } else {
+        // Read the files concurrently into pinned memory, and copy all of them at once
+        uint8_t *h_staging = nullptr;
+        CUDA_TRY(cudaMallocHost(&h_staging, _metadata->total_data_size));
+        staging.reset(h_staging);
+        std::vector<size_t> dst_offsets(data_ranges.size() + 1, 0);
+        for (size_t i = 0; i < data_ranges.size(); ++i) {
+          dst_offsets[i + 1] = dst_offsets[i] + data_ranges[i].size;
+        }
+        parallel_for(
+          pool,
+          data_ranges.size(),
+          [] { return 0; },
+          [&](int, size_t i) {
+            const auto &range    = data_ranges[i];
+            const auto file_data = range.source->get_buffer(range.offset, range.size);
+            CUDF_EXPECTS(file_data->size() == range.size, "Cannot read Avro block data");
+            memcpy(h_staging + dst_offsets[i], file_data->data(), range.size);
+          });
+        h_block_data = h_staging;
+        block_data   = rmm::device_buffer(h_staging, _metadata->total_data_size, stream);
+      }
 
       if (_metadata->codec != "" && _metadata->codec != "null") {
-        auto decomp_block_data = decompress_data(block_data, stream);
+        auto decomp_block_data = decompress_data(h_block_data, block_data, stream);
         block_data             = std::move(decomp_block_data);
       } else {
         auto dst_ofs = _metadata->block_list[0].offset;
@@ -488,6 +650,16 @@ reader::reader(std::shared_ptr<arrow::io::RandomAccessFile> file,
 {
 }
 
+// Forward to implementation
+reader::reader(std::vector<std::string> const &filepaths,
+               reader_options const &options,
+               rmm::mr::device_memory_resource *mr)
+{
+  std::vector<std::unique_ptr<datasource>> sources;
+  for (const auto &filepath : filepaths) { sources.emplace_back(datasource::create(filepath)); }
+  _impl = std::make_unique<impl>(std::move(sources), options, mr);
+}
+
 // Destructor within this translation unit
 reader::~reader() = default;
 
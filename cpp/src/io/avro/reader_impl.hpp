@@ -27,6 +27,7 @@
 #include <io/utilities/column_buffer.hpp>
 #include <io/utilities/datasource.hpp>
 #include <io/utilities/hostdevice_vector.hpp>
+#include <io/utilities/thread_pool.hpp>
 
 #include <cudf/io/readers.hpp>
 
@@ -61,6 +62,17 @@ class reader::impl {
                 reader_options const &options,
                 rmm::mr::device_memory_resource *mr);
 
+  /**
+   * @brief Constructor from a set of dataset sources with the same schema.
+   *
+   * @param sources Dataset sources, in row order
+   * @param options Settings for controlling reading behavior
+   * @param mr Resource to use for device memory allocation
+   */
+  explicit impl(std::vector<std::unique_ptr<datasource>> &&sources,
+                reader_options const &options,
+                rmm::mr::device_memory_resource *mr);
+
   /**
    * @brief Read an entire set or a subset of data and returns a set of columns
    *
@@ -73,15 +85,40 @@ class reader::impl {
   table_with_metadata read(int skip_rows, int num_rows, cudaStream_t stream);
 
  private:
+  /**
+   * @brief Location of the selected block data of a file
+   */
+  struct file_data_range {
+    datasource *source;
+    size_t offset;  ///< Offset of the first selected block in the file
+    size_t size;    ///< Size of the selected blocks
+  };
+
+  /**
+   * @brief Parses the metadata of every source and merges the blocks of the selected rows.
+   *
+   * Block offsets of the merged metadata refer to the data of all the files laid out one after
+   * another, without their headers.
+   *
+   * @param pool Pool parsing the files concurrently
+   * @param[in,out] skip_rows Number of rows to skip from the start
+   * @param[in,out] num_rows Number of rows to read; negative for all
+   *
+   * @return Location of the block data of each file whose rows are selected
+   */
+  std::vector<file_data_range> select_rows(thread_pool &pool, int &skip_rows, int &num_rows);
+
   /**
    * @brief Decompresses the block data.
    *
+   * @param h_block_data Compressed block data in host memory
    * @param comp_block_data Compressed block data
    * @param stream Stream to use for memory allocation and kernels
    *
    * @return Device buffer to decompressed block data
    */
-  rmm::device_buffer decompress_data(const rmm::device_buffer &comp_block_data,
+  rmm::device_buffer decompress_data(const uint8_t *h_block_data,
+                                     const rmm::device_buffer &comp_block_data,
                                      cudaStream_t stream);
 
   /**
@@ -105,10 +142,11 @@ class reader::impl {
 
  private:
   rmm::mr::device_memory_resource *_mr = nullptr;
-  std::unique_ptr<datasource> _source;
+  std::vector<std::unique_ptr<datasource>> _sources;
   std::unique_ptr<metadata> _metadata;
 
   std::vector<std::string> _columns;
+  size_t _num_threads = 0;
 };
 
 }  // namespace avro
@@ -0,0 +1,354 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cuda_runtime.h>
+#include <string.h>  // memcpy
+#include "cpu_comp.h"
+#include "gpuinflate.h"
+#include "io_uncomp.h"
+
+#ifdef CUDF_WITH_ZSTD
+#include <zstd.h>
+#endif
+
+#include <io/utilities/thread_pool.hpp>
+
+#include <cudf/utilities/error.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+namespace cudf {
+namespace io {
+/* --------------------------------------------------------------------------*/
+/**
+ * @Brief LZ4 host compressor class
+ *
+ * Greedy single-probe block encoder producing standard LZ4 blocks, optionally wrapped in a single
+ * Hadoop frame (big-endian 32-bit uncompressed and compressed sizes) as Parquet readers expect.
+ */
+/* ----------------------------------------------------------------------------*/
+
+class HostCompressor_LZ4 : public HostCompressor {
+ public:
+  explicit HostCompressor_LZ4(bool hadoop_framing) : hadoop(hadoop_framing) {}
+  size_t Compress(uint8_t* dstBytes, size_t dstLen, const uint8_t* srcBytes, size_t srcLen) override
+  {
+    if (!hadoop) { return CompressBlock(dstBytes, dstLen, srcBytes, srcLen); }
+    if (dstLen < 8 || srcLen > UINT32_MAX) { return 0; }
+    size_t const block_len = CompressBlock(dstBytes + 8, dstLen - 8, srcBytes, srcLen);
+    if (block_len == 0) { return 0; }
+    PutBigEndian32(dstBytes, static_cast<uint32_t>(srcLen));
+    PutBigEndian32(dstBytes + 4, static_cast<uint32_t>(block_len));
+    return block_len + 8;
+  }
+
+ protected:
+  static constexpr int hash_bits         = 12;
+  static constexpr size_t min_match      = 4;
+  static constexpr size_t last_literals  = 5;   // The last 5 bytes are always literals
+  static constexpr size_t match_limit    = 12;  // No match may start in the last 12 bytes
+  static constexpr size_t max_offset     = 65535;
+  static constexpr int skip_acceleration = 6;  // Search step grows after 64 failed probes
+
+  static void PutBigEndian32(uint8_t* dst, uint32_t v)
+  {
+    dst[0] = static_cast<uint8_t>(v >> 24);
+    dst[1] = static_cast<uint8_t>(v >> 16);
+    dst[2] = static_cast<uint8_t>(v >> 8);
+    dst[3] = static_cast<uint8_t>(v);
+  }
+
+  static uint32_t Load32(const uint8_t* p)
+  {
+    uint32_t v;
+    memcpy(&v, p, sizeof(v));
+    return v;
+  }
+
+  static uint8_t* PutLength(uint8_t* dst, size_t len)
+  {
+    for (; len >= 255; len -= 255) { *dst++ = 255; }
+    *dst++ = static_cast<uint8_t>(len);
+    return dst;
+  }
+
+  /**
+   * @Brief Appends a sequence of literals followed by an optional match (match_len = 0 for none),
+   * returning the new output position or nullptr if the output buffer is too small
+   */
+  static uint8_t* PutSequence(uint8_t* dst,
+                              const uint8_t* dst_end,
+                              const uint8_t* literals,
+                              size_t literal_len,
+                              size_t offset,
+                              size_t match_len)
+  {
+    size_t const worst_case = 1 + literal_len / 255 + 1 + literal_len + 2 + match_len / 255 + 1;
+    if (worst_case > static_cast<size_t>(dst_end - dst)) { return nullptr; }
+    size_t const match_code = (match_len != 0) ? match_len - min_match : 0;
+    uint8_t* token          = dst++;
+    *token = static_cast<uint8_t>((std::min<size_t>(literal_len, 15) << 4) |
+                                  std::min<size_t>(match_code, 15));
+    if (literal_len >= 15) { dst = PutLength(dst, literal_len - 15); }
+    if (literal_len != 0) { memcpy(dst, literals, literal_len); }
+    dst += literal_len;
+    if (match_len != 0) {
+      *dst++ = static_cast<uint8_t>(offset);
+      *dst++ = static_cast<uint8_t>(offset >> 8);
+      if (match_code >= 15) { dst = PutLength(dst, match_code - 15); }
+    }
+    return dst;
+  }
+
+  /**
+   * @Brief Encodes a raw LZ4 block, returning the compressed size or zero if it doesn't fit
+   */
+  size_t CompressBlock(uint8_t* dst, size_t dst_len, const uint8_t* src, size_t src_len)
+  {
+    uint8_t* out           = dst;
+    const uint8_t* out_end = dst + dst_len;
+    size_t anchor          = 0;
+    size_t pos             = 0;
+    // Hash table entries are input positions plus one, so that zero marks an empty slot
+    std::fill(std::begin(hash_table), std::end(hash_table), 0);
+    while (pos + match_limit <= src_len) {
+      uint32_t const seq  = Load32(src + pos);
+      uint32_t const hash = (seq * 2654435761u) >> (32 - hash_bits);
+      size_t const ref    = hash_table[hash];
+      hash_table[hash]    = static_cast<uint32_t>(pos + 1);
+      if (ref == 0 || pos + 1 - ref > max_offset || Load32(src + ref - 1) != seq) {
+        pos += 1 + ((pos - anchor) >> skip_acceleration);
+        continue;
+      }
+      size_t const match_pos = ref - 1;
+      size_t const max_len   = src_len - last_literals - pos;
+      size_t match_len       = min_match;
+      while (match_len < max_len && src[match_pos + match_len] == src[pos + match_len]) {
+        match_len++;
+      }
+      out = PutSequence(out, out_end, src + anchor, pos - anchor, pos - match_pos, match_len);
+      if (out == nullptr) { return 0; }
+      pos += match_len;
+      anchor = pos;
+    }
+    out = PutSequence(out, out_end, src + anchor, src_len - anchor, 0, 0);
+    return (out != nullptr) ? out - dst : 0;
+  }
+
+  bool const hadoop;
+  uint32_t hash_table[1 << hash_bits];
+};
+
+#ifdef CUDF_WITH_ZSTD
+/* --------------------------------------------------------------------------*/
+/**
+ * @Brief ZSTD host compressor class
+ */
+/* ----------------------------------------------------------------------------*/
+
+class HostCompressor_ZSTD : public HostCompressor {
+ public:
+  HostCompressor_ZSTD() : cctx(ZSTD_createCCtx()) {}
+  ~HostCompressor_ZSTD() { ZSTD_freeCCtx(cctx); }
+  size_t Compress(uint8_t* dstBytes, size_t dstLen, const uint8_t* srcBytes, size_t srcLen) override
+  {
+    if (cctx == nullptr) { return 0; }
+    size_t const compressed_size =
+      ZSTD_compressCCtx(cctx, dstBytes, dstLen, srcBytes, srcLen, ZSTD_CLEVEL_DEFAULT);
+    return ZSTD_isError(compressed_size) ? 0 : compressed_size;
+  }
+
+ protected:
+  ZSTD_CCtx* const cctx;
+};
+#endif
+
+/* --------------------------------------------------------------------------*/
+/**
+ * @Brief CPU compression factory
+ *
+ * @param stream_type[in] compression method (IO_UNCOMP_STREAM_TYPE_XXX)
+ *
+ * @returns corresponding HostCompressor class, nullptr if failure.
+ */
+/* ----------------------------------------------------------------------------*/
+
+HostCompressor* HostCompressor::Create(int stream_type)
+{
+  HostCompressor* compressor;
+  switch (stream_type) {
+    case IO_UNCOMP_STREAM_TYPE_LZ4: compressor = new HostCompressor_LZ4(false); break;
+    case IO_UNCOMP_STREAM_TYPE_LZ4_HADOOP: compressor = new HostCompressor_LZ4(true); break;
+#ifdef CUDF_WITH_ZSTD
+    case IO_UNCOMP_STREAM_TYPE_ZSTD: compressor = new HostCompressor_ZSTD(); break;
+#endif
+    default: compressor = nullptr; break;
+  }
+  return compressor;
+}
+
+bool is_host_compression_supported(int stream_type)
+{
+  return std::unique_ptr<HostCompressor>(HostCompressor::Create(stream_type)) != nullptr;
+}
+
+bool is_host_decompression_supported(int stream_type)
+{
+  return std::unique_ptr<HostDecompressor>(HostDecompressor::Create(stream_type)) != nullptr;
+}
+
+void host_compress_batch(int stream_type,
+                         const gpu_inflate_input_s* inputs,
+                         gpu_inflate_status_s* outputs,
+                         int count)
+{
+  detail::parallel_for(
+    detail::get_host_worker_pool(),
+    std::max(count, 0),
+    [stream_type]() {
+      return std::unique_ptr<HostCompressor>(HostCompressor::Create(stream_type));
+    },
+    [&](std::unique_ptr<HostCompressor>& compressor, size_t i) {
+      size_t bytes_written = 0;
+      if (compressor != nullptr) {
+        bytes_written = compressor->Compress(static_cast<uint8_t*>(inputs[i].dstDevice),
+                                             inputs[i].dstSize,
+                                             static_cast<const uint8_t*>(inputs[i].srcDevice),
+                                             inputs[i].srcSize);
+      }
+      outputs[i].bytes_written = bytes_written;
+      outputs[i].status        = (bytes_written == 0) ? 1 : 0;
+      outputs[i].reserved      = 0;
+    });
+}
+
+namespace {
+using pinned_buffer = std::unique_ptr<uint8_t, decltype(&cudaFreeHost)>;
+
+pinned_buffer make_pinned_buffer(size_t size)
+{
+  uint8_t* ptr = nullptr;
+  if (size != 0) { CUDA_TRY(cudaMallocHost(&ptr, size)); }
+  return pinned_buffer{ptr, cudaFreeHost};
+}
+
+/**
+ * @brief Runs a host batch codec on chunks in device memory
+ *
+ * Stages the source chunks through pinned host memory, runs `host_batch` on host copies of the
+ * arguments, and copies the successfully processed chunks and all status structures back to the
+ * device. Synchronizes the stream before returning.
+ */
+template <typename HostBatch>
+cudaError_t run_on_host(HostBatch const& host_batch,
+                        gpu_inflate_input_s* inputs,
+                        gpu_inflate_status_s* outputs,
+                        int count,
+                        cudaStream_t stream)
+{
+  if (count <= 0) { return cudaSuccess; }
+  std::vector<gpu_inflate_input_s> args(count);
+  CUDA_TRY(cudaMemcpyAsync(
+    args.data(), inputs, count * sizeof(gpu_inflate_input_s), cudaMemcpyDeviceToHost, stream));
+  CUDA_TRY(cudaStreamSynchronize(stream));
+
+  size_t total_src_size = 0;
+  size_t total_dst_size = 0;
+  for (auto const& arg : args) {
+    total_src_size += arg.srcSize;
+    total_dst_size += arg.dstSize;
+  }
+  auto src_buffer = make_pinned_buffer(total_src_size);
+  auto dst_buffer = make_pinned_buffer(total_dst_size);
+
+  std::vector<gpu_inflate_input_s> host_args(args);
+  size_t src_pos = 0;
+  size_t dst_pos = 0;
+  for (int i = 0; i < count; ++i) {
+    host_args[i].srcDevice = src_buffer.get() + src_pos;
+    host_args[i].dstDevice = dst_buffer.get() + dst_pos;
+    if (args[i].srcSize != 0) {
+      CUDA_TRY(cudaMemcpyAsync(src_buffer.get() + src_pos,
+                               args[i].srcDevice,
+                               args[i].srcSize,
+                               cudaMemcpyDeviceToHost,
+                               stream));
+    }
+    src_pos += args[i].srcSize;
+    dst_pos += args[i].dstSize;
+  }
+  CUDA_TRY(cudaStreamSynchronize(stream));
+
+  std::vector<gpu_inflate_status_s> stats(count);
+  host_batch(host_args.data(), stats.data(), count);
+
+  for (int i = 0; i < count; ++i) {
+    if (stats[i].status == 0 && stats[i].bytes_written != 0) {
+      CUDA_TRY(cudaMemcpyAsync(args[i].dstDevice,
+                               host_args[i].dstDevice,
+                               stats[i].bytes_written,
+                               cudaMemcpyHostToDevice,
+                               stream));
+    }
+  }
+  CUDA_TRY(cudaMemcpyAsync(
+    outputs, stats.data(), count * sizeof(gpu_inflate_status_s), cudaMemcpyHostToDevice, stream));
+  CUDA_TRY(cudaStreamSynchronize(stream));
+  return cudaSuccess;
+}
+
+}  // namespace
+
+cudaError_t cpu_decompress(int stream_type,
+                           gpu_inflate_input_s* inputs,
+                           gpu_inflate_status_s* outputs,
+                           int count,
+                           cudaStream_t stream)
+{
+  CUDF_EXPECTS(is_host_decompression_supported(stream_type),
+               "Decompression codec not available in this build");
+  return run_on_host(
+    [stream_type](gpu_inflate_input_s const* in, gpu_inflate_status_s* out, int n) {
+      host_decompress_batch(stream_type, in, out, n);
+    },
+    inputs,
+    outputs,
+    count,
+    stream);
+}
+
+cudaError_t cpu_compress(int stream_type,
+                         gpu_inflate_input_s* inputs,
+                         gpu_inflate_status_s* outputs,
+                         int count,
+                         cudaStream_t stream)
+{
+  CUDF_EXPECTS(is_host_compression_supported(stream_type),
+               "Compression codec not available in this build");
+  return run_on_host(
+    [stream_type](gpu_inflate_input_s const* in, gpu_inflate_status_s* out, int n) {
+      host_compress_batch(stream_type, in, out, n);
+    },
+    inputs,
+    outputs,
+    count,
+    stream);
+}
+
+}  // namespace io
+}  // namespace cudf
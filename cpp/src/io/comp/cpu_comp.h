@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace cudf {
+namespace io {
+struct gpu_inflate_input_s;
+struct gpu_inflate_status_s;
+
+/**
+ * @brief Compresses a batch of independent chunks on the host
+ *
+ * Host counterpart of `gpu_snap()` for codecs without a GPU encoder, using the same argument
+ * structures but with `srcDevice` and `dstDevice` pointing to host memory. Chunks are compressed in
+ * parallel on a host thread pool. Chunks whose compressed form doesn't fit in `dstSize` bytes, or
+ * whose codec isn't available, have a non-zero status.
+ *
+ * @param[in] stream_type Compression method (IO_UNCOMP_STREAM_TYPE_XXX)
+ * @param[in] inputs List of input argument structures
+ * @param[out] outputs List of output status structures
+ * @param[in] count Number of input/output structures
+ */
+void host_compress_batch(int stream_type,
+                         const gpu_inflate_input_s* inputs,
+                         gpu_inflate_status_s* outputs,
+                         int count);
+
+/**
+ * @brief Returns whether data can be compressed with the given codec in this build
+ *
+ * @param[in] stream_type Compression method (IO_UNCOMP_STREAM_TYPE_XXX)
+ */
+bool is_host_compression_supported(int stream_type);
+
+/**
+ * @brief Returns whether data can be decompressed with the given codec on the host in this build
+ *
+ * @param[in] stream_type Compression method (IO_UNCOMP_STREAM_TYPE_XXX)
+ */
+bool is_host_decompression_supported(int stream_type);
+
+class HostCompressor {
+ public:
+  /**
+   * @brief Compresses a chunk, returning the compressed size or zero if it doesn't fit in dstLen
+   */
+  virtual size_t Compress(uint8_t* dstBytes,
+                          size_t dstLen,
+                          const uint8_t* srcBytes,
+                          size_t srcLen) = 0;
+  virtual ~HostCompressor() {}
+
+ public:
+  static HostCompressor* Create(int stream_type);
+};
+
+}  // namespace io
+}  // namespace cudf
@@ -603,5 +603,54 @@ int32_t cpu_bz2_uncompress(
   return ret;
 }
 
+int32_t cpu_bz2_uncompress_block(const uint8_t *source,
+                                 size_t sourceLen,
+                                 uint64_t *block_start,
+                                 uint8_t *dest,
+                                 size_t *destLen)
+{
+  unbz_state_s s;
+  int ret;
+
+  if (dest == NULL || destLen == NULL || source == NULL || block_start == NULL || sourceLen < 12)
+    return BZ_PARAM_ERROR;
+
+  s.currBlockNo = 0;
+  s.base        = source;
+  s.end         = source + sourceLen - 4;
+  s.cur         = source + (size_t)(*block_start >> 3);
+  s.bitpos      = (uint32_t)(*block_start & 7);
+  if (s.cur + 8 > s.end) return BZ_PARAM_ERROR;
+  s.bitbuf = bswap_64(*(const uint64_t *)s.cur);
+
+  s.out     = dest;
+  s.outend  = dest + *destLen;
+  s.outbase = dest;
+
+  s.save_nblock = 0;
+
+  // The stream header may not be known to the caller, so allow for the largest block size
+  s.blockSize100k = 9;
+  s.tt            = (uint32_t *)malloc(s.blockSize100k * 100000 * sizeof(int32_t));
+  if (s.tt == NULL) return BZ_MEM_ERROR;
+
+  ret = bz2_decompress_block(&s);
+  if (ret == BZ_OK || ret == BZ_STREAM_END) {
+    bzUnRLE(&s);
+    if (s.nblock_used != s.save_nblock + 1) {
+      ret = BZ_DATA_ERROR;
+    } else if (s.out > s.outend) {
+      ret = BZ_OUTBUFF_FULL;
+    }
+  }
+
+  *destLen     = s.out - s.outbase;
+  *block_start = ((s.cur - s.base) << 3) + (s.bitpos);
+
+  free(s.tt);
+
+  return ret;
+}
+
 }  // namespace io
 }  // namespace cudf
@@ -130,6 +130,44 @@ cudaError_t gpu_snap(gpu_inflate_input_s *inputs,
                      int count           = 1,
                      cudaStream_t stream = (cudaStream_t)0);
 
+/**
+ * @brief Interface for decompressing data with a host codec
+ *
+ * Used for codecs without a GPU decoder. Takes the same device argument arrays as `gpu_unsnap()`;
+ * the chunks are staged through pinned host memory and decompressed in parallel on the host, and
+ * the stream is synchronized before returning. Throws if the codec isn't available in this build.
+ *
+ * @param[in] stream_type Compression method (IO_UNCOMP_STREAM_TYPE_XXX)
+ * @param[in] inputs List of input argument structures
+ * @param[out] outputs List of output status structures
+ * @param[in] count Number of input/output structures, default 1
+ * @param[in] stream CUDA stream to use, default 0
+ **/
+cudaError_t cpu_decompress(int stream_type,
+                           gpu_inflate_input_s *inputs,
+                           gpu_inflate_status_s *outputs,
+                           int count           = 1,
+                           cudaStream_t stream = (cudaStream_t)0);
+
+/**
+ * @brief Interface for compressing data with a host codec
+ *
+ * Used for codecs without a GPU encoder. Takes the same device argument arrays as `gpu_snap()`;
+ * chunks whose compressed form doesn't fit in `dstSize` bytes have a non-zero status. The stream is
+ * synchronized before returning. Throws if the codec isn't available in this build.
+ *
+ * @param[in] stream_type Compression method (IO_UNCOMP_STREAM_TYPE_XXX)
+ * @param[in] inputs List of input argument structures
+ * @param[out] outputs List of output status structures
+ * @param[in] count Number of input/output structures, default 1
+ * @param[in] stream CUDA stream to use, default 0
+ **/
+cudaError_t cpu_compress(int stream_type,
+                         gpu_inflate_input_s *inputs,
+                         gpu_inflate_status_s *outputs,
+                         int count           = 1,
+                         cudaStream_t stream = (cudaStream_t)0);
+
 }  // namespace io
 }  // namespace cudf
 
@@ -16,35 +16,75 @@
 
 #pragma once
 
+#include <functional>
 #include <string>
 #include <vector>
 
 namespace cudf {
 namespace io {
 enum {
-  IO_UNCOMP_STREAM_TYPE_INFER   = 0,
-  IO_UNCOMP_STREAM_TYPE_GZIP    = 1,
-  IO_UNCOMP_STREAM_TYPE_ZIP     = 2,
-  IO_UNCOMP_STREAM_TYPE_BZIP2   = 3,
-  IO_UNCOMP_STREAM_TYPE_XZ      = 4,
-  IO_UNCOMP_STREAM_TYPE_INFLATE = 5,
-  IO_UNCOMP_STREAM_TYPE_SNAPPY  = 6,
-  IO_UNCOMP_STREAM_TYPE_BROTLI  = 7,
-  IO_UNCOMP_STREAM_TYPE_LZ4     = 8,
-  IO_UNCOMP_STREAM_TYPE_LZO     = 9,
-  IO_UNCOMP_STREAM_TYPE_ZSTD    = 10,
+  IO_UNCOMP_STREAM_TYPE_INFER      = 0,
+  IO_UNCOMP_STREAM_TYPE_GZIP       = 1,
+  IO_UNCOMP_STREAM_TYPE_ZIP        = 2,
+  IO_UNCOMP_STREAM_TYPE_BZIP2      = 3,
+  IO_UNCOMP_STREAM_TYPE_XZ         = 4,
+  IO_UNCOMP_STREAM_TYPE_INFLATE    = 5,
+  IO_UNCOMP_STREAM_TYPE_SNAPPY     = 6,
+  IO_UNCOMP_STREAM_TYPE_BROTLI     = 7,
+  IO_UNCOMP_STREAM_TYPE_LZ4        = 8,
+  IO_UNCOMP_STREAM_TYPE_LZO        = 9,
+  IO_UNCOMP_STREAM_TYPE_ZSTD       = 10,
+  IO_UNCOMP_STREAM_TYPE_LZ4_HADOOP = 11,  // LZ4 blocks with Hadoop framing (Parquet LZ4 codec)
 };
 
+/**
+ * @brief Consumer of uncompressed data, called once per independently uncompressed segment
+ */
+using uncompressed_segment_consumer = std::function<void(std::vector<char>&& segment)>;
+
+void io_uncompress_segments(const void* src,
+                            size_t src_size,
+                            int strm_type,
+                            bool all_zip_entries,
+                            uncompressed_segment_consumer const& consume);
+
 void io_uncompress_single_h2d(const void* src,
                               size_t src_size,
                               int strm_type,
-                              std::vector<char>& dst);
+                              std::vector<char>& dst,
+                              bool all_zip_entries = false);
 
 void getUncompressedHostData(const char* h_data,
                              size_t num_bytes,
                              const std::string& compression,
                              std::vector<char>& h_uncomp_data);
 
+void getUncompressedHostSegments(const char* h_data,
+                                 size_t num_bytes,
+                                 const std::string& compression,
+                                 uncompressed_segment_consumer const& consume);
+
+struct gpu_inflate_input_s;
+struct gpu_inflate_status_s;
+
+/**
+ * @brief Decompresses a batch of independent chunks on the host
+ *
+ * Host counterpart of `gpuinflate()`, `gpu_unsnap()` and `gpu_debrotli()`, using the same
+ * argument structures but with `srcDevice` and `dstDevice` pointing to host memory. Chunks are
+ * decompressed in parallel on a host thread pool. Chunks that fail to decompress, or whose codec
+ * isn't available on the host, have a non-zero status.
+ *
+ * @param[in] stream_type Compression method (IO_UNCOMP_STREAM_TYPE_XXX)
+ * @param[in] inputs List of input argument structures
+ * @param[out] outputs List of output status structures
+ * @param[in] count Number of input/output structures
+ */
+void host_decompress_batch(int stream_type,
+                           const gpu_inflate_input_s* inputs,
+                           gpu_inflate_status_s* outputs,
+                           int count);
+
 class HostDecompressor {
  public:
   virtual size_t Decompress(uint8_t* dstBytes,
@@ -103,5 +103,12 @@ int32_t cpu_bz2_uncompress(const uint8_t *input,
                            size_t *dstlen,
                            uint64_t *block_start = nullptr);
 
+// Decodes the single block starting at bit offset block_start. On success, returns BZ_OK if the
+// block is followed by another block (whose bit offset is returned in block_start), or
+// BZ_STREAM_END if it is followed by the end-of-stream signature. If BZ_OUTBUFF_FULL is returned,
+// dstlen is updated to the size required to hold the uncompressed block.
+int32_t cpu_bz2_uncompress_block(
+  const uint8_t *input, size_t inlen, uint64_t *block_start, uint8_t *dst, size_t *dstlen);
+
 }  // namespace io
 }  // namespace cudf
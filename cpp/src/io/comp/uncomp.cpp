@@ -18,11 +18,26 @@
 #include <rmm/rmm.h>
 #include <string.h>  // memset
 #include <zlib.h>    // uncompress
+#include "gpuinflate.h"
 #include "io_uncomp.h"
 #include "unbz2.h"  // bz2 uncompress
 
+#ifdef CUDF_WITH_BROTLI
+#include <brotli/decode.h>
+#endif
+#ifdef CUDF_WITH_ZSTD
+#include <zstd.h>
+#endif
+
+#include <io/utilities/thread_pool.hpp>
+
 #include <cudf/utilities/error.hpp>
 
+#include <algorithm>
+#include <deque>
+#include <future>
+#include <memory>
+
 namespace cudf {
 namespace io {
 #define GZ_FLG_FTEXT 0x01     // ASCII text hint
@@ -246,8 +261,12 @@ int cpu_inflate(uint8_t *uncomp_data, size_t *destLen, const uint8_t *comp_data,
  * @param dst[out] Destination vector
  * @param comp_data[in] Raw compressed data
  * @param comp_len[in] Compressed data size
+ * @param consumed[out] If not null, the number of compressed bytes up to the end of the stream
  */
-int cpu_inflate_vector(std::vector<char> &dst, const uint8_t *comp_data, size_t comp_len)
+int cpu_inflate_vector(std::vector<char> &dst,
+                       const uint8_t *comp_data,
+                       size_t comp_len,
+                       size_t *consumed = nullptr)
 {
   int zerr;
   z_stream strm;
@@ -274,32 +293,321 @@ int cpu_inflate_vector(std::vector<char> &dst, const uint8_t *comp_data, size_t
   } while ((zerr == Z_BUF_ERROR || zerr == Z_OK) && strm.avail_out == 0 &&
            strm.total_out == dst.size());
   dst.resize(strm.total_out);
+  if (consumed != nullptr) { *consumed = strm.total_in; }
   inflateEnd(&strm);
   return (zerr == Z_STREAM_END) ? Z_OK : zerr;
 }
 
+namespace {
+/**
+ * @Brief Decompresses independent segments of an input on the host thread pool and passes them to
+ * a consumer in order.
+ *
+ * Only a bounded number of segments is in flight at a time. Each segment is passed on as soon as
+ * it and all preceding segments are complete, so consuming the output overlaps with decompressing
+ * the following segments.
+ *
+ * @param num_segments[in] Number of segments
+ * @param decode[in] Callable decoding the segment at a given index into a vector; returns false
+ * if the segment cannot be decoded independently
+ * @param consume[in] Consumer of the uncompressed segments
+ *
+ * @returns The number of segments passed to `consume`, which stops before the first segment that
+ * cannot be decoded
+ */
+template <typename Decode>
+size_t decompress_segments(size_t num_segments,
+                           Decode const &decode,
+                           uncompressed_segment_consumer const &consume)
+{
+  using decoded_segment = std::pair<bool, std::vector<char>>;
+  auto &pool            = detail::get_host_worker_pool();
+  size_t const window   = 2 * pool.size();
+  std::deque<std::future<decoded_segment>> in_flight;
+  size_t num_consumed = 0;
+  try {
+    for (size_t next = 0; next < num_segments || !in_flight.empty();) {
+      if (next < num_segments && in_flight.size() < window) {
+        in_flight.emplace_back(pool.submit([&decode, next] {
+          decoded_segment segment;
+          segment.first = decode(next, segment.second);
+          return segment;
+        }));
+        ++next;
+      } else {
+        auto task = std::move(in_flight.front());
+        in_flight.pop_front();
+        auto segment = task.get();
+        if (!segment.first) { break; }
+        consume(std::move(segment.second));
+        ++num_consumed;
+      }
+    }
+  } catch (...) {
+    // The remaining tasks reference `decode`, so they must complete before unwinding
+    for (auto &task : in_flight) { task.wait(); }
+    throw;
+  }
+  for (auto &task : in_flight) { task.wait(); }
+  return num_consumed;
+}
+
+/**
+ * @Brief Returns the total size of a BGZF member, or zero if the member isn't one
+ *
+ * BGZF members (as written by bgzip and similar block compressors) record their compressed size
+ * in a "BC" extra subfield, so all members can be located without inflating them.
+ */
+size_t bgzf_member_size(const gz_archive_s &gz)
+{
+  if (!(gz.fhdr->flags & GZ_FLG_FEXTRA)) return 0;
+  for (size_t ofs = 0; ofs + 4 <= gz.xlen;) {
+    size_t const slen = gz.fxtra[ofs + 2] | (gz.fxtra[ofs + 3] << 8);
+    if (gz.fxtra[ofs] == 'B' && gz.fxtra[ofs + 1] == 'C' && slen == 2 && ofs + 6 <= gz.xlen) {
+      return (gz.fxtra[ofs + 4] | (gz.fxtra[ofs + 5] << 8)) + 1;
+    }
+    ofs += 4 + slen;
+  }
+  return 0;
+}
+
+/**
+ * @Brief Uncompresses all members of a gzip file.
+ *
+ * BGZF members are inflated in parallel. Other multi-member files are inflated one member after
+ * another, as the end of a member is only known once it has been inflated.
+ *
+ * @param raw[in] Gzip file data
+ * @param src_size[in] Size of the file, in bytes
+ * @param consume[in] Consumer of the uncompressed members
+ */
+void gz_uncompress_members(const uint8_t *raw,
+                           size_t src_size,
+                           uncompressed_segment_consumer const &consume)
+{
+  struct gz_member_s {
+    const uint8_t *comp_data;
+    size_t comp_len;
+    uint32_t isize;
+  };
+  std::vector<gz_member_s> members;
+  size_t ofs = 0;
+  while (ofs < src_size) {
+    gz_archive_s gz;
+    if (!ParseGZArchive(&gz, raw + ofs, src_size - ofs)) break;
+    size_t const member_size = bgzf_member_size(gz);
+    if (member_size == 0 || ofs + member_size > src_size ||
+        !ParseGZArchive(&gz, raw + ofs, member_size)) {
+      break;
+    }
+    members.push_back({gz.comp_data, gz.comp_len, gz.isize});
+    ofs += member_size;
+  }
+
+  if (members.size() > 1 && ofs == src_size) {
+    decompress_segments(
+      members.size(),
+      [&members](size_t i, std::vector<char> &out) {
+        out.resize(members[i].isize);
+        if (out.empty()) { return true; }
+        size_t out_len = out.size();
+        int zerr       = cpu_inflate(reinterpret_cast<uint8_t *>(out.data()),
+                               &out_len,
+                               members[i].comp_data,
+                               members[i].comp_len);
+        CUDF_EXPECTS(zerr == 0 && out_len == out.size(), "Decompression: error in stream");
+        return true;
+      },
+      consume);
+    return;
+  }
+
+  for (ofs = 0; ofs < src_size;) {
+    gz_archive_s gz;
+    if (!ParseGZArchive(&gz, raw + ofs, src_size - ofs)) {
+      // Ignore trailing data after the last member, as gzip does
+      CUDF_EXPECTS(ofs != 0, "Decompression: error in stream");
+      break;
+    }
+    // The trailer of the last member is the only size hint available
+    std::vector<char> member(gz.isize != 0 ? gz.isize : gz.comp_len * 4 + 4096);
+    size_t consumed = 0;
+    int zerr        = cpu_inflate_vector(member, gz.comp_data, gz.comp_len, &consumed);
+    CUDF_EXPECTS(zerr == 0, "Decompression: error in stream");
+    consume(std::move(member));
+    ofs = (gz.comp_data - raw) + consumed + 8;  // Skip the member's CRC32 and ISIZE
+  }
+}
+
+/**
+ * @Brief Returns the bit offsets of all bzip2 block signatures in the input
+ *
+ * Block signatures are not byte-aligned; the input is scanned in parallel on the host thread pool.
+ */
+std::vector<uint64_t> find_bz2_block_starts(const uint8_t *data, size_t len)
+{
+  constexpr uint64_t block_signature = 0x314159265359ull;
+  constexpr size_t scan_chunk_size   = 4 << 20;
+
+  std::vector<uint64_t> block_starts;
+  if (len < 8) return block_starts;
+  size_t const scan_len = len - 7;
+
+  std::vector<std::future<std::vector<uint64_t>>> tasks;
+  for (size_t begin = 0; begin < scan_len; begin += scan_chunk_size) {
+    tasks.emplace_back(detail::get_host_worker_pool().submit([=] {
+      std::vector<uint64_t> starts;
+      size_t const end = std::min(begin + scan_chunk_size, scan_len);
+      uint64_t window  = 0;
+      for (size_t i = 0; i < 7; i++) { window = (window << 8) | data[begin + i]; }
+      for (size_t pos = begin; pos < end; pos++) {
+        window = (window << 8) | data[pos + 7];
+        for (uint32_t shift = 0; shift < 8; shift++) {
+          if (((window << shift) >> 16) == block_signature) { starts.push_back(pos * 8 + shift); }
+        }
+      }
+      return starts;
+    }));
+  }
+  for (auto &task : tasks) {
+    auto const starts = task.get();
+    block_starts.insert(block_starts.end(), starts.begin(), starts.end());
+  }
+  return block_starts;
+}
+
+/**
+ * @Brief Uncompresses a bzip2 file by decoding its blocks in parallel.
+ *
+ * A block signature can also occur by chance inside compressed data. Such a false match is
+ * detected because the preceding block doesn't end where the match starts. The blocks before it
+ * are still passed on; the caller decodes the rest of the file serially, starting at the block
+ * whose end did not match.
+ *
+ * @param comp_data[in] Bzip2 file data
+ * @param comp_len[in] Size of the file, in bytes
+ * @param consume[in] Consumer of the uncompressed blocks
+ * @param resume_pos[out] Bit offset of the first block left to decode serially; zero to decode the
+ * whole file serially
+ *
+ * @returns true if the whole file was decoded
+ */
+bool bz2_uncompress_blocks(const uint8_t *comp_data,
+                           size_t comp_len,
+                           uncompressed_segment_consumer const &consume,
+                           uint64_t *resume_pos)
+{
+  *resume_pos             = 0;
+  auto const block_starts = find_bz2_block_starts(comp_data, comp_len);
+  if (block_starts.size() < 2) return false;
+
+  auto const num_decoded = decompress_segments(
+    block_starts.size(),
+    [&](size_t i, std::vector<char> &out) {
+      // Most blocks expand to less than 1MB; retry with the reported size otherwise
+      out.resize(1 << 20);
+      uint64_t block_pos = block_starts[i];
+      size_t out_len     = out.size();
+      int bz_err         = cpu_bz2_uncompress_block(
+        comp_data, comp_len, &block_pos, reinterpret_cast<uint8_t *>(out.data()), &out_len);
+      if (bz_err == BZ_OUTBUFF_FULL) {
+        out.resize(out_len);
+        block_pos = block_starts[i];
+        bz_err    = cpu_bz2_uncompress_block(
+          comp_data, comp_len, &block_pos, reinterpret_cast<uint8_t *>(out.data()), &out_len);
+      }
+      out.resize(out_len);
+      return (bz_err == BZ_STREAM_END) ||
+             (bz_err == BZ_OK && i + 1 < block_starts.size() && block_pos == block_starts[i + 1]);
+    },
+    consume);
+  if (num_decoded == block_starts.size()) { return true; }
+  // All blocks before the first mismatch ended where a genuine block starts
+  if (num_decoded != 0) { *resume_pos = block_starts[num_decoded]; }
+  return false;
+}
+
+/**
+ * @Brief Uncompresses a bzip2 file one block after another
+ *
+ * @param comp_data[in] Bzip2 file data
+ * @param comp_len[in] Size of the file, in bytes
+ * @param block_start[in] Bit offset of the first block to decode; zero for the start of the file
+ * @param consume[in] Consumer of the uncompressed data
+ */
+void bz2_uncompress_serial(const uint8_t *comp_data,
+                           size_t comp_len,
+                           uint64_t block_start,
+                           uncompressed_segment_consumer const &consume)
+{
+  // In case uncompressed size isn't known in advance, assume ~4:1 compression for initial size
+  size_t uncomp_len = comp_len * 4 + 4096;
+  size_t src_ofs    = block_start;
+  size_t dst_ofs    = 0;
+  int bz_err        = 0;
+  std::vector<char> dst(uncomp_len);
+  do {
+    size_t dst_len = uncomp_len - dst_ofs;
+    bz_err         = cpu_bz2_uncompress(
+      comp_data, comp_len, ((uint8_t *)dst.data()) + dst_ofs, &dst_len, &src_ofs);
+    if (bz_err == BZ_OUTBUFF_FULL) {
+      // TBD: We could infer the compression ratio based on produced/consumed byte counts
+      // in order to minimize realloc events and over-allocation
+      dst_ofs = dst_len;
+      dst_len = uncomp_len + (uncomp_len / 2);
+      dst.resize(dst_len);
+      uncomp_len = dst_len;
+    } else if (bz_err == 0) {
+      uncomp_len = dst_len;
+      dst.resize(uncomp_len);
+    }
+  } while (bz_err == BZ_OUTBUFF_FULL);
+  CUDF_EXPECTS(bz_err == 0, "Decompression: error in stream");
+  consume(std::move(dst));
+}
+
+/**
+ * @Brief Returns whether a zip entry holds file data, as opposed to a directory or to the
+ * resource fork that macOS archivers store under "__MACOSX/"
+ */
+bool is_zip_file_entry(const zip_cdfh_s *cdfh)
+{
+  const char *fname        = reinterpret_cast<const char *>(cdfh + 1);
+  constexpr char macosx[]  = "__MACOSX/";
+  size_t const macosx_len  = sizeof(macosx) - 1;
+  bool const is_directory  = cdfh->fname_len != 0 && fname[cdfh->fname_len - 1] == '/';
+  bool const is_macos_fork = cdfh->fname_len >= macosx_len && !memcmp(fname, macosx, macosx_len);
+  return !is_directory && !is_macos_fork;
+}
+
+}  // namespace
+
 /* --------------------------------------------------------------------------*/
 /**
- * @Brief Uncompresses a gzip/zip/bzip2/xz file stored in system memory.
- * The result is allocated and stored in a vector.
- * If the function call fails, the output vector is empty.
+ * @Brief Uncompresses a gzip/zip/bzip2/xz file stored in system memory, passing the output to a
+ * consumer in segments.
+ *
+ * Only the first file entry of a zip archive is uncompressed unless `all_zip_entries` is set.
  *
  * @param src[in] Pointer to the compressed data in system memory
  * @param src_size[in] The size of the compressed data, in bytes
  * @param strm_type[in] Type of compression of the input data
- * @param dst[out] Vector containing the uncompressed output
+ * @param all_zip_entries[in] Whether to uncompress all the file entries of a zip archive,
+ * concatenated in directory order
+ * @param consume[in] Consumer of the uncompressed segments, called in order
  */
 /* ----------------------------------------------------------------------------*/
-void io_uncompress_single_h2d(const void *src,
-                              size_t src_size,
-                              int strm_type,
-                              std::vector<char> &dst)
+void io_uncompress_segments(const void *src,
+                            size_t src_size,
+                            int strm_type,
+                            bool all_zip_entries,
+                            uncompressed_segment_consumer const &consume)
 {
   const uint8_t *raw       = (const uint8_t *)src;
   const uint8_t *comp_data = nullptr;
   size_t comp_len          = 0;
   size_t uncomp_len        = 0;
-  cudaStream_t strm        = (cudaStream_t)0;
+  std::vector<const zip_lfh_s *> zip_entries;
 
   CUDF_EXPECTS(src != nullptr, "Decompression: Source cannot be nullptr");
   CUDF_EXPECTS(src_size != 0, "Decompression: Source size cannot be 0");
@@ -328,7 +636,8 @@ void io_uncompress_single_h2d(const void *src,
             break;
           }
           // For now, only accept with non-zero file sizes and DEFLATE
-          if (cdfh->comp_method == 8 && cdfh->comp_size > 0 && cdfh->uncomp_size > 0) {
+          if (cdfh->comp_method == 8 && cdfh->comp_size > 0 && cdfh->uncomp_size > 0 &&
+              is_zip_file_entry(cdfh)) {
             size_t lfh_ofs       = cdfh->hdr_ofs;
             const zip_lfh_s *lfh = (const zip_lfh_s *)(raw + lfh_ofs);
             if (lfh_ofs + sizeof(zip_lfh_s) <= src_size && lfh->sig == 0x04034b50 &&
@@ -337,16 +646,19 @@ void io_uncompress_single_h2d(const void *src,
                 size_t file_start = lfh_ofs + sizeof(zip_lfh_s) + lfh->fname_len + lfh->extra_len;
                 size_t file_end   = file_start + lfh->comp_size;
                 if (file_end <= src_size) {
-                  // Pick the first valid file of non-zero size (only 1 file expected in archive)
-                  strm_type  = IO_UNCOMP_STREAM_TYPE_ZIP;
-                  comp_data  = raw + file_start;
-                  comp_len   = lfh->comp_size;
-                  uncomp_len = lfh->uncomp_size;
-                  break;
+                  if (zip_entries.empty()) {
+                    strm_type  = IO_UNCOMP_STREAM_TYPE_ZIP;
+                    comp_data  = raw + file_start;
+                    comp_len   = lfh->comp_size;
+                    uncomp_len = lfh->uncomp_size;
+                  }
+                  zip_entries.push_back(lfh);
                 }
               }
             }
           }
+          // Other entries are only read when requested, as they are often unrelated files
+          if (!all_zip_entries && !zip_entries.empty()) { break; }
           cdfh_ofs += cdfh_len;
         }
       }
@@ -372,49 +684,87 @@ void io_uncompress_single_h2d(const void *src,
   CUDF_EXPECTS(comp_data != nullptr, "Unsupported compressed stream type");
   CUDF_EXPECTS(comp_len > 0, "Unsupported compressed stream type");
 
-  if (uncomp_len <= 0) {
-    uncomp_len = comp_len * 4 + 4096;  // In case uncompressed size isn't known in advance, assume
-                                       // ~4:1 compression for initial size
-  }
-
-  if (strm_type == IO_UNCOMP_STREAM_TYPE_GZIP || strm_type == IO_UNCOMP_STREAM_TYPE_ZIP) {
+  if (strm_type == IO_UNCOMP_STREAM_TYPE_GZIP) {
+    gz_uncompress_members(raw, src_size, consume);
+  } else if (strm_type == IO_UNCOMP_STREAM_TYPE_ZIP && zip_entries.size() > 1) {
+    decompress_segments(
+      zip_entries.size(),
+      [&zip_entries](size_t i, std::vector<char> &out) {
+        const zip_lfh_s *lfh = zip_entries[i];
+        out.resize(lfh->uncomp_size);
+        int zerr = cpu_inflate_vector(out,
+                                      reinterpret_cast<const uint8_t *>(lfh + 1) +
+                                        lfh->fname_len + lfh->extra_len,
+                                      lfh->comp_size);
+        CUDF_EXPECTS(zerr == 0, "Decompression: error in stream");
+        return true;
+      },
+      consume);
+  } else if (strm_type == IO_UNCOMP_STREAM_TYPE_ZIP) {
     // INFLATE
-    dst.resize(uncomp_len);
+    std::vector<char> dst(uncomp_len);
     int zerr = cpu_inflate_vector(dst, comp_data, comp_len);
-    if (zerr != 0) {
-      dst.resize(0);
-      CUDF_EXPECTS(0, "Decompression: error in stream");
-    }
+    CUDF_EXPECTS(zerr == 0, "Decompression: error in stream");
+    consume(std::move(dst));
   } else if (strm_type == IO_UNCOMP_STREAM_TYPE_BZIP2) {
-    size_t src_ofs = 0;
-    size_t dst_ofs = 0;
-    int bz_err     = 0;
-    dst.resize(uncomp_len);
-    do {
-      size_t dst_len = uncomp_len - dst_ofs;
-      bz_err         = cpu_bz2_uncompress(
-        comp_data, comp_len, ((uint8_t *)dst.data()) + dst_ofs, &dst_len, &src_ofs);
-      if (bz_err == BZ_OUTBUFF_FULL) {
-        // TBD: We could infer the compression ratio based on produced/consumed byte counts
-        // in order to minimize realloc events and over-allocation
-        dst_ofs = dst_len;
-        dst_len = uncomp_len + (uncomp_len / 2);
-        dst.resize(dst_len);
-        uncomp_len = dst_len;
-      } else if (bz_err == 0) {
-        uncomp_len = dst_len;
-        dst.resize(uncomp_len);
-      }
-    } while (bz_err == BZ_OUTBUFF_FULL);
-    if (bz_err != 0) {
-      dst.resize(0);
-      CUDF_EXPECTS(0, "Decompression: error in stream");
+    uint64_t resume_pos = 0;
+    if (!bz2_uncompress_blocks(comp_data, comp_len, consume, &resume_pos)) {
+      bz2_uncompress_serial(comp_data, comp_len, resume_pos, consume);
     }
   } else {
     CUDF_EXPECTS(0, "Unsupported compressed stream type");
   }
 }
 
+/* --------------------------------------------------------------------------*/
+/**
+ * @Brief Uncompresses a gzip/zip/bzip2/xz file stored in system memory.
+ * The result is allocated and stored in a vector.
+ * If the function call fails, the output vector is empty.
+ *
+ * @param src[in] Pointer to the compressed data in system memory
+ * @param src_size[in] The size of the compressed data, in bytes
+ * @param strm_type[in] Type of compression of the input data
+ * @param dst[out] Vector containing the uncompressed output
+ * @param all_zip_entries[in] Whether to uncompress all the file entries of a zip archive
+ */
+/* ----------------------------------------------------------------------------*/
+void io_uncompress_single_h2d(const void *src,
+                              size_t src_size,
+                              int strm_type,
+                              std::vector<char> &dst,
+                              bool all_zip_entries)
+{
+  dst.clear();
+  try {
+    io_uncompress_segments(
+      src, src_size, strm_type, all_zip_entries, [&dst](std::vector<char> &&segment) {
+        if (dst.empty()) {
+          dst.swap(segment);
+        } else {
+          dst.insert(dst.end(), segment.begin(), segment.end());
+        }
+      });
+  } catch (...) {
+    dst.clear();
+    throw;
+  }
+}
+
+namespace {
+/**
+ * @brief Returns the stream type matching a compression string, inferring it by default
+ */
+int compression_stream_type(std::string const &compression)
+{
+  if (compression == "gzip") return IO_UNCOMP_STREAM_TYPE_GZIP;
+  if (compression == "zip") return IO_UNCOMP_STREAM_TYPE_ZIP;
+  if (compression == "bz2") return IO_UNCOMP_STREAM_TYPE_BZIP2;
+  if (compression == "xz") return IO_UNCOMP_STREAM_TYPE_XZ;
+  return IO_UNCOMP_STREAM_TYPE_INFER;
+}
+}  // namespace
+
 /**
  * @brief Uncompresses the input data and stores the allocated result into
  * a vector.
@@ -429,17 +779,24 @@ void getUncompressedHostData(const char *h_data,
                              const std::string &compression,
                              std::vector<char> &h_uncomp_data)
 {
-  int comp_type = IO_UNCOMP_STREAM_TYPE_INFER;
-  if (compression == "gzip")
-    comp_type = IO_UNCOMP_STREAM_TYPE_GZIP;
-  else if (compression == "zip")
-    comp_type = IO_UNCOMP_STREAM_TYPE_ZIP;
-  else if (compression == "bz2")
-    comp_type = IO_UNCOMP_STREAM_TYPE_BZIP2;
-  else if (compression == "xz")
-    comp_type = IO_UNCOMP_STREAM_TYPE_XZ;
-
-  io_uncompress_single_h2d(h_data, num_bytes, comp_type, h_uncomp_data);
+  io_uncompress_single_h2d(h_data, num_bytes, compression_stream_type(compression), h_uncomp_data);
+}
+
+/**
+ * @brief Uncompresses the input data and passes the result to a consumer in segments, so that the
+ * whole uncompressed data never needs to be held in host memory at once.
+ *
+ * @param[in] h_data Pointer to the csv data in host memory
+ * @param[in] num_bytes Size of the input data, in bytes
+ * @param[in] compression String describing the compression type
+ * @param[in] consume Consumer of the uncompressed segments, called in order
+ **/
+void getUncompressedHostSegments(const char *h_data,
+                                 size_t num_bytes,
+                                 const std::string &compression,
+                                 uncompressed_segment_consumer const &consume)
+{
+  io_uncompress_segments(h_data, num_bytes, compression_stream_type(compression), false, consume);
 }
 
 /* --------------------------------------------------------------------------*/
@@ -570,6 +927,156 @@ class HostDecompressor_SNAPPY : public HostDecompressor {
   }
 };
 
+/* --------------------------------------------------------------------------*/
+/**
+ * @Brief LZ4 host decompressor class
+ *
+ * Accepts both raw LZ4 blocks (as used by ORC) and LZ4 blocks with Hadoop framing (as written by
+ * most Parquet implementations for the LZ4 codec). Hadoop framing is tried first, and the data is
+ * decoded as a raw block if it isn't consistent with that framing.
+ */
+/* ----------------------------------------------------------------------------*/
+
+class HostDecompressor_LZ4 : public HostDecompressor {
+ public:
+  HostDecompressor_LZ4() {}
+  size_t Decompress(uint8_t *dstBytes,
+                    size_t dstLen,
+                    const uint8_t *srcBytes,
+                    size_t srcLen) override
+  {
+    if (!dstBytes || srcLen < 1) { return 0; }
+    size_t decoded_size = DecompressHadoop(dstBytes, dstLen, srcBytes, srcLen);
+    return (decoded_size != 0) ? decoded_size : DecompressBlock(dstBytes, dstLen, srcBytes, srcLen);
+  }
+
+ protected:
+  /**
+   * @Brief Decodes a sequence of Hadoop frames: a big-endian 32-bit uncompressed size and
+   * compressed size, followed by a raw LZ4 block
+   */
+  static size_t DecompressHadoop(uint8_t *dst, size_t dst_len, const uint8_t *src, size_t src_len)
+  {
+    size_t dst_pos = 0;
+    while (src_len >= 8) {
+      uint32_t frame_uncomp_len = (src[0] << 24) | (src[1] << 16) | (src[2] << 8) | src[3];
+      uint32_t frame_comp_len   = (src[4] << 24) | (src[5] << 16) | (src[6] << 8) | src[7];
+      src += 8;
+      src_len -= 8;
+      if (frame_comp_len > src_len || frame_uncomp_len > dst_len - dst_pos) { return 0; }
+      if (DecompressBlock(dst + dst_pos, frame_uncomp_len, src, frame_comp_len) !=
+          frame_uncomp_len) {
+        return 0;
+      }
+      dst_pos += frame_uncomp_len;
+      src += frame_comp_len;
+      src_len -= frame_comp_len;
+    }
+    return (src_len == 0) ? dst_pos : 0;
+  }
+
+  /**
+   * @Brief Decodes a raw LZ4 block, returning the decoded size or zero on error
+   */
+  static size_t DecompressBlock(uint8_t *dst, size_t dst_len, const uint8_t *src, size_t src_len)
+  {
+    const uint8_t *cur = src;
+    const uint8_t *end = src + src_len;
+    size_t dst_pos     = 0;
+    while (cur < end) {
+      uint32_t token     = *cur++;
+      size_t literal_len = token >> 4;
+      if (literal_len == 15) {
+        uint32_t c;
+        do {
+          if (cur >= end) return 0;
+          c = *cur++;
+          literal_len += c;
+        } while (c == 255);
+      }
+      if (literal_len > (size_t)(end - cur) || literal_len > dst_len - dst_pos) return 0;
+      memcpy(dst + dst_pos, cur, literal_len);
+      cur += literal_len;
+      dst_pos += literal_len;
+      if (cur == end) break;  // The last sequence has no match
+      if (end - cur < 2) return 0;
+      size_t offset = cur[0] | (cur[1] << 8);
+      cur += 2;
+      if (offset == 0 || offset > dst_pos) return 0;
+      size_t match_len = (token & 0xf) + 4;
+      if ((token & 0xf) == 15) {
+        uint32_t c;
+        do {
+          if (cur >= end) return 0;
+          c = *cur++;
+          match_len += c;
+        } while (c == 255);
+      }
+      if (match_len > dst_len - dst_pos) return 0;
+      if (offset >= match_len) {
+        memcpy(dst + dst_pos, dst + dst_pos - offset, match_len);
+        dst_pos += match_len;
+      } else {
+        // Overlapping copy repeats the last `offset` bytes
+        for (size_t i = 0; i < match_len; i++, dst_pos++) { dst[dst_pos] = dst[dst_pos - offset]; }
+      }
+    }
+    return dst_pos;
+  }
+};
+
+#ifdef CUDF_WITH_ZSTD
+/* --------------------------------------------------------------------------*/
+/**
+ * @Brief ZSTD host decompressor class
+ */
+/* ----------------------------------------------------------------------------*/
+
+class HostDecompressor_ZSTD : public HostDecompressor {
+ public:
+  HostDecompressor_ZSTD() : dctx(ZSTD_createDCtx()) {}
+  ~HostDecompressor_ZSTD() { ZSTD_freeDCtx(dctx); }
+  size_t Decompress(uint8_t *dstBytes,
+                    size_t dstLen,
+                    const uint8_t *srcBytes,
+                    size_t srcLen) override
+  {
+    if (dctx == nullptr) { return 0; }
+    size_t decoded_size = ZSTD_decompressDCtx(dctx, dstBytes, dstLen, srcBytes, srcLen);
+    return ZSTD_isError(decoded_size) ? 0 : decoded_size;
+  }
+
+ protected:
+  ZSTD_DCtx *const dctx;
+};
+#endif
+
+#ifdef CUDF_WITH_BROTLI
+/* --------------------------------------------------------------------------*/
+/**
+ * @Brief BROTLI host decompressor class
+ */
+/* ----------------------------------------------------------------------------*/
+
+class HostDecompressor_BROTLI : public HostDecompressor {
+ public:
+  HostDecompressor_BROTLI() {}
+  size_t Decompress(uint8_t *dstBytes,
+                    size_t dstLen,
+                    const uint8_t *srcBytes,
+                    size_t srcLen) override
+  {
+    size_t decoded_size = dstLen;
+    if (BrotliDecoderDecompress(srcLen, srcBytes, &decoded_size, dstBytes) ==
+        BROTLI_DECODER_RESULT_SUCCESS) {
+      return decoded_size;
+    } else {
+      return 0;
+    }
+  }
+};
+#endif
+
 /* --------------------------------------------------------------------------*/
 /**
  * @Brief CPU decompression class
@@ -587,10 +1094,43 @@ HostDecompressor *HostDecompressor::Create(int stream_type)
     case IO_UNCOMP_STREAM_TYPE_GZIP: decompressor = new HostDecompressor_ZLIB(true); break;
     case IO_UNCOMP_STREAM_TYPE_INFLATE: decompressor = new HostDecompressor_ZLIB(false); break;
     case IO_UNCOMP_STREAM_TYPE_SNAPPY: decompressor = new HostDecompressor_SNAPPY(); break;
+    case IO_UNCOMP_STREAM_TYPE_LZ4:
+    case IO_UNCOMP_STREAM_TYPE_LZ4_HADOOP: decompressor = new HostDecompressor_LZ4(); break;
+#ifdef CUDF_WITH_BROTLI
+    case IO_UNCOMP_STREAM_TYPE_BROTLI: decompressor = new HostDecompressor_BROTLI(); break;
+#endif
+#ifdef CUDF_WITH_ZSTD
+    case IO_UNCOMP_STREAM_TYPE_ZSTD: decompressor = new HostDecompressor_ZSTD(); break;
+#endif
     default: decompressor = nullptr; break;
   }
   return decompressor;
 }
 
+void host_decompress_batch(int stream_type,
+                           const gpu_inflate_input_s *inputs,
+                           gpu_inflate_status_s *outputs,
+                           int count)
+{
+  detail::parallel_for(
+    detail::get_host_worker_pool(),
+    std::max(count, 0),
+    [stream_type]() {
+      return std::unique_ptr<HostDecompressor>(HostDecompressor::Create(stream_type));
+    },
+    [&](std::unique_ptr<HostDecompressor> &decompressor, size_t i) {
+      size_t bytes_written = 0;
+      if (decompressor != nullptr) {
+        bytes_written = decompressor->Decompress(static_cast<uint8_t *>(inputs[i].dstDevice),
+                                                 inputs[i].dstSize,
+                                                 static_cast<const uint8_t *>(inputs[i].srcDevice),
+                                                 inputs[i].srcSize);
+      }
+      outputs[i].bytes_written = bytes_written;
+      outputs[i].status        = (bytes_written == 0 && inputs[i].dstSize != 0) ? 1 : 0;
+      outputs[i].reserved      = 0;
+    });
+}
+
 }  // namespace io
 }  // namespace cudf
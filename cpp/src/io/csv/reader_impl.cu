@@ -20,13 +20,17 @@
  **/
 
 #include "reader_impl.hpp"
+#include "row_boundaries.hpp"
 
 #include <algorithm>
+#include <future>
 #include <iostream>
 #include <numeric>
+#include <set>
 #include <tuple>
 #include <unordered_map>
 
+#include <cudf/detail/concatenate.cuh>
 #include <cudf/strings/replace.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/utilities/error.hpp>
@@ -213,18 +217,20 @@ table_with_metadata reader::impl::read(size_t range_offset,
     auto data_size = (map_range_size != 0) ? map_range_size : source_->size();
     auto buffer    = source_->get_buffer(range_offset, data_size);
 
-    std::vector<char> h_uncomp_data_owner;
     if (compression_type_ == "none") {
-      // Do not use the owner vector here to avoid extra copy
       h_uncomp_data = reinterpret_cast<const char *>(buffer->data());
       h_uncomp_size = buffer->size();
     } else {
-      getUncompressedHostData(reinterpret_cast<const char *>(buffer->data()),
-                              buffer->size(),
-                              compression_type_,
-                              h_uncomp_data_owner);
-      h_uncomp_data = h_uncomp_data_owner.data();
-      h_uncomp_size = h_uncomp_data_owner.size();
+      // Copy each segment to the GPU as soon as it is uncompressed, instead of holding the whole
+      // uncompressed data in host memory; `gather_row_offsets` then works on `data_` directly
+      data_.resize(0);
+      getUncompressedHostSegments(reinterpret_cast<const char *>(buffer->data()),
+                                  buffer->size(),
+                                  compression_type_,
+                                  [this](std::vector<char> &&segment) {
+                                    data_.insert(data_.end(), segment.begin(), segment.end());
+                                  });
+      h_uncomp_size = data_.size();
     }
     // None of the parameters for row selection is used, we are parsing the entire file
     const bool load_whole_file = range_offset == 0 && range_size == 0 && skip_rows <= 0 &&
@@ -385,6 +391,105 @@ table_with_metadata reader::impl::read(size_t range_offset,
   return {std::make_unique<table>(std::move(out_columns)), std::move(metadata)};
 }
 
+table_with_metadata reader::impl::read_split(size_type num_ranges, cudaStream_t stream)
+{
+  if (source_ == nullptr) {
+    assert(!filepath_.empty());
+    source_ = datasource::create(filepath_);
+  }
+  // Rows ahead of a non-leading header would have to be counted before splitting
+  if (num_ranges <= 1 || compression_type_ != "none" || args_.header > 0 || source_->empty()) {
+    return read(0, 0, 0, 0, -1, stream);
+  }
+
+  auto const buffer = source_->get_buffer(0, source_->size());
+  auto const h_data = reinterpret_cast<const char *>(buffer->data());
+  auto const h_size = buffer->size();
+
+  std::vector<size_t> positions;
+  for (size_type i = 1; i < num_ranges; ++i) { positions.push_back(h_size * i / num_ranges); }
+  auto const to_int = [](char c, bool enabled) {
+    return enabled ? static_cast<int>(static_cast<unsigned char>(c)) : 0x100;
+  };
+  row_parse_chars const chars{to_int(opts.terminator, true),
+                              to_int(opts.delimiter, true),
+                              to_int(opts.quotechar, opts.quotechar != '\0'),
+                              to_int(opts.comment, opts.comment != '\0')};
+  auto splits = find_row_starts(h_data, h_size, positions, chars, get_host_worker_pool());
+  // Keep distinct splits with at least one row on either side
+  splits.erase(std::remove_if(splits.begin(),
+                              splits.end(),
+                              [h_size](size_t pos) { return pos == 0 || pos >= h_size; }),
+               splits.end());
+  splits.erase(std::unique(splits.begin(), splits.end()), splits.end());
+  if (splits.empty()) { return read(0, 0, 0, 0, -1, stream); }
+
+  // Every range starts right after the terminator of the previous row, so the byte range offset
+  // points at that terminator; the range then ends at the terminator preceding the next split
+  reader_options range_options = args_;
+  range_options.compression    = compression_type::NONE;
+  std::vector<table_with_metadata> results;
+  impl first_range(datasource::create(h_data, h_size), "", range_options, mr_);
+  results.emplace_back(first_range.read(0, splits.front() - 1, 0, 0, -1, stream));
+
+  // Later ranges have no header, so they reuse the names resolved from the first one
+  auto const &names = first_range.col_names;
+  if (std::set<std::string>(names.begin(), names.end()).size() != names.size()) {
+    return read(0, 0, 0, 0, -1, stream);
+  }
+  range_options.header = -1;
+  range_options.names  = names;
+
+  // Later ranges also use the column types inferred from the first one, except for the columns
+  // that only hold nulls there, whose types each range infers
+  std::vector<data_type> range_types;
+  if (args_.dtype.empty()) {
+    for (auto const &col : results.front().tbl->view()) {
+      range_types.push_back((col.null_count() == col.size()) ? data_type{EMPTY} : col.type());
+    }
+  }
+
+  // Every later range is parsed by a host worker on its own stream, so the ranges are parsed
+  // concurrently
+  int device_id = 0;
+  CUDA_TRY(cudaGetDevice(&device_id));
+  std::vector<cudaStream_t> range_streams(splits.size());
+  for (auto &range_stream : range_streams) { CUDA_TRY(cudaStreamCreate(&range_stream)); }
+  results.resize(splits.size() + 1);
+  std::vector<std::future<void>> tasks;
+  for (size_t i = 0; i < splits.size(); ++i) {
+    tasks.emplace_back(get_host_worker_pool().submit([&, i]() {
+      CUDA_TRY(cudaSetDevice(device_id));
+      auto const offset = splits[i] - 1;
+      auto const size   = (i + 1 < splits.size()) ? splits[i + 1] - splits[i] : 0;
+      impl range(datasource::create(h_data, h_size), "", range_options, mr_);
+      range.inferred_types = range_types;
+      results[i + 1]       = range.read(offset, size, 0, 0, -1, range_streams[i]);
+      CUDA_TRY(cudaStreamSynchronize(range_streams[i]));
+    }));
+  }
+  // Every task references local state, so wait for all of them before surfacing any error
+  for (auto &task : tasks) { task.wait(); }
+  for (auto &range_stream : range_streams) { cudaStreamDestroy(range_stream); }
+  for (auto &task : tasks) { task.get(); }
+
+  // Ranges that inferred different types for columns that only held nulls in the first range
+  // would not match a single read of the whole data
+  std::vector<table_view> views;
+  for (auto const &result : results) {
+    auto const view = result.tbl->view();
+    auto const ref  = results.front().tbl->view();
+    if (view.num_columns() != ref.num_columns() ||
+        !std::equal(view.begin(), view.end(), ref.begin(), [](auto const &a, auto const &b) {
+          return a.type() == b.type();
+        })) {
+      return read(0, 0, 0, 0, -1, stream);
+    }
+    views.push_back(view);
+  }
+  return {cudf::detail::concatenate(views, mr_, stream), std::move(results.front().metadata)};
+}
+
 size_t reader::impl::find_first_row_start(const char *h_data, size_t h_size)
 {
   // For now, look for the first terminator (assume the first terminator isn't within a quote)
@@ -416,14 +521,18 @@ void reader::impl::gather_row_offsets(const char *h_data,
   // For compatibility with the previous parser, a row is considered in-range if the
   // previous row terminator is within the given range
   range_end += (range_end < h_size);
-  data_.resize(0);
   row_offsets.resize(0);
-  data_.reserve((load_whole_file) ? h_size : std::min(buffer_size * 2, h_size));
+  if (h_data != nullptr) {
+    data_.resize(0);
+    data_.reserve((load_whole_file) ? h_size : std::min(buffer_size * 2, h_size));
+  }
   do {
     size_t target_pos = std::min(pos + max_chunk_bytes, h_size);
     size_t chunk_size = target_pos - pos;
 
-    data_.insert(data_.end(), h_data + buffer_pos + data_.size(), h_data + target_pos);
+    if (h_data != nullptr) {
+      data_.insert(data_.end(), h_data + buffer_pos + data_.size(), h_data + target_pos);
+    }
 
     // Pass 1: Count the potential number of rows in each character block for each
     // possible parser state at the beginning of the block.
@@ -507,7 +616,7 @@ void reader::impl::gather_row_offsets(const char *h_data,
           }
         }
       }
-    } else {
+    } else if (h_data != nullptr) {
       // Discard data (all rows below skip_rows), keeping one character for history
       size_t discard_bytes = std::max(data_.size(), sizeof(char)) - sizeof(char);
       if (discard_bytes != 0) {
@@ -534,7 +643,17 @@ void reader::impl::gather_row_offsets(const char *h_data,
     const auto header_start = buffer_pos + row_ctx[0];
     const auto header_end   = buffer_pos + row_ctx[1];
     CUDF_EXPECTS(header_start <= header_end && header_end <= h_size, "Invalid csv header location");
-    header.assign(h_data + header_start, h_data + header_end);
+    if (h_data != nullptr) {
+      header.assign(h_data + header_start, h_data + header_end);
+    } else {
+      header.resize(header_end - header_start);
+      CUDA_TRY(cudaMemcpyAsync(header.data(),
+                               data_.data().get() + row_ctx[0],
+                               header.size(),
+                               cudaMemcpyDeviceToHost,
+                               stream));
+      CUDA_TRY(cudaStreamSynchronize(stream));
+    }
     if (header_rows > 0) {
       row_offsets.erase(row_offsets.begin(), row_offsets.begin() + header_rows);
     }
@@ -548,7 +667,14 @@ std::vector<data_type> reader::impl::gather_column_types(cudaStream_t stream)
   std::vector<data_type> dtypes;
 
   if (args_.dtype.empty()) {
-    if (num_records == 0) {
+    const bool all_inferred =
+      !inferred_types.empty() &&
+      std::none_of(inferred_types.begin(), inferred_types.end(), [](const auto &type) {
+        return type.id() == cudf::type_id::EMPTY;
+      });
+    if (all_inferred) {
+      dtypes = inferred_types;
+    } else if (num_records == 0) {
       dtypes.resize(num_active_cols, data_type{EMPTY});
     } else {
       d_column_flags = h_column_flags;
@@ -596,6 +722,11 @@ std::vector<data_type> reader::impl::gather_column_types(cudaStream_t stream)
         }
       }
     }
+
+    // Keep the types that a previous range of a split read inferred
+    for (size_t col = 0; col < inferred_types.size() && col < dtypes.size(); ++col) {
+      if (inferred_types[col].id() != cudf::type_id::EMPTY) { dtypes[col] = inferred_types[col]; }
+    }
   } else {
     const bool is_dict = std::all_of(args_.dtype.begin(), args_.dtype.end(), [](const auto &s) {
       return s.find(':') != std::string::npos;
@@ -794,6 +925,12 @@ table_with_metadata reader::read_byte_range(size_t offset, size_t size, cudaStre
   return _impl->read(offset, size, 0, 0, -1, stream);
 }
 
+// Forward to implementation
+table_with_metadata reader::read_split(size_type num_ranges, cudaStream_t stream)
+{
+  return _impl->read_split(num_ranges, stream);
+}
+
 // Forward to implementation
 table_with_metadata reader::read_rows(size_type num_skip_header,
                                       size_type num_skip_footer,
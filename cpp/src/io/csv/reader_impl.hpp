@@ -100,6 +100,22 @@ class reader::impl {
                            int num_rows,
                            cudaStream_t stream);
 
+  /**
+   * @brief Reads the entire data by splitting it into byte ranges at row boundaries.
+   *
+   * The row boundaries are found on host threads. The first range is parsed first, then the
+   * others are parsed concurrently on host workers, each on its own stream, with the column names
+   * and types of the first range, and the results are concatenated. Falls back to a single read
+   * if the input is compressed, if the ranges infer different types for columns that only hold
+   * nulls in the first range, or if column names cannot be carried over from the first range.
+   *
+   * @param num_ranges Number of byte ranges to split the data into
+   * @param stream Stream to use for memory allocation and kernels
+   *
+   * @return The set of columns along with metadata
+   */
+  table_with_metadata read_split(size_type num_ranges, cudaStream_t stream);
+
  private:
   /**
    * @brief Finds row positions within the specified input data.
@@ -108,7 +124,8 @@ class reader::impl {
    * the start of the input data).
    * A row is actually the data/offset between two termination symbols.
    *
-   * @param h_data Uncompressed input data in host memory
+   * @param h_data Uncompressed input data in host memory; nullptr if the data has already been
+   * copied to `data_`
    * @param h_size Number of bytes of uncompressed input data
    * @param range_begin Only include rows starting after this position
    * @param range_end Only include rows starting before this position
@@ -180,6 +197,8 @@ class reader::impl {
   // Intermediate data
   std::vector<std::string> col_names;
   std::vector<char> header;
+  // Column types inferred from the first range of a split read; EMPTY types are still inferred
+  std::vector<data_type> inferred_types;
 };
 
 }  // namespace csv
@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "row_boundaries.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+
+namespace cudf {
+namespace io {
+namespace csv {
+namespace {
+/// Row parser states; same values as the GPU row contexts
+enum row_state : uint8_t { ROW_NONE = 0, ROW_QUOTE = 1, ROW_COMMENT = 2, NUM_ROW_STATES = 3 };
+
+/// Scan granularity of the first pass; large enough to amortize the task overhead
+constexpr size_t block_bytes = 4 * 1024 * 1024;
+
+/**
+ * @brief Returns the parser state after character `c`, mirroring `gather_row_offsets_gpu`
+ **/
+inline row_state next_state(row_state state, int c_prev, int c, row_parse_chars const &chars)
+{
+  if (c_prev == chars.terminator) {
+    if (c == chars.comment) { return (state == ROW_QUOTE) ? ROW_QUOTE : ROW_COMMENT; }
+    if (c == chars.quotechar) { return (state == ROW_QUOTE) ? ROW_NONE : ROW_QUOTE; }
+    return (state == ROW_QUOTE) ? ROW_QUOTE : ROW_NONE;
+  }
+  if (c == chars.quotechar && state != ROW_COMMENT) {
+    // Opening quote after a delimiter or double-quote; any other quote closes or is ignored
+    bool const opens = (c_prev == chars.delimiter || c_prev == chars.quotechar);
+    return (opens && state == ROW_NONE) ? ROW_QUOTE : ROW_NONE;
+  }
+  return state;
+}
+
+/**
+ * @brief Returns the character preceding `pos`; the start of data acts as a terminator
+ **/
+inline int prev_char(const char *data, size_t pos, row_parse_chars const &chars)
+{
+  return (pos > 0) ? static_cast<unsigned char>(data[pos - 1]) : chars.terminator;
+}
+
+}  // namespace
+
+std::vector<size_t> find_row_starts(const char *data,
+                                    size_t size,
+                                    std::vector<size_t> const &positions,
+                                    row_parse_chars const &chars,
+                                    detail::thread_pool &pool)
+{
+  auto const num_blocks = (size + block_bytes - 1) / block_bytes;
+
+  // Pass 1: output state of every block for each of the possible input states
+  std::vector<std::array<row_state, NUM_ROW_STATES>> block_exit(num_blocks);
+  detail::parallel_for(
+    pool,
+    num_blocks,
+    [] { return 0; },
+    [&](int, size_t b) {
+      auto const begin = b * block_bytes;
+      auto const end   = std::min(begin + block_bytes, size);
+      std::array<row_state, NUM_ROW_STATES> states{ROW_NONE, ROW_QUOTE, ROW_COMMENT};
+      int c_prev = prev_char(data, begin, chars);
+      for (size_t pos = begin; pos < end; ++pos) {
+        int const c = static_cast<unsigned char>(data[pos]);
+        for (auto &state : states) { state = next_state(state, c_prev, c, chars); }
+        c_prev = c;
+      }
+      block_exit[b] = states;
+    });
+
+  // Resolve the actual input state of every block from the start of the data
+  std::vector<row_state> block_entry(num_blocks + 1, ROW_NONE);
+  for (size_t b = 0; b < num_blocks; ++b) { block_entry[b + 1] = block_exit[b][block_entry[b]]; }
+
+  // Pass 2: scan forward from the start of the block containing each position
+  std::vector<size_t> row_starts(positions.size(), size);
+  detail::parallel_for(
+    pool,
+    positions.size(),
+    [] { return 0; },
+    [&](int, size_t i) {
+      auto const target = std::min(positions[i], size);
+      auto const b      = std::min(target / block_bytes, num_blocks);
+      auto state        = block_entry[b];
+      for (size_t pos = b * block_bytes; pos < size; ++pos) {
+        int const c_prev = prev_char(data, pos, chars);
+        if (pos >= target && c_prev == chars.terminator && state != ROW_QUOTE) {
+          row_starts[i] = pos;
+          return;
+        }
+        state = next_state(state, c_prev, static_cast<unsigned char>(data[pos]), chars);
+      }
+    });
+
+  return row_starts;
+}
+
+}  // namespace csv
+}  // namespace io
+}  // namespace cudf
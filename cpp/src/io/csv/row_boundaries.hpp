@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <io/utilities/thread_pool.hpp>
+
+#include <cstddef>
+#include <vector>
+
+namespace cudf {
+namespace io {
+namespace csv {
+/**
+ * @brief Characters that drive the row parsing state machine.
+ *
+ * Disabled characters (no quoting, no comments) are set to a value outside of the `char` range,
+ * the same way as for `gpu::gather_row_offsets`.
+ **/
+struct row_parse_chars {
+  int terminator;
+  int delimiter;
+  int quotechar;
+  int comment;
+};
+
+/**
+ * @brief Finds the first row that starts at or after each of the given positions.
+ *
+ * The quote and comment context at an arbitrary position depends on all of the preceding data,
+ * so the input is divided into large blocks that are scanned on host threads. The first pass runs
+ * the same state machine as `gpu::gather_row_offsets` speculatively from every possible input
+ * state of each block and records the corresponding output state. A serial prefix over the blocks
+ * then resolves the actual input state of every block, and a second parallel pass scans forward
+ * from each requested position with its now known state.
+ *
+ * @param data Uncompressed input data in host memory
+ * @param size Number of bytes of input data
+ * @param positions Byte positions to find row starts for
+ * @param chars Terminator, delimiter, quote and comment characters
+ * @param pool Host threads to scan the blocks on
+ *
+ * @return Byte position of the first row start at or after each position, or `size` if there is
+ * none
+ **/
+std::vector<size_t> find_row_starts(const char *data,
+                                    size_t size,
+                                    std::vector<size_t> const &positions,
+                                    row_parse_chars const &chars,
+                                    detail::thread_pool &pool);
+
+}  // namespace csv
+}  // namespace io
+}  // namespace cudf
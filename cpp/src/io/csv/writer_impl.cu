@@ -38,6 +38,7 @@
 
 #include <algorithm>
 #include <cstring>
+#include <future>
 #include <iterator>
 #include <sstream>
 #include <type_traits>
@@ -385,45 +386,89 @@ void writer::impl::write_chunked_begin(table_view const& table,
   }
 }
 
-void writer::impl::write_chunked(strings_column_view const& str_column_view,
-                                 const table_metadata* metadata,
-                                 cudaStream_t stream)
+std::unique_ptr<column> writer::impl::format_chunk(table_view const& table, cudaStream_t stream)
 {
-  // algorithm outline:
+  column_to_strings_fn converter{options_, mr_};
+  std::vector<std::unique_ptr<column>> str_column_vec;
+
+  // populate vector of string-converted columns:
   //
-  //  for_each(strings_column.begin(), strings_column.end(),
-  //           [sink = out_sink_](auto str_row) mutable {
-  //               auto host_buffer = str_row.host_buffer();
-  //               sink->host_write(host_buffer_.data(), host_buffer_.size());
-  //           });//or...sink->device_write(device_buffer,...);
+  std::transform(table.begin(),
+                 table.end(),
+                 std::back_inserter(str_column_vec),
+                 [converter](auto const& current_col) {
+                   return cudf::type_dispatcher(current_col.type(), converter, current_col);
+                 });
+
+  // create string table view from str_column_vec:
   //
-  // added line_terminator functionality
+  auto str_table_ptr = std::make_unique<cudf::table>(std::move(str_column_vec));
+  table_view str_table_view{std::move(*str_table_ptr)};
+
+  // concatenate columns in each row into one big string column
+  //(using null representation and delimiter):
   //
+  std::string delimiter_str{options_.inter_column_delimiter()};
+  auto str_concat_col =
+    cudf::strings::concatenate(str_table_view, delimiter_str, options_.na_rep(), mr_);
 
-  CUDF_EXPECTS(str_column_view.size() > 0, "Unexpected empty strings column.");
+  strings_column_view strings_converted{std::move(*str_concat_col)};
+  CUDF_EXPECTS(strings_converted.size() > 0, "Unexpected empty strings column.");
 
+  // added line_terminator functionality
+  //
   cudf::string_scalar newline{options_.line_terminator()};
-  auto p_str_col_w_nl = cudf::strings::join_strings(str_column_view, newline);
-  strings_column_view strings_column{std::move(p_str_col_w_nl->view())};
+  return cudf::strings::join_strings(strings_converted, newline);
+}
 
+void writer::impl::write_chunked(std::unique_ptr<column> chunk, cudaStream_t stream)
+{
+  // algorithm outline:
+  //
+  //  wait for the write of the previous chunk;
+  //  write this chunk on a background thread while the caller formats the next one:
+  //  sink->device_write(device_buffer,...), or, via an alternating staging buffer,
+  //  sink->host_write(host_buffer,...);
+  //
+  strings_column_view strings_column{chunk->view()};
   auto total_num_bytes      = strings_column.chars_size();
   char const* ptr_all_bytes = strings_column.chars().data<char>();
 
+  // The write threads start on the default device, so they use the caller's device explicitly
+  int device_id = 0;
+  CUDA_TRY(cudaGetDevice(&device_id));
+
   if (out_sink_->supports_device_write()) {
     // host algorithm call, but the underlying call
     // is a device_write taking a device buffer;
+    // the chunk is kept alive until its write completes
     //
-    out_sink_->device_write(ptr_all_bytes, total_num_bytes, stream);
-    out_sink_->device_write(newline.data(),
-                            newline.size(),
-                            stream);  // needs newline at the end, to separate from next chunk
+    wait_for_pending_write();
+    pending_chunk_ = std::move(chunk);
+    pending_write_ = std::async(
+      std::launch::async, [this, ptr_all_bytes, total_num_bytes, stream, device_id] {
+        CUDA_TRY(cudaSetDevice(device_id));
+        out_sink_->device_write(ptr_all_bytes, total_num_bytes, stream);
+        out_sink_->device_write(d_line_terminator_->data(),
+                                d_line_terminator_->size(),
+                                stream);  // needs newline at the end, to separate from next chunk
+      });
   } else {
     // no device write possible;
     //
-    // copy the bytes to host, too:
+    // copy the bytes to host; the staging buffer was last used by the chunk before the previous
+    // one, whose write has completed, so the copy overlaps with the previous chunk's write
     //
-    thrust::host_vector<char> h_bytes(total_num_bytes);
-    CUDA_TRY(cudaMemcpyAsync(h_bytes.data(),
+    auto& staging = staging_[next_staging_];
+    next_staging_ = 1 - next_staging_;
+    if (staging.capacity < static_cast<size_t>(total_num_bytes)) {
+      char* ptr = nullptr;
+      staging.data.reset();
+      CUDA_TRY(cudaMallocHost(&ptr, total_num_bytes));
+      staging.data.reset(ptr);
+      staging.capacity = total_num_bytes;
+    }
+    CUDA_TRY(cudaMemcpyAsync(staging.data.get(),
                              ptr_all_bytes,
                              total_num_bytes * sizeof(char),
                              cudaMemcpyDeviceToHost,
@@ -434,14 +479,32 @@ void writer::impl::write_chunked(strings_column_view const& str_column_view,
     // host algorithm call, where the underlying call
     // is also host_write taking a host buffer;
     //
-    char const* ptr_h_bytes = h_bytes.data();
-    out_sink_->host_write(ptr_h_bytes, total_num_bytes);
-    out_sink_->host_write(
-      options_.line_terminator().data(),
-      options_.line_terminator().size());  // needs newline at the end, to separate from next chunk
+    char const* ptr_h_bytes = staging.data.get();
+    wait_for_pending_write();
+    pending_write_ =
+      std::async(std::launch::async, [this, ptr_h_bytes, total_num_bytes, device_id] {
+        CUDA_TRY(cudaSetDevice(device_id));
+        out_sink_->host_write(ptr_h_bytes, total_num_bytes);
+        // needs newline at the end, to separate from next chunk
+        out_sink_->host_write(options_.line_terminator().data(),
+                              options_.line_terminator().size());
+      });
   }
 }
 
+void writer::impl::wait_for_pending_write()
+{
+  if (pending_write_.valid()) { pending_write_.get(); }
+  pending_chunk_.reset();
+}
+
+void writer::impl::write_chunked_end(table_view const& table,
+                                     const table_metadata* metadata,
+                                     cudaStream_t stream)
+{
+  wait_for_pending_write();
+}
+
 void writer::impl::write(table_view const& table,
                          const table_metadata* metadata,
                          cudaStream_t stream)
@@ -460,7 +523,8 @@ void writer::impl::write(table_view const& table,
     // This outputs the CSV in row chunks to save memory.
     // Maybe we can use the total_rows*count calculation and a memory threshold
     // instead of an arbitrary chunk count.
-    // The entire CSV chunk must fit in CPU memory before writing it out.
+    // At most two CSV chunks are held in memory: the one being written out
+    // and the one being formatted.
     //
     if (n_rows_per_chunk % 8)  // must be divisible by 8
       n_rows_per_chunk += 8 - (n_rows_per_chunk % 8);
@@ -495,40 +559,21 @@ void writer::impl::write(table_view const& table,
       vector_views = cudf::split(table, splits);
     }
 
-    // convert each chunk to CSV:
+    if (out_sink_->supports_device_write() && d_line_terminator_ == nullptr) {
+      d_line_terminator_ = std::make_unique<string_scalar>(options_.line_terminator());
+    }
+
+    // convert each chunk to CSV; the conversion of a chunk overlaps with the write of the
+    // previous one:
     //
-    column_to_strings_fn converter{options_, mr_};
     for (auto&& sub_view : vector_views) {
-      std::vector<std::unique_ptr<column>> str_column_vec;
-
-      // populate vector of string-converted columns:
-      //
-      std::transform(sub_view.begin(),
-                     sub_view.end(),
-                     std::back_inserter(str_column_vec),
-                     [converter](auto const& current_col) {
-                       return cudf::type_dispatcher(current_col.type(), converter, current_col);
-                     });
-
-      // create string table view from str_column_vec:
-      //
-      auto str_table_ptr = std::make_unique<cudf::table>(std::move(str_column_vec));
-      table_view str_table_view{std::move(*str_table_ptr)};
-
-      // concatenate columns in each row into one big string column
-      //(using null representation and delimiter):
-      //
-      std::string delimiter_str{options_.inter_column_delimiter()};
-      auto str_concat_col =
-        cudf::strings::concatenate(str_table_view, delimiter_str, options_.na_rep(), mr_);
-
-      strings_column_view strings_converted{std::move(*str_concat_col)};
-
-      write_chunked(strings_converted, metadata, stream);
+      // a trailing split may be empty when num_rows is a multiple of the chunk size
+      if (sub_view.num_rows() == 0) { continue; }
+      write_chunked(format_chunk(sub_view, stream), stream);
     }
   }
 
-  // finalize (no-op, for now, but offers a hook for future extensions):
+  // finalize; waits for the last chunk to be written:
   //
   write_chunked_end(table, metadata, stream);
 }
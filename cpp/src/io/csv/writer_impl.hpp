@@ -30,9 +30,12 @@
 #include <cudf/detail/utilities/integer_utils.hpp>
 #include <cudf/io/data_sink.hpp>
 #include <cudf/io/writers.hpp>
+#include <cudf/scalar/scalar.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/utilities/error.hpp>
 
+#include <array>
+#include <future>
 #include <memory>
 #include <string>
 #include <vector>
@@ -84,34 +87,64 @@ class writer::impl {
                            cudaStream_t stream            = nullptr);
 
   /**
-   * @brief Write dataset to CSV format without header.
+   * @brief Converts a chunk of rows to CSV text on the device.
    *
-   * @param strings_column Subset of columns converted to string to be written.
-   * @param metadata The metadata associated with the table
+   * @param table The subset of rows to convert
+   * @param stream Stream to use for memory allocation and kernels
+   *
+   * @return Single-row strings column holding the rows separated by the line terminator
+   **/
+  std::unique_ptr<column> format_chunk(table_view const& table, cudaStream_t stream = nullptr);
+
+  /**
+   * @brief Write a formatted chunk to CSV format without header.
+   *
+   * The sink write runs on a background thread so that the caller can format the next chunk in
+   * the meantime. Only one write is in flight at a time, which keeps the chunks in order and
+   * bounds the memory held to two chunks.
+   *
+   * @param chunk Chunk returned by `format_chunk()`
    * @param stream Stream to use for memory allocation and kernels
    **/
-  void write_chunked(strings_column_view const& strings_column,
-                     const table_metadata* metadata = nullptr,
-                     cudaStream_t stream            = nullptr);
+  void write_chunked(std::unique_ptr<column> chunk, cudaStream_t stream = nullptr);
 
   /**
    * @brief Write footer of CSV format (typically, empty).
    *
+   * Waits for the write of the last chunk to complete.
+   *
    * @param table The set of columns
    * @param metadata The metadata associated with the table
    * @param stream Stream to use for memory allocation and kernels
    **/
   void write_chunked_end(table_view const& table,
                          const table_metadata* metadata = nullptr,
-                         cudaStream_t stream            = nullptr)
-  {
-    // purposely no-op (for now);
-  }
+                         cudaStream_t stream            = nullptr);
 
  private:
+  /**
+   * @brief Page-locked staging buffer for sinks that do not support device writes
+   **/
+  struct staging_buffer {
+    std::unique_ptr<char, decltype(&cudaFreeHost)> data{nullptr, cudaFreeHost};
+    size_t capacity = 0;
+  };
+
+  /**
+   * @brief Waits for the background write of the previous chunk and rethrows its errors.
+   **/
+  void wait_for_pending_write();
+
   std::unique_ptr<data_sink> out_sink_;
   rmm::mr::device_memory_resource* mr_ = nullptr;
   writer_options const options_;
+
+  std::unique_ptr<string_scalar> d_line_terminator_;
+  std::array<staging_buffer, 2> staging_;
+  int next_staging_ = 0;
+  std::unique_ptr<column> pending_chunk_;
+  // Declared last so that an in-flight write completes before the other members are destroyed
+  std::future<void> pending_write_;
 };
 
 }  // namespace csv
@@ -46,10 +46,12 @@ std::unique_ptr<reader> make_reader(source_info const& source,
 template <typename writer, typename writer_options>
 std::unique_ptr<writer> make_writer(sink_info const& sink,
                                     writer_options const& options,
-                                    rmm::mr::device_memory_resource* mr)
+                                    rmm::mr::device_memory_resource* mr,
+                                    bool background_flush = false)
 {
   if (sink.type == io_type::FILEPATH) {
-    return std::make_unique<writer>(cudf::io::data_sink::create(sink.filepath), options, mr);
+    return std::make_unique<writer>(
+      cudf::io::data_sink::create(sink.filepath, background_flush), options, mr);
   }
   if (sink.type == io_type::HOST_BUFFER) {
     return std::make_unique<writer>(cudf::io::data_sink::create(sink.buffer), options, mr);
@@ -73,7 +75,13 @@ table_with_metadata read_avro(read_avro_args const& args, rmm::mr::device_memory
 
   CUDF_FUNC_RANGE();
   avro::reader_options options{args.columns};
-  auto reader = make_reader<avro::reader>(args.source, options, mr);
+  options.num_threads = args.num_threads;
+  std::unique_ptr<avro::reader> reader;
+  if (args.filepaths.empty()) {
+    reader = make_reader<avro::reader>(args.source, options, mr);
+  } else {
+    reader = std::make_unique<avro::reader>(args.filepaths, options, mr);
+  }
 
   if (args.skip_rows != -1 || args.num_rows != -1) {
     return reader->read_rows(args.skip_rows, args.num_rows);
@@ -89,6 +97,7 @@ table_with_metadata read_json(read_json_args const& args, rmm::mr::device_memory
 
   CUDF_FUNC_RANGE();
   json::reader_options options{args.lines, args.compression, args.dtype, args.dayfirst};
+  options.flatten_nested = args.flatten_nested;
   auto reader = make_reader<json::reader>(args.source, options, mr);
 
   if (args.byte_range_offset != 0 || args.byte_range_size != 0) {
@@ -145,6 +154,8 @@ table_with_metadata read_csv(read_csv_args const& args, rmm::mr::device_memory_r
     return reader->read_byte_range(args.byte_range_offset, args.byte_range_size);
   } else if (args.skiprows != -1 || args.skipfooter != -1 || args.nrows != -1) {
     return reader->read_rows(args.skiprows, args.skipfooter, args.nrows);
+  } else if (args.num_byte_ranges > 1) {
+    return reader->read_split(args.num_byte_ranges);
   } else {
     return reader->read_all();
   }
@@ -155,7 +166,7 @@ void write_csv(write_csv_args const& args, rmm::mr::device_memory_resource* mr)
 {
   using namespace cudf::io::detail;
 
-  auto writer = make_writer<csv::writer>(args.sink(), args, mr);
+  auto writer = make_writer<csv::writer>(args.sink(), args, mr, args.background_flush());
 
   writer->write_all(args.table(), args.metadata());
 }
@@ -172,6 +183,11 @@ table_with_metadata read_orc(read_orc_args const& args, rmm::mr::device_memory_r
                                      args.timestamp_type,
                                      args.decimals_as_float,
                                      args.forced_decimals_scale};
+  options.read_method                  = args.read_method;
+  options.filter                       = args.filter;
+  options.footer_cache                 = args.footer_cache;
+  options.host_decompression_threshold = args.host_decompression_threshold;
+
   auto reader = make_reader<detail_orc::reader>(args.source, options, mr);
 
   if (args.stripe_list.size() > 0) {
@@ -185,12 +201,57 @@ table_with_metadata read_orc(read_orc_args const& args, rmm::mr::device_memory_r
   }
 }
 
+/**
+ * @copydoc cudf::io::read_orc_chunked_begin
+ *
+ **/
+std::shared_ptr<detail_orc::orc_chunked_read_state> read_orc_chunked_begin(
+  read_orc_chunked_args const& args, rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  detail_orc::reader_options options{args.columns,
+                                     args.use_index,
+                                     args.use_np_dtypes,
+                                     args.timestamp_type,
+                                     args.decimals_as_float,
+                                     args.forced_decimals_scale};
+  options.read_method                  = args.read_method;
+  options.filter                       = args.filter;
+  options.footer_cache                 = args.footer_cache;
+  options.host_decompression_threshold = args.host_decompression_threshold;
+
+  auto state = std::make_shared<detail_orc::orc_chunked_read_state>();
+  state->rp  = make_reader<detail_orc::reader>(args.source, options, mr);
+  state->rp->read_chunked_begin(args.chunk_read_limit);
+  return state;
+}
+
+/**
+ * @copydoc cudf::io::read_orc_chunked_has_next
+ *
+ **/
+bool read_orc_chunked_has_next(std::shared_ptr<detail_orc::orc_chunked_read_state> const& state)
+{
+  return state->rp->has_next();
+}
+
+/**
+ * @copydoc cudf::io::read_orc_chunked
+ *
+ **/
+table_with_metadata read_orc_chunked(
+  std::shared_ptr<detail_orc::orc_chunked_read_state> const& state)
+{
+  CUDF_FUNC_RANGE();
+  return state->rp->read_chunk();
+}
+
 // Freeform API wraps the detail writer class API
 void write_orc(write_orc_args const& args, rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
   detail_orc::writer_options options{args.compression, args.enable_statistics};
-  auto writer = make_writer<detail_orc::writer>(args.sink, options, mr);
+  auto writer = make_writer<detail_orc::writer>(args.sink, options, mr, args.background_flush);
 
   writer->write_all(args.table, args.metadata);
 }
@@ -206,7 +267,7 @@ std::shared_ptr<detail_orc::orc_chunked_state> write_orc_chunked_begin(
   detail_orc::writer_options options{args.compression, args.enable_statistics};
 
   auto state = std::make_shared<detail_orc::orc_chunked_state>();
-  state->wp  = make_writer<detail_orc::writer>(args.sink, options, mr);
+  state->wp  = make_writer<detail_orc::writer>(args.sink, options, mr, args.background_flush);
 
   // have to make a copy of the metadata here since we can't really
   // guarantee the lifetime of the incoming pointer
@@ -250,6 +311,11 @@ table_with_metadata read_parquet(read_parquet_args const& args, rmm::mr::device_
   CUDF_FUNC_RANGE();
   detail_parquet::reader_options options{
     args.columns, args.strings_to_categorical, args.use_pandas_metadata, args.timestamp_type};
+  options.read_method                  = args.read_method;
+  options.filter                       = args.filter;
+  options.footer_cache                 = args.footer_cache;
+  options.host_decompression_threshold = args.host_decompression_threshold;
+
   auto reader = make_reader<detail_parquet::reader>(args.source, options, mr);
 
   if (args.row_group_list.size() > 0) {
@@ -269,12 +335,77 @@ std::unique_ptr<std::vector<uint8_t>> write_parquet(write_parquet_args const& ar
 {
   CUDF_FUNC_RANGE();
   detail_parquet::writer_options options{args.compression, args.stats_level};
-  auto writer = make_writer<detail_parquet::writer>(args.sink, options, mr);
+  options.column_encodings = args.column_encodings;
+  options.write_v2_headers = args.write_v2_headers;
+
+  auto writer =
+    make_writer<detail_parquet::writer>(args.sink, options, mr, args.background_flush);
 
   return writer->write_all(
     args.table, args.metadata, args.return_filemetadata, args.metadata_out_file_path);
 }
 
+/**
+ * @copydoc cudf::io::read_parquet_chunked_begin
+ *
+ **/
+std::shared_ptr<pq_chunked_read_state> read_parquet_chunked_begin(
+  read_parquet_chunked_args const& args, rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  detail_parquet::reader_options options{
+    args.columns, args.strings_to_categorical, args.use_pandas_metadata, args.timestamp_type};
+  options.read_method                  = args.read_method;
+  options.filter                       = args.filter;
+  options.footer_cache                 = args.footer_cache;
+  options.host_decompression_threshold = args.host_decompression_threshold;
+
+  auto state = std::make_shared<pq_chunked_read_state>();
+  state->rp  = make_reader<detail_parquet::reader>(args.source, options, mr);
+  state->rp->read_chunked_begin(args.chunk_read_limit, args.pass_read_limit);
+  return state;
+}
+
+/**
+ * @copydoc cudf::io::read_parquet_chunked_has_next
+ *
+ **/
+bool read_parquet_chunked_has_next(std::shared_ptr<pq_chunked_read_state> const& state)
+{
+  return state->rp->has_next();
+}
+
+/**
+ * @copydoc cudf::io::read_parquet_chunked
+ *
+ **/
+table_with_metadata read_parquet_chunked(std::shared_ptr<pq_chunked_read_state> const& state)
+{
+  CUDF_FUNC_RANGE();
+  return state->rp->read_chunk();
+}
+
+// Freeform API wraps the detail dataset reader class API
+table_with_metadata read_parquet_dataset(read_parquet_dataset_args const& args,
+                                         rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  detail_parquet::reader_options options{
+    args.columns, args.strings_to_categorical, args.use_pandas_metadata, args.timestamp_type};
+  options.read_method                  = args.read_method;
+  options.filter                       = args.filter;
+  options.footer_cache                 = args.footer_cache;
+  options.host_decompression_threshold = args.host_decompression_threshold;
+
+  detail_parquet::dataset_options dataset;
+  dataset.directory         = args.directory;
+  dataset.hive_partitioning = args.hive_partitioning;
+  dataset.num_threads       = args.num_threads;
+
+  detail_parquet::dataset_reader reader(args.filepaths, dataset, options, mr);
+  return reader.read_all();
+}
+
 /**
  * @copydoc cudf::io::merge_rowgroup_metadata
  *
@@ -295,9 +426,11 @@ std::shared_ptr<pq_chunked_state> write_parquet_chunked_begin(
 {
   CUDF_FUNC_RANGE();
   detail_parquet::writer_options options{args.compression, args.stats_level};
+  options.column_encodings = args.column_encodings;
+  options.write_v2_headers = args.write_v2_headers;
 
   auto state = std::make_shared<pq_chunked_state>();
-  state->wp  = make_writer<detail_parquet::writer>(args.sink, options, mr);
+  state->wp  = make_writer<detail_parquet::writer>(args.sink, options, mr, args.background_flush);
 
   // have to make a copy of the metadata here since we can't really
   // guarantee the lifetime of the incoming pointer
@@ -331,5 +464,48 @@ void write_parquet_chunked_end(std::shared_ptr<pq_chunked_state>& state)
   state.reset();
 }
 
+/**
+ * @copydoc cudf::io::write_parquet_dataset_begin
+ *
+ **/
+std::shared_ptr<pq_dataset_state> write_parquet_dataset_begin(
+  write_parquet_dataset_args const& args, rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  detail_parquet::dataset_writer_options options;
+  options.directory                     = args.directory;
+  options.partition_cols                = args.partition_cols;
+  options.max_open_files                = args.max_open_files;
+  options.write_metadata_file           = args.write_metadata_file;
+  options.file_options = detail_parquet::writer_options{args.compression, args.stats_level};
+  options.file_options.column_encodings = args.column_encodings;
+  options.file_options.write_v2_headers = args.write_v2_headers;
+
+  auto state = std::make_shared<pq_dataset_state>();
+  state->wp  = std::make_unique<detail_parquet::dataset_writer>(options, args.metadata, mr);
+  return state;
+}
+
+/**
+ * @copydoc cudf::io::write_parquet_dataset
+ *
+ **/
+void write_parquet_dataset(table_view const& table, std::shared_ptr<pq_dataset_state> state)
+{
+  CUDF_FUNC_RANGE();
+  state->wp->write(table);
+}
+
+/**
+ * @copydoc cudf::io::write_parquet_dataset_end
+ *
+ **/
+void write_parquet_dataset_end(std::shared_ptr<pq_dataset_state>& state)
+{
+  CUDF_FUNC_RANGE();
+  state->wp->close();
+  state.reset();
+}
+
 }  // namespace io
 }  // namespace cudf
@@ -32,6 +32,24 @@ struct ColumnInfo {
   cudf::size_type null_count;
 };
 
+/**
+ * @brief Kinds of structural tokens within a JSON record
+ **/
+enum class token_kind : uint8_t { OBJECT_BEGIN, OBJECT_END, ARRAY_BEGIN, ARRAY_END, KEY, VALUE };
+
+/**
+ * @brief Structural token of a JSON record
+ *
+ * Offsets are relative to the start of the data. Key tokens exclude the quotes, while value tokens
+ * keep them so that quoted values can still be told apart from other values.
+ **/
+struct json_token {
+  uint64_t start;
+  uint64_t end;
+  uint16_t depth;  ///< Nesting depth; brackets of the record itself are at depth 0
+  token_kind kind;
+};
+
 }  // namespace json
 }  // namespace io
 }  // namespace cudf
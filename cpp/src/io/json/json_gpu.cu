@@ -16,6 +16,7 @@
 
 #include "json_common.h"
 #include "json_gpu.h"
+#include "json_tokenizer.cuh"
 
 #include <rmm/device_buffer.hpp>
 
@@ -400,6 +401,61 @@ __device__ __inline__ bool is_like_float(
   return true;
 }
 
+/**
+ * @brief Converts a single field and stores it in the output column, setting its valid bit.
+ *
+ * @param[in] data The entire data to read
+ * @param[in] start Offset of the first character of the field
+ * @param[in] field_end Offset of the first character after the field
+ * @param[in] rec_id Index of the record, i.e. the output row
+ * @param[in] dtype The data type of the column
+ * @param[in] opts A set of parsing options
+ * @param[out] output_column The output column data
+ * @param[out] valid_field The bitmap indicating whether column fields are valid
+ * @param[out] num_valid_field The number of valid fields in the column
+ *
+ * @return void
+ **/
+__device__ void convert_field(const char *data,
+                              long start,
+                              long field_end,
+                              long rec_id,
+                              data_type dtype,
+                              ParseOptions const &opts,
+                              void *output_column,
+                              bitmask_type *valid_field,
+                              cudf::size_type *num_valid_field)
+{
+  long field_data_last = field_end - 1;
+  // Modify start & end to ignore whitespace and quotechars
+  trim_field_start_end(data, &start, &field_data_last, opts.quotechar);
+  // Empty fields are not legal values
+  if (start <= field_data_last &&
+      !serializedTrieContains(opts.naValuesTrie, data + start, field_end - start)) {
+    // Type dispatcher does not handle strings
+    if (dtype.id() == STRING) {
+      auto str_list           = static_cast<string_pair *>(output_column);
+      str_list[rec_id].first  = data + start;
+      str_list[rec_id].second = field_data_last - start + 1;
+
+      // set the valid bitmap - all bits were set to 0 to start
+      set_bit(valid_field, rec_id);
+      atomicAdd(num_valid_field, 1);
+    } else {
+      if (cudf::type_dispatcher(
+            dtype, ConvertFunctor{}, data, output_column, rec_id, start, field_data_last, opts)) {
+        // set the valid bitmap - all bits were set to 0 to start
+        set_bit(valid_field, rec_id);
+        atomicAdd(num_valid_field, 1);
+      }
+    }
+  } else if (dtype.id() == STRING) {
+    auto str_list           = static_cast<string_pair *>(output_column);
+    str_list[rec_id].first  = nullptr;
+    str_list[rec_id].second = 0;
+  }
+}
+
 /**
  * @brief CUDA kernel that parses and converts plain text data into cuDF column data.
  *
@@ -443,41 +499,114 @@ __global__ void convert_json_to_columns_kernel(const char *data,
     if (is_object) { start = seek_field_name_end(data, opts, start, stop); }
     // field_end is at the next delimiter/newline
     const long field_end = cudf::io::gpu::seek_field_end(data, opts, start, stop);
-    long field_data_last = field_end - 1;
-    // Modify start & end to ignore whitespace and quotechars
-    trim_field_start_end(data, &start, &field_data_last, opts.quotechar);
-    // Empty fields are not legal values
-    if (start <= field_data_last &&
-        !serializedTrieContains(opts.naValuesTrie, data + start, field_end - start)) {
-      // Type dispatcher does not handle strings
-      if (dtypes[col].id() == STRING) {
-        auto str_list           = static_cast<string_pair *>(output_columns[col]);
-        str_list[rec_id].first  = data + start;
-        str_list[rec_id].second = field_data_last - start + 1;
+    convert_field(data,
+                  start,
+                  field_end,
+                  rec_id,
+                  dtypes[col],
+                  opts,
+                  output_columns[col],
+                  valid_fields[col],
+                  &num_valid_fields[col]);
+    start = field_end + 1;
+  }
+}
 
-        // set the valid bitmap - all bits were set to 0 to start
-        set_bit(valid_fields[col], rec_id);
-        atomicAdd(&num_valid_fields[col], 1);
+/**
+ * @brief Updates the data type counts of a column with the contents of a single field.
+ *
+ * @param[in] data Input data buffer
+ * @param[in] field_start Offset of the first character of the trimmed field
+ * @param[in] field_data_last Offset of the last character of the trimmed field
+ * @param[in] opts A set of parsing options
+ * @param[out] column_info The count for each data type of the column
+ *
+ * @returns void
+ **/
+__device__ void detect_field_type(const char *data,
+                                  long field_start,
+                                  long field_data_last,
+                                  ParseOptions const &opts,
+                                  ColumnInfo *column_info)
+{
+  const int field_len = field_data_last - field_start + 1;
+
+  // Checking if the field is empty
+  if (field_start > field_data_last ||
+      serializedTrieContains(opts.naValuesTrie, data + field_start, field_len)) {
+    atomicAdd(&column_info->null_count, 1);
+    return;
+  }
+  // Don't need counts to detect strings, any field in quotes is deduced to be a string
+  if (data[field_start] == opts.quotechar && data[field_data_last] == opts.quotechar) {
+    atomicAdd(&column_info->string_count, 1);
+    return;
+  }
+
+  int digit_count    = 0;
+  int decimal_count  = 0;
+  int slash_count    = 0;
+  int dash_count     = 0;
+  int colon_count    = 0;
+  int exponent_count = 0;
+  int other_count    = 0;
+
+  const bool maybe_hex =
+    ((field_len > 2 && data[field_start] == '0' && data[field_start + 1] == 'x') ||
+     (field_len > 3 && data[field_start] == '-' && data[field_start + 1] == '0' &&
+      data[field_start + 2] == 'x'));
+  for (long pos = field_start; pos <= field_data_last; pos++) {
+    if (is_digit(data[pos], maybe_hex)) {
+      digit_count++;
+      continue;
+    }
+    // Looking for unique characters that will help identify column types
+    switch (data[pos]) {
+      case '.': decimal_count++; break;
+      case '-': dash_count++; break;
+      case '/': slash_count++; break;
+      case ':': colon_count++; break;
+      case 'e':
+      case 'E':
+        if (!maybe_hex && pos > field_start && pos < field_data_last) exponent_count++;
+        break;
+      default: other_count++; break;
+    }
+  }
+
+  // Integers have to have the length of the string
+  int int_req_number_cnt = field_len;
+  // Off by one if they start with a minus sign
+  if (data[field_start] == '-' && field_len > 1) { --int_req_number_cnt; }
+  // Off by one if they are a hexadecimal number
+  if (maybe_hex) { --int_req_number_cnt; }
+  if (serializedTrieContains(opts.trueValuesTrie, data + field_start, field_len) ||
+      serializedTrieContains(opts.falseValuesTrie, data + field_start, field_len)) {
+    atomicAdd(&column_info->bool_count, 1);
+  } else if (digit_count == int_req_number_cnt) {
+    atomicAdd(&column_info->int_count, 1);
+  } else if (is_like_float(field_len, digit_count, decimal_count, dash_count, exponent_count)) {
+    atomicAdd(&column_info->float_count, 1);
+  }
+  // A date-time field cannot have more than 3 non-special characters
+  // A number field cannot have more than one decimal point
+  else if (other_count > 3 || decimal_count > 1) {
+    atomicAdd(&column_info->string_count, 1);
+  } else {
+    // A date field can have either one or two '-' or '\'; A legal combination will only have one
+    // of them To simplify the process of auto column detection, we are not covering all the
+    // date-time formation permutations
+    if ((dash_count > 0 && dash_count <= 2 && slash_count == 0) ||
+        (dash_count == 0 && slash_count > 0 && slash_count <= 2)) {
+      if (colon_count <= 2) {
+        atomicAdd(&column_info->datetime_count, 1);
       } else {
-        if (cudf::type_dispatcher(dtypes[col],
-                                  ConvertFunctor{},
-                                  data,
-                                  output_columns[col],
-                                  rec_id,
-                                  start,
-                                  field_data_last,
-                                  opts)) {
-          // set the valid bitmap - all bits were set to 0 to start
-          set_bit(valid_fields[col], rec_id);
-          atomicAdd(&num_valid_fields[col], 1);
-        }
+        atomicAdd(&column_info->string_count, 1);
       }
-    } else if (dtypes[col].id() == STRING) {
-      auto str_list           = static_cast<string_pair *>(output_columns[col]);
-      str_list[rec_id].first  = nullptr;
-      str_list[rec_id].second = 0;
+    } else {
+      // Default field type is string
+      atomicAdd(&column_info->string_count, 1);
     }
-    start = field_end + 1;
   }
 }
 
@@ -522,88 +651,201 @@ __global__ void detect_json_data_types(const char *data,
     const long field_end = cudf::io::gpu::seek_field_end(data, opts, field_start, stop);
     long field_data_last = field_end - 1;
     trim_field_start_end(data, &field_start, &field_data_last);
-    const int field_len = field_data_last - field_start + 1;
     // Advance the start offset
     start = field_end + 1;
 
-    // Checking if the field is empty
-    if (field_start > field_data_last ||
-        serializedTrieContains(opts.naValuesTrie, data + field_start, field_len)) {
-      atomicAdd(&column_infos[col].null_count, 1);
-      continue;
-    }
-    // Don't need counts to detect strings, any field in quotes is deduced to be a string
-    if (data[field_start] == opts.quotechar && data[field_data_last] == opts.quotechar) {
-      atomicAdd(&column_infos[col].string_count, 1);
-      continue;
-    }
+    detect_field_type(data, field_start, field_data_last, opts, &column_infos[col]);
+  }
+}
 
-    int digit_count    = 0;
-    int decimal_count  = 0;
-    int slash_count    = 0;
-    int dash_count     = 0;
-    int colon_count    = 0;
-    int exponent_count = 0;
-    int other_count    = 0;
-
-    const bool maybe_hex =
-      ((field_len > 2 && data[field_start] == '0' && data[field_start + 1] == 'x') ||
-       (field_len > 3 && data[field_start] == '-' && data[field_start + 1] == '0' &&
-        data[field_start + 2] == 'x'));
-    for (long pos = field_start; pos <= field_data_last; pos++) {
-      if (is_digit(data[pos], maybe_hex)) {
-        digit_count++;
-        continue;
-      }
-      // Looking for unique characters that will help identify column types
-      switch (data[pos]) {
-        case '.': decimal_count++; break;
-        case '-': dash_count++; break;
-        case '/': slash_count++; break;
-        case ':': colon_count++; break;
-        case 'e':
-        case 'E':
-          if (!maybe_hex && pos > field_start && pos < field_data_last) exponent_count++;
-          break;
-        default: other_count++; break;
-      }
-    }
+/**
+ * @brief Returns the start and the end (one past the last character) of a record
+ **/
+__device__ void get_record_range(const uint64_t *rec_starts,
+                                 cudf::size_type num_records,
+                                 size_t data_size,
+                                 long rec_id,
+                                 uint64_t &start,
+                                 uint64_t &stop)
+{
+  start = rec_starts[rec_id];
+  stop  = (rec_id < num_records - 1) ? rec_starts[rec_id + 1] : data_size;
+}
 
-    // Integers have to have the length of the string
-    int int_req_number_cnt = field_len;
-    // Off by one if they start with a minus sign
-    if (data[field_start] == '-' && field_len > 1) { --int_req_number_cnt; }
-    // Off by one if they are a hexadecimal number
-    if (maybe_hex) { --int_req_number_cnt; }
-    if (serializedTrieContains(opts.trueValuesTrie, data + field_start, field_len) ||
-        serializedTrieContains(opts.falseValuesTrie, data + field_start, field_len)) {
-      atomicAdd(&column_infos[col].bool_count, 1);
-    } else if (digit_count == int_req_number_cnt) {
-      atomicAdd(&column_infos[col].int_count, 1);
-    } else if (is_like_float(field_len, digit_count, decimal_count, dash_count, exponent_count)) {
-      atomicAdd(&column_infos[col].float_count, 1);
+/**
+ * @brief Returns the index of the column with the given path hash, or -1 if there is none
+ *
+ * @param[in] path Hash of the dotted path of the value
+ * @param[in] column_hashes Sorted path hashes of the columns
+ * @param[in] column_indices Column index of each hash in `column_hashes`
+ * @param[in] num_columns The number of columns
+ **/
+__device__ int find_column(uint64_t path,
+                           const uint64_t *column_hashes,
+                           const cudf::size_type *column_indices,
+                           int num_columns)
+{
+  int lo = 0;
+  int hi = num_columns;
+  while (lo < hi) {
+    const int mid = (lo + hi) / 2;
+    if (column_hashes[mid] < path) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
     }
-    // A date-time field cannot have more than 3 non-special characters
-    // A number field cannot have more than one decimal point
-    else if (other_count > 3 || decimal_count > 1) {
+  }
+  return (lo < num_columns && column_hashes[lo] == path) ? column_indices[lo] : -1;
+}
+
+/**
+ * @brief Functor that updates the type counts of the column of each flattened value
+ **/
+struct nested_type_detector {
+  const char *data;
+  const ParseOptions &opts;
+  const uint64_t *column_hashes;
+  const cudf::size_type *column_indices;
+  int num_columns;
+  ColumnInfo *column_infos;
+
+  __device__ void operator()(uint64_t path, uint64_t start, uint64_t end)
+  {
+    const int col = find_column(path, column_hashes, column_indices, num_columns);
+    if (col < 0) return;
+    // Arrays and deeply nested objects are read as their JSON text
+    if (data[start] == '[' || data[start] == '{') {
       atomicAdd(&column_infos[col].string_count, 1);
-    } else {
-      // A date field can have either one or two '-' or '\'; A legal combination will only have one
-      // of them To simplify the process of auto column detection, we are not covering all the
-      // date-time formation permutations
-      if ((dash_count > 0 && dash_count <= 2 && slash_count == 0) ||
-          (dash_count == 0 && slash_count > 0 && slash_count <= 2)) {
-        if (colon_count <= 2) {
-          atomicAdd(&column_infos[col].datetime_count, 1);
-        } else {
-          atomicAdd(&column_infos[col].string_count, 1);
-        }
-      } else {
-        // Default field type is string
-        atomicAdd(&column_infos[col].string_count, 1);
-      }
+      return;
     }
+    long field_start     = start;
+    long field_data_last = end - 1;
+    trim_field_start_end(data, &field_start, &field_data_last);
+    detect_field_type(data, field_start, field_data_last, opts, &column_infos[col]);
   }
+};
+
+/**
+ * @brief Functor that converts each flattened value into the row of its column
+ **/
+struct nested_field_converter {
+  const char *data;
+  const ParseOptions &opts;
+  const uint64_t *column_hashes;
+  const cudf::size_type *column_indices;
+  int num_columns;
+  long rec_id;
+  const data_type *dtypes;
+  void *const *output_columns;
+  bitmask_type *const *valid_fields;
+  cudf::size_type *num_valid_fields;
+
+  __device__ void operator()(uint64_t path, uint64_t start, uint64_t end)
+  {
+    const int col = find_column(path, column_hashes, column_indices, num_columns);
+    // Keep the first valid value if a member name is repeated within the record
+    if (col < 0 || bit_is_set(valid_fields[col], rec_id)) return;
+    convert_field(data,
+                  start,
+                  end,
+                  rec_id,
+                  dtypes[col],
+                  opts,
+                  output_columns[col],
+                  valid_fields[col],
+                  &num_valid_fields[col]);
+  }
+};
+
+/**
+ * @brief CUDA kernel that determines the column types of records with nested objects.
+ *
+ * @param[in] data Input data buffer
+ * @param[in] data_size Size of the data buffer, in bytes
+ * @param[in] rec_starts The start of each data record
+ * @param[in] num_records The number of lines/rows
+ * @param[in] column_hashes Sorted path hashes of the columns
+ * @param[in] column_indices Column index of each hash in `column_hashes`
+ * @param[in] num_columns The number of columns
+ * @param[in] opts A set of parsing options
+ * @param[out] column_infos The count for each column data type
+ *
+ * @returns void
+ **/
+__global__ void detect_nested_json_data_types(const char *data,
+                                              size_t data_size,
+                                              const uint64_t *rec_starts,
+                                              cudf::size_type num_records,
+                                              const uint64_t *column_hashes,
+                                              const cudf::size_type *column_indices,
+                                              int num_columns,
+                                              const ParseOptions opts,
+                                              ColumnInfo *column_infos)
+{
+  const long rec_id = threadIdx.x + (blockDim.x * blockIdx.x);
+  if (rec_id >= num_records) return;
+
+  uint64_t start;
+  uint64_t stop;
+  get_record_range(rec_starts, num_records, data_size, rec_id, start, stop);
+
+  nested_type_detector detector{
+    data, opts, column_hashes, column_indices, num_columns, column_infos};
+  visit_json_leaves(data, start, stop, opts.quotechar, json_path_hasher{}, detector);
+}
+
+/**
+ * @brief CUDA kernel that converts records with nested objects into cuDF column data.
+ *
+ * Values are matched to columns by the hash of their dotted path; values of paths that are not
+ * columns are ignored, and columns without a value in a record are null.
+ *
+ * @param[in] data The entire data to read
+ * @param[in] data_size Size of the data buffer, in bytes
+ * @param[in] rec_starts The start of each data record
+ * @param[in] num_records The number of lines/rows
+ * @param[in] column_hashes Sorted path hashes of the columns
+ * @param[in] column_indices Column index of each hash in `column_hashes`
+ * @param[in] num_columns The number of columns
+ * @param[in] dtypes The data type of each column
+ * @param[in] opts A set of parsing options
+ * @param[out] output_columns The output column data
+ * @param[out] valid_fields The bitmaps indicating whether column fields are valid
+ * @param[out] num_valid_fields The numbers of valid fields in columns
+ *
+ * @return void
+ **/
+__global__ void convert_nested_json_to_columns_kernel(const char *data,
+                                                      size_t data_size,
+                                                      const uint64_t *rec_starts,
+                                                      cudf::size_type num_records,
+                                                      const uint64_t *column_hashes,
+                                                      const cudf::size_type *column_indices,
+                                                      int num_columns,
+                                                      const data_type *dtypes,
+                                                      ParseOptions opts,
+                                                      void *const *output_columns,
+                                                      bitmask_type *const *valid_fields,
+                                                      cudf::size_type *num_valid_fields)
+{
+  const long rec_id = threadIdx.x + (blockDim.x * blockIdx.x);
+  if (rec_id >= num_records) return;
+
+  uint64_t start;
+  uint64_t stop;
+  get_record_range(rec_starts, num_records, data_size, rec_id, start, stop);
+
+  nested_field_converter converter{data,
+                                   opts,
+                                   column_hashes,
+                                   column_indices,
+                                   num_columns,
+                                   rec_id,
+                                   dtypes,
+                                   output_columns,
+                                   valid_fields,
+                                   num_valid_fields};
+  visit_json_leaves(data, start, stop, opts.quotechar, json_path_hasher{}, converter);
 }
 
 }  // namespace
@@ -671,6 +913,82 @@ void detect_data_types(ColumnInfo *column_infos,
   CUDA_TRY(cudaGetLastError());
 }
 
+/**
+ * @copydoc cudf::io::json::gpu::detect_nested_data_types
+ *
+ **/
+void detect_nested_data_types(ColumnInfo *column_infos,
+                              const char *data,
+                              size_t data_size,
+                              const uint64_t *rec_starts,
+                              cudf::size_type num_records,
+                              const uint64_t *column_hashes,
+                              const cudf::size_type *column_indices,
+                              int num_columns,
+                              const ParseOptions &options,
+                              cudaStream_t stream)
+{
+  int block_size;
+  int min_grid_size;
+  CUDA_TRY(cudaOccupancyMaxPotentialBlockSize(
+    &min_grid_size, &block_size, detect_nested_json_data_types));
+
+  const int grid_size = (num_records + block_size - 1) / block_size;
+
+  detect_nested_json_data_types<<<grid_size, block_size, 0, stream>>>(data,
+                                                                      data_size,
+                                                                      rec_starts,
+                                                                      num_records,
+                                                                      column_hashes,
+                                                                      column_indices,
+                                                                      num_columns,
+                                                                      options,
+                                                                      column_infos);
+
+  CUDA_TRY(cudaGetLastError());
+}
+
+/**
+ * @copydoc cudf::io::json::gpu::convert_nested_json_to_columns
+ *
+ **/
+void convert_nested_json_to_columns(rmm::device_buffer const &input_data,
+                                    data_type *const dtypes,
+                                    void *const *output_columns,
+                                    cudf::size_type num_records,
+                                    cudf::size_type num_columns,
+                                    const uint64_t *rec_starts,
+                                    const uint64_t *column_hashes,
+                                    const cudf::size_type *column_indices,
+                                    bitmask_type *const *valid_fields,
+                                    cudf::size_type *num_valid_fields,
+                                    ParseOptions const &opts,
+                                    cudaStream_t stream)
+{
+  int block_size;
+  int min_grid_size;
+  CUDA_TRY(cudaOccupancyMaxPotentialBlockSize(
+    &min_grid_size, &block_size, convert_nested_json_to_columns_kernel));
+
+  const int grid_size = (num_records + block_size - 1) / block_size;
+
+  convert_nested_json_to_columns_kernel<<<grid_size, block_size, 0, stream>>>(
+    static_cast<const char *>(input_data.data()),
+    input_data.size(),
+    rec_starts,
+    num_records,
+    column_hashes,
+    column_indices,
+    num_columns,
+    dtypes,
+    opts,
+    output_columns,
+    valid_fields,
+    num_valid_fields);
+
+  CUDA_TRY(cudaGetLastError());
+}
+
 }  // namespace gpu
 }  // namespace json
 }  // namespace io
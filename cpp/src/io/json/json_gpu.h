@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include "json_common.h"
+
 #include <cudf/types.hpp>
 #include <io/utilities/parsing_utils.cuh>
 
@@ -73,6 +75,70 @@ void detect_data_types(ColumnInfo *column_infos,
                        cudf::size_type num_records,
                        cudaStream_t stream = 0);
 
+/**
+ * @brief Determines the column types of records, with nested objects flattened into dotted-path
+ * columns.
+ *
+ * Each record is tokenized as its values are matched to columns.
+ *
+ * @param[out] column_infos The count for each column data type
+ * @param[in] data Input data buffer
+ * @param[in] data_size Size of the data buffer, in bytes
+ * @param[in] rec_starts The start of each data record
+ * @param[in] num_records The number of lines/rows of input data
+ * @param[in] column_hashes Sorted hashes of the column paths
+ * @param[in] column_indices Column index of each hash in `column_hashes`
+ * @param[in] num_columns The number of columns
+ * @param[in] opts A set of parsing options
+ * @param[in] stream Cuda stream to run kernels on
+ *
+ * @returns void
+ **/
+void detect_nested_data_types(ColumnInfo *column_infos,
+                              const char *data,
+                              size_t data_size,
+                              const uint64_t *rec_starts,
+                              cudf::size_type num_records,
+                              const uint64_t *column_hashes,
+                              const cudf::size_type *column_indices,
+                              int num_columns,
+                              const ParseOptions &options,
+                              cudaStream_t stream = 0);
+
+/**
+ * @brief Converts records into raw cuDF column data, with nested objects flattened into
+ * dotted-path columns.
+ *
+ * Each record is tokenized as its values are matched to columns.
+ *
+ * @param[in] input_data The entire data to read
+ * @param[in] dtypes The data type of each column
+ * @param[out] output_columns The output column data
+ * @param[in] num_records The number of lines/rows
+ * @param[in] num_columns The number of columns
+ * @param[in] rec_starts The start of each data record
+ * @param[in] column_hashes Sorted hashes of the column paths
+ * @param[in] column_indices Column index of each hash in `column_hashes`
+ * @param[out] valid_fields The bitmaps indicating whether column fields are valid
+ * @param[out] num_valid_fields The numbers of valid fields in columns
+ * @param[in] opts A set of parsing options
+ * @param[in] stream Cuda stream to run kernels on
+ *
+ * @returns void
+ **/
+void convert_nested_json_to_columns(rmm::device_buffer const &input_data,
+                                    data_type *const dtypes,
+                                    void *const *output_columns,
+                                    cudf::size_type num_records,
+                                    cudf::size_type num_columns,
+                                    const uint64_t *rec_starts,
+                                    const uint64_t *column_hashes,
+                                    const cudf::size_type *column_indices,
+                                    bitmask_type *const *valid_fields,
+                                    cudf::size_type *num_valid_fields,
+                                    ParseOptions const &opts,
+                                    cudaStream_t stream = 0);
+
 }  // namespace gpu
 }  // namespace json
 }  // namespace io
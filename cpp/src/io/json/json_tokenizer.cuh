@@ -0,0 +1,217 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file json_tokenizer.cuh
+ * @brief Structural tokenization of JSON records, shared by the host and the device
+ */
+
+#pragma once
+
+#include "json_common.h"
+
+#include <cudf/types.hpp>
+
+#include <cstdint>
+
+namespace cudf {
+namespace io {
+namespace json {
+/// Maximum depth of objects flattened into columns; deeper objects are read as JSON text
+constexpr int max_flattened_depth = 16;
+
+CUDA_HOST_DEVICE_CALLABLE bool is_json_whitespace(char c)
+{
+  return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
+/**
+ * @brief Reads the next structural token of a record, skipping whitespace and separators.
+ *
+ * @param[in] data Input data
+ * @param[in,out] pos Position to start from; set to the position after the token
+ * @param[in] stop End of the record (one past the last character)
+ * @param[in] quotechar Quotation character
+ * @param[in,out] depth Current nesting depth; updated by brackets
+ * @param[out] token Token that was read
+ *
+ * @return `true` if a token was read, `false` at the end of the record
+ **/
+CUDA_HOST_DEVICE_CALLABLE bool next_json_token(
+  const char *data, uint64_t &pos, uint64_t stop, char quotechar, int &depth, json_token &token)
+{
+  while (pos < stop && (is_json_whitespace(data[pos]) || data[pos] == ',' || data[pos] == ':')) {
+    ++pos;
+  }
+  if (pos >= stop) { return false; }
+
+  char const c = data[pos];
+  token.start  = pos;
+  if (c == '{' || c == '[') {
+    token.kind  = (c == '{') ? token_kind::OBJECT_BEGIN : token_kind::ARRAY_BEGIN;
+    token.depth = depth++;
+    token.end   = ++pos;
+  } else if (c == '}' || c == ']') {
+    depth       = (depth > 0) ? depth - 1 : 0;
+    token.kind  = (c == '}') ? token_kind::OBJECT_END : token_kind::ARRAY_END;
+    token.depth = depth;
+    token.end   = ++pos;
+  } else if (c == quotechar) {
+    // A quote escaped by an odd number of backslashes does not end the string, while one that
+    // follows escaped backslashes does (e.g. "C:\\")
+    auto end     = pos + 1;
+    bool escaped = false;
+    while (end < stop && (escaped || data[end] != quotechar)) {
+      escaped = !escaped && data[end] == '\\';
+      ++end;
+    }
+    end = (end < stop) ? end + 1 : stop;
+    // A quoted string followed by a colon is the name of an object member
+    auto next = end;
+    while (next < stop && is_json_whitespace(data[next])) { ++next; }
+    if (next < stop && data[next] == ':') {
+      token.kind  = token_kind::KEY;
+      token.start = pos + 1;
+      token.end   = end - 1;
+    } else {
+      token.kind = token_kind::VALUE;
+      token.end  = end;
+    }
+    token.depth = depth;
+    pos         = end;
+  } else {
+    // Unquoted literal: number, boolean or null
+    while (pos < stop && !is_json_whitespace(data[pos]) && data[pos] != ',' && data[pos] != ':' &&
+           data[pos] != '}' && data[pos] != ']') {
+      ++pos;
+    }
+    token.kind  = token_kind::VALUE;
+    token.depth = depth;
+    token.end   = pos;
+  }
+  return true;
+}
+
+/**
+ * @brief Builds 64-bit FNV-1a hashes of dotted member paths on the device.
+ *
+ * Appending a member to a path hashes the separator and the member name, so the hash of a path
+ * built member by member equals `hash_json_path()` of the whole dotted path.
+ **/
+struct json_path_hasher {
+  using path_type = uint64_t;
+
+  static constexpr uint64_t offset_basis = 14695981039346656037ull;
+  static constexpr uint64_t prime        = 1099511628211ull;
+
+  CUDA_HOST_DEVICE_CALLABLE path_type root() const { return offset_basis; }
+
+  CUDA_HOST_DEVICE_CALLABLE path_type append(path_type parent, const char *name, size_t len) const
+  {
+    auto hash = parent;
+    if (parent != offset_basis) { hash = (hash ^ static_cast<uint8_t>('.')) * prime; }
+    for (size_t i = 0; i < len; ++i) { hash = (hash ^ static_cast<uint8_t>(name[i])) * prime; }
+    return hash;
+  }
+};
+
+/**
+ * @brief Returns the hash of a dotted member path, as built by `json_path_hasher`
+ **/
+inline uint64_t hash_json_path(const char *path, size_t len)
+{
+  uint64_t hash = json_path_hasher::offset_basis;
+  for (size_t i = 0; i < len; ++i) {
+    hash = (hash ^ static_cast<uint8_t>(path[i])) * json_path_hasher::prime;
+  }
+  return hash;
+}
+
+/**
+ * @brief Calls `on_leaf(path, start, end)` for every flattened value of a record.
+ *
+ * The record is tokenized as it is walked, so its tokens are never stored. Members of nested
+ * objects are named by their dotted path from the record root, and elements of a top-level array
+ * by their index. Arrays within the record, and objects nested deeper than `max_flattened_depth`,
+ * are single values that span their JSON text.
+ *
+ * @param[in] data Input data
+ * @param[in] pos Start of the record
+ * @param[in] stop End of the record (one past the last character)
+ * @param[in] quotechar Quotation character
+ * @param[in] paths Path builder providing `root()` and `append(parent, name, len)`
+ * @param[in] on_leaf Callable taking the path and the byte range of every value
+ **/
+#pragma nv_exec_check_disable
+template <typename PathBuilder, typename LeafFunc>
+CUDA_HOST_DEVICE_CALLABLE void visit_json_leaves(const char *data,
+                                                 uint64_t pos,
+                                                 uint64_t stop,
+                                                 char quotechar,
+                                                 PathBuilder const &paths,
+                                                 LeafFunc &on_leaf)
+{
+  using path_type = typename PathBuilder::path_type;
+  json_token token;
+  int depth = 0;
+  if (!next_json_token(data, pos, stop, quotechar, depth, token)) { return; }
+
+  bool const root_is_array = (token.kind == token_kind::ARRAY_BEGIN);
+  path_type stack[max_flattened_depth];
+  stack[0]         = paths.root();
+  int top          = 0;
+  int element      = 0;
+  path_type member = stack[0];
+  // A record ends with its top level closing bracket
+  while (depth > 0 && next_json_token(data, pos, stop, quotechar, depth, token)) {
+    if (token.kind == token_kind::KEY) {
+      member = paths.append(stack[top], data + token.start, token.end - token.start);
+      continue;
+    }
+    if (token.kind == token_kind::OBJECT_END || token.kind == token_kind::ARRAY_END) {
+      // Only flattened objects push a path; the record's own closing bracket is at depth 0
+      if (token.depth > 0 && top > 0) { --top; }
+      continue;
+    }
+    if (root_is_array && token.depth == 1) {
+      char digits[16];
+      int len = 0;
+      for (int n = element++; len == 0 || n > 0; n /= 10) { digits[len++] = '0' + n % 10; }
+      for (int d = 0; d < len / 2; ++d) {
+        char const tmp      = digits[d];
+        digits[d]           = digits[len - 1 - d];
+        digits[len - 1 - d] = tmp;
+      }
+      member = paths.append(stack[0], digits, len);
+    }
+    if (token.kind == token_kind::VALUE) {
+      on_leaf(member, token.start, token.end);
+    } else if (token.kind == token_kind::OBJECT_BEGIN && top + 1 < max_flattened_depth) {
+      stack[++top] = member;
+    } else {
+      // Arrays, and objects nested too deeply, are read as their JSON text, up to their closing
+      // bracket or the end of the record
+      auto const value_depth = static_cast<int>(token.depth);
+      auto const value_start = token.start;
+      while (depth > value_depth && next_json_token(data, pos, stop, quotechar, depth, token)) {}
+      on_leaf(member, value_start, token.end);
+    }
+  }
+}
+
+}  // namespace json
+}  // namespace io
+}  // namespace cudf
@@ -20,6 +20,7 @@
  **/
 
 #include "reader_impl.hpp"
+#include "json_tokenizer.cuh"
 
 #include <rmm/thrust_rmm_allocator.h>
 
@@ -33,6 +34,9 @@
 
 #include <cudf/table/table.hpp>
 
+#include <algorithm>
+#include <set>
+
 namespace cudf {
 namespace io {
 namespace detail {
@@ -83,6 +87,41 @@ std::vector<std::string> get_names_from_json_object(const std::vector<char> &jso
   return names;
 }
 
+/**
+ * @brief Builds dotted member paths as strings, mirroring `json_path_hasher`
+ **/
+struct json_path_builder {
+  using path_type = std::string;
+
+  path_type root() const { return {}; }
+
+  path_type append(path_type const &parent, const char *name, size_t len) const
+  {
+    return parent.empty() ? std::string(name, len) : parent + '.' + std::string(name, len);
+  }
+};
+
+/**
+ * @brief Extract the dotted paths of all values in a JSON record, with nested objects flattened
+ *
+ * @param[in] json_record Host vector containing the JSON record
+ * @param[in] opts Parsing options (e.g. delimiter and quotation character)
+ *
+ * @return std::vector<std::string> unique paths in the order of first appearance
+ **/
+std::vector<std::string> get_paths_from_json_record(const std::vector<char> &json_record,
+                                                    const ParseOptions &opts)
+{
+  std::vector<std::string> paths;
+  std::set<std::string> seen;
+  auto add_path = [&](std::string const &path, uint64_t, uint64_t) {
+    if (seen.insert(path).second) { paths.push_back(path); }
+  };
+  visit_json_leaves(
+    json_record.data(), 0, json_record.size(), opts.quotechar, json_path_builder{}, add_path);
+  return paths;
+}
+
 /**
  * @brief Estimates the maximum expected length or a row, based on the number
  * of columns
@@ -324,7 +363,31 @@ void reader::impl::set_column_names(cudaStream_t stream)
                "Input data is not a valid JSON file.");
   // If the first opening bracket is '{', assume object format
   const bool is_object = first_curly_bracket < first_square_bracket;
-  if (is_object) {
+  if (args_.flatten_nested) {
+    metadata.column_names = get_paths_from_json_record(first_row, opts_);
+
+    // Map the hash of each path to its column for lookups on the device
+    std::vector<std::pair<uint64_t, cudf::size_type>> hashed_paths;
+    for (size_t col = 0; col < metadata.column_names.size(); ++col) {
+      auto const &name = metadata.column_names[col];
+      hashed_paths.emplace_back(hash_json_path(name.data(), name.size()), col);
+    }
+    std::sort(hashed_paths.begin(), hashed_paths.end());
+    CUDF_EXPECTS(std::adjacent_find(hashed_paths.begin(),
+                                    hashed_paths.end(),
+                                    [](auto const &lhs, auto const &rhs) {
+                                      return lhs.first == rhs.first;
+                                    }) == hashed_paths.end(),
+                 "Colliding hashes of nested column names.\n");
+    thrust::host_vector<uint64_t> h_hashes(hashed_paths.size());
+    thrust::host_vector<cudf::size_type> h_indices(hashed_paths.size());
+    for (size_t i = 0; i < hashed_paths.size(); ++i) {
+      h_hashes[i]  = hashed_paths[i].first;
+      h_indices[i] = hashed_paths[i].second;
+    }
+    d_column_hashes_  = h_hashes;
+    d_column_indices_ = h_indices;
+  } else if (is_object) {
     metadata.column_names = get_names_from_json_object(first_row, opts_);
   } else {
     int cols_found = 0;
@@ -391,14 +454,27 @@ void reader::impl::set_data_types(cudaStream_t stream)
 
     rmm::device_vector<cudf::io::json::ColumnInfo> d_column_infos(num_columns,
                                                                   cudf::io::json::ColumnInfo{});
-    cudf::io::json::gpu::detect_data_types(d_column_infos.data().get(),
-                                           static_cast<const char *>(data_.data()),
-                                           data_.size(),
-                                           opts_,
-                                           num_columns,
-                                           rec_starts_.data().get(),
-                                           rec_starts_.size(),
-                                           stream);
+    if (args_.flatten_nested) {
+      cudf::io::json::gpu::detect_nested_data_types(d_column_infos.data().get(),
+                                                    static_cast<const char *>(data_.data()),
+                                                    data_.size(),
+                                                    rec_starts_.data().get(),
+                                                    rec_starts_.size(),
+                                                    d_column_hashes_.data().get(),
+                                                    d_column_indices_.data().get(),
+                                                    num_columns,
+                                                    opts_,
+                                                    stream);
+    } else {
+      cudf::io::json::gpu::detect_data_types(d_column_infos.data().get(),
+                                             static_cast<const char *>(data_.data()),
+                                             data_.size(),
+                                             opts_,
+                                             num_columns,
+                                             rec_starts_.data().get(),
+                                             rec_starts_.size(),
+                                             stream);
+    }
     thrust::host_vector<cudf::io::json::ColumnInfo> h_column_infos = d_column_infos;
 
     for (const auto &cinfo : h_column_infos) {
@@ -455,16 +531,31 @@ table_with_metadata reader::impl::convert_data_to_table(cudaStream_t stream)
   rmm::device_vector<cudf::bitmask_type *> d_valid = h_valid;
   rmm::device_vector<cudf::size_type> d_valid_counts(num_columns, 0);
 
-  cudf::io::json::gpu::convert_json_to_columns(data_,
-                                               d_dtypes.data().get(),
-                                               d_data.data().get(),
-                                               num_records,
-                                               num_columns,
-                                               rec_starts_.data().get(),
-                                               d_valid.data().get(),
-                                               d_valid_counts.data().get(),
-                                               opts_,
-                                               stream);
+  if (args_.flatten_nested) {
+    cudf::io::json::gpu::convert_nested_json_to_columns(data_,
+                                                        d_dtypes.data().get(),
+                                                        d_data.data().get(),
+                                                        num_records,
+                                                        num_columns,
+                                                        rec_starts_.data().get(),
+                                                        d_column_hashes_.data().get(),
+                                                        d_column_indices_.data().get(),
+                                                        d_valid.data().get(),
+                                                        d_valid_counts.data().get(),
+                                                        opts_,
+                                                        stream);
+  } else {
+    cudf::io::json::gpu::convert_json_to_columns(data_,
+                                                 d_dtypes.data().get(),
+                                                 d_data.data().get(),
+                                                 num_records,
+                                                 num_columns,
+                                                 rec_starts_.data().get(),
+                                                 d_valid.data().get(),
+                                                 d_valid_counts.data().get(),
+                                                 opts_,
+                                                 stream);
+  }
   CUDA_TRY(cudaStreamSynchronize(stream));
   CUDA_TRY(cudaGetLastError());
 
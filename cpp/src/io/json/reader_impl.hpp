@@ -66,6 +66,10 @@ class reader::impl {
   size_t byte_range_size_   = 0;
   bool load_whole_file_     = true;
 
+  // Sorted hashes of the dotted column paths and the column index of each hash
+  rmm::device_vector<uint64_t> d_column_hashes_;
+  rmm::device_vector<cudf::size_type> d_column_indices_;
+
   table_metadata metadata;
   std::vector<data_type> dtypes_;
 
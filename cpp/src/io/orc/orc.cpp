@@ -111,6 +111,59 @@ void ProtobufReader::skip_struct_field(int t)
     break;                                       \
   }
 
+// Optional fields also record their presence in the matching has_<field> member
+#define ORC_FLD_OPT_UINT64(id, m) \
+  case (id)*8 + PB_TYPE_VARINT:   \
+    s->m       = get_u64();       \
+    s->has_##m = true;            \
+    break;
+
+#define ORC_FLD_OPT_INT64(id, m) \
+  case (id)*8 + PB_TYPE_VARINT:  \
+    s->m       = get_i64();      \
+    s->has_##m = true;           \
+    break;
+
+#define ORC_FLD_OPT_INT32(id, m) \
+  case (id)*8 + PB_TYPE_VARINT:  \
+    s->m       = get_i32();      \
+    s->has_##m = true;           \
+    break;
+
+#define ORC_FLD_OPT_BOOL(id, m)    \
+  case (id)*8 + PB_TYPE_VARINT:    \
+    s->m       = (get_u32() != 0); \
+    s->has_##m = true;             \
+    break;
+
+#define ORC_FLD_OPT_DOUBLE(id, m)      \
+  case (id)*8 + PB_TYPE_FIXED64: {     \
+    if (end - m_cur < 8) return false; \
+    memcpy(&s->m, m_cur, 8);           \
+    m_cur += 8;                        \
+    s->has_##m = true;                 \
+    break;                             \
+  }
+
+#define ORC_FLD_OPT_STRING(id, m)                \
+  case (id)*8 + PB_TYPE_FIXEDLEN: {              \
+    uint32_t n = get_u32();                      \
+    if (n > (size_t)(end - m_cur)) return false; \
+    s->m.assign((const char *)m_cur, n);         \
+    m_cur += n;                                  \
+    s->has_##m = true;                           \
+    break;                                       \
+  }
+
+#define ORC_FLD_OPT_STRUCT(id, m)                \
+  case (id)*8 + PB_TYPE_FIXEDLEN: {              \
+    uint32_t n = get_u32();                      \
+    if (n > (size_t)(end - m_cur)) return false; \
+    if (!read(&s->m, n)) return false;           \
+    s->has_##m = true;                           \
+    break;                                       \
+  }
+
 #define ORC_END_STRUCT_(postproccond)                                    \
   default: /*printf("unknown fld %d of type %d\n", fld >> 3, fld & 7);*/ \
            skip_struct_field(fld & 7);                                   \
@@ -189,6 +242,43 @@ ORC_BEGIN_STRUCT(Metadata)
 ORC_FLD_REPEATED_STRUCT(1, stripeStats)
 ORC_END_STRUCT()
 
+ORC_BEGIN_STRUCT(IntegerStatistics)
+ORC_FLD_OPT_INT64(1, minimum)
+ORC_FLD_OPT_INT64(2, maximum)
+ORC_END_STRUCT()
+
+ORC_BEGIN_STRUCT(DoubleStatistics)
+ORC_FLD_OPT_DOUBLE(1, minimum)
+ORC_FLD_OPT_DOUBLE(2, maximum)
+ORC_END_STRUCT()
+
+ORC_BEGIN_STRUCT(StringStatistics)
+ORC_FLD_OPT_STRING(1, minimum)
+ORC_FLD_OPT_STRING(2, maximum)
+ORC_END_STRUCT()
+
+ORC_BEGIN_STRUCT(DateStatistics)
+ORC_FLD_OPT_INT32(1, minimum)
+ORC_FLD_OPT_INT32(2, maximum)
+ORC_END_STRUCT()
+
+ORC_BEGIN_STRUCT(ColumnStatisticsInfo)
+ORC_FLD_OPT_UINT64(1, numberOfValues)
+ORC_FLD_OPT_STRUCT(2, intStatistics)
+ORC_FLD_OPT_STRUCT(3, doubleStatistics)
+ORC_FLD_OPT_STRUCT(4, stringStatistics)
+ORC_FLD_OPT_STRUCT(7, dateStatistics)
+ORC_FLD_OPT_BOOL(10, hasNull)
+ORC_END_STRUCT()
+
+ORC_BEGIN_STRUCT(RowIndexEntry)
+ORC_FLD_OPT_STRUCT(2, statistics)
+ORC_END_STRUCT()
+
+ORC_BEGIN_STRUCT(RowIndex)
+ORC_FLD_REPEATED_STRUCT(1, entry)
+ORC_END_STRUCT()
+
 // return the column name
 std::string FileFooter::GetColumnName(uint32_t column_id)
 {
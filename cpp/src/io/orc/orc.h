@@ -105,6 +105,59 @@ struct Metadata {
   std::vector<StripeStatistics> stripeStats;
 };
 
+struct IntegerStatistics {
+  int64_t minimum  = 0;  // optional: the minimum value
+  int64_t maximum  = 0;  // optional: the maximum value
+  bool has_minimum = false;
+  bool has_maximum = false;
+};
+
+struct DoubleStatistics {
+  double minimum   = 0;  // optional: the minimum value
+  double maximum   = 0;  // optional: the maximum value
+  bool has_minimum = false;
+  bool has_maximum = false;
+};
+
+struct StringStatistics {
+  std::string minimum;  // optional: the minimum value (absent if truncated)
+  std::string maximum;  // optional: the maximum value (absent if truncated)
+  bool has_minimum = false;
+  bool has_maximum = false;
+};
+
+struct DateStatistics {
+  int32_t minimum  = 0;  // optional: the minimum value in days since epoch
+  int32_t maximum  = 0;  // optional: the maximum value in days since epoch
+  bool has_minimum = false;
+  bool has_maximum = false;
+};
+
+struct ColumnStatisticsInfo {
+  uint64_t numberOfValues = 0;  // optional: the number of non-null values
+  IntegerStatistics intStatistics;
+  DoubleStatistics doubleStatistics;
+  StringStatistics stringStatistics;
+  DateStatistics dateStatistics;
+  bool hasNull = true;  // optional: whether any value is null
+  // Presence of the optional fields
+  bool has_numberOfValues   = false;
+  bool has_intStatistics    = false;
+  bool has_doubleStatistics = false;
+  bool has_stringStatistics = false;
+  bool has_dateStatistics   = false;
+  bool has_hasNull          = false;
+};
+
+struct RowIndexEntry {
+  ColumnStatisticsInfo statistics;  // optional: statistics of the rows of the entry
+  bool has_statistics = false;
+};
+
+struct RowIndex {
+  std::vector<RowIndexEntry> entry;  // one entry per row group (rowIndexStride rows)
+};
+
 // Minimal protobuf reader for orc metadata
 
 /**
@@ -170,6 +223,13 @@ class ProtobufReader {
   DECL_ORC_STRUCT(ColumnEncoding);
   DECL_ORC_STRUCT(StripeStatistics);
   DECL_ORC_STRUCT(Metadata);
+  DECL_ORC_STRUCT(IntegerStatistics);
+  DECL_ORC_STRUCT(DoubleStatistics);
+  DECL_ORC_STRUCT(StringStatistics);
+  DECL_ORC_STRUCT(DateStatistics);
+  DECL_ORC_STRUCT(ColumnStatisticsInfo);
+  DECL_ORC_STRUCT(RowIndexEntry);
+  DECL_ORC_STRUCT(RowIndex);
 #undef DECL_ORC_STRUCT
  protected:
   bool InitSchema(FileFooter *);
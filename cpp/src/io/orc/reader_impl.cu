@@ -22,8 +22,14 @@
 #include "reader_impl.hpp"
 #include "timezone.h"
 
+#include <io/comp/cpu_comp.h>
 #include <io/comp/gpuinflate.h>
+#include <io/comp/io_uncomp.h>
+#include <io/utilities/metadata_cache.hpp>
+#include <io/utilities/stats_filter.hpp>
 
+#include <cudf/detail/concatenate.cuh>
+#include <cudf/null_mask.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/utilities/error.hpp>
 #include <cudf/utilities/traits.hpp>
@@ -33,6 +39,9 @@
 
 #include <algorithm>
 #include <array>
+#include <cmath>
+#include <future>
+#include <map>
 
 namespace cudf {
 namespace io {
@@ -118,6 +127,114 @@ constexpr std::pair<gpu::StreamIndexType, uint32_t> get_index_type_and_pos(
   }
 }
 
+/**
+ * @brief Converts the ORC statistics of a column over a range of rows for filter evaluation
+ *
+ * @param info Parsed column statistics
+ * @param schema Schema of the column
+ * @param is_top_level Whether the column is a direct child of the root, whose non-null value
+ * count is relative to the rows of the range
+ * @param num_rows Number of rows in the range
+ */
+column_range_statistics decode_column_statistics(const ColumnStatisticsInfo &info,
+                                                 const orc::SchemaType &schema,
+                                                 bool is_top_level,
+                                                 int64_t num_rows)
+{
+  column_range_statistics stats;
+  if (is_top_level && info.has_numberOfValues) {
+    stats.has_null_count = true;
+    stats.null_count     = std::max<int64_t>(num_rows - info.numberOfValues, 0);
+  } else if (is_top_level && info.has_hasNull && !info.hasNull) {
+    stats.has_null_count = true;
+  }
+
+  auto const set_min_max = [&](auto const &minmax) {
+    if (minmax.has_minimum && minmax.has_maximum) {
+      stats.has_min_max = true;
+      stats.min_value   = filter_literal(minmax.minimum);
+      stats.max_value   = filter_literal(minmax.maximum);
+    }
+  };
+  switch (schema.kind) {
+    case orc::BYTE:
+    case orc::SHORT:
+    case orc::INT:
+    case orc::LONG:
+      if (info.has_intStatistics) { set_min_max(info.intStatistics); }
+      break;
+    case orc::FLOAT:
+    case orc::DOUBLE:
+      if (info.has_doubleStatistics && !std::isnan(info.doubleStatistics.minimum) &&
+          !std::isnan(info.doubleStatistics.maximum)) {
+        set_min_max(info.doubleStatistics);
+      }
+      break;
+    case orc::STRING:
+    case orc::VARCHAR:
+    case orc::CHAR:
+      if (info.has_stringStatistics) { set_min_max(info.stringStatistics); }
+      break;
+    case orc::DATE:
+      // Days since epoch; some writers store them as integer statistics
+      if (info.has_dateStatistics) {
+        set_min_max(info.dateStatistics);
+      } else if (info.has_intStatistics) {
+        set_min_max(info.intStatistics);
+      }
+      break;
+    default: break;
+  }
+  return stats;
+}
+
+/**
+ * @brief Parsed postscript and file footer of an ORC file
+ **/
+struct file_metadata {
+  PostScript ps;
+  FileFooter ff;
+  size_t postscript_length = 0;
+};
+
+/**
+ * @brief Reads and parses the postscript and file footer of a dataset
+ *
+ * @param source Dataset source
+ * @param footer_size Set to the size of the decompressed file footer
+ **/
+std::shared_ptr<file_metadata const> read_file_metadata(datasource *source, size_t *footer_size)
+{
+  auto parsed            = std::make_shared<file_metadata>();
+  auto &ps               = parsed->ps;
+  const auto len         = source->size();
+  const auto max_ps_size = std::min(len, static_cast<size_t>(256));
+
+  // Read uncompressed postscript section (max 255 bytes + 1 byte for length)
+  auto buffer            = source->get_buffer(len - max_ps_size, max_ps_size);
+  const size_t ps_length = buffer->data()[max_ps_size - 1];
+  const uint8_t *ps_data = &buffer->data()[max_ps_size - ps_length - 1];
+  ProtobufReader pb;
+  pb.init(ps_data, ps_length);
+  CUDF_EXPECTS(pb.read(&ps, ps_length), "Cannot read postscript");
+  CUDF_EXPECTS(ps.footerLength + ps_length < len, "Invalid footer length");
+  parsed->postscript_length = ps_length;
+
+  // If compression is used, all the rest of the metadata is compressed
+  // If no compressed is used, the decompressor is simply a pass-through
+  OrcDecompressor decompressor(ps.compression, ps.compressionBlockSize);
+
+  // Read compressed filefooter section
+  buffer           = source->get_buffer(len - ps_length - 1 - ps.footerLength, ps.footerLength);
+  size_t ff_length = 0;
+  auto ff_data     = decompressor.Decompress(buffer->data(), ps.footerLength, &ff_length);
+  pb.init(ff_data, ff_length);
+  CUDF_EXPECTS(pb.read(&parsed->ff, ff_length), "Cannot read filefooter");
+  CUDF_EXPECTS(parsed->ff.types.size() > 0, "No columns found");
+  *footer_size = ff_length;
+  return parsed;
+}
+
 }  // namespace
 
 /**
@@ -128,31 +245,13 @@ class metadata {
   using OrcStripeInfo = std::pair<const StripeInformation *, const StripeFooter *>;
 
  public:
-  explicit metadata(datasource *const src) : source(src)
+  explicit metadata(datasource *const src, file_metadata const &parsed)
+    : ps(parsed.ps),
+      ff(parsed.ff),
+      decompressor(std::make_unique<OrcDecompressor>(ps.compression, ps.compressionBlockSize)),
+      source(src),
+      postscript_length(parsed.postscript_length)
   {
-    const auto len         = source->size();
-    const auto max_ps_size = std::min(len, static_cast<size_t>(256));
-
-    // Read uncompressed postscript section (max 255 bytes + 1 byte for length)
-    auto buffer            = source->get_buffer(len - max_ps_size, max_ps_size);
-    const size_t ps_length = buffer->data()[max_ps_size - 1];
-    const uint8_t *ps_data = &buffer->data()[max_ps_size - ps_length - 1];
-    ProtobufReader pb;
-    pb.init(ps_data, ps_length);
-    CUDF_EXPECTS(pb.read(&ps, ps_length), "Cannot read postscript");
-    CUDF_EXPECTS(ps.footerLength + ps_length < len, "Invalid footer length");
-
-    // If compression is used, all the rest of the metadata is compressed
-    // If no compressed is used, the decompressor is simply a pass-through
-    decompressor = std::make_unique<OrcDecompressor>(ps.compression, ps.compressionBlockSize);
-
-    // Read compressed filefooter section
-    buffer           = source->get_buffer(len - ps_length - 1 - ps.footerLength, ps.footerLength);
-    size_t ff_length = 0;
-    auto ff_data     = decompressor->Decompress(buffer->data(), ps.footerLength, &ff_length);
-    pb.init(ff_data, ff_length);
-    CUDF_EXPECTS(pb.read(&ff, ff_length), "Cannot read filefooter");
-    CUDF_EXPECTS(get_num_columns() > 0, "No columns found");
   }
 
   /**
@@ -280,6 +379,148 @@ class metadata {
     return selection;
   }
 
+  /**
+   * @brief Reads the per-stripe column statistics from the metadata section, if not yet read
+   *
+   * @return False if the file has no usable stripe statistics
+   **/
+  bool read_stripe_statistics()
+  {
+    if (md.stripeStats.size() == 0 && ps.metadataLength != 0) {
+      const auto len = source->size();
+      if (ps.metadataLength + ps.footerLength + postscript_length >= len) { return false; }
+      const auto md_offset = len - postscript_length - 1 - ps.footerLength - ps.metadataLength;
+      const auto buffer    = source->get_buffer(md_offset, ps.metadataLength);
+      size_t md_length     = 0;
+      const auto md_data   = decompressor->Decompress(buffer->data(), buffer->size(), &md_length);
+      ProtobufReader pb(md_data, md_length);
+      if (md_data == nullptr || !pb.read(&md, md_length)) {
+        md.stripeStats.clear();
+        return false;
+      }
+    }
+    return md.stripeStats.size() == ff.stripes.size();
+  }
+
+  /**
+   * @brief Returns the ORC column index of a leaf column by name, or -1 if not found
+   **/
+  int find_column(std::string const &name)
+  {
+    for (int i = 0; i < get_num_columns(); ++i) {
+      if (ff.types[i].subtypes.size() == 0 && ff.GetColumnName(i) == name) { return i; }
+    }
+    return -1;
+  }
+
+  /**
+   * @brief Returns whether a column is a direct child of the root struct
+   **/
+  bool is_top_level_column(int column) const
+  {
+    const auto parent = ff.types[column].parent_idx;
+    return parent >= 0 && parent != column && ff.types[parent].parent_idx == parent;
+  }
+
+  /**
+   * @brief Returns the statistics of a column over a stripe, as recorded in the metadata section
+   *
+   * @param stripe Index of the stripe
+   * @param name Name of the column
+   **/
+  column_range_statistics get_stripe_statistics(size_t stripe, std::string const &name)
+  {
+    const auto column = find_column(name);
+    if (column < 0 || !read_stripe_statistics() ||
+        static_cast<size_t>(column) >= md.stripeStats[stripe].colStats.size()) {
+      return {};
+    }
+    const auto &blob = md.stripeStats[stripe].colStats[column];
+    ColumnStatisticsInfo info;
+    ProtobufReader pb(blob.data(), blob.size());
+    if (!pb.read(&info, blob.size())) { return {}; }
+    return decode_column_statistics(
+      info, ff.types[column], is_top_level_column(column), ff.stripes[stripe].numberOfRows);
+  }
+
+  /**
+   * @brief Returns the rows of a stripe that might satisfy a filter, from its first to its last
+   * matching row group, given the statistics of each row group (row index entry) of the filter's
+   * columns
+   *
+   * Columns whose row index holds no statistics never cause row groups to be skipped.
+   *
+   * @param stripe Stripe information
+   * @param stripefooter Stripe footer, listing the stripe's streams
+   * @param filter Filter expression
+   *
+   * @return First row within the stripe and number of rows; no rows if no row group can match
+   **/
+  std::pair<size_type, size_type> get_matching_row_groups(const StripeInformation *stripe,
+                                                          const StripeFooter *stripefooter,
+                                                          filter_expression const &filter)
+  {
+    const auto stride   = get_row_index_stride();
+    const auto all_rows = std::make_pair(0, static_cast<size_type>(stripe->numberOfRows));
+    if (stride <= 0 || stripe->numberOfRows <= static_cast<uint32_t>(stride)) { return all_rows; }
+
+    // Parse the row index of each filter column, if it has statistics
+    std::map<std::string, std::pair<int, RowIndex>> indexes;
+    for (const auto &name : get_filter_columns(filter)) {
+      const auto column = find_column(name);
+      if (column < 0) { continue; }
+      uint64_t stream_offset = 0;
+      for (const auto &strm : stripefooter->streams) {
+        if (strm.kind == orc::ROW_INDEX && strm.column == static_cast<uint32_t>(column) &&
+            stream_offset + strm.length <= stripe->indexLength) {
+          const auto buffer     = source->get_buffer(stripe->offset + stream_offset, strm.length);
+          size_t index_length   = 0;
+          const auto index_data =
+            decompressor->Decompress(buffer->data(), buffer->size(), &index_length);
+          RowIndex index;
+          ProtobufReader pb(index_data, index_length);
+          if (index_data != nullptr && pb.read(&index, index_length)) {
+            indexes[name] = std::make_pair(column, std::move(index));
+          }
+          break;
+        }
+        stream_offset += strm.length;
+      }
+    }
+    if (indexes.empty()) { return all_rows; }
+
+    const auto num_row_groups        = (stripe->numberOfRows + stride - 1) / stride;
+    const auto row_group_might_match = [&](uint32_t rg) {
+      const auto rg_rows   = std::min<int64_t>(stride, stripe->numberOfRows - rg * stride);
+      auto const get_stats = [&](std::string const &name) {
+        const auto it = indexes.find(name);
+        if (it == indexes.end() || rg >= it->second.second.entry.size() ||
+            !it->second.second.entry[rg].has_statistics) {
+          return column_range_statistics{};
+        }
+        const auto column = it->second.first;
+        return decode_column_statistics(it->second.second.entry[rg].statistics,
+                                        ff.types[column],
+                                        is_top_level_column(column),
+                                        rg_rows);
+      };
+      return range_might_match(filter, rg_rows, get_stats);
+    };
+
+    // Only the leading and trailing row groups are skipped, so that the rows read from a stripe
+    // stay consecutive
+    uint32_t first_rg = 0;
+    while (first_rg < num_row_groups && !row_group_might_match(first_rg)) { ++first_rg; }
+    if (first_rg == num_row_groups) { return std::make_pair(0, 0); }
+    uint32_t end_rg = num_row_groups;
+    while (end_rg > first_rg + 1 && !row_group_might_match(end_rg - 1)) { --end_rg; }
+
+    const auto first_row = first_rg * stride;
+    const auto end_row   = std::min<uint32_t>(end_rg * stride, stripe->numberOfRows);
+    return std::make_pair(static_cast<size_type>(first_row),
+                          static_cast<size_type>(end_row - first_row));
+  }
+
   inline size_t get_total_rows() const { return ff.numberOfRows; }
   inline int get_num_stripes() const { return ff.stripes.size(); }
   inline int get_num_columns() const { return ff.types.size(); }
@@ -288,11 +529,13 @@ class metadata {
  public:
   PostScript ps;
   FileFooter ff;
+  Metadata md;
   std::vector<StripeFooter> stripefooters;
   std::unique_ptr<OrcDecompressor> decompressor;
 
  private:
   datasource *const source;
+  size_t postscript_length = 0;
 };
 
 namespace {
@@ -388,23 +631,63 @@ size_t gather_stream_info(const size_t stripe_index,
   return dst_offset;
 }
 
+/**
+ * @brief Makes a device buffer hold at least the given size, only reallocating it if it is too
+ * small; its contents are not preserved
+ **/
+void reserve_buffer(rmm::device_buffer &buffer, size_t size, cudaStream_t stream)
+{
+  if (buffer.size() < size) {
+    buffer = rmm::device_buffer{};
+    buffer = rmm::device_buffer(size, stream);
+  }
+}
+
+/**
+ * @brief Returns the host decompression method of an ORC compression kind
+ **/
+int to_host_stream_type(orc::CompressionKind kind)
+{
+  switch (kind) {
+    case orc::ZLIB: return IO_UNCOMP_STREAM_TYPE_INFLATE;
+    case orc::SNAPPY: return IO_UNCOMP_STREAM_TYPE_SNAPPY;
+    case orc::ZSTD: return IO_UNCOMP_STREAM_TYPE_ZSTD;
+    case orc::LZ4: return IO_UNCOMP_STREAM_TYPE_LZ4;
+    default: return IO_UNCOMP_STREAM_TYPE_INFER;
+  }
+}
+
 }  // namespace
 
-rmm::device_buffer reader::impl::decompress_stripe_data(
-  hostdevice_vector<gpu::ColumnDesc> &chunks,
-  const std::vector<rmm::device_buffer> &stripe_data,
-  const OrcDecompressor *decompressor,
-  std::vector<orc_stream_info> &stream_info,
-  size_t num_stripes,
-  rmm::device_vector<gpu::RowGroup> &row_groups,
-  size_t row_index_stride,
-  cudaStream_t stream)
+/**
+ * @brief Stripes selected for a read, along with their column data once loaded to device memory
+ * and decompressed
+ */
+struct reader::impl::stripe_load {
+  std::vector<std::pair<const StripeInformation *, const StripeFooter *>> stripes;
+  size_type skip_rows = 0;
+  size_type num_rows  = 0;
+
+  std::unique_ptr<hostdevice_vector<gpu::ColumnDesc>> chunks;
+  std::vector<orc_stream_info> stream_info;
+  rmm::device_vector<gpu::RowGroup> row_groups;  // Row index descriptors, if used
+  size_t num_dict_entries = 0;
+};
+
+void reader::impl::decompress_stripe_data(hostdevice_vector<gpu::ColumnDesc> &chunks,
+                                          stripe_scratch &scratch,
+                                          const OrcDecompressor *decompressor,
+                                          std::vector<orc_stream_info> &stream_info,
+                                          size_t num_stripes,
+                                          rmm::device_vector<gpu::RowGroup> &row_groups,
+                                          size_t row_index_stride,
+                                          cudaStream_t stream)
 {
   // Parse the columns' compressed info
   hostdevice_vector<gpu::CompressedStreamInfo> compinfo(0, stream_info.size(), stream);
   for (const auto &info : stream_info) {
     compinfo.insert(gpu::CompressedStreamInfo(
-      static_cast<const uint8_t *>(stripe_data[info.stripe_idx].data()) + info.dst_pos,
+      static_cast<const uint8_t *>(scratch.stripe_data[info.stripe_idx].data()) + info.dst_pos,
       info.length));
   }
   CUDA_TRY(cudaMemcpyAsync(compinfo.device_ptr(),
@@ -427,29 +710,35 @@ rmm::device_buffer reader::impl::decompress_stripe_data(
   // Count the exact number of compressed blocks
   size_t num_compressed_blocks   = 0;
   size_t num_uncompressed_blocks = 0;
+  size_t total_comp_size         = 0;
   size_t total_decomp_size       = 0;
   for (size_t i = 0; i < compinfo.size(); ++i) {
     num_compressed_blocks += compinfo[i].num_compressed_blocks;
     num_uncompressed_blocks += compinfo[i].num_uncompressed_blocks;
+    total_comp_size += compinfo[i].compressed_data_size;
     total_decomp_size += compinfo[i].max_uncompressed_size;
   }
   CUDF_EXPECTS(total_decomp_size > 0, "No decompressible data found");
 
-  rmm::device_buffer decomp_data(total_decomp_size, stream);
-  rmm::device_vector<gpu_inflate_input_s> inflate_in(num_compressed_blocks +
-                                                     num_uncompressed_blocks);
-  rmm::device_vector<gpu_inflate_status_s> inflate_out(num_compressed_blocks);
+  // The buffers are reused from previous reads when they are large enough
+  reserve_buffer(scratch.decomp_data, total_decomp_size, stream);
+  reserve_buffer(scratch.inflate_in,
+                 (num_compressed_blocks + num_uncompressed_blocks) * sizeof(gpu_inflate_input_s),
+                 stream);
+  reserve_buffer(scratch.inflate_out, num_compressed_blocks * sizeof(gpu_inflate_status_s), stream);
+  auto const inflate_in  = static_cast<gpu_inflate_input_s *>(scratch.inflate_in.data());
+  auto const inflate_out = static_cast<gpu_inflate_status_s *>(scratch.inflate_out.data());
 
   // Parse again to populate the decompression input/output buffers
   size_t decomp_offset      = 0;
   uint32_t start_pos        = 0;
   uint32_t start_pos_uncomp = (uint32_t)num_compressed_blocks;
   for (size_t i = 0; i < compinfo.size(); ++i) {
-    auto dst_base                 = static_cast<uint8_t *>(decomp_data.data());
+    auto dst_base                 = static_cast<uint8_t *>(scratch.decomp_data.data());
     compinfo[i].uncompressed_data = dst_base + decomp_offset;
-    compinfo[i].decctl            = inflate_in.data().get() + start_pos;
-    compinfo[i].decstatus         = inflate_out.data().get() + start_pos;
-    compinfo[i].copyctl           = inflate_in.data().get() + start_pos_uncomp;
+    compinfo[i].decctl            = inflate_in + start_pos;
+    compinfo[i].decstatus         = inflate_out + start_pos;
+    compinfo[i].copyctl           = inflate_in + start_pos_uncomp;
 
     stream_info[i].dst_pos = decomp_offset;
     decomp_offset += compinfo[i].max_uncompressed_size;
@@ -467,23 +756,37 @@ rmm::device_buffer reader::impl::decompress_stripe_data(
                                           decompressor->GetLog2MaxCompressionRatio(),
                                           stream));
 
-  // Dispatch batches of blocks to decompress
+  // Dispatch batches of blocks to decompress; small batches are decompressed on the host, where
+  // they do not pay for kernel launches that only fill a few blocks
   if (num_compressed_blocks > 0) {
-    switch (decompressor->GetKind()) {
-      case orc::ZLIB:
-        CUDA_TRY(gpuinflate(
-          inflate_in.data().get(), inflate_out.data().get(), num_compressed_blocks, 0, stream));
-        break;
-      case orc::SNAPPY:
-        CUDA_TRY(gpu_unsnap(
-          inflate_in.data().get(), inflate_out.data().get(), num_compressed_blocks, stream));
-        break;
-      default: CUDF_EXPECTS(false, "Unexpected decompression dispatch"); break;
+    const auto host_stream_type = to_host_stream_type(decompressor->GetKind());
+    if (total_comp_size < _host_decompression_threshold &&
+        is_host_decompression_supported(host_stream_type)) {
+      CUDA_TRY(
+        cpu_decompress(host_stream_type, inflate_in, inflate_out, num_compressed_blocks, stream));
+    } else {
+      switch (decompressor->GetKind()) {
+        case orc::ZLIB:
+          CUDA_TRY(gpuinflate(inflate_in, inflate_out, num_compressed_blocks, 0, stream));
+          break;
+        case orc::SNAPPY:
+          CUDA_TRY(gpu_unsnap(inflate_in, inflate_out, num_compressed_blocks, stream));
+          break;
+        case orc::ZSTD:
+          CUDA_TRY(cpu_decompress(
+            IO_UNCOMP_STREAM_TYPE_ZSTD, inflate_in, inflate_out, num_compressed_blocks, stream));
+          break;
+        case orc::LZ4:
+          CUDA_TRY(cpu_decompress(
+            IO_UNCOMP_STREAM_TYPE_LZ4, inflate_in, inflate_out, num_compressed_blocks, stream));
+          break;
+        default: CUDF_EXPECTS(false, "Unexpected decompression dispatch"); break;
+      }
     }
   }
   if (num_uncompressed_blocks > 0) {
     CUDA_TRY(gpu_copy_uncompressed_blocks(
-      inflate_in.data().get() + num_compressed_blocks, num_uncompressed_blocks, stream));
+      inflate_in + num_compressed_blocks, num_uncompressed_blocks, stream));
   }
   CUDA_TRY(gpu::PostDecompressionReassemble(compinfo.device_ptr(), compinfo.size(), stream));
 
@@ -528,8 +831,6 @@ rmm::device_buffer reader::impl::decompress_stripe_data(
                                      row_index_stride,
                                      stream));
   }
-
-  return decomp_data;
 }
 
 void reader::impl::decode_stream_data(hostdevice_vector<gpu::ColumnDesc> &chunks,
@@ -593,12 +894,17 @@ void reader::impl::decode_stream_data(hostdevice_vector<gpu::ColumnDesc> &chunks
 }
 
 reader::impl::impl(std::unique_ptr<datasource> source,
+                   std::string const &filepath,
                    reader_options const &options,
                    rmm::mr::device_memory_resource *mr)
   : _source(std::move(source)), _mr(mr)
 {
-  // Open and parse the source dataset metadata
-  _metadata = std::make_unique<metadata>(_source.get());
+  // Open and parse the source dataset metadata, unless the footer of the file is already cached
+  const auto footer = get_cached_metadata<file_metadata>(
+    options.footer_cache.get(), "orc", filepath, [&](size_t *footer_size) {
+      return read_file_metadata(_source.get(), footer_size);
+    });
+  _metadata = std::make_unique<metadata>(_source.get(), *footer);
 
   // Select only columns required by the options
   _selected_columns = _metadata->select_columns(options.columns, _has_timestamp_column);
@@ -615,210 +921,281 @@ reader::impl::impl(std::unique_ptr<datasource> source,
   // Control decimals conversion (float64 or int64 with optional scale)
   _decimals_as_float     = options.decimals_as_float;
   _decimals_as_int_scale = options.forced_decimals_scale;
-}
-
-table_with_metadata reader::impl::read(size_type skip_rows,
-                                       size_type num_rows,
-                                       size_type stripe,
-                                       size_type max_stripe_count,
-                                       const size_type *stripe_indices,
-                                       cudaStream_t stream)
-{
-  std::vector<std::unique_ptr<column>> out_columns;
-  table_metadata out_metadata;
 
-  // Select only stripes required (aka row groups)
-  const auto selected_stripes =
-    _metadata->select_stripes(stripe, max_stripe_count, stripe_indices, skip_rows, num_rows);
+  // Stripes are skipped based on their statistics if a filter is specified
+  _filter = options.filter;
 
-  // Association between each ORC column and its cudf::column
-  std::vector<int32_t> orc_col_map(_metadata->get_num_columns(), -1);
+  // Stripes with less compressed data are decompressed on the host
+  _host_decompression_threshold = options.host_decompression_threshold;
+}
 
-  // Get a list of column data types
+std::vector<data_type> reader::impl::get_column_types() const
+{
   std::vector<data_type> column_types;
   for (const auto &col : _selected_columns) {
     auto col_type = to_type_id(
       _metadata->ff.types[col], _use_np_dtypes, _timestamp_type.id(), _decimals_as_float);
     CUDF_EXPECTS(col_type != type_id::EMPTY, "Unknown type");
     column_types.emplace_back(col_type);
-
-    // Map each ORC column to its column
-    orc_col_map[col] = column_types.size() - 1;
   }
+  return column_types;
+}
 
-  // If no rows or stripes to read, return empty columns
-  if (num_rows <= 0 || selected_stripes.size() == 0) {
-    std::transform(column_types.cbegin(),
-                   column_types.cend(),
-                   std::back_inserter(out_columns),
-                   [](auto const &dtype) { return make_empty_column(dtype); });
-  } else {
-    const auto num_columns = _selected_columns.size();
-    const auto num_chunks  = selected_stripes.size() * num_columns;
-    hostdevice_vector<gpu::ColumnDesc> chunks(num_chunks, stream);
-    memset(chunks.host_ptr(), 0, chunks.memory_size());
-
-    const bool use_index =
-      (_use_index == true) &&
-      // Only use if we don't have much work with complete columns & stripes
-      // TODO: Consider nrows, gpu, and tune the threshold
-      (num_rows > _metadata->get_row_index_stride() && !(_metadata->get_row_index_stride() & 7) &&
-       _metadata->get_row_index_stride() > 0 && num_columns * selected_stripes.size() < 8 * 128) &&
-      // Only use if first row is aligned to a stripe boundary
-      // TODO: Fix logic to handle unaligned rows
-      (skip_rows == 0);
-
-    // Logically view streams as columns
-    std::vector<orc_stream_info> stream_info;
+std::pair<size_type, size_type> reader::impl::get_matching_rows(
+  const StripeInformation *stripe, const StripeFooter *stripefooter) const
+{
+  const size_t stripe_idx = stripe - _metadata->ff.stripes.data();
+  auto const get_stats    = [&](std::string const &name) {
+    return _metadata->get_stripe_statistics(stripe_idx, name);
+  };
+  if (!range_might_match(_filter, stripe->numberOfRows, get_stats)) { return {0, 0}; }
+  return _metadata->get_matching_row_groups(stripe, stripefooter, _filter);
+}
 
-    // Tracker for eventually deallocating compressed and uncompressed data
-    std::vector<rmm::device_buffer> stripe_data;
-
-    size_t stripe_start_row = 0;
-    size_t num_dict_entries = 0;
-    size_t num_rowgroups    = 0;
-    for (size_t i = 0; i < selected_stripes.size(); ++i) {
-      const auto stripe_info   = selected_stripes[i].first;
-      const auto stripe_footer = selected_stripes[i].second;
-
-      auto stream_count          = stream_info.size();
-      const auto total_data_size = gather_stream_info(i,
-                                                      stripe_info,
-                                                      stripe_footer,
-                                                      orc_col_map,
-                                                      _selected_columns,
-                                                      _metadata->ff.types,
-                                                      use_index,
-                                                      &num_dict_entries,
-                                                      chunks,
-                                                      stream_info);
-      CUDF_EXPECTS(total_data_size > 0, "Expected streams data within stripe");
-
-      stripe_data.emplace_back(total_data_size, stream);
-      auto dst_base = static_cast<uint8_t *>(stripe_data.back().data());
-
-      // Coalesce consecutive streams into one read
-      while (stream_count < stream_info.size()) {
-        const auto d_dst  = dst_base + stream_info[stream_count].dst_pos;
-        const auto offset = stream_info[stream_count].offset;
-        auto len          = stream_info[stream_count].length;
-        stream_count++;
+void reader::impl::count_filtered_stripe(const StripeInformation *stripe,
+                                         const StripeFooter *stripefooter,
+                                         table_metadata &out_metadata) const
+{
+  out_metadata.num_filtered_row_groups++;
+  out_metadata.num_filtered_rows += stripe->numberOfRows;
+  for (const auto &strm : stripefooter->streams) {
+    const auto column = static_cast<int>(strm.column);
+    if (std::find(_selected_columns.cbegin(), _selected_columns.cend(), column) !=
+        _selected_columns.cend()) {
+      out_metadata.num_filtered_bytes += strm.length;
+    }
+  }
+}
 
-        while (stream_count < stream_info.size() &&
-               stream_info[stream_count].offset == offset + len) {
-          len += stream_info[stream_count].length;
-          stream_count++;
-        }
-        const auto buffer = _source->get_buffer(offset, len);
-        CUDA_TRY(cudaMemcpyAsync(d_dst, buffer->data(), len, cudaMemcpyHostToDevice, stream));
-        CUDA_TRY(cudaStreamSynchronize(stream));
+size_t reader::impl::estimate_stripe_size(const StripeInformation *stripe,
+                                          const StripeFooter *stripefooter,
+                                          const std::vector<data_type> &column_types) const
+{
+  const auto rows    = static_cast<size_t>(stripe->numberOfRows);
+  size_t data_size   = 0;
+  size_t output_size = 0;
+  for (size_t i = 0; i < _selected_columns.size(); ++i) {
+    size_t column_data_size = 0;
+    bool has_nulls          = false;
+    for (const auto &strm : stripefooter->streams) {
+      if (strm.column == static_cast<uint32_t>(_selected_columns[i])) {
+        column_data_size += strm.length;
+        has_nulls |= (strm.kind == orc::PRESENT);
       }
+    }
+    data_size += column_data_size;
+    if (column_types[i].id() == type_id::STRING) {
+      // Strings are decoded as pointer and length pairs before building the offsets, and their
+      // characters take at least the size of the column's streams
+      output_size += rows * (sizeof(std::pair<const char *, size_t>) + sizeof(size_type)) +
+                     column_data_size;
+    } else {
+      output_size += rows * cudf::size_of(column_types[i]);
+    }
+    if (has_nulls) { output_size += bitmask_allocation_size_bytes(stripe->numberOfRows); }
+  }
+  // The decompressed streams are assumed to be no larger than the decoded columns
+  const auto decomp_size = (_metadata->ps.compression != orc::NONE) ? output_size : 0;
+  return data_size + decomp_size + output_size;
+}
 
-      // Update chunks to reference streams pointers
-      for (size_t j = 0; j < num_columns; j++) {
-        auto &chunk         = chunks[i * num_columns + j];
-        chunk.start_row     = stripe_start_row;
-        chunk.num_rows      = stripe_info->numberOfRows;
-        chunk.encoding_kind = stripe_footer->columns[_selected_columns[j]].kind;
-        chunk.type_kind     = _metadata->ff.types[_selected_columns[j]].kind;
-        if (_decimals_as_float) {
-          chunk.decimal_scale =
-            _metadata->ff.types[_selected_columns[j]].scale | ORC_DECIMAL2FLOAT64_SCALE;
-        } else if (_decimals_as_int_scale < 0) {
-          chunk.decimal_scale = _metadata->ff.types[_selected_columns[j]].scale;
-        } else {
-          chunk.decimal_scale = _decimals_as_int_scale;
-        }
-        chunk.rowgroup_id = num_rowgroups;
-        chunk.dtype_len   = (column_types[j].id() == type_id::STRING)
-                            ? sizeof(std::pair<const char *, size_t>)
-                            : cudf::size_of(column_types[j]);
-        if (chunk.type_kind == orc::TIMESTAMP) {
-          chunk.ts_clock_rate = to_clockrate(_timestamp_type.id());
-        }
-        for (int k = 0; k < gpu::CI_NUM_STREAMS; k++) {
-          if (chunk.strm_len[k] > 0) {
-            chunk.streams[k] = dst_base + stream_info[chunk.strm_id[k]].dst_pos;
-          }
-        }
-      }
-      stripe_start_row += stripe_info->numberOfRows;
-      if (use_index) {
-        num_rowgroups += (stripe_info->numberOfRows + _metadata->get_row_index_stride() - 1) /
-                         _metadata->get_row_index_stride();
+void reader::impl::load_stripes(stripe_load &load,
+                                const std::vector<data_type> &column_types,
+                                stripe_scratch &scratch,
+                                cudaStream_t stream)
+{
+  const auto &selected_stripes = load.stripes;
+  const auto num_rows          = load.num_rows;
+  const auto skip_rows         = load.skip_rows;
+
+  // Association between each ORC column and its cudf::column
+  std::vector<int32_t> orc_col_map(_metadata->get_num_columns(), -1);
+  for (size_t i = 0; i < _selected_columns.size(); ++i) { orc_col_map[_selected_columns[i]] = i; }
+
+  const auto num_columns = _selected_columns.size();
+  const auto num_chunks  = selected_stripes.size() * num_columns;
+  load.chunks            = std::make_unique<hostdevice_vector<gpu::ColumnDesc>>(num_chunks, stream);
+  auto &chunks           = *load.chunks;
+  memset(chunks.host_ptr(), 0, chunks.memory_size());
+
+  const bool use_index =
+    (_use_index == true) &&
+    // Only use if we don't have much work with complete columns & stripes
+    // TODO: Consider nrows, gpu, and tune the threshold
+    (num_rows > _metadata->get_row_index_stride() && !(_metadata->get_row_index_stride() & 7) &&
+     _metadata->get_row_index_stride() > 0 && num_columns * selected_stripes.size() < 8 * 128) &&
+    // Only use if first row is aligned to a stripe boundary
+    // TODO: Fix logic to handle unaligned rows
+    (skip_rows == 0);
+
+  // Logically view streams as columns
+  auto &stream_info = load.stream_info;
+
+  // Pending reads of stripe data and their device destinations
+  std::vector<std::pair<uint8_t *, std::future<std::shared_ptr<arrow::Buffer>>>> read_tasks;
+
+  size_t stripe_start_row = 0;
+  size_t num_rowgroups    = 0;
+  for (size_t i = 0; i < selected_stripes.size(); ++i) {
+    const auto stripe_info   = selected_stripes[i].first;
+    const auto stripe_footer = selected_stripes[i].second;
+
+    auto stream_count          = stream_info.size();
+    const auto total_data_size = gather_stream_info(i,
+                                                    stripe_info,
+                                                    stripe_footer,
+                                                    orc_col_map,
+                                                    _selected_columns,
+                                                    _metadata->ff.types,
+                                                    use_index,
+                                                    &load.num_dict_entries,
+                                                    chunks,
+                                                    stream_info);
+    CUDF_EXPECTS(total_data_size > 0, "Expected streams data within stripe");
+
+    if (scratch.stripe_data.size() <= i) { scratch.stripe_data.emplace_back(); }
+    reserve_buffer(scratch.stripe_data[i], total_data_size, stream);
+    auto dst_base = static_cast<uint8_t *>(scratch.stripe_data[i].data());
+
+    // Coalesce consecutive streams into one read; the reads for all stripes are issued before
+    // waiting on any of them so that they overlap with each other and with the setup below
+    while (stream_count < stream_info.size()) {
+      const auto d_dst  = dst_base + stream_info[stream_count].dst_pos;
+      const auto offset = stream_info[stream_count].offset;
+      auto len          = stream_info[stream_count].length;
+      stream_count++;
+
+      while (stream_count < stream_info.size() &&
+             stream_info[stream_count].offset == offset + len) {
+        len += stream_info[stream_count].length;
+        stream_count++;
       }
+      read_tasks.emplace_back(d_dst, _source->get_buffer_async(offset, len));
     }
 
-    // Process dataset chunk pages into output columns
-    if (stripe_data.size() != 0) {
-      // Setup row group descriptors if using indexes
-      rmm::device_vector<gpu::RowGroup> row_groups(num_rowgroups * num_columns);
-      if (_metadata->ps.compression != orc::NONE) {
-        auto decomp_data = decompress_stripe_data(chunks,
-                                                  stripe_data,
-                                                  _metadata->decompressor.get(),
-                                                  stream_info,
-                                                  selected_stripes.size(),
-                                                  row_groups,
-                                                  _metadata->get_row_index_stride(),
-                                                  stream);
-        stripe_data.clear();
-        stripe_data.push_back(std::move(decomp_data));
+    // Update chunks to reference streams pointers
+    for (size_t j = 0; j < num_columns; j++) {
+      auto &chunk         = chunks[i * num_columns + j];
+      chunk.start_row     = stripe_start_row;
+      chunk.num_rows      = stripe_info->numberOfRows;
+      chunk.encoding_kind = stripe_footer->columns[_selected_columns[j]].kind;
+      chunk.type_kind     = _metadata->ff.types[_selected_columns[j]].kind;
+      if (_decimals_as_float) {
+        chunk.decimal_scale =
+          _metadata->ff.types[_selected_columns[j]].scale | ORC_DECIMAL2FLOAT64_SCALE;
+      } else if (_decimals_as_int_scale < 0) {
+        chunk.decimal_scale = _metadata->ff.types[_selected_columns[j]].scale;
       } else {
-        if (not row_groups.empty()) {
-          CUDA_TRY(cudaMemcpyAsync(chunks.device_ptr(),
-                                   chunks.host_ptr(),
-                                   chunks.memory_size(),
-                                   cudaMemcpyHostToDevice,
-                                   stream));
-          CUDA_TRY(gpu::ParseRowGroupIndex(row_groups.data().get(),
-                                           nullptr,
-                                           chunks.device_ptr(),
-                                           num_columns,
-                                           selected_stripes.size(),
-                                           num_rowgroups,
-                                           _metadata->get_row_index_stride(),
-                                           stream));
-        }
+        chunk.decimal_scale = _decimals_as_int_scale;
       }
-
-      // Setup table for converting timestamp columns from local to UTC time
-      std::vector<int64_t> tz_table;
-      if (_has_timestamp_column) {
-        CUDF_EXPECTS(
-          BuildTimezoneTransitionTable(tz_table, selected_stripes[0].second->writerTimezone),
-          "Cannot setup timezone LUT");
+      chunk.rowgroup_id = num_rowgroups;
+      chunk.dtype_len   = (column_types[j].id() == type_id::STRING)
+                          ? sizeof(std::pair<const char *, size_t>)
+                          : cudf::size_of(column_types[j]);
+      if (chunk.type_kind == orc::TIMESTAMP) {
+        chunk.ts_clock_rate = to_clockrate(_timestamp_type.id());
       }
-
-      std::vector<column_buffer> out_buffers;
-      for (size_t i = 0; i < column_types.size(); ++i) {
-        bool is_nullable = false;
-        for (size_t j = 0; j < selected_stripes.size(); ++j) {
-          if (chunks[j * num_columns + i].strm_len[gpu::CI_PRESENT] != 0) {
-            is_nullable = true;
-            break;
-          }
+      for (int k = 0; k < gpu::CI_NUM_STREAMS; k++) {
+        if (chunk.strm_len[k] > 0) {
+          chunk.streams[k] = dst_base + stream_info[chunk.strm_id[k]].dst_pos;
         }
-        out_buffers.emplace_back(column_types[i], num_rows, is_nullable, stream, _mr);
       }
+    }
+    stripe_start_row += stripe_info->numberOfRows;
+    if (use_index) {
+      num_rowgroups += (stripe_info->numberOfRows + _metadata->get_row_index_stride() - 1) /
+                       _metadata->get_row_index_stride();
+    }
+  }
+
+  // Transfer the stripe data to device memory as each read completes
+  std::vector<std::shared_ptr<arrow::Buffer>> host_buffers;
+  host_buffers.reserve(read_tasks.size());
+  for (auto &task : read_tasks) {
+    host_buffers.emplace_back(task.second.get());
+    CUDA_TRY(cudaMemcpyAsync(task.first,
+                             host_buffers.back()->data(),
+                             host_buffers.back()->size(),
+                             cudaMemcpyHostToDevice,
+                             stream));
+  }
+  CUDA_TRY(cudaStreamSynchronize(stream));
+  host_buffers.clear();
+
+  // Setup row group descriptors if using indexes
+  load.row_groups.resize(num_rowgroups * num_columns);
+  if (_metadata->ps.compression != orc::NONE) {
+    decompress_stripe_data(chunks,
+                           scratch,
+                           _metadata->decompressor.get(),
+                           stream_info,
+                           selected_stripes.size(),
+                           load.row_groups,
+                           _metadata->get_row_index_stride(),
+                           stream);
+  } else if (not load.row_groups.empty()) {
+    CUDA_TRY(cudaMemcpyAsync(chunks.device_ptr(),
+                             chunks.host_ptr(),
+                             chunks.memory_size(),
+                             cudaMemcpyHostToDevice,
+                             stream));
+    CUDA_TRY(gpu::ParseRowGroupIndex(load.row_groups.data().get(),
+                                     nullptr,
+                                     chunks.device_ptr(),
+                                     num_columns,
+                                     selected_stripes.size(),
+                                     num_rowgroups,
+                                     _metadata->get_row_index_stride(),
+                                     stream));
+  }
+}
+
+std::vector<std::unique_ptr<column>> reader::impl::decode_stripes(
+  stripe_load &load, const std::vector<data_type> &column_types, cudaStream_t stream)
+{
+  const auto num_columns = _selected_columns.size();
+  auto &chunks           = *load.chunks;
+
+  // Setup table for converting timestamp columns from local to UTC time
+  std::vector<int64_t> tz_table;
+  if (_has_timestamp_column) {
+    CUDF_EXPECTS(BuildTimezoneTransitionTable(tz_table, load.stripes[0].second->writerTimezone),
+                 "Cannot setup timezone LUT");
+  }
 
-      decode_stream_data(chunks,
-                         num_dict_entries,
-                         skip_rows,
-                         num_rows,
-                         tz_table,
-                         row_groups,
-                         _metadata->get_row_index_stride(),
-                         out_buffers,
-                         stream);
-
-      for (size_t i = 0; i < column_types.size(); ++i) {
-        out_columns.emplace_back(
-          make_column(column_types[i], num_rows, out_buffers[i], stream, _mr));
+  std::vector<column_buffer> out_buffers;
+  for (size_t i = 0; i < column_types.size(); ++i) {
+    bool is_nullable = false;
+    for (size_t j = 0; j < load.stripes.size(); ++j) {
+      if (chunks[j * num_columns + i].strm_len[gpu::CI_PRESENT] != 0) {
+        is_nullable = true;
+        break;
       }
     }
+    out_buffers.emplace_back(column_types[i], load.num_rows, is_nullable, stream, _mr);
   }
 
+  decode_stream_data(chunks,
+                     load.num_dict_entries,
+                     load.skip_rows,
+                     load.num_rows,
+                     tz_table,
+                     load.row_groups,
+                     _metadata->get_row_index_stride(),
+                     out_buffers,
+                     stream);
+
+  std::vector<std::unique_ptr<column>> out_columns;
+  for (size_t i = 0; i < column_types.size(); ++i) {
+    out_columns.emplace_back(
+      make_column(column_types[i], load.num_rows, out_buffers[i], stream, _mr));
+  }
+  return out_columns;
+}
+
+table_with_metadata reader::impl::make_table(std::vector<std::unique_ptr<column>> &&out_columns,
+                                             table_metadata &&out_metadata) const
+{
   // Return column names (must match order of returned columns)
   out_metadata.column_names.resize(_selected_columns.size());
   for (size_t i = 0; i < _selected_columns.size(); i++) {
@@ -832,11 +1209,244 @@ table_with_metadata reader::impl::read(size_type skip_rows,
   return {std::make_unique<table>(std::move(out_columns)), std::move(out_metadata)};
 }
 
+table_with_metadata reader::impl::read(size_type skip_rows,
+                                       size_type num_rows,
+                                       size_type stripe,
+                                       size_type max_stripe_count,
+                                       const size_type *stripe_indices,
+                                       cudaStream_t stream)
+{
+  std::vector<std::unique_ptr<column>> out_columns;
+  table_metadata out_metadata;
+
+  // Row ranges cannot be combined with a filter, as the rows a range refers to would depend on it
+  CUDF_EXPECTS(_filter.empty() || (skip_rows == 0 && num_rows == -1),
+               "Cannot read a range of rows with a filter");
+
+  // Select only stripes required (aka row groups)
+  const auto stripes =
+    _metadata->select_stripes(stripe, max_stripe_count, stripe_indices, skip_rows, num_rows);
+
+  // The stripes are read together unless the filter skips rows within them
+  std::vector<stripe_load> loads(1);
+  if (_filter.empty()) {
+    loads[0].stripes   = stripes;
+    loads[0].skip_rows = skip_rows;
+    loads[0].num_rows  = num_rows;
+  } else {
+    // Skip stripes in which no row can satisfy the filter, using the stripe statistics first and
+    // then the statistics of the stripe's row groups, before reading any column data. Leading
+    // and trailing row groups are skipped within the other stripes, which starts a new read
+    // after a stripe ending with skipped rows or before one starting with them
+    bool ends_with_skipped_rows = false;
+    for (const auto &selected : stripes) {
+      const auto rows = get_matching_rows(selected.first, selected.second);
+      if (rows.second == 0) {
+        count_filtered_stripe(selected.first, selected.second, out_metadata);
+        continue;
+      }
+      out_metadata.num_filtered_rows += selected.first->numberOfRows - rows.second;
+      if (!loads.back().stripes.empty() && (ends_with_skipped_rows || rows.first > 0)) {
+        loads.emplace_back();
+      }
+      auto &load = loads.back();
+      if (load.stripes.empty()) { load.skip_rows = rows.first; }
+      load.stripes.push_back(selected);
+      load.num_rows += rows.second;
+      ends_with_skipped_rows =
+        (static_cast<uint32_t>(rows.first + rows.second) < selected.first->numberOfRows);
+    }
+  }
+
+  // Get a list of column data types
+  const auto column_types = get_column_types();
+
+  // If no rows or stripes to read, return empty columns
+  if (loads[0].num_rows <= 0 || loads[0].stripes.size() == 0) {
+    std::transform(column_types.cbegin(),
+                   column_types.cend(),
+                   std::back_inserter(out_columns),
+                   [](auto const &dtype) { return make_empty_column(dtype); });
+  } else {
+    // Tracker for eventually deallocating compressed and uncompressed data
+    stripe_scratch scratch;
+    std::vector<std::unique_ptr<table>> tables;
+    for (auto &load : loads) {
+      load_stripes(load, column_types, scratch, stream);
+      // The compressed data is no longer needed once decompressed
+      if (_metadata->ps.compression != orc::NONE) { scratch.stripe_data.clear(); }
+      tables.push_back(std::make_unique<table>(decode_stripes(load, column_types, stream)));
+    }
+    if (tables.size() == 1) {
+      out_columns = tables[0]->release();
+    } else {
+      std::vector<table_view> views;
+      for (const auto &tbl : tables) { views.push_back(tbl->view()); }
+      out_columns = cudf::detail::concatenate(views, _mr, stream)->release();
+    }
+  }
+
+  return make_table(std::move(out_columns), std::move(out_metadata));
+}
+
+void reader::impl::read_chunked_begin(size_t chunk_read_limit, cudaStream_t stream)
+{
+  // A pending read refers to the previous chunks
+  if (_next_read.valid()) { _next_read.wait(); }
+  if (_next_load.valid()) { _next_load.wait(); }
+  _next_read = {};
+  _next_load = {};
+  _chunks.clear();
+  _chunk_rows.clear();
+  _next_chunk        = 0;
+  _filtered_metadata = table_metadata{};
+  _chunked_stream    = stream;
+  if (_load_stream == 0) { CUDA_TRY(cudaStreamCreate(&_load_stream)); }
+
+  // While a table is being used, the next one is decoded while the stripes of the one after are
+  // loaded: half of the limit is left for the table being used and the loaded stripes
+  _chunk_budget = (chunk_read_limit != 0) ? std::max<size_t>(chunk_read_limit / 2, 1) : 0;
+
+  const auto column_types = get_column_types();
+  size_type row_start     = 0;
+  size_type row_count     = -1;
+  const auto stripes      = _metadata->select_stripes(-1, -1, nullptr, row_start, row_count);
+
+  // The stripe footers are kept with the chunks, as the next selection of stripes replaces them
+  _chunk_footers.clear();
+  _chunk_footers.reserve(stripes.size());
+
+  // Group consecutive stripes while they fit within the budget; a stripe that exceeds it on its
+  // own is read by itself, as stripes are the smallest unit of compressed data. The leading and
+  // trailing row groups skipped by the filter also end a group, as the rows of a group are
+  // decoded as one range
+  std::vector<std::pair<const StripeInformation *, const StripeFooter *>> group;
+  std::pair<size_type, size_type> group_rows{0, 0};
+  size_t group_size           = 0;
+  bool ends_with_skipped_rows = false;
+  for (const auto &stripe : stripes) {
+    auto rows = std::make_pair(0, static_cast<size_type>(stripe.first->numberOfRows));
+    if (!_filter.empty()) {
+      rows = get_matching_rows(stripe.first, stripe.second);
+      if (rows.second == 0) {
+        count_filtered_stripe(stripe.first, stripe.second, _filtered_metadata);
+        continue;
+      }
+      _filtered_metadata.num_filtered_rows += stripe.first->numberOfRows - rows.second;
+    }
+    const auto stripe_size = estimate_stripe_size(stripe.first, stripe.second, column_types);
+    if (!group.empty() &&
+        ((_chunk_budget != 0 && group_size + stripe_size > _chunk_budget) ||
+         ends_with_skipped_rows || rows.first > 0)) {
+      _chunks.push_back(std::move(group));
+      _chunk_rows.push_back(group_rows);
+      group.clear();
+      group_size = 0;
+    }
+    if (group.empty()) { group_rows = {rows.first, 0}; }
+    _chunk_footers.push_back(*stripe.second);
+    group.emplace_back(stripe.first, &_chunk_footers.back());
+    group_rows.second += rows.second;
+    group_size += stripe_size;
+    ends_with_skipped_rows =
+      (static_cast<uint32_t>(rows.first + rows.second) < stripe.first->numberOfRows);
+  }
+  if (!group.empty()) {
+    _chunks.push_back(std::move(group));
+    _chunk_rows.push_back(group_rows);
+  }
+
+  // Always return at least one, possibly empty, table with the selected columns
+  if (_chunks.empty()) {
+    _chunks.emplace_back();
+    _chunk_rows.emplace_back(0, 0);
+  }
+}
+
+std::future<std::unique_ptr<reader::impl::stripe_load>> reader::impl::load_chunk_async(
+  size_t chunk)
+{
+  // The worker thread starts on the default device, so it uses the caller's device explicitly
+  int device_id = 0;
+  CUDA_TRY(cudaGetDevice(&device_id));
+  return std::async(std::launch::async, [this, chunk, device_id]() {
+    CUDA_TRY(cudaSetDevice(device_id));
+    auto load       = std::make_unique<stripe_load>();
+    load->stripes   = _chunks[chunk];
+    load->skip_rows = _chunk_rows[chunk].first;
+    load->num_rows  = _chunk_rows[chunk].second;
+    if (load->num_rows > 0) {
+      // Consecutive chunks alternate between the two sets of scratch buffers
+      load_stripes(*load, get_column_types(), _scratch[chunk % 2], _load_stream);
+    }
+    CUDA_TRY(cudaStreamSynchronize(_load_stream));
+    return load;
+  });
+}
+
+std::future<table_with_metadata> reader::impl::read_chunk_async(size_t chunk)
+{
+  // The worker thread starts on the default device, so it uses the caller's device explicitly
+  int device_id = 0;
+  CUDA_TRY(cudaGetDevice(&device_id));
+  return std::async(std::launch::async, [this, chunk, device_id]() {
+    CUDA_TRY(cudaSetDevice(device_id));
+    if (!_next_load.valid()) { _next_load = load_chunk_async(chunk); }
+    auto load = _next_load.get();
+
+    // Load the stripes of the following chunk into the other scratch buffers while this chunk is
+    // decoded
+    if (chunk + 1 < _chunks.size()) { _next_load = load_chunk_async(chunk + 1); }
+
+    const auto column_types = get_column_types();
+    std::vector<std::unique_ptr<column>> out_columns;
+    if (load->num_rows > 0) {
+      out_columns = decode_stripes(*load, column_types, _chunked_stream);
+    } else {
+      std::transform(column_types.cbegin(),
+                     column_types.cend(),
+                     std::back_inserter(out_columns),
+                     [](auto const &dtype) { return make_empty_column(dtype); });
+    }
+    CUDA_TRY(cudaStreamSynchronize(_chunked_stream));
+
+    // Only keep scratch buffers that fit within the budget of a chunk for the next reads
+    auto &scratch = _scratch[chunk % 2];
+    if (_chunk_budget != 0 && scratch.size() > _chunk_budget) { scratch = stripe_scratch{}; }
+
+    return make_table(std::move(out_columns), table_metadata{});
+  });
+}
+
+table_with_metadata reader::impl::read_chunk()
+{
+  CUDF_EXPECTS(has_next(), "No chunk left to read");
+  if (!_next_read.valid()) { _next_read = read_chunk_async(_next_chunk); }
+  auto result = _next_read.get();
+  if (_next_chunk == 0) {
+    result.metadata.num_filtered_row_groups = _filtered_metadata.num_filtered_row_groups;
+    result.metadata.num_filtered_rows       = _filtered_metadata.num_filtered_rows;
+    result.metadata.num_filtered_bytes      = _filtered_metadata.num_filtered_bytes;
+  }
+  // Decode the next chunk while this one is being used
+  if (++_next_chunk < _chunks.size()) { _next_read = read_chunk_async(_next_chunk); }
+  return result;
+}
+
+reader::impl::~impl()
+{
+  // Pending reads use the streams and the scratch buffers
+  if (_next_read.valid()) { _next_read.wait(); }
+  if (_next_load.valid()) { _next_load.wait(); }
+  if (_load_stream != 0) { cudaStreamDestroy(_load_stream); }
+}
+
 // Forward to implementation
 reader::reader(std::string filepath,
                reader_options const &options,
                rmm::mr::device_memory_resource *mr)
-  : _impl(std::make_unique<impl>(datasource::create(filepath), options, mr))
+  : _impl(std::make_unique<impl>(
+      datasource::create(filepath, options.read_method), filepath, options, mr))
 {
 }
 
@@ -845,7 +1455,7 @@ reader::reader(const char *buffer,
                size_t length,
                reader_options const &options,
                rmm::mr::device_memory_resource *mr)
-  : _impl(std::make_unique<impl>(datasource::create(buffer, length), options, mr))
+  : _impl(std::make_unique<impl>(datasource::create(buffer, length), "", options, mr))
 {
 }
 
@@ -853,7 +1463,7 @@ reader::reader(const char *buffer,
 reader::reader(std::shared_ptr<arrow::io::RandomAccessFile> file,
                reader_options const &options,
                rmm::mr::device_memory_resource *mr)
-  : _impl(std::make_unique<impl>(datasource::create(file), options, mr))
+  : _impl(std::make_unique<impl>(datasource::create(file), "", options, mr))
 {
 }
 
@@ -888,6 +1498,18 @@ table_with_metadata reader::read_rows(size_type skip_rows, size_type num_rows, c
   return _impl->read(skip_rows, (num_rows != 0) ? num_rows : -1, -1, -1, nullptr, stream);
 }
 
+// Forward to implementation
+void reader::read_chunked_begin(size_t chunk_read_limit, cudaStream_t stream)
+{
+  _impl->read_chunked_begin(chunk_read_limit, stream);
+}
+
+// Forward to implementation
+bool reader::has_next() const { return _impl->has_next(); }
+
+// Forward to implementation
+table_with_metadata reader::read_chunk() { return _impl->read_chunk(); }
+
 }  // namespace orc
 }  // namespace detail
 }  // namespace io
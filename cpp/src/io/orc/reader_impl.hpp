@@ -30,6 +30,8 @@
 
 #include <cudf/io/readers.hpp>
 
+#include <array>
+#include <future>
 #include <memory>
 #include <string>
 #include <utility>
@@ -57,13 +59,20 @@ class reader::impl {
    * @brief Constructor from a dataset source with reader options.
    *
    * @param source Dataset source
+   * @param filepath Path of the source, used to look up its cached footer; empty if not a file
    * @param options Settings for controlling reading behavior
    * @param mr Resource to use for device memory allocation
    */
   explicit impl(std::unique_ptr<datasource> source,
+                std::string const &filepath,
                 reader_options const &options,
                 rmm::mr::device_memory_resource *mr);
 
+  /**
+   * @brief Destructor waiting for the reads of the chunked reader to complete
+   */
+  ~impl();
+
   /**
    * @brief Read an entire set or a subset of data and returns a set of columns
    *
@@ -83,29 +92,159 @@ class reader::impl {
                            const size_type *stripe_indices,
                            cudaStream_t stream);
 
+  /**
+   * @brief Groups the selected stripes into the tables read by `read_chunk()`
+   *
+   * While a table is being used, the next one is decoded and the stripes of the one after it are
+   * loaded and decompressed, so each table is given half of the limit.
+   *
+   * @param chunk_read_limit Maximum size in bytes of the memory used by the reads; 0 is no limit
+   * @param stream Stream to use for memory allocation and kernels
+   */
+  void read_chunked_begin(size_t chunk_read_limit, cudaStream_t stream);
+
+  /**
+   * @brief Returns whether there are chunks left to read with `read_chunk()`
+   */
+  bool has_next() const { return _next_chunk < _chunks.size(); }
+
+  /**
+   * @brief Returns the next chunk, and starts reading the following one in the background
+   *
+   * @return The set of columns along with metadata
+   */
+  table_with_metadata read_chunk();
+
  private:
+  /**
+   * @brief Device buffers holding the stripe data while it is decompressed and decoded; the
+   * chunked reader keeps them from one read to the next, and only grows them when needed
+   */
+  struct stripe_scratch {
+    std::vector<rmm::device_buffer> stripe_data;  // Compressed data of each stripe
+    rmm::device_buffer decomp_data;               // Decompressed streams of all stripes
+    rmm::device_buffer inflate_in;                // Decompression block descriptors
+    rmm::device_buffer inflate_out;               // Decompression block results
+
+    size_t size() const
+    {
+      size_t total = decomp_data.size() + inflate_in.size() + inflate_out.size();
+      for (const auto &data : stripe_data) { total += data.size(); }
+      return total;
+    }
+  };
+
+  struct stripe_load;
+
+  /**
+   * @brief Returns the output data type of each selected column
+   */
+  std::vector<data_type> get_column_types() const;
+
+  /**
+   * @brief Returns the rows of a stripe that can satisfy the filter; the leading and trailing row
+   * groups of the stripe that cannot are left out
+   *
+   * @param stripe Stripe information
+   * @param stripefooter Stripe footer, listing the stripe's streams
+   *
+   * @return First row within the stripe and number of rows; no rows if the stripe can be skipped
+   */
+  std::pair<size_type, size_type> get_matching_rows(const StripeInformation *stripe,
+                                                    const StripeFooter *stripefooter) const;
+
+  /**
+   * @brief Adds a stripe skipped by the filter to the counts of filtered rows and bytes
+   *
+   * @param stripe Stripe information
+   * @param stripefooter Stripe footer, listing the stripe's streams
+   * @param out_metadata Metadata holding the counts
+   */
+  void count_filtered_stripe(const StripeInformation *stripe,
+                             const StripeFooter *stripefooter,
+                             table_metadata &out_metadata) const;
+
+  /**
+   * @brief Returns the estimated device memory used to read the selected columns of a stripe:
+   * its stream data, the decompressed streams and the decoded columns
+   *
+   * @param stripe Stripe information
+   * @param stripefooter Stripe footer, listing the stripe's streams
+   * @param column_types Output data type of each selected column
+   */
+  size_t estimate_stripe_size(const StripeInformation *stripe,
+                              const StripeFooter *stripefooter,
+                              const std::vector<data_type> &column_types) const;
+
+  /**
+   * @brief Reads the selected columns of stripes to device memory and decompresses them
+   *
+   * @param load Stripes to read, receiving the column chunk descriptors
+   * @param column_types Output data type of each selected column
+   * @param scratch Buffers receiving the stripe data, reused if large enough
+   * @param stream Stream to use for memory allocation and kernels
+   */
+  void load_stripes(stripe_load &load,
+                    const std::vector<data_type> &column_types,
+                    stripe_scratch &scratch,
+                    cudaStream_t stream);
+
+  /**
+   * @brief Decodes loaded stripes into columns
+   *
+   * @param load Loaded stripes
+   * @param column_types Output data type of each selected column
+   * @param stream Stream to use for memory allocation and kernels
+   */
+  std::vector<std::unique_ptr<column>> decode_stripes(stripe_load &load,
+                                                      const std::vector<data_type> &column_types,
+                                                      cudaStream_t stream);
+
+  /**
+   * @brief Makes the output table from columns, with the columns' metadata
+   *
+   * @param out_columns Columns of the table
+   * @param out_metadata Metadata to return along with the columns
+   */
+  table_with_metadata make_table(std::vector<std::unique_ptr<column>> &&out_columns,
+                                 table_metadata &&out_metadata) const;
+
+  /**
+   * @brief Starts loading the stripes of a chunk in the background, using the load stream and
+   * the scratch buffers of the chunk's parity
+   *
+   * @param chunk Index of the chunk
+   */
+  std::future<std::unique_ptr<stripe_load>> load_chunk_async(size_t chunk);
+
+  /**
+   * @brief Starts decoding a chunk in the background, once its stripes are loaded; the stripes of
+   * the following chunk are loaded meanwhile
+   *
+   * @param chunk Index of the chunk
+   */
+  std::future<table_with_metadata> read_chunk_async(size_t chunk);
+
   /**
    * @brief Decompresses the stripe data, at stream granularity
    *
    * @param chunks List of column chunk descriptors
-   * @param stripe_data List of source stripe column data
+   * @param scratch Buffers holding the source stripe column data, and the decompressed data
    * @param decompressor Originally host decompressor
    * @param stream_info List of stream to column mappings
    * @param num_stripes Number of stripes making up column chunks
    * @param row_groups List of row index descriptors
    * @param row_index_stride Distance between each row index
    * @param stream Stream to use for memory allocation and kernels
-   *
-   * @return Device buffer to decompressed page data
    */
-  rmm::device_buffer decompress_stripe_data(hostdevice_vector<gpu::ColumnDesc> &chunks,
-                                            const std::vector<rmm::device_buffer> &stripe_data,
-                                            const OrcDecompressor *decompressor,
-                                            std::vector<orc_stream_info> &stream_info,
-                                            size_t num_stripes,
-                                            rmm::device_vector<gpu::RowGroup> &row_groups,
-                                            size_t row_index_stride,
-                                            cudaStream_t stream);
+  void decompress_stripe_data(hostdevice_vector<gpu::ColumnDesc> &chunks,
+                              stripe_scratch &scratch,
+                              const OrcDecompressor *decompressor,
+                              std::vector<orc_stream_info> &stream_info,
+                              size_t num_stripes,
+                              rmm::device_vector<gpu::RowGroup> &row_groups,
+                              size_t row_index_stride,
+                              cudaStream_t stream);
 
   /**
    * @brief Converts the stripe column data and outputs to columns
@@ -142,6 +281,22 @@ class reader::impl {
   bool _decimals_as_float    = true;
   int _decimals_as_int_scale = -1;
   data_type _timestamp_type{type_id::EMPTY};
+  filter_expression _filter;
+  size_t _host_decompression_threshold = 0;
+
+  // Chunked reading state; the pending reads are declared last so that they complete before the
+  // state they use is destroyed
+  std::vector<std::vector<std::pair<const StripeInformation *, const StripeFooter *>>> _chunks;
+  std::vector<std::pair<size_type, size_type>> _chunk_rows;  // First row and rows of each chunk
+  std::vector<StripeFooter> _chunk_footers;
+  size_t _next_chunk = 0;
+  table_metadata _filtered_metadata;
+  size_t _chunk_budget         = 0;
+  cudaStream_t _chunked_stream = 0;
+  cudaStream_t _load_stream    = 0;
+  std::array<stripe_scratch, 2> _scratch;
+  std::future<std::unique_ptr<stripe_load>> _next_load;
+  std::future<table_with_metadata> _next_read;
 };
 
 }  // namespace orc
@@ -13,6 +13,7 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include <io/comp/io_uncomp.h>
 #include <io/utilities/block_utils.cuh>
 #include "orc_common.h"
 #include "orc_gpu.h"
@@ -1290,7 +1291,13 @@ cudaError_t CompressOrcDataStreams(uint8_t *compressed_data,
   dim3 dim_grid(num_stripe_streams, 1);
   gpuInitCompressionBlocks<<<dim_grid, dim_block_init, 0, stream>>>(
     strm_desc, chunks, comp_in, comp_out, compressed_data, comp_blk_size);
-  if (compression == SNAPPY) { gpu_snap(comp_in, comp_out, num_compressed_blocks, stream); }
+  if (compression == SNAPPY) {
+    gpu_snap(comp_in, comp_out, num_compressed_blocks, stream);
+  } else if (compression == ZSTD) {
+    cpu_compress(IO_UNCOMP_STREAM_TYPE_ZSTD, comp_in, comp_out, num_compressed_blocks, stream);
+  } else if (compression == LZ4) {
+    cpu_compress(IO_UNCOMP_STREAM_TYPE_LZ4, comp_in, comp_out, num_compressed_blocks, stream);
+  }
   dim3 dim_block_compact(1024, 1);
   gpuCompactCompressedBlocks<<<dim_grid, dim_block_compact, 0, stream>>>(
     strm_desc, comp_in, comp_out, compressed_data, comp_blk_size);
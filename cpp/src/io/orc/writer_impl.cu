@@ -21,6 +21,9 @@
 
 #include "writer_impl.hpp"
 
+#include <io/comp/cpu_comp.h>
+#include <io/comp/io_uncomp.h>
+
 #include <cudf/null_mask.hpp>
 #include <cudf/strings/strings_column_view.hpp>
 
@@ -53,6 +56,11 @@ orc::CompressionKind to_orc_compression(compression_type compression)
   switch (compression) {
     case compression_type::AUTO:
     case compression_type::SNAPPY: return orc::CompressionKind::SNAPPY;
+    case compression_type::ZSTD:
+      CUDF_EXPECTS(is_host_compression_supported(IO_UNCOMP_STREAM_TYPE_ZSTD),
+                   "ZSTD compression is not available in this build");
+      return orc::CompressionKind::ZSTD;
+    case compression_type::LZ4: return orc::CompressionKind::LZ4;
     case compression_type::NONE: return orc::CompressionKind::NONE;
     default: CUDF_EXPECTS(false, "Unsupported compression type"); return orc::CompressionKind::NONE;
   }
@@ -16,13 +16,18 @@
 
 /**
  * @file chunked_state.hpp
- * @brief definition for chunked state structure used by Parquet writer
+ * @brief definition for chunked state structures used by Parquet writer and reader
  */
 
 #pragma once
 
 #include "parquet.h"
 
+#include <cudf/io/readers.hpp>
+#include <cudf/io/writers.hpp>
+
+#include <memory>
+
 namespace cudf {
 namespace io {
 namespace detail {
@@ -43,6 +48,9 @@ struct pq_chunked_state {
   cudf::io::parquet::FileMetaData md;
   /// current write position for rowgroups/chunks
   std::size_t current_chunk_offset;
+  /// Page indexes of each column chunk [rowgroup][column], written during write_chunked_end()
+  std::vector<std::vector<cudf::io::parquet::OffsetIndex>> offset_indexes;
+  std::vector<std::vector<cudf::io::parquet::ColumnIndex>> column_indexes;
   /// optional user metadata
   table_metadata_with_nullability user_metadata_with_nullability;
   /// special parameter only used by detail::write() to indicate that we are guaranteeing
@@ -62,6 +70,23 @@ struct pq_chunked_state {
   }
 };
 
+/**
+ * @brief Dataset writer state struct. Holds the writer of the partitioned files across the
+ * begin() / write() / end() call process.
+ */
+struct pq_dataset_state {
+  /// The writer to be used; it keeps track of the open files
+  std::unique_ptr<dataset_writer> wp;
+};
+
+/**
+ * @brief Chunked reader state struct. Holds the reader across the begin() / read() call process.
+ */
+struct pq_chunked_read_state {
+  /// The reader to be used; it keeps track of the tables left to read
+  std::unique_ptr<reader> rp;
+};
+
 }  // namespace parquet
 }  // namespace detail
 }  // namespace io
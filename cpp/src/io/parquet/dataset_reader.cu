@@ -0,0 +1,600 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file dataset_reader.cu
+ * @brief cuDF-IO Parquet reader of a set of files, with hive partitioning
+ */
+
+#include "reader_impl.hpp"
+
+#include <io/utilities/stats_filter.hpp>
+#include <io/utilities/thread_pool.hpp>
+
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/gather.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/thrust_rmm_allocator.h>
+#include <rmm/device_buffer.hpp>
+
+#include <thrust/binary_search.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/scan.h>
+#include <thrust/transform.h>
+
+#include <dirent.h>
+#include <sys/stat.h>
+
+#include <algorithm>
+#include <cctype>
+#include <cerrno>
+#include <cstdlib>
+#include <limits>
+#include <map>
+#include <numeric>
+
+namespace cudf {
+namespace io {
+namespace detail {
+namespace parquet {
+namespace {
+/**
+ * @brief Value of a partition key for the files of a directory
+ */
+struct partition_value {
+  bool is_null = false;
+  std::string value;
+};
+
+/**
+ * @brief Appends the paths of the files under a directory, in lexicographical order
+ *
+ * Files and directories whose names start with `_` or `.`, such as `_SUCCESS` markers, `_metadata`
+ * summaries and hidden files, are not part of the dataset.
+ */
+void list_dataset_files(std::string const &directory, std::vector<std::string> &filepaths)
+{
+  DIR *dir = opendir(directory.c_str());
+  CUDF_EXPECTS(dir != nullptr, "Cannot open dataset directory");
+  std::vector<std::string> names;
+  while (const auto *entry = readdir(dir)) {
+    const std::string name = entry->d_name;
+    if (!name.empty() && name[0] != '.' && name[0] != '_') { names.push_back(name); }
+  }
+  closedir(dir);
+  std::sort(names.begin(), names.end());
+
+  for (const auto &name : names) {
+    const auto path = directory + "/" + name;
+    struct stat info;
+    if (stat(path.c_str(), &info) != 0) { continue; }
+    if (S_ISDIR(info.st_mode)) {
+      list_dataset_files(path, filepaths);
+    } else if (S_ISREG(info.st_mode)) {
+      filepaths.push_back(path);
+    }
+  }
+}
+
+/**
+ * @brief Decodes the `%XX` escapes that writers use for special characters in partition values
+ */
+std::string percent_decode(std::string const &str)
+{
+  const auto hex_value = [](char c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+  };
+  std::string decoded;
+  for (size_t i = 0; i < str.size(); ++i) {
+    if (str[i] == '%' && i + 2 < str.size() && hex_value(str[i + 1]) >= 0 &&
+        hex_value(str[i + 2]) >= 0) {
+      decoded.push_back(static_cast<char>(hex_value(str[i + 1]) * 16 + hex_value(str[i + 2])));
+      i += 2;
+    } else {
+      decoded.push_back(str[i]);
+    }
+  }
+  return decoded;
+}
+
+/**
+ * @brief Returns the `key=value` directories of a file path, below the dataset directory if any
+ */
+std::vector<std::pair<std::string, partition_value>> parse_hive_partitions(
+  std::string const &filepath, std::string const &directory)
+{
+  auto path = filepath;
+  if (!directory.empty()) {
+    auto root = directory;
+    if (root.back() != '/') { root.push_back('/'); }
+    if (path.compare(0, root.size(), root) == 0) { path = path.substr(root.size()); }
+  }
+
+  std::vector<std::pair<std::string, partition_value>> partitions;
+  size_t start = 0;
+  for (auto end = path.find('/'); end != std::string::npos; end = path.find('/', start)) {
+    const auto segment = path.substr(start, end - start);
+    const auto equal   = segment.find('=');
+    if (equal != std::string::npos && equal > 0) {
+      partition_value value;
+      value.value   = percent_decode(segment.substr(equal + 1));
+      value.is_null = (value.value == "__HIVE_DEFAULT_PARTITION__");
+      partitions.emplace_back(segment.substr(0, equal), value);
+    }
+    start = end + 1;
+  }
+  return partitions;
+}
+
+/**
+ * @brief Returns whether a partition value is a decimal integer within the range of `int64_t`
+ */
+bool is_integer(std::string const &str)
+{
+  if (str.empty() || str.size() > 20) { return false; }
+  const auto digits = (str[0] == '-' || str[0] == '+') ? str.substr(1) : str;
+  if (digits.empty() || !std::all_of(digits.begin(), digits.end(), ::isdigit)) { return false; }
+  errno = 0;
+  std::strtoll(str.c_str(), nullptr, 10);
+  return errno != ERANGE;
+}
+
+/**
+ * @brief Copies the characters of a range of rows of a string column buffer to a new buffer and
+ * points the rows at the copy, so that the page data holding the characters can be released
+ *
+ * @param buffer String column buffer
+ * @param begin First row of the range
+ * @param count Number of rows in the range
+ * @param stream Stream to use for memory allocation and kernels
+ *
+ * @return The buffer holding the characters of the rows
+ */
+rmm::device_buffer copy_string_chars(column_buffer &buffer,
+                                     size_type begin,
+                                     size_type count,
+                                     cudaStream_t stream)
+{
+  using str_pair     = column_buffer::str_pair;
+  auto const strings = buffer._strings.data().get() + begin;
+  rmm::device_vector<size_t> offsets(count + 1, 0);
+  thrust::transform(rmm::exec_policy(stream)->on(stream),
+                    strings,
+                    strings + count,
+                    offsets.begin() + 1,
+                    [] __device__(str_pair const &str) { return static_cast<size_t>(str.second); });
+  thrust::inclusive_scan(
+    rmm::exec_policy(stream)->on(stream), offsets.begin() + 1, offsets.end(), offsets.begin() + 1);
+  size_t num_chars = 0;
+  CUDA_TRY(cudaMemcpyAsync(&num_chars,
+                           offsets.data().get() + count,
+                           sizeof(size_t),
+                           cudaMemcpyDeviceToHost,
+                           stream));
+  CUDA_TRY(cudaStreamSynchronize(stream));
+
+  // Empty strings need a valid pointer as well, as null rows are the ones without
+  rmm::device_buffer chars(std::max<size_t>(num_chars, 1), stream);
+  auto const d_chars   = static_cast<char *>(chars.data());
+  auto const d_offsets = offsets.data().get();
+  thrust::for_each(rmm::exec_policy(stream)->on(stream),
+                   thrust::make_counting_iterator<size_type>(0),
+                   thrust::make_counting_iterator<size_type>(count),
+                   [strings, d_offsets, d_chars] __device__(size_type row) {
+                     auto &str = strings[row];
+                     if (str.first == nullptr) { return; }
+                     memcpy(d_chars + d_offsets[row], str.first, str.second);
+                     str.first = d_chars + d_offsets[row];
+                   });
+  return chars;
+}
+
+}  // namespace
+
+/**
+ * @brief Implementation for the Parquet dataset reader
+ */
+class dataset_reader::impl {
+ public:
+  /**
+   * @brief Finds the files of the dataset and their partitions, opens them concurrently to unify
+   * their columns, and skips the files whose partition values cannot satisfy the filter.
+   *
+   * @param filepaths Paths of the files; empty for all the files of the dataset directory
+   * @param dataset Settings for finding the files and their partitions
+   * @param options Settings for controlling reading behavior of each file
+   * @param mr Resource to use for device memory allocation
+   */
+  impl(std::vector<std::string> filepaths,
+       dataset_options const &dataset,
+       reader_options const &options,
+       rmm::mr::device_memory_resource *mr);
+
+  /**
+   * @brief Reads all the files into a single table
+   *
+   * @param stream Stream to use for memory allocation and kernels
+   *
+   * @return The set of columns along with metadata
+   */
+  table_with_metadata read_all(cudaStream_t stream);
+
+ private:
+  /**
+   * @brief Unifies the columns of the files by name, in order of first appearance
+   */
+  void unify_columns();
+
+  /**
+   * @brief Returns whether the partition values of a file might satisfy the filter
+   *
+   * @param file Index of the file
+   */
+  bool partitions_might_match(size_t file) const;
+
+  /**
+   * @brief Returns a partition column holding the value of each file for its rows
+   *
+   * @param key Index of the partition key
+   * @param file_row_ends Row after the last row of each file
+   * @param stream Stream to use for memory allocation and kernels
+   */
+  std::unique_ptr<column> make_partition_column(size_t key,
+                                                const std::vector<size_type> &file_row_ends,
+                                                cudaStream_t stream) const;
+
+ private:
+  rmm::mr::device_memory_resource *_mr = nullptr;
+  std::vector<std::string> _columns;
+  filter_expression _filter;
+  size_t _num_threads = 0;
+
+  std::vector<std::string> _partition_keys;
+  std::vector<data_type> _partition_types;
+  std::vector<std::vector<partition_value>> _partition_values;  // Per file, then per key
+  std::vector<std::unique_ptr<reader::impl>> _readers;          // Per file
+
+  std::vector<std::string> _names;
+  std::vector<data_type> _types;
+  std::vector<bool> _nullability;
+  std::vector<std::vector<int>> _file_column_maps;         // Per file, then per file column
+  std::vector<std::vector<data_type>> _file_column_types;  // Per file, then per file column
+};
+
+dataset_reader::impl::impl(std::vector<std::string> filepaths,
+                           dataset_options const &dataset,
+                           reader_options const &options,
+                           rmm::mr::device_memory_resource *mr)
+  : _mr(mr), _columns(options.columns), _filter(options.filter), _num_threads(dataset.num_threads)
+{
+  if (filepaths.empty()) {
+    CUDF_EXPECTS(!dataset.directory.empty(), "No files or directory to read");
+    list_dataset_files(dataset.directory, filepaths);
+  }
+
+  // Every file must have the same partition keys, in the same order
+  _partition_values.resize(filepaths.size());
+  if (dataset.hive_partitioning) {
+    for (size_t f = 0; f < filepaths.size(); ++f) {
+      const auto partitions = parse_hive_partitions(filepaths[f], dataset.directory);
+      if (f == 0) {
+        for (const auto &partition : partitions) { _partition_keys.push_back(partition.first); }
+      }
+      CUDF_EXPECTS(partitions.size() == _partition_keys.size(), "Mismatched partition keys");
+      for (size_t k = 0; k < partitions.size(); ++k) {
+        CUDF_EXPECTS(partitions[k].first == _partition_keys[k], "Mismatched partition keys");
+        _partition_values[f].push_back(partitions[k].second);
+      }
+    }
+  }
+
+  // Partition columns are integers if all their values are, and strings otherwise
+  for (size_t k = 0; k < _partition_keys.size(); ++k) {
+    const bool all_integers =
+      std::all_of(_partition_values.begin(), _partition_values.end(), [&](const auto &values) {
+        return values[k].is_null || is_integer(values[k].value);
+      });
+    _partition_types.emplace_back(all_integers ? type_id::INT64 : type_id::STRING);
+  }
+
+  // Open the files and parse their footers concurrently
+  _readers.resize(filepaths.size());
+  thread_pool pool(_num_threads);
+  parallel_for(
+    pool,
+    filepaths.size(),
+    [] { return 0; },
+    [&](int, size_t f) {
+      _readers[f] = std::make_unique<reader::impl>(
+        datasource::create(filepaths[f], options.read_method), filepaths[f], options, mr);
+    });
+
+  // The columns of the files that the partitions skip are still part of the dataset's columns
+  unify_columns();
+
+  // Skip the files whose partitions cannot match
+  if (!_filter.empty() && !_partition_keys.empty()) {
+    size_t num_matching = 0;
+    for (size_t f = 0; f < _readers.size(); ++f) {
+      if (partitions_might_match(f)) {
+        _readers[num_matching]           = std::move(_readers[f]);
+        _partition_values[num_matching]  = std::move(_partition_values[f]);
+        _file_column_maps[num_matching]  = std::move(_file_column_maps[f]);
+        _file_column_types[num_matching] = std::move(_file_column_types[f]);
+        num_matching++;
+      }
+    }
+    _readers.resize(num_matching);
+    _partition_values.resize(num_matching);
+    _file_column_maps.resize(num_matching);
+    _file_column_types.resize(num_matching);
+  }
+}
+
+void dataset_reader::impl::unify_columns()
+{
+  // Files without row groups have no column types
+  _file_column_maps.resize(_readers.size());
+  _file_column_types.resize(_readers.size());
+  for (size_t f = 0; f < _readers.size(); ++f) {
+    _file_column_types[f] = _readers[f]->get_column_types();
+    const auto file_names = _readers[f]->get_column_names();
+    const auto file_nulls = _readers[f]->get_column_nullability();
+    for (size_t i = 0; i < _file_column_types[f].size(); ++i) {
+      CUDF_EXPECTS(std::find(_partition_keys.begin(), _partition_keys.end(), file_names[i]) ==
+                     _partition_keys.end(),
+                   "Column name conflicts with a partition key");
+      const auto it  = std::find(_names.begin(), _names.end(), file_names[i]);
+      const auto col = static_cast<int>(std::distance(_names.begin(), it));
+      if (it == _names.end()) {
+        _names.push_back(file_names[i]);
+        _types.push_back(_file_column_types[f][i]);
+        _nullability.push_back(file_nulls[i]);
+      } else {
+        CUDF_EXPECTS(_types[col] == _file_column_types[f][i], "Mismatched column types");
+        _nullability[col] = _nullability[col] || file_nulls[i];
+      }
+      _file_column_maps[f].push_back(col);
+    }
+  }
+}
+
+bool dataset_reader::impl::partitions_might_match(size_t file) const
+{
+  // Every row of the file has the same partition values, so they are evaluated as a single row
+  const auto get_stats = [&](std::string const &name) {
+    column_range_statistics stats;
+    const auto key = std::find(_partition_keys.begin(), _partition_keys.end(), name);
+    if (key != _partition_keys.end()) {
+      const auto k         = std::distance(_partition_keys.begin(), key);
+      const auto &value    = _partition_values[file][k];
+      stats.has_null_count = true;
+      stats.null_count     = value.is_null ? 1 : 0;
+      if (!value.is_null) {
+        stats.has_min_max = true;
+        stats.min_value   = (_partition_types[k].id() == type_id::INT64)
+                            ? filter_literal(std::strtoll(value.value.c_str(), nullptr, 10))
+                            : filter_literal(value.value);
+        stats.max_value = stats.min_value;
+      }
+    }
+    return stats;
+  };
+  return range_might_match(_filter, 1, get_stats);
+}
+
+std::unique_ptr<column> dataset_reader::impl::make_partition_column(
+  size_t key, const std::vector<size_type> &file_row_ends, cudaStream_t stream) const
+{
+  const auto num_files = static_cast<size_type>(_partition_values.size());
+  const auto num_rows  = file_row_ends.empty() ? 0 : file_row_ends.back();
+  if (num_rows == 0) { return make_empty_column(_partition_types[key]); }
+
+  // One value per file
+  std::vector<bitmask_type> null_mask((num_files + 31) / 32, 0);
+  size_type null_count = 0;
+  for (size_type f = 0; f < num_files; ++f) {
+    if (_partition_values[f][key].is_null) {
+      null_count++;
+    } else {
+      null_mask[f / 32] |= 1u << (f % 32);
+    }
+  }
+  std::unique_ptr<column> file_values;
+  if (_partition_types[key].id() == type_id::INT64) {
+    std::vector<int64_t> values(num_files, 0);
+    for (size_type f = 0; f < num_files; ++f) {
+      const auto &value = _partition_values[f][key];
+      if (!value.is_null) { values[f] = std::strtoll(value.value.c_str(), nullptr, 10); }
+    }
+    file_values = std::make_unique<column>(
+      _partition_types[key],
+      num_files,
+      rmm::device_buffer(values.data(), values.size() * sizeof(int64_t), stream),
+      rmm::device_buffer(null_mask.data(), null_mask.size() * sizeof(bitmask_type), stream),
+      null_count);
+  } else {
+    std::vector<char> chars;
+    std::vector<size_type> offsets(1, 0);
+    for (size_type f = 0; f < num_files; ++f) {
+      const auto &value = _partition_values[f][key];
+      if (!value.is_null) { chars.insert(chars.end(), value.value.begin(), value.value.end()); }
+      offsets.push_back(chars.size());
+    }
+    file_values = make_strings_column(chars, offsets, null_mask, null_count, stream);
+  }
+
+  // Gather the value of the file of each row
+  rmm::device_vector<size_type> row_ends(file_row_ends);
+  rmm::device_vector<size_type> row_files(num_rows);
+  thrust::upper_bound(rmm::exec_policy(stream)->on(stream),
+                      row_ends.begin(),
+                      row_ends.end(),
+                      thrust::make_counting_iterator<size_type>(0),
+                      thrust::make_counting_iterator<size_type>(num_rows),
+                      row_files.begin());
+  const column_view gather_map(data_type{type_id::INT32}, num_rows, row_files.data().get());
+  auto gathered = cudf::detail::gather(
+    table_view{{file_values->view()}}, gather_map, false, false, false, _mr, stream);
+  return std::move(gathered->release()[0]);
+}
+
+table_with_metadata dataset_reader::impl::read_all(cudaStream_t stream)
+{
+  table_metadata out_metadata;
+  const auto num_files = _readers.size();
+
+  // Select the row groups of each file that the filter does not skip
+  std::vector<std::vector<std::pair<size_type, size_t>>> file_row_groups(num_files);
+  std::vector<size_type> file_rows(num_files);
+  std::vector<table_metadata> file_metadata(num_files);
+  thread_pool pool(_num_threads);
+  parallel_for(
+    pool,
+    num_files,
+    [] { return 0; },
+    [&](int, size_t f) {
+      std::tie(file_row_groups[f], file_rows[f]) =
+        _readers[f]->select_filtered_row_groups(file_metadata[f]);
+    });
+
+  std::vector<size_type> file_row_ends(num_files);
+  size_t total_rows = 0;
+  for (size_t f = 0; f < num_files; ++f) {
+    total_rows += file_rows[f];
+    file_row_ends[f] = static_cast<size_type>(total_rows);
+    out_metadata.num_filtered_row_groups += file_metadata[f].num_filtered_row_groups;
+    out_metadata.num_filtered_rows += file_metadata[f].num_filtered_rows;
+    out_metadata.num_filtered_bytes += file_metadata[f].num_filtered_bytes;
+  }
+  CUDF_EXPECTS(total_rows <= static_cast<size_t>(std::numeric_limits<size_type>::max()),
+               "Dataset exceeds the maximum number of rows of a table");
+
+  // Rows of the files missing a column are null
+  std::vector<size_type> missing_rows(_names.size(), 0);
+  for (size_t f = 0; f < num_files; ++f) {
+    std::vector<bool> present(_names.size(), false);
+    for (const auto col : _file_column_maps[f]) { present[col] = true; }
+    for (size_t col = 0; col < _names.size(); ++col) {
+      if (!present[col]) { missing_rows[col] += file_rows[f]; }
+    }
+  }
+
+  // Decode each file directly into its rows of the output columns
+  std::vector<std::unique_ptr<column>> file_columns;
+  if (total_rows != 0) {
+    std::vector<column_buffer> out_buffers;
+    out_buffers.reserve(_types.size());
+    for (size_t col = 0; col < _types.size(); ++col) {
+      out_buffers.emplace_back(
+        _types[col], total_rows, _nullability[col] || missing_rows[col] != 0, stream, _mr);
+      out_buffers.back().null_count() = missing_rows[col];
+    }
+
+    // String column buffers refer to the page data of their file, so the characters of each file
+    // are copied out of it, and its page data released, before the next file is decoded
+    std::vector<rmm::device_buffer> string_chars;
+    for (size_t f = 0; f < num_files; ++f) {
+      if (file_rows[f] == 0 || _file_column_maps[f].empty()) { continue; }
+      const auto row_offset = file_row_ends[f] - file_rows[f];
+      const auto page_data  = _readers[f]->decode_row_groups(file_row_groups[f],
+                                                             0,
+                                                             file_rows[f],
+                                                             _file_column_types[f],
+                                                             _file_column_maps[f],
+                                                             row_offset,
+                                                             out_buffers,
+                                                             stream);
+      for (const auto col : _file_column_maps[f]) {
+        if (_types[col].id() == type_id::STRING) {
+          string_chars.emplace_back(
+            copy_string_chars(out_buffers[col], row_offset, file_rows[f], stream));
+        }
+      }
+    }
+
+    for (size_t col = 0; col < _types.size(); ++col) {
+      file_columns.emplace_back(
+        make_column(_types[col], total_rows, out_buffers[col], stream, _mr));
+    }
+  } else {
+    for (const auto &type : _types) { file_columns.emplace_back(make_empty_column(type)); }
+  }
+
+  std::vector<std::unique_ptr<column>> partition_columns;
+  for (size_t k = 0; k < _partition_keys.size(); ++k) {
+    partition_columns.emplace_back(make_partition_column(k, file_row_ends, stream));
+  }
+
+  // File columns come first, then partition columns, unless a set of columns is selected; only
+  // the selected partition columns are then returned, in the selected order
+  std::vector<std::unique_ptr<column>> out_columns;
+  const auto add_column = [&](std::unique_ptr<column> &col, std::string const &name) {
+    if (col != nullptr) {
+      out_columns.emplace_back(std::move(col));
+      out_metadata.column_names.push_back(name);
+    }
+  };
+  for (const auto &name : _columns) {
+    const auto file_col = std::find(_names.begin(), _names.end(), name);
+    const auto key      = std::find(_partition_keys.begin(), _partition_keys.end(), name);
+    if (file_col != _names.end()) {
+      add_column(file_columns[std::distance(_names.begin(), file_col)], name);
+    } else if (key != _partition_keys.end()) {
+      add_column(partition_columns[std::distance(_partition_keys.begin(), key)], name);
+    }
+  }
+  for (size_t col = 0; col < _names.size(); ++col) { add_column(file_columns[col], _names[col]); }
+  if (_columns.empty()) {
+    for (size_t k = 0; k < _partition_keys.size(); ++k) {
+      add_column(partition_columns[k], _partition_keys[k]);
+    }
+  }
+
+  // Return the user metadata of the first file
+  if (num_files != 0) { out_metadata.user_data = _readers[0]->get_user_data(); }
+
+  return {std::make_unique<table>(std::move(out_columns)), std::move(out_metadata)};
+}
+
+// Forward to implementation
+dataset_reader::dataset_reader(std::vector<std::string> filepaths,
+                               dataset_options const &dataset,
+                               reader_options const &options,
+                               rmm::mr::device_memory_resource *mr)
+  : _impl(std::make_unique<impl>(std::move(filepaths), dataset, options, mr))
+{
+}
+
+// Destructor within this translation unit
+dataset_reader::~dataset_reader() = default;
+
+// Forward to implementation
+table_with_metadata dataset_reader::read_all(cudaStream_t stream)
+{
+  return _impl->read_all(stream);
+}
+
+}  // namespace parquet
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
@@ -0,0 +1,414 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file dataset_writer.cu
+ * @brief cuDF-IO Parquet writer of hive-partitioned sets of files
+ */
+
+#include "writer_impl.hpp"
+
+#include <cudf/copying.hpp>
+#include <cudf/detail/gather.hpp>
+#include <cudf/detail/groupby/sort_helper.hpp>
+#include <cudf/detail/sorting.hpp>
+#include <cudf/null_mask.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/utilities/bit.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <sys/stat.h>
+
+#include <algorithm>
+#include <cctype>
+#include <cerrno>
+#include <map>
+#include <string>
+#include <type_traits>
+
+namespace cudf {
+namespace io {
+namespace detail {
+namespace parquet {
+namespace {
+/**
+ * @brief Directory name of null partition values, as used by Hive and Spark
+ */
+constexpr char const *null_partition_value = "__HIVE_DEFAULT_PARTITION__";
+
+/**
+ * @brief Creates a directory along with its missing parents
+ */
+void create_directories(std::string const &path)
+{
+  for (auto end = path.find('/', 1); true; end = path.find('/', end + 1)) {
+    const auto dir = path.substr(0, end);
+    CUDF_EXPECTS(mkdir(dir.c_str(), 0755) == 0 || errno == EEXIST,
+                 "Cannot create dataset directory");
+    if (end == std::string::npos) { break; }
+  }
+}
+
+/**
+ * @brief Escapes the characters of a partition value that are not safe in a directory name
+ */
+std::string percent_encode(std::string const &str)
+{
+  constexpr char const *hex_digits = "0123456789ABCDEF";
+  std::string encoded;
+  for (const auto c : str) {
+    if (std::isalnum(static_cast<unsigned char>(c)) || c == '-' || c == '_' || c == '.' ||
+        c == '~') {
+      encoded.push_back(c);
+    } else {
+      encoded.push_back('%');
+      encoded.push_back(hex_digits[static_cast<uint8_t>(c) >> 4]);
+      encoded.push_back(hex_digits[static_cast<uint8_t>(c) & 0xf]);
+    }
+  }
+  return encoded;
+}
+
+/**
+ * @brief Functor formatting an element of an integer or boolean column
+ */
+struct format_integer_fn {
+  template <typename T>
+  std::enable_if_t<std::is_integral<T>::value, std::string> operator()(void const *data,
+                                                                        size_type index)
+  {
+    return std::to_string(static_cast<T const *>(data)[index]);
+  }
+
+  template <typename T>
+  std::enable_if_t<!std::is_integral<T>::value, std::string> operator()(void const *,
+                                                                         size_type)
+  {
+    CUDF_FAIL("Unsupported partition column type");
+  }
+};
+
+/**
+ * @brief Returns the directory name of each value of a partition column
+ */
+std::vector<std::string> format_partition_values(column_view const &col, cudaStream_t stream)
+{
+  std::vector<bitmask_type> null_mask;
+  if (col.nullable()) {
+    null_mask.resize(num_bitmask_words(col.offset() + col.size()));
+    CUDA_TRY(cudaMemcpyAsync(null_mask.data(),
+                             col.null_mask(),
+                             null_mask.size() * sizeof(bitmask_type),
+                             cudaMemcpyDeviceToHost,
+                             stream));
+  }
+
+  std::vector<std::string> values(col.size());
+  std::vector<char> data;
+  std::vector<size_type> offsets;
+  if (col.type().id() == type_id::STRING) {
+    const strings_column_view strings(col);
+    offsets.resize(col.size() + 1);
+    CUDA_TRY(cudaMemcpyAsync(offsets.data(),
+                             strings.offsets().data<size_type>() + col.offset(),
+                             offsets.size() * sizeof(size_type),
+                             cudaMemcpyDeviceToHost,
+                             stream));
+    CUDA_TRY(cudaStreamSynchronize(stream));
+    data.resize(offsets.back() - offsets.front());
+    CUDA_TRY(cudaMemcpyAsync(data.data(),
+                             strings.chars().data<char>() + offsets.front(),
+                             data.size(),
+                             cudaMemcpyDeviceToHost,
+                             stream));
+  } else {
+    const auto width = size_of(col.type());
+    data.resize(col.size() * width);
+    CUDA_TRY(cudaMemcpyAsync(data.data(),
+                             static_cast<char const *>(col.head()) + col.offset() * width,
+                             data.size(),
+                             cudaMemcpyDeviceToHost,
+                             stream));
+  }
+  CUDA_TRY(cudaStreamSynchronize(stream));
+
+  for (size_type i = 0; i < col.size(); ++i) {
+    if (!null_mask.empty() && !bit_is_set(null_mask.data(), col.offset() + i)) {
+      values[i] = null_partition_value;
+    } else if (col.type().id() == type_id::STRING) {
+      const auto start = offsets[i] - offsets.front();
+      values[i] = percent_encode(std::string(data.data() + start, offsets[i + 1] - offsets[i]));
+    } else {
+      values[i] = type_dispatcher(col.type(), format_integer_fn{}, data.data(), i);
+    }
+  }
+  return values;
+}
+
+}  // namespace
+
+/**
+ * @brief Implementation for the Parquet dataset writer
+ */
+class dataset_writer::impl {
+ public:
+  /**
+   * @brief Constructor for output to a directory
+   *
+   * @param options Settings for controlling writing behavior
+   * @param metadata Optional names and nullability of all the columns
+   * @param mr Resource to use for device memory allocation
+   */
+  impl(dataset_writer_options const &options,
+       table_metadata_with_nullability const *metadata,
+       rmm::mr::device_memory_resource *mr);
+
+  /**
+   * @brief Appends the rows of a table to the files of their partitions
+   *
+   * @param table Set of columns to output, including the partition columns
+   * @param stream Stream to use for memory allocation and kernels
+   */
+  void write(table_view const &table, cudaStream_t stream);
+
+  /**
+   * @brief Closes all the files, and writes the `_metadata` file if requested
+   *
+   * @param stream Stream to use for memory allocation and kernels
+   */
+  void close(cudaStream_t stream);
+
+ private:
+  /**
+   * @brief A file being written, and the state of its chunked writer
+   */
+  struct open_file {
+    std::string path;  // Relative to the dataset directory
+    std::unique_ptr<pq_chunked_state> state;
+    size_t last_write = 0;  // Order of the last write to the file, to close the oldest first
+  };
+
+  /**
+   * @brief Sets up the metadata of the files from the structure of the first table
+   *
+   * @param table Set of columns to output, including the partition columns
+   */
+  void init_file_metadata(table_view const &table);
+
+  /**
+   * @brief Opens a new file in a partition directory, closing another file first if too many are
+   * already open
+   *
+   * @param partition_dir Partition directory, relative to the dataset directory
+   * @param stream Stream to use for memory allocation and kernels
+   */
+  open_file &open(std::string const &partition_dir, cudaStream_t stream);
+
+  /**
+   * @brief Finishes writing a file, and keeps its footer for the `_metadata` file
+   *
+   * @param partition_dir Partition directory of the file
+   */
+  void close_file(std::string const &partition_dir);
+
+ private:
+  dataset_writer_options _options;
+  rmm::mr::device_memory_resource *_mr = nullptr;
+  table_metadata_with_nullability _metadata;       // Of all the columns
+  table_metadata_with_nullability _file_metadata;  // Of the columns written to the files
+  std::vector<size_type> _data_cols;               // Indices of the columns written to the files
+  std::vector<std::string> _partition_keys;
+
+  std::map<std::string, open_file> _open_files;  // By partition directory
+  std::map<std::string, size_t> _file_counts;    // Files created in each partition directory
+  std::vector<std::unique_ptr<std::vector<uint8_t>>> _file_footers;
+  size_t _num_writes = 0;
+};
+
+dataset_writer::impl::impl(dataset_writer_options const &options,
+                           table_metadata_with_nullability const *metadata,
+                           rmm::mr::device_memory_resource *mr)
+  : _options(options), _mr(mr)
+{
+  CUDF_EXPECTS(!_options.directory.empty(), "No dataset directory");
+  CUDF_EXPECTS(!_options.partition_cols.empty(), "No partition columns");
+  if (_options.directory.size() > 1 && _options.directory.back() == '/') {
+    _options.directory.pop_back();
+  }
+  if (metadata != nullptr) { _metadata = *metadata; }
+}
+
+void dataset_writer::impl::init_file_metadata(table_view const &table)
+{
+  const auto num_columns = table.num_columns();
+  const auto column_name = [&](size_type col) {
+    return (static_cast<size_t>(col) < _metadata.column_names.size())
+             ? _metadata.column_names[col]
+             : "_col" + std::to_string(col);
+  };
+  for (const auto col : _options.partition_cols) {
+    CUDF_EXPECTS(col >= 0 && col < num_columns, "Invalid partition column index");
+    _partition_keys.push_back(column_name(col));
+  }
+
+  // The partition columns are only stored in the directory names
+  for (size_type col = 0; col < num_columns; ++col) {
+    const auto &keys = _options.partition_cols;
+    if (std::find(keys.begin(), keys.end(), col) != keys.end()) { continue; }
+    _data_cols.push_back(col);
+    _file_metadata.column_names.push_back(column_name(col));
+    if (!_metadata.column_nullable.empty()) {
+      _file_metadata.column_nullable.push_back(_metadata.column_nullable[col]);
+    }
+  }
+  _file_metadata.user_data = _metadata.user_data;
+
+  auto &encodings = _options.file_options.column_encodings;
+  if (!encodings.empty()) {
+    std::vector<column_encoding> file_encodings;
+    for (const auto col : _data_cols) {
+      const bool has_encoding = static_cast<size_t>(col) < encodings.size();
+      file_encodings.push_back(has_encoding ? encodings[col] : column_encoding::AUTO);
+    }
+    encodings = std::move(file_encodings);
+  }
+}
+
+dataset_writer::impl::open_file &dataset_writer::impl::open(std::string const &partition_dir,
+                                                           cudaStream_t stream)
+{
+  if (_options.max_open_files != 0 && _open_files.size() >= _options.max_open_files) {
+    const auto lru = std::min_element(
+      _open_files.begin(), _open_files.end(), [](const auto &lhs, const auto &rhs) {
+        return lhs.second.last_write < rhs.second.last_write;
+      });
+    close_file(lru->first);
+  }
+
+  create_directories(_options.directory + "/" + partition_dir);
+  auto &file       = _open_files[partition_dir];
+  const auto index = _file_counts[partition_dir]++;
+  file.path        = partition_dir + "/part-" + std::to_string(index) + ".parquet";
+
+  file.state     = std::make_unique<pq_chunked_state>();
+  file.state->wp = std::make_unique<writer>(
+    data_sink::create(_options.directory + "/" + file.path), _options.file_options, _mr);
+  file.state->user_metadata_with_nullability = _file_metadata;
+  file.state->user_metadata                  = &file.state->user_metadata_with_nullability;
+  file.state->stream                         = stream;
+  file.state->wp->write_chunked_begin(*file.state);
+  return file;
+}
+
+void dataset_writer::impl::close_file(std::string const &partition_dir)
+{
+  auto it     = _open_files.find(partition_dir);
+  auto footer = it->second.state->wp->write_chunked_end(
+    *it->second.state, _options.write_metadata_file, it->second.path);
+  if (footer != nullptr) { _file_footers.push_back(std::move(footer)); }
+  _open_files.erase(it);
+}
+
+void dataset_writer::impl::write(table_view const &table, cudaStream_t stream)
+{
+  if (_partition_keys.empty()) { init_file_metadata(table); }
+  CUDF_EXPECTS(static_cast<size_t>(table.num_columns()) ==
+                 _partition_keys.size() + _data_cols.size(),
+               "Mismatch in table structure between multiple calls to write");
+  if (table.num_rows() == 0) { return; }
+
+  // Group the rows by partition with a stable sort, so that the rows of each partition keep their
+  // order, and the groups are in sorted order of their keys
+  const auto temp_mr    = rmm::mr::get_default_resource();
+  const auto key_view   = table.select(_options.partition_cols);
+  const auto nulls_last = std::vector<null_order>(key_view.num_columns(), null_order::AFTER);
+  const auto order = cudf::detail::stable_sorted_order(key_view, {}, nulls_last, temp_mr, stream);
+  const auto grouped =
+    cudf::detail::gather(table, order->view(), false, false, false, temp_mr, stream);
+  groupby::detail::sort::sort_groupby_helper helper(
+    grouped->view().select(_options.partition_cols), null_policy::INCLUDE, sorted::YES);
+  const auto keys       = helper.unique_keys(temp_mr, stream);
+  const auto &d_offsets = helper.group_offsets(stream);
+  std::vector<size_type> group_offsets(d_offsets.size());
+  CUDA_TRY(cudaMemcpyAsync(group_offsets.data(),
+                           d_offsets.data().get(),
+                           d_offsets.size() * sizeof(size_type),
+                           cudaMemcpyDeviceToHost,
+                           stream));
+  CUDA_TRY(cudaStreamSynchronize(stream));
+
+  // Only the distinct keys are copied to the host to name the directories
+  std::vector<std::vector<std::string>> key_values;
+  for (const auto &key : keys->view()) {
+    key_values.push_back(format_partition_values(key, stream));
+  }
+
+  const auto num_groups = static_cast<size_type>(group_offsets.size()) - 1;
+  const auto groups     = cudf::split(grouped->view().select(_data_cols),
+                                  {group_offsets.begin() + 1, group_offsets.end() - 1});
+  for (size_type g = 0; g < num_groups; ++g) {
+    std::string partition_dir;
+    for (size_t k = 0; k < _partition_keys.size(); ++k) {
+      if (k != 0) { partition_dir += "/"; }
+      partition_dir += _partition_keys[k] + "=" + key_values[k][g];
+    }
+    auto it    = _open_files.find(partition_dir);
+    auto &file = (it != _open_files.end()) ? it->second : open(partition_dir, stream);
+    file.state->stream = stream;
+    file.state->wp->write_chunked(groups[g], *file.state);
+    file.last_write    = ++_num_writes;
+  }
+}
+
+void dataset_writer::impl::close(cudaStream_t stream)
+{
+  while (!_open_files.empty()) { close_file(_open_files.begin()->first); }
+
+  if (_options.write_metadata_file && !_file_footers.empty()) {
+    const auto merged = writer::merge_rowgroup_metadata(_file_footers);
+    auto sink         = data_sink::create(_options.directory + "/_metadata");
+    sink->host_write(merged->data(), merged->size());
+    sink->flush();
+    _file_footers.clear();
+  }
+}
+
+// Forward to implementation
+dataset_writer::dataset_writer(dataset_writer_options const &options,
+                               table_metadata_with_nullability const *metadata,
+                               rmm::mr::device_memory_resource *mr)
+  : _impl(std::make_unique<impl>(options, metadata, mr))
+{
+}
+
+// Destructor within this translation unit
+dataset_writer::~dataset_writer() = default;
+
+// Forward to implementation
+void dataset_writer::write(table_view const &table, cudaStream_t stream)
+{
+  _impl->write(table, stream);
+}
+
+// Forward to implementation
+void dataset_writer::close(cudaStream_t stream) { _impl->close(stream); }
+
+}  // namespace parquet
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
@@ -150,6 +150,9 @@ inline __device__ uint32_t get_vlq32(const uint8_t *&cur, const uint8_t *end)
  * @brief Parse the beginning of the level section (definition or repetition),
  * initializes the initial RLE run & value, and returns the section length
  *
+ * The levels of V2 data pages are not prefixed by their length, which is taken from the page
+ * header instead.
+ *
  * @param[in,out] s The page state
  * @param[in] cur The current data position
  * @param[in] end The end of the data
@@ -161,16 +164,21 @@ __device__ uint32_t InitLevelSection(
   page_state_s *s, const uint8_t *cur, const uint8_t *end, int encoding, int level_bits, int idx)
 {
   int32_t len;
+  bool is_v2 = (s->page.flags & PAGEINFO_FLAGS_V2) != 0;
   if (level_bits == 0) {
-    len                       = 0;
+    len                       = (is_v2) ? s->page.lvl_bytes[idx] : 0;
     s->initial_rle_run[idx]   = s->page.num_values * 2;  // repeated value
     s->initial_rle_value[idx] = 0;
     s->lvl_start[idx]         = cur;
   } else if (encoding == RLE) {
-    if (cur + 4 < end) {
+    if ((is_v2) ? cur + s->page.lvl_bytes[idx] <= end : cur + 4 < end) {
       uint32_t run;
-      len = 4 + (cur[0]) + (cur[1] << 8) + (cur[2] << 16) + (cur[3] << 24);
-      cur += 4;
+      if (is_v2) {
+        len = s->page.lvl_bytes[idx];
+      } else {
+        len = 4 + (cur[0]) + (cur[1] << 8) + (cur[2] << 16) + (cur[3] << 24);
+        cur += 4;
+      }
       run                     = get_vlq32(cur, end);
       s->initial_rle_run[idx] = run;
       if (!(run & 1)) {
@@ -1035,12 +1043,20 @@ extern "C" __global__ void __launch_bounds__(NTHREADS) gpuDecodePageData(
       if (page_start_row + s->num_rows > min_row + num_rows) {
         s->num_rows = (int32_t)max((int64_t)(min_row + num_rows - page_start_row), INT64_C(0));
       }
-      // Find the compressed size of definition levels
-      cur +=
-        InitLevelSection(s, cur, end, s->page.definition_level_encoding, s->col.def_level_bits, 0);
-      // Find the compressed size of repetition levels
-      cur +=
-        InitLevelSection(s, cur, end, s->page.repetition_level_encoding, s->col.rep_level_bits, 1);
+      if (s->page.flags & PAGEINFO_FLAGS_V2) {
+        // V2 data pages store the repetition levels before the definition levels
+        cur += InitLevelSection(
+          s, cur, end, s->page.repetition_level_encoding, s->col.rep_level_bits, 1);
+        cur += InitLevelSection(
+          s, cur, end, s->page.definition_level_encoding, s->col.def_level_bits, 0);
+      } else {
+        // Find the compressed size of definition levels
+        cur += InitLevelSection(
+          s, cur, end, s->page.definition_level_encoding, s->col.def_level_bits, 0);
+        // Find the compressed size of repetition levels
+        cur += InitLevelSection(
+          s, cur, end, s->page.repetition_level_encoding, s->col.rep_level_bits, 1);
+      }
       s->dict_bits = 0;
       s->dict_base = 0;
       s->dict_size = 0;
@@ -0,0 +1,532 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <io/utilities/block_utils.cuh>
+#include "parquet_gpu.h"
+
+#define DELTA_MAX_MINIBLOCKS 64
+
+namespace cudf {
+namespace io {
+namespace parquet {
+namespace gpu {
+/**
+ * @brief State of a DELTA_BINARY_PACKED stream decoder
+ **/
+struct delta_state_s {
+  const uint8_t *cur;                              // start of the next block
+  const uint8_t *end;                              // end of the page data
+  uint32_t block_size;                             // number of values per block
+  uint32_t mb_size;                                // number of values per miniblock
+  uint32_t num_mb;                                 // number of miniblocks per block
+  uint32_t num_values;                             // total number of values in the stream
+  uint32_t value_pos;                              // number of values decoded so far
+  uint32_t block_pos;                              // number of values decoded in the block
+  uint32_t block_values;                           // number of values in the current block
+  uint64_t last_value;                             // last decoded value
+  int64_t min_delta;                               // min delta of the current block
+  const uint8_t *mb_start[DELTA_MAX_MINIBLOCKS];  // miniblock data of the current block
+  uint8_t mb_width[DELTA_MAX_MINIBLOCKS];         // bit width of the miniblocks
+};
+
+struct plain_state_s {
+  delta_state_s delta[2];    // value streams (DELTA_BYTE_ARRAY: prefix and suffix lengths)
+  uint64_t values[2][128];   // decoded values of the streams
+  uint64_t offsets[2][128];  // source and destination offsets of the strings
+  uint64_t scratch[4];
+  const uint8_t *data;      // start of the encoded values
+  const uint8_t *end;       // end of the page data
+  const uint8_t *str_data;  // start of the string bytes
+  uint8_t *prev_str;        // previous string in the output (DELTA_BYTE_ARRAY)
+  uint32_t prev_len;        // length of the previous string
+  uint32_t levels_size;     // size of the definition and repetition levels
+  uint32_t num_values;      // number of encoded values
+  uint32_t dtype_len;       // size of the values in the PLAIN encoding
+  uint64_t size;            // size of the page in the PLAIN encoding
+  int32_t error;
+};
+
+inline __device__ uint64_t get_vlq64(const uint8_t *&cur, const uint8_t *end)
+{
+  uint64_t v = 0;
+  for (uint32_t shift = 0; cur < end && shift < 64; shift += 7) {
+    uint8_t b = *cur++;
+    v |= static_cast<uint64_t>(b & 0x7f) << shift;
+    if (!(b & 0x80)) break;
+  }
+  return v;
+}
+
+inline __device__ int64_t zigzag_decode64(uint64_t v)
+{
+  return static_cast<int64_t>((v >> 1) ^ (~(v & 1) + 1));
+}
+
+/**
+ * @brief Returns the size of a level section (definition or repetition)
+ *
+ * @param[in] cur Start of the level section
+ * @param[in] end End of the page data
+ * @param[in] encoding The encoding type
+ * @param[in] level_bits The bits required
+ * @param[in] num_values Number of values in the page
+ *
+ * @return The size of the level section in bytes, or -1 if the encoding is not supported
+ **/
+inline __device__ int32_t LevelSectionSize(
+  const uint8_t *cur, const uint8_t *end, int encoding, int level_bits, int32_t num_values)
+{
+  if (level_bits == 0) {
+    return 0;
+  } else if (encoding == RLE) {
+    return (cur + 4 <= end) ? 4 + (cur[0] + (cur[1] << 8) + (cur[2] << 16) + (cur[3] << 24)) : -1;
+  } else if (encoding == BIT_PACKED) {
+    return (num_values * level_bits + 7) >> 3;
+  } else {
+    return -1;
+  }
+}
+
+/**
+ * @brief Parses the header of a DELTA_BINARY_PACKED stream (single thread)
+ *
+ * @param[out] d Decoder state
+ * @param[in] cur Start of the stream
+ * @param[in] end End of the page data
+ *
+ * @return true if the header is valid
+ **/
+__device__ bool InitDeltaStream(delta_state_s *d, const uint8_t *cur, const uint8_t *end)
+{
+  d->block_size   = static_cast<uint32_t>(get_vlq64(cur, end));
+  d->num_mb       = static_cast<uint32_t>(get_vlq64(cur, end));
+  d->num_values   = static_cast<uint32_t>(get_vlq64(cur, end));
+  d->last_value   = static_cast<uint64_t>(zigzag_decode64(get_vlq64(cur, end)));
+  d->value_pos    = 0;
+  d->block_pos    = 0;
+  d->block_values = 0;
+  d->cur          = cur;
+  d->end          = end;
+  if (d->block_size == 0 || (d->block_size & 0x7f) || d->num_mb == 0 ||
+      d->num_mb > DELTA_MAX_MINIBLOCKS || d->block_size % d->num_mb != 0) {
+    return false;
+  }
+  d->mb_size = d->block_size / d->num_mb;
+  return !(d->mb_size & 0x1f) && cur <= end;
+}
+
+/**
+ * @brief Parses the header of the next block of a DELTA_BINARY_PACKED stream (single thread)
+ *
+ * Only the miniblocks holding values are stored in the last block.
+ *
+ * @param[in,out] d Decoder state
+ *
+ * @return true if the block is valid
+ **/
+__device__ bool InitDeltaBlock(delta_state_s *d)
+{
+  const uint8_t *cur = d->cur;
+  const uint8_t *end = d->end;
+  uint32_t remaining = d->num_values - max(d->value_pos, 1);
+  uint32_t num_mb;
+
+  d->min_delta    = zigzag_decode64(get_vlq64(cur, end));
+  d->block_pos    = 0;
+  d->block_values = min(remaining, d->block_size);
+  num_mb          = (d->block_values + d->mb_size - 1) / d->mb_size;
+  if (cur + d->num_mb > end) { return false; }
+  for (uint32_t i = 0; i < d->num_mb; i++) { d->mb_width[i] = cur[i]; }
+  cur += d->num_mb;
+  for (uint32_t i = 0; i < num_mb; i++) {
+    if (d->mb_width[i] > 64) { return false; }
+    d->mb_start[i] = cur;
+    cur += (d->mb_width[i] * d->mb_size) >> 3;
+  }
+  d->cur = cur;
+  return cur <= end;
+}
+
+/**
+ * @brief Returns the end of a DELTA_BINARY_PACKED stream without decoding its values
+ *
+ * @param[in,out] d Decoder state, initialized with InitDeltaStream
+ *
+ * @return The end of the stream, or nullptr if the stream is not valid
+ **/
+__device__ const uint8_t *SkipDeltaStream(delta_state_s *d)
+{
+  if (d->num_values > 0) { d->value_pos = 1; }
+  while (d->value_pos < d->num_values) {
+    if (!InitDeltaBlock(d)) { return nullptr; }
+    d->value_pos += d->block_values;
+  }
+  return d->cur;
+}
+
+/**
+ * @brief Extracts a bit-packed value
+ **/
+inline __device__ uint64_t UnpackBits(const uint8_t *p,
+                                      const uint8_t *end,
+                                      uint32_t bit,
+                                      uint32_t w)
+{
+  uint64_t v = 0;
+  p += bit >> 3;
+  bit &= 7;
+  for (uint32_t n = 0; n < w + bit; n += 8, p++) {
+    uint64_t b = (p < end) ? *p : 0;
+    v |= (n != 0) ? b << (n - bit) : b >> bit;
+  }
+  return (w < 64) ? v & ((1ull << w) - 1) : v;
+}
+
+/**
+ * @brief Computes the inclusive prefix sum of a value across the thread block
+ *
+ * @param[in] v Value of the thread
+ * @param[in] scratch Scratch memory (4 entries)
+ * @param[out] total Sum of the values of all the threads
+ * @param[in] t thread id (0..127)
+ **/
+inline __device__ uint64_t BlockInclusiveSum(uint64_t v,
+                                             volatile uint64_t *scratch,
+                                             uint64_t &total,
+                                             uint32_t t)
+{
+  v = WarpReducePos32(v, t);
+  if ((t & 0x1f) == 0x1f) { scratch[t >> 5] = v; }
+  __syncthreads();
+  total = scratch[0] + scratch[1] + scratch[2] + scratch[3];
+  for (uint32_t w = 0; w < (t >> 5); w++) { v += scratch[w]; }
+  __syncthreads();
+  return v;
+}
+
+/**
+ * @brief Decodes the next values of a DELTA_BINARY_PACKED stream
+ *
+ * @param[in,out] s Page state
+ * @param[in,out] d Decoder state
+ * @param[out] values Decoded values
+ * @param[in] count Number of values to decode (up to 128)
+ * @param[in] t thread id (0..127)
+ **/
+__device__ void DecodeDeltaValues(
+  plain_state_s *s, delta_state_s *d, uint64_t *values, uint32_t count, uint32_t t)
+{
+  uint32_t pos = 0;
+  while (pos < count) {
+    uint32_t n;
+    uint64_t delta = 0, total;
+    if (d->value_pos == 0) {
+      // The first value is stored in the stream header
+      __syncthreads();
+      if (!t) {
+        values[0]    = d->last_value;
+        d->value_pos = 1;
+      }
+      n = 1;
+    } else {
+      uint32_t block_pos;
+      if (d->block_pos == d->block_values) {
+        __syncthreads();
+        if (!t && !InitDeltaBlock(d)) {
+          // Consume the remaining values as zero deltas
+          s->error        = 1;
+          d->min_delta    = 0;
+          d->block_pos    = 0;
+          d->block_values = d->num_values;
+          d->mb_size      = d->num_values;
+          d->mb_width[0]  = 0;
+        }
+        __syncthreads();
+      }
+      block_pos = d->block_pos;
+      n         = min(count - pos, d->block_values - block_pos);
+      if (t < n) {
+        uint32_t i  = block_pos + t;
+        uint32_t mb = i / d->mb_size;
+        uint32_t w  = d->mb_width[mb];
+        delta       = UnpackBits(d->mb_start[mb], d->end, (i - mb * d->mb_size) * w, w);
+        delta += static_cast<uint64_t>(d->min_delta);
+      }
+      delta = BlockInclusiveSum(delta, s->scratch, total, t);
+      if (t < n) { values[pos + t] = d->last_value + delta; }
+      __syncthreads();
+      if (!t) {
+        d->last_value = values[pos + n - 1];
+        d->block_pos += n;
+        d->value_pos += n;
+      }
+    }
+    __syncthreads();
+    pos += n;
+  }
+}
+
+/**
+ * @brief Converts a data page encoded with a delta or byte stream split encoding to the PLAIN
+ * encoding, so that it can be decoded like the other pages
+ *
+ * A first pass (null output) returns the size of the converted page, a second pass writes it.
+ *
+ * @param[in] pages List of pages
+ * @param[in] chunks List of column chunks
+ * @param[in,out] plain_pages Output buffer and size of the converted pages
+ **/
+// blockDim(128, 1, 1)
+__global__ void __launch_bounds__(128) gpuDecodeToPlain(const PageInfo *pages,
+                                                        const ColumnChunkDesc *chunks,
+                                                        PlainPageDesc *plain_pages)
+{
+  __shared__ __align__(8) plain_state_s state_g;
+
+  plain_state_s *const s = &state_g;
+  uint32_t t             = threadIdx.x;
+  const PageInfo *page   = &pages[blockIdx.x];
+  uint8_t *out           = plain_pages[blockIdx.x].data;
+  int encoding           = page->encoding;
+  int dtype              = chunks[page->chunk_idx].data_type & 7;
+  uint32_t num_values;
+
+  if ((page->flags & PAGEINFO_FLAGS_DICTIONARY) ||
+      (encoding != DELTA_BINARY_PACKED && encoding != DELTA_LENGTH_BYTE_ARRAY &&
+       encoding != DELTA_BYTE_ARRAY && encoding != BYTE_STREAM_SPLIT)) {
+    return;
+  }
+  if (!t) {
+    const ColumnChunkDesc *col = &chunks[page->chunk_idx];
+    const uint8_t *cur         = page->page_data;
+    const uint8_t *end         = cur + page->uncompressed_page_size;
+    int32_t def_size, rep_size;
+    if (page->flags & PAGEINFO_FLAGS_V2) {
+      // V2 data pages store the size of the levels in the page header
+      def_size = page->lvl_bytes[0];
+      rep_size = page->lvl_bytes[1];
+    } else {
+      def_size = LevelSectionSize(
+        cur, end, page->definition_level_encoding, col->def_level_bits, page->num_values);
+      rep_size = LevelSectionSize(cur + max(def_size, 0),
+                                  end,
+                                  page->repetition_level_encoding,
+                                  col->rep_level_bits,
+                                  page->num_values);
+    }
+    s->error       = (def_size < 0 || rep_size < 0 || def_size + rep_size > end - cur);
+    s->levels_size = (s->error) ? 0 : def_size + rep_size;
+    s->data        = cur + s->levels_size;
+    s->end         = end;
+    s->size        = s->levels_size;
+    s->prev_str    = nullptr;
+    s->prev_len    = 0;
+    s->num_values  = 0;
+    switch (encoding) {
+      case DELTA_BINARY_PACKED:
+        s->dtype_len = (dtype == INT32) ? 4 : 8;
+        if (dtype != INT32 && dtype != INT64) { s->error = 1; }
+        break;
+      case DELTA_LENGTH_BYTE_ARRAY:
+      case DELTA_BYTE_ARRAY:
+        s->dtype_len = 4;
+        if (dtype != BYTE_ARRAY) { s->error = 1; }
+        break;
+      default:
+        s->dtype_len = (dtype == FLOAT || dtype == INT32)
+                         ? 4
+                         : (dtype == DOUBLE || dtype == INT64)
+                             ? 8
+                             : (dtype == FIXED_LEN_BYTE_ARRAY) ? col->data_type >> 3 : 0;
+        if (s->dtype_len == 0) { s->error = 1; }
+        break;
+    }
+    if (!s->error && (page->flags & PAGEINFO_FLAGS_V2) && page->num_nulls >= page->num_values) {
+      // V2 pages with only nulls have no values to convert, and their value bytes are not
+      // decompressed
+      s->end      = s->data;
+      s->str_data = s->data;
+    } else if (!s->error && encoding == BYTE_STREAM_SPLIT) {
+      s->num_values = static_cast<uint32_t>(s->end - s->data) / s->dtype_len;
+    } else if (!s->error) {
+      // Locate the value streams, and the string bytes following them
+      if (!InitDeltaStream(&s->delta[0], s->data, end)) {
+        s->error = 1;
+      } else if (encoding == DELTA_LENGTH_BYTE_ARRAY) {
+        delta_state_s d = s->delta[0];
+        s->str_data     = SkipDeltaStream(&d);
+      } else if (encoding == DELTA_BYTE_ARRAY) {
+        delta_state_s d         = s->delta[0];
+        const uint8_t *suffixes = SkipDeltaStream(&d);
+        if (!suffixes || !InitDeltaStream(&s->delta[1], suffixes, end)) {
+          s->error = 1;
+        } else {
+          d           = s->delta[1];
+          s->str_data = SkipDeltaStream(&d);
+          if (s->delta[1].num_values != s->delta[0].num_values) { s->error = 1; }
+        }
+      }
+      if (encoding != DELTA_BINARY_PACKED && !s->error && !s->str_data) { s->error = 1; }
+      s->num_values = s->delta[0].num_values;
+    }
+  }
+  __syncthreads();
+  if (s->error) {
+    if (!t) { plain_pages[blockIdx.x].error = s->error; }
+    return;
+  }
+  if (out) {
+    // Levels are kept as is
+    for (uint32_t i = t; i < s->levels_size; i += 128) { out[i] = page->page_data[i]; }
+    out += s->levels_size;
+  }
+  num_values = s->num_values;
+  if (encoding == DELTA_BINARY_PACKED) {
+    if (out) {
+      for (uint32_t pos = 0; pos < num_values; pos += 128) {
+        uint32_t n = min(num_values - pos, 128);
+        DecodeDeltaValues(s, &s->delta[0], s->values[0], n, t);
+        if (t < n) {
+          uint64_t v   = s->values[0][t];
+          uint8_t *dst = out + (pos + t) * s->dtype_len;
+          for (uint32_t b = 0; b < s->dtype_len; b++) { dst[b] = v >> (b * 8); }
+        }
+        __syncthreads();
+      }
+    }
+    if (!t) { s->size += num_values * s->dtype_len; }
+  } else if (encoding == DELTA_LENGTH_BYTE_ARRAY) {
+    if (out) {
+      uint64_t src_pos = 0, dst_pos = 0;
+      for (uint32_t pos = 0; pos < num_values; pos += 128) {
+        uint32_t n   = min(num_values - pos, 128);
+        uint64_t len = 0, src_end, dst_end, total_len, total_size;
+        DecodeDeltaValues(s, &s->delta[0], s->values[0], n, t);
+        if (t < n) { len = static_cast<uint32_t>(s->values[0][t]); }
+        src_end = src_pos + BlockInclusiveSum(len, s->scratch, total_len, t);
+        dst_end = dst_pos + BlockInclusiveSum((t < n) ? 4 + len : 0, s->scratch, total_size, t);
+        if (t < n) {
+          const uint8_t *src = s->str_data + src_end - len;
+          uint8_t *dst       = out + dst_end - 4 - len;
+          if (src + len > s->end) {
+            s->error = 1;
+          } else {
+            dst[0] = len;
+            dst[1] = len >> 8;
+            dst[2] = len >> 16;
+            dst[3] = len >> 24;
+            memcpy(dst + 4, src, len);
+          }
+        }
+        src_pos += total_len;
+        dst_pos += total_size;
+      }
+    }
+    if (!t) { s->size += 4 * num_values + (s->end - s->str_data); }
+  } else if (encoding == DELTA_BYTE_ARRAY) {
+    uint64_t src_pos = 0, dst_pos = 0;
+    for (uint32_t pos = 0; pos < num_values; pos += 128) {
+      uint32_t n      = min(num_values - pos, 128);
+      uint64_t prefix = 0, suffix = 0, src_end, dst_end, total_suffix, total_size;
+      DecodeDeltaValues(s, &s->delta[0], s->values[0], n, t);
+      DecodeDeltaValues(s, &s->delta[1], s->values[1], n, t);
+      if (t < n) {
+        prefix = static_cast<uint32_t>(s->values[0][t]);
+        suffix = static_cast<uint32_t>(s->values[1][t]);
+      }
+      src_end = src_pos + BlockInclusiveSum(suffix, s->scratch, total_suffix, t);
+      dst_end =
+        dst_pos + BlockInclusiveSum((t < n) ? 4 + prefix + suffix : 0, s->scratch, total_size, t);
+      if (out) {
+        s->offsets[0][t] = src_end - suffix;
+        s->offsets[1][t] = dst_end - 4 - prefix - suffix;
+        __syncthreads();
+        // Each string starts with a prefix of the previous one, so the strings are rebuilt in
+        // order by the first warp
+        if (t < 32) {
+          for (uint32_t k = 0; k < n; k++) {
+            uint32_t prefix_len = static_cast<uint32_t>(s->values[0][k]);
+            uint32_t suffix_len = static_cast<uint32_t>(s->values[1][k]);
+            uint32_t len        = prefix_len + suffix_len;
+            const uint8_t *src  = s->str_data + s->offsets[0][k];
+            const uint8_t *prev = s->prev_str;
+            uint8_t *dst        = out + s->offsets[1][k];
+            if (prefix_len > s->prev_len || src + suffix_len > s->end) {
+              if (!t) { s->error = 1; }
+              break;
+            }
+            if (t < 4) { dst[t] = len >> (t * 8); }
+            for (uint32_t i = t; i < prefix_len; i += 32) { dst[4 + i] = prev[i]; }
+            for (uint32_t i = t; i < suffix_len; i += 32) { dst[4 + prefix_len + i] = src[i]; }
+            SYNCWARP();
+            if (!t) {
+              s->prev_str = dst + 4;
+              s->prev_len = len;
+            }
+            SYNCWARP();
+          }
+        }
+        __syncthreads();
+      }
+      src_pos += total_suffix;
+      dst_pos += total_size;
+    }
+    if (!t) {
+      s->size += dst_pos;
+      if (src_pos > static_cast<uint64_t>(s->end - s->str_data)) { s->error = 1; }
+    }
+  } else {
+    if (out) {
+      for (uint32_t i = t; i < num_values; i += 128) {
+        for (uint32_t b = 0; b < s->dtype_len; b++) {
+          out[i * s->dtype_len + b] = s->data[b * num_values + i];
+        }
+      }
+    }
+    if (!t) { s->size += num_values * s->dtype_len; }
+  }
+  __syncthreads();
+  if (!t) {
+    plain_pages[blockIdx.x].size  = s->size;
+    plain_pages[blockIdx.x].error = s->error;
+  }
+}
+
+/**
+ * @brief Launches kernel for converting the delta and byte stream split encoded data pages to
+ * the PLAIN encoding
+ *
+ * @param[in] pages List of pages
+ * @param[in] num_pages Number of pages
+ * @param[in] chunks List of column chunks
+ * @param[in,out] plain_pages Output buffer and size of the converted pages
+ * @param[in] stream CUDA stream to use, default 0
+ *
+ * @return cudaSuccess if successful, a CUDA error code otherwise
+ **/
+cudaError_t __host__ DecodeToPlainPages(const PageInfo *pages,
+                                        int32_t num_pages,
+                                        const ColumnChunkDesc *chunks,
+                                        PlainPageDesc *plain_pages,
+                                        cudaStream_t stream)
+{
+  gpuDecodeToPlain<<<num_pages, 128, 0, stream>>>(pages, chunks, plain_pages);
+  return cudaSuccess;
+}
+
+}  // namespace gpu
+}  // namespace parquet
+}  // namespace io
+}  // namespace cudf
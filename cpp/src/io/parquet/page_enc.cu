@@ -41,6 +41,8 @@ struct frag_init_state_s {
 #define RLE_BFRSZ (1 << LOG2_RLE_BFRSZ)
 #define RLE_MAX_LIT_RUN 0xfff8  // Maximum literal run for 2-byte run code
 
+#define DELTA_BFRSZ 256  // Values buffered by the delta encoder (up to two blocks of 128 deltas)
+
 struct page_enc_state_s {
   uint8_t *cur;          //!< current output ptr
   uint8_t *rle_out;      //!< current RLE write ptr
@@ -50,6 +52,11 @@ struct page_enc_state_s {
   uint32_t rle_numvals;  //!< RLE input value count
   uint32_t rle_lit_count;
   uint32_t rle_rpt_count;
+  uint8_t *delta_out;    //!< current delta encoder write ptr
+  uint32_t delta_pos;    //!< delta encoder position (values already encoded)
+  uint32_t delta_count;  //!< delta encoder input value count
+  uint32_t delta_total;  //!< total count of values in the delta stream
+  uint32_t prev_row;     //!< last valid row of the previous batch, ~0 if none
   volatile uint32_t rpt_map[4];
   volatile uint32_t scratch_red[32];
   EncPage page;
@@ -57,7 +64,16 @@ struct page_enc_state_s {
   EncColumnDesc col;
   gpu_inflate_input_s comp_in;
   gpu_inflate_status_s comp_out;
-  uint16_t vals[RLE_BFRSZ];
+  union {
+    uint16_t vals[RLE_BFRSZ];
+    struct {
+      uint64_t values[DELTA_BFRSZ];  //!< values waiting to be delta-encoded
+      uint64_t packed[128];          //!< deltas of a block relative to the block's min delta
+      int64_t min_delta[4];          //!< min delta of each warp
+      uint32_t rows[128];            //!< valid rows of the current batch
+      uint8_t bit_width[4];          //!< bit width of each miniblock
+    } delta;
+  };
 };
 
 /**
@@ -373,6 +389,28 @@ __global__ void __launch_bounds__(128) gpuInitFragmentStats(statistics_group *gr
   }
 }
 
+/**
+ * @brief Returns the worst-case size of a page of non-null values using a delta encoding, in excess
+ * of the size of the same values in PLAIN encoding
+ *
+ * Every DELTA_BINARY_PACKED stream has a header, a header per block of 128 deltas (zigzag min delta
+ * and 4 miniblock bit widths) and pads its last miniblock to 32 values. Deltas take at most as many
+ * bits as the PLAIN values or string lengths, and DELTA_BYTE_ARRAY adds a stream of prefix lengths.
+ *
+ * @param[in] encoding Encoding of the page
+ * @param[in] num_values Number of rows in the page
+ **/
+inline __device__ uint32_t MaxDeltaEncodingOverhead(uint32_t encoding, uint32_t num_values)
+{
+  uint32_t stream_overhead = 32 + ((num_values + 127) >> 7) * 14 + 32 * 8;
+  switch (encoding) {
+    case DELTA_BINARY_PACKED:
+    case DELTA_LENGTH_BYTE_ARRAY: return stream_overhead;
+    case DELTA_BYTE_ARRAY: return 2 * stream_overhead + num_values * 4;
+    default: return 0;
+  }
+}
+
 // blockDim {128,1,1}
 __global__ void __launch_bounds__(128) gpuInitPages(EncColumnChunk *chunks,
                                                     EncPage *pages,
@@ -380,7 +418,8 @@ __global__ void __launch_bounds__(128) gpuInitPages(EncColumnChunk *chunks,
                                                     statistics_merge_group *page_grstats,
                                                     statistics_merge_group *chunk_grstats,
                                                     int32_t num_rowgroups,
-                                                    int32_t num_columns)
+                                                    int32_t num_columns,
+                                                    bool write_v2_headers)
 {
   __shared__ __align__(8) EncColumnDesc col_g;
   __shared__ __align__(8) EncColumnChunk ck_g;
@@ -431,6 +470,8 @@ __global__ void __launch_bounds__(128) gpuInitPages(EncColumnChunk *chunks,
         page_g.max_data_size   = ck_g.dictionary_size;
         page_g.start_row       = cur_row;
         page_g.num_rows        = ck_g.total_dict_entries;
+        page_g.num_nulls       = 0;
+        page_g.levels_size     = 0;
         page_offset += page_g.max_hdr_size + page_g.max_data_size;
         comp_page_offset += page_g.max_hdr_size + GetMaxCompressedBfrSize(page_g.max_data_size);
       }
@@ -506,10 +547,10 @@ __global__ void __launch_bounds__(128) gpuInitPages(EncColumnChunk *chunks,
               : 0;
           page_g.num_fragments   = fragments_in_chunk - page_start;
           page_g.chunk_id        = blockIdx.y * num_columns + blockIdx.x;
-          page_g.page_type       = DATA_PAGE;
+          page_g.page_type       = (write_v2_headers) ? DATA_PAGE_V2 : DATA_PAGE;
           page_g.dict_bits_plus1 = dict_bits_plus1;
           page_g.hdr_size        = 0;
-          page_g.max_hdr_size    = 32;  // Max size excluding statistics
+          page_g.max_hdr_size    = (write_v2_headers) ? 48 : 32;  // Max size excluding statistics
           if (ck_g.stats) {
             uint32_t stats_hdr_len = 16;
             if (col_g.stats_dtype == dtype_string) {
@@ -519,11 +560,16 @@ __global__ void __launch_bounds__(128) gpuInitPages(EncColumnChunk *chunks,
             }
             page_g.max_hdr_size += stats_hdr_len;
           }
-          page_g.max_data_size    = page_size + def_level_size;
+          page_g.max_data_size = page_size + def_level_size;
+          if (!dict_bits_plus1) {
+            page_g.max_data_size += MaxDeltaEncodingOverhead(col_g.encoding, rows_in_page);
+          }
           page_g.page_data        = ck_g.uncompressed_bfr + page_offset;
           page_g.compressed_data  = ck_g.compressed_bfr + comp_page_offset;
           page_g.start_row        = cur_row;
           page_g.num_rows         = rows_in_page;
+          page_g.num_nulls        = 0;
+          page_g.levels_size      = 0;
           pagestats_g.start_chunk = ck_g.first_fragment + page_start;
           pagestats_g.num_chunks  = page_g.num_fragments;
           page_offset += page_g.max_hdr_size + page_g.max_data_size;
@@ -815,6 +861,410 @@ static __device__ void PlainBoolEncode(page_enc_state_s *s,
   }
 }
 
+/**
+ * @brief Variable-length encode a 64-bit integer
+ **/
+inline __device__ uint8_t *VlqEncode64(uint8_t *p, uint64_t v)
+{
+  while (v > 0x7f) {
+    *p++ = (v | 0x80);
+    v >>= 7;
+  }
+  *p++ = v;
+  return p;
+}
+
+/**
+ * @brief Zigzag-encode a signed 64-bit integer
+ **/
+inline __device__ uint64_t ZigZagEncode64(int64_t v)
+{
+  return (static_cast<uint64_t>(v) << 1) ^ static_cast<uint64_t>(v >> 63);
+}
+
+/**
+ * @brief Returns whether a row of the column is valid (non-null)
+ **/
+inline __device__ uint32_t IsRowValid(const page_enc_state_s *s, uint32_t row)
+{
+  const uint32_t *valid = s->col.valid_map_base;
+  return (row < s->col.num_rows) ? (valid) ? (valid[row >> 5] >> (row & 0x1f)) & 1 : 1 : 0;
+}
+
+/**
+ * @brief Returns the number of valid values in the page
+ *
+ * @param[in,out] s Page encode state
+ * @param[in] t thread id (0..127)
+ */
+static __device__ uint32_t CountPageValues(page_enc_state_s *s, uint32_t t)
+{
+  uint32_t count = 0;
+  for (uint32_t i = t; i < s->page.num_rows; i += 128) {
+    count += IsRowValid(s, s->page.start_row + i);
+  }
+  count = WarpReduceSum32(count);
+  if (!(t & 0x1f)) { s->scratch_red[t >> 5] = count; }
+  __syncthreads();
+  count = s->scratch_red[0] + s->scratch_red[1] + s->scratch_red[2] + s->scratch_red[3];
+  __syncthreads();
+  return count;
+}
+
+/**
+ * @brief Returns the position of a valid value among the valid values of a batch of 128 rows
+ *
+ * The number of valid values in the batch is left in scratch_red[3].
+ *
+ * @param[in,out] s Page encode state
+ * @param[in] is_valid nonzero if the thread's row is valid
+ * @param[in] t thread id (0..127)
+ */
+static __device__ uint32_t ValuePosition(page_enc_state_s *s, uint32_t is_valid, uint32_t t)
+{
+  uint32_t warp_valids = BALLOT(is_valid);
+  uint32_t pos         = __popc(warp_valids & ((1u << (t & 0x1f)) - 1));
+  if (!(t & 0x1f)) { s->scratch_red[t >> 5] = __popc(warp_valids); }
+  __syncthreads();
+  if (t < 32) { s->scratch_red[t] = WarpReducePos4((t < 4) ? s->scratch_red[t] : 0, t); }
+  __syncthreads();
+  return pos + ((t >= 32) ? s->scratch_red[(t - 32) >> 5] : 0);
+}
+
+/**
+ * @brief Returns the value of a row of an INT32 or INT64 column, as stored in the page
+ **/
+inline __device__ int64_t GetIntegerValue(const page_enc_state_s *s,
+                                          uint32_t row,
+                                          uint32_t dtype_len_in)
+{
+  const uint8_t *src8 =
+    reinterpret_cast<const uint8_t *>(s->col.column_data_base) + row * (size_t)dtype_len_in;
+  if (s->col.physical_type == INT64) {
+    int64_t v        = *reinterpret_cast<const int64_t *>(src8);
+    int32_t ts_scale = s->col.ts_scale;
+    if (ts_scale != 0) {
+      if (ts_scale < 0) {
+        v /= -ts_scale;
+      } else {
+        v *= ts_scale;
+      }
+    }
+    return v;
+  } else if (dtype_len_in == 4) {
+    return *reinterpret_cast<const int32_t *>(src8);
+  } else if (dtype_len_in == 2) {
+    return *reinterpret_cast<const int16_t *>(src8);
+  } else {
+    return *reinterpret_cast<const int8_t *>(src8);
+  }
+}
+
+/**
+ * @brief Returns the length of the prefix a string shares with the previous valid string
+ *
+ * @param[in] s Page encode state
+ * @param[in] row Row of the string
+ * @param[in] pos Position of the string among the valid values of the batch
+ */
+inline __device__ uint32_t PrefixLength(const page_enc_state_s *s, uint32_t row, uint32_t pos)
+{
+  const nvstrdesc_s *strings = reinterpret_cast<const nvstrdesc_s *>(s->col.column_data_base);
+  uint32_t prev_row          = (pos > 0) ? s->delta.rows[pos - 1] : s->prev_row;
+  if (prev_row == ~0u) { return 0; }
+  const char *cur  = strings[row].ptr;
+  const char *prev = strings[prev_row].ptr;
+  uint32_t len     = min((uint32_t)strings[row].count, (uint32_t)strings[prev_row].count);
+  uint32_t i       = 0;
+  while (i < len && cur[i] == prev[i]) { i++; }
+  return i;
+}
+
+/**
+ * @brief Kinds of values encoded in DELTA_BINARY_PACKED streams
+ **/
+enum delta_value_kind {
+  DELTA_VALUES,          // Integer values
+  DELTA_LENGTHS,         // String lengths
+  DELTA_PREFIX_LENGTHS,  // Lengths of the prefixes shared with the previous strings
+  DELTA_SUFFIX_LENGTHS,  // Lengths of the strings without their shared prefix
+};
+
+/**
+ * @brief DELTA_BINARY_PACKED encoder, using blocks of 128 deltas split in 4 miniblocks of 32
+ *
+ * @param[in,out] s Page encode state
+ * @param[in] numvals Total count of input values
+ * @param[in] is64 nonzero for 64-bit values, otherwise deltas wrap around in 32 bits
+ * @param[in] flush nonzero if last batch in stream
+ * @param[in] t thread id (0..127)
+ */
+static __device__ void DeltaEncode(
+  page_enc_state_s *s, uint32_t numvals, uint32_t is64, uint32_t flush, uint32_t t)
+{
+  uint32_t delta_pos = s->delta_pos;
+
+  if (delta_pos == 0 && (numvals != 0 || flush)) {
+    // Stream header: block size, miniblocks per block, value count and first value
+    if (!t) {
+      uint8_t *dst = VlqEncode(s->delta_out, 128);
+      dst          = VlqEncode(dst, 4);
+      dst          = VlqEncode(dst, s->delta_total);
+      dst = VlqEncode64(dst, ZigZagEncode64((numvals != 0) ? s->delta.values[0] : 0));
+      s->delta_out = dst;
+    }
+    delta_pos = 1;
+  }
+  while (delta_pos < numvals && (numvals - delta_pos >= 128 || flush)) {
+    uint32_t n     = min(numvals - delta_pos, 128);
+    uint32_t pos   = delta_pos + t;
+    uint64_t delta = 0, rel, bits;
+    int64_t min_delta;
+    uint32_t num_miniblocks, mb_ofs[4], body_size;
+    uint8_t *dst;
+
+    __syncthreads();
+    if (t < n) {
+      delta = s->delta.values[pos & (DELTA_BFRSZ - 1)] -
+              s->delta.values[(pos - 1) & (DELTA_BFRSZ - 1)];
+      if (!is64) { delta = static_cast<int64_t>(static_cast<int32_t>(delta)); }
+    }
+    min_delta = (t < n) ? static_cast<int64_t>(delta) : INT64_MAX;
+    for (uint32_t i = 1; i < 32; i <<= 1) {
+      int64_t v = SHFL_XOR(min_delta, i);
+      min_delta = (v < min_delta) ? v : min_delta;
+    }
+    if (!(t & 0x1f)) { s->delta.min_delta[t >> 5] = min_delta; }
+    __syncthreads();
+    for (uint32_t i = 0; i < 4; i++) {
+      min_delta = (s->delta.min_delta[i] < min_delta) ? s->delta.min_delta[i] : min_delta;
+    }
+    rel = (t < n) ? delta - static_cast<uint64_t>(min_delta) : 0;
+    if (!is64) { rel = static_cast<uint32_t>(rel); }
+    bits = rel;
+    for (uint32_t i = 1; i < 32; i <<= 1) { bits |= SHFL_XOR(bits, i); }
+    s->delta.packed[t] = rel;
+    if (!(t & 0x1f)) { s->delta.bit_width[t >> 5] = 64 - __clzll(bits); }
+    __syncthreads();
+    // Block header: min delta and bit width of each miniblock (0 for unused miniblocks)
+    if (!t) {
+      dst = VlqEncode64(s->delta_out, ZigZagEncode64(min_delta));
+      for (uint32_t i = 0; i < 4; i++) { dst[i] = s->delta.bit_width[i]; }
+      s->delta_out = dst + 4;
+    }
+    __syncthreads();
+    // Miniblocks of 32 bit-packed values; only the miniblocks holding values are stored
+    dst            = s->delta_out;
+    num_miniblocks = (n + 31) >> 5;
+    body_size      = 0;
+    for (uint32_t i = 0; i < 4; i++) {
+      mb_ofs[i] = body_size;
+      if (i < num_miniblocks) { body_size += s->delta.bit_width[i] * 4; }
+    }
+    for (uint32_t b = t; b < body_size; b += 128) {
+      uint32_t mb = 0;
+      while (mb + 1 < num_miniblocks && b >= mb_ofs[mb + 1]) { mb++; }
+      uint32_t w     = s->delta.bit_width[mb];
+      uint32_t bit   = (b - mb_ofs[mb]) * 8;
+      uint32_t idx   = bit / w;
+      uint32_t shift = bit % w;
+      uint32_t v     = 0;
+      for (uint32_t nbits = 0; nbits < 8 && idx < 32;) {
+        uint32_t len = min(w - shift, 8 - nbits);
+        v |= static_cast<uint32_t>((s->delta.packed[mb * 32 + idx] >> shift) & ((1u << len) - 1))
+             << nbits;
+        nbits += len;
+        shift += len;
+        if (shift == w) {
+          shift = 0;
+          idx++;
+        }
+      }
+      dst[b] = v;
+    }
+    __syncthreads();
+    if (!t) { s->delta_out = dst + body_size; }
+    delta_pos += n;
+  }
+  __syncthreads();
+  if (!t) { s->delta_pos = delta_pos; }
+  __syncthreads();
+}
+
+/**
+ * @brief Encodes the valid values of the page (or their lengths) as a DELTA_BINARY_PACKED stream
+ *
+ * @param[in,out] s Page encode state
+ * @param[in] kind Kind of values to encode (delta_value_kind)
+ * @param[in] num_values Number of valid values in the page
+ * @param[in] dtype_len_in Size of the input values
+ * @param[in] t thread id (0..127)
+ */
+static __device__ void DeltaEncodeStream(
+  page_enc_state_s *s, uint32_t kind, uint32_t num_values, uint32_t dtype_len_in, uint32_t t)
+{
+  const nvstrdesc_s *strings = reinterpret_cast<const nvstrdesc_s *>(s->col.column_data_base);
+  uint32_t is64              = (kind == DELTA_VALUES && s->col.physical_type == INT64);
+
+  if (!t) {
+    s->delta_out   = s->cur;
+    s->delta_pos   = 0;
+    s->delta_count = 0;
+    s->delta_total = num_values;
+    s->prev_row    = ~0u;
+  }
+  __syncthreads();
+  for (uint32_t cur_row = 0; cur_row < s->page.num_rows;) {
+    uint32_t nrows    = min(s->page.num_rows - cur_row, 128);
+    uint32_t row      = s->page.start_row + cur_row + t;
+    uint32_t is_valid = (cur_row + t < s->page.num_rows) ? IsRowValid(s, row) : 0;
+    uint32_t pos      = ValuePosition(s, is_valid, t);
+    uint32_t count    = s->delta_count;
+    uint32_t numvals  = count + s->scratch_red[3];
+
+    cur_row += nrows;
+    if (is_valid) { s->delta.rows[pos] = row; }
+    __syncthreads();
+    if (is_valid) {
+      uint64_t v;
+      switch (kind) {
+        case DELTA_VALUES: v = GetIntegerValue(s, row, dtype_len_in); break;
+        case DELTA_LENGTHS: v = strings[row].count; break;
+        case DELTA_PREFIX_LENGTHS:
+          v                      = PrefixLength(s, row, pos);
+          s->col.prefix_len[row] = v;
+          break;
+        default: v = strings[row].count - s->col.prefix_len[row]; break;
+      }
+      s->delta.values[(count + pos) & (DELTA_BFRSZ - 1)] = v;
+    }
+    __syncthreads();
+    if (!t) {
+      if (numvals > count) { s->prev_row = s->delta.rows[numvals - count - 1]; }
+      s->delta_count = numvals;
+    }
+    DeltaEncode(s, numvals, is64, 0, t);
+  }
+  DeltaEncode(s, s->delta_count, is64, 1, t);
+  if (!t) { s->cur = s->delta_out; }
+  __syncthreads();
+}
+
+/**
+ * @brief Copies the bytes of the valid strings of the page, following their delta-encoded lengths
+ *
+ * @param[in,out] s Page encode state
+ * @param[in] suffix_only nonzero to leave out the prefixes shared with the previous strings
+ * @param[in] t thread id (0..127)
+ */
+static __device__ void StringBytesEncode(page_enc_state_s *s, uint32_t suffix_only, uint32_t t)
+{
+  const nvstrdesc_s *strings = reinterpret_cast<const nvstrdesc_s *>(s->col.column_data_base);
+
+  for (uint32_t cur_row = 0; cur_row < s->page.num_rows;) {
+    uint32_t nrows    = min(s->page.num_rows - cur_row, 128);
+    uint32_t row      = s->page.start_row + cur_row + t;
+    uint32_t is_valid = (cur_row + t < s->page.num_rows) ? IsRowValid(s, row) : 0;
+    uint32_t prefix = 0, len = 0;
+    uint8_t *dst = s->cur;
+
+    cur_row += nrows;
+    if (is_valid) {
+      prefix = (suffix_only) ? s->col.prefix_len[row] : 0;
+      len    = (uint32_t)strings[row].count - prefix;
+    }
+    uint32_t pos = WarpReducePos32(len, t);
+    if ((t & 0x1f) == 0x1f) { s->scratch_red[t >> 5] = pos; }
+    __syncthreads();
+    if (t < 32) { s->scratch_red[t] = WarpReducePos4((t < 4) ? s->scratch_red[t] : 0, t); }
+    __syncthreads();
+    if (t == 0) { s->cur = dst + s->scratch_red[3]; }
+    pos = pos + ((t >= 32) ? s->scratch_red[(t - 32) >> 5] : 0) - len;
+    if (len != 0) { memcpy(dst + pos, strings[row].ptr + prefix, len); }
+    __syncthreads();
+  }
+}
+
+/**
+ * @brief BYTE_STREAM_SPLIT encoder, scattering the bytes of the values to one stream per byte
+ *
+ * @param[in,out] s Page encode state
+ * @param[in] num_values Number of valid values in the page
+ * @param[in] dtype_len Size of the values
+ * @param[in] t thread id (0..127)
+ */
+static __device__ void ByteStreamSplitEncode(page_enc_state_s *s,
+                                             uint32_t num_values,
+                                             uint32_t dtype_len,
+                                             uint32_t t)
+{
+  uint32_t count = 0;
+
+  for (uint32_t cur_row = 0; cur_row < s->page.num_rows;) {
+    uint32_t nrows    = min(s->page.num_rows - cur_row, 128);
+    uint32_t row      = s->page.start_row + cur_row + t;
+    uint32_t is_valid = (cur_row + t < s->page.num_rows) ? IsRowValid(s, row) : 0;
+    uint32_t pos      = ValuePosition(s, is_valid, t);
+
+    cur_row += nrows;
+    if (is_valid) {
+      const uint8_t *src8 =
+        reinterpret_cast<const uint8_t *>(s->col.column_data_base) + row * (size_t)dtype_len;
+      for (uint32_t b = 0; b < dtype_len; b++) { s->cur[b * num_values + count + pos] = src8[b]; }
+    }
+    count += s->scratch_red[3];
+    __syncthreads();
+  }
+  if (!t) { s->cur += num_values * dtype_len; }
+  __syncthreads();
+}
+
+/**
+ * @brief Sets up the compression of an encoded page and stores the page and compression state
+ */
+inline __device__ void StoreEncodedPage(page_enc_state_s *s,
+                                        EncPage *pages,
+                                        gpu_inflate_input_s *comp_in,
+                                        gpu_inflate_status_s *comp_out,
+                                        uint32_t start_page,
+                                        uint32_t t)
+{
+  if (t == 0) {
+    // Only the values are compressed, the levels of V2 data pages are stored uncompressed
+    uint8_t *base                = s->page.page_data + s->page.max_hdr_size;
+    uint32_t actual_data_size    = static_cast<uint32_t>(s->cur - base);
+    uint32_t levels_size         = s->page.levels_size;
+    uint32_t compressed_bfr_size = GetMaxCompressedBfrSize(actual_data_size - levels_size);
+    s->page.max_data_size        = actual_data_size;
+    s->comp_in.srcDevice         = base + levels_size;
+    s->comp_in.srcSize           = actual_data_size - levels_size;
+    s->comp_in.dstDevice         = s->page.compressed_data + s->page.max_hdr_size + levels_size;
+    s->comp_in.dstSize           = compressed_bfr_size;
+    s->comp_out.bytes_written    = 0;
+    s->comp_out.status           = ~0;
+    s->comp_out.reserved         = 0;
+  }
+  __syncthreads();
+  if (comp_in) {
+    const uint8_t *levels = s->page.page_data + s->page.max_hdr_size;
+    for (uint32_t i = t; i < s->page.levels_size; i += 128) {
+      s->page.compressed_data[s->page.max_hdr_size + i] = levels[i];
+    }
+  }
+  if (t < sizeof(EncPage) / sizeof(uint32_t)) {
+    reinterpret_cast<uint32_t *>(&pages[start_page + blockIdx.x])[t] =
+      reinterpret_cast<uint32_t *>(&s->page)[t];
+  }
+  if (comp_in && t < sizeof(gpu_inflate_input_s) / sizeof(uint32_t)) {
+    reinterpret_cast<uint32_t *>(&comp_in[blockIdx.x])[t] =
+      reinterpret_cast<uint32_t *>(&s->comp_in)[t];
+  }
+  if (comp_out && t < sizeof(gpu_inflate_status_s) / sizeof(uint32_t)) {
+    reinterpret_cast<uint32_t *>(&comp_out[blockIdx.x])[t] =
+      reinterpret_cast<uint32_t *>(&s->comp_out)[t];
+  }
+}
+
 // blockDim(128, 1, 1)
 __global__ void __launch_bounds__(128, 8) gpuEncodePages(EncPage *pages,
                                                          const EncColumnChunk *chunks,
@@ -855,7 +1305,8 @@ __global__ void __launch_bounds__(128, 8) gpuEncodePages(EncPage *pages,
         s->rle_run     = 0;
         s->rle_pos     = 0;
         s->rle_numvals = 0;
-        s->rle_out     = s->cur + 4;
+        // V2 data pages store the size of the levels in the page header instead of a prefix
+        s->rle_out = (s->page.page_type == DATA_PAGE_V2) ? s->cur : s->cur + 4;
       }
       __syncthreads();
       while (s->rle_numvals < s->page.num_rows) {
@@ -874,7 +1325,7 @@ __global__ void __launch_bounds__(128, 8) gpuEncodePages(EncPage *pages,
       if (t < 32) {
         uint8_t *cur     = s->cur;
         uint8_t *rle_out = s->rle_out;
-        if (t < 4) {
+        if (t < 4 && s->page.page_type != DATA_PAGE_V2) {
           uint32_t rle_bytes = (uint32_t)(rle_out - cur) - 4;
           cur[t]             = rle_bytes >> (t * 8);
         }
@@ -885,6 +1336,14 @@ __global__ void __launch_bounds__(128, 8) gpuEncodePages(EncPage *pages,
   }
   // Encode data values
   __syncthreads();
+  if (s->page.page_type == DATA_PAGE_V2) {
+    uint32_t num_valid = CountPageValues(s, t);
+    if (!t) {
+      s->page.num_nulls   = s->page.num_rows - num_valid;
+      s->page.levels_size =
+        static_cast<uint32_t>(s->cur - (s->page.page_data + s->page.max_hdr_size));
+    }
+  }
   dtype         = s->col.physical_type;
   dtype_len_out = (dtype == INT64 || dtype == DOUBLE) ? 8 : (dtype == BOOLEAN) ? 1 : 4;
   if (dtype == INT32) {
@@ -906,6 +1365,27 @@ __global__ void __launch_bounds__(128, 8) gpuEncodePages(EncPage *pages,
     }
   }
   __syncthreads();
+  if (s->page.page_type != DICTIONARY_PAGE && dict_bits < 0 && s->col.encoding != PLAIN) {
+    // Delta and byte stream split encodings
+    uint32_t num_values = CountPageValues(s, t);
+    switch (s->col.encoding) {
+      case DELTA_BINARY_PACKED:
+        DeltaEncodeStream(s, DELTA_VALUES, num_values, dtype_len_in, t);
+        break;
+      case DELTA_LENGTH_BYTE_ARRAY:
+        DeltaEncodeStream(s, DELTA_LENGTHS, num_values, dtype_len_in, t);
+        StringBytesEncode(s, 0, t);
+        break;
+      case DELTA_BYTE_ARRAY:
+        DeltaEncodeStream(s, DELTA_PREFIX_LENGTHS, num_values, dtype_len_in, t);
+        DeltaEncodeStream(s, DELTA_SUFFIX_LENGTHS, num_values, dtype_len_in, t);
+        StringBytesEncode(s, 1, t);
+        break;
+      case BYTE_STREAM_SPLIT: ByteStreamSplitEncode(s, num_values, dtype_len_out, t); break;
+    }
+    StoreEncodedPage(s, pages, comp_in, comp_out, start_page, t);
+    return;
+  }
   for (uint32_t cur_row = 0; cur_row < s->page.num_rows;) {
     uint32_t nrows = min(s->page.num_rows - cur_row, 128);
     uint32_t row   = s->page.start_row + cur_row + t;
@@ -1027,32 +1507,18 @@ __global__ void __launch_bounds__(128, 8) gpuEncodePages(EncPage *pages,
       __syncthreads();
     }
   }
-  if (t == 0) {
-    uint8_t *base                = s->page.page_data + s->page.max_hdr_size;
-    uint32_t actual_data_size    = static_cast<uint32_t>(s->cur - base);
-    uint32_t compressed_bfr_size = GetMaxCompressedBfrSize(actual_data_size);
-    s->page.max_data_size        = actual_data_size;
-    s->comp_in.srcDevice         = base;
-    s->comp_in.srcSize           = actual_data_size;
-    s->comp_in.dstDevice         = s->page.compressed_data + s->page.max_hdr_size;
-    s->comp_in.dstSize           = compressed_bfr_size;
-    s->comp_out.bytes_written    = 0;
-    s->comp_out.status           = ~0;
-    s->comp_out.reserved         = 0;
-  }
-  __syncthreads();
-  if (t < sizeof(EncPage) / sizeof(uint32_t)) {
-    reinterpret_cast<uint32_t *>(&pages[start_page + blockIdx.x])[t] =
-      reinterpret_cast<uint32_t *>(&s->page)[t];
-  }
-  if (comp_in && t < sizeof(gpu_inflate_input_s) / sizeof(uint32_t)) {
-    reinterpret_cast<uint32_t *>(&comp_in[blockIdx.x])[t] =
-      reinterpret_cast<uint32_t *>(&s->comp_in)[t];
-  }
-  if (comp_out && t < sizeof(gpu_inflate_status_s) / sizeof(uint32_t)) {
-    reinterpret_cast<uint32_t *>(&comp_out[blockIdx.x])[t] =
-      reinterpret_cast<uint32_t *>(&s->comp_out)[t];
-  }
+  StoreEncodedPage(s, pages, comp_in, comp_out, start_page, t);
+}
+
+/**
+ * @brief Returns whether the values of a page are compressed when its column chunk is, which is
+ * not the case for V2 data pages without any values (all nulls)
+ *
+ * @param[in] page Encoder page
+ */
+inline __device__ bool HasCompressedValues(const EncPage &page)
+{
+  return page.page_type != DATA_PAGE_V2 || page.max_data_size > page.levels_size;
 }
 
 // blockDim(128, 1, 1)
@@ -1083,8 +1549,11 @@ __global__ void __launch_bounds__(128) gpuDecideCompression(EncColumnChunk *chun
       uint32_t comp_idx       = first_page + page - start_page;
       uncompressed_data_size += page_data_size;
       if (comp_out) {
-        compressed_data_size += (uint32_t)comp_out[comp_idx].bytes_written;
-        if (comp_out[comp_idx].status != 0) { atomicAdd(&error_count, 1); }
+        compressed_data_size += pages[first_page + page].levels_size;
+        if (HasCompressedValues(pages[first_page + page])) {
+          compressed_data_size += (uint32_t)comp_out[comp_idx].bytes_written;
+          if (comp_out[comp_idx].status != 0) { atomicAdd(&error_count, 1); }
+        }
       }
     }
     uncompressed_data_size = WarpReduceSum32(uncompressed_data_size);
@@ -1165,6 +1634,10 @@ inline __device__ uint8_t *cpw_put_fldh(uint8_t *p, int f, int cur, int t)
   *p++    = 0;                \
   cur_fld = f;
 
+#define CPW_FLD_BOOL(f, v)                                                 \
+  p       = cpw_put_fldh(p, f, cur_fld, (v) ? ST_FLD_TRUE : ST_FLD_FALSE); \
+  cur_fld = f;
+
 #define CPW_FLD_INT32(f, v)                          \
   p       = cpw_put_fldh(p, f, cur_fld, ST_FLD_I32); \
   p       = cpw_put_int32(p, v);                     \
@@ -1284,7 +1757,10 @@ __global__ void __launch_bounds__(128) gpuEncodePageHeaders(EncPage *pages,
     uncompressed_page_size = page_g.max_data_size;
     if (ck_g.is_compressed) {
       hdr_start            = page_g.compressed_data;
-      compressed_page_size = (uint32_t)comp_out[blockIdx.x].bytes_written;
+      compressed_page_size = page_g.levels_size;
+      if (HasCompressedValues(page_g)) {
+        compressed_page_size += (uint32_t)comp_out[blockIdx.x].bytes_written;
+      }
       page_g.max_data_size = compressed_page_size;
     } else {
       hdr_start            = page_g.page_data;
@@ -1296,13 +1772,14 @@ __global__ void __launch_bounds__(128) gpuEncodePageHeaders(EncPage *pages,
     // RLE_DICTIONARY in data page, but parquet v1 uses PLAIN_DICTIONARY in both dictionary and data
     // pages (actual encoding is identical).
 #if ENABLE_BOOL_RLE
-    int encoding =
-      (col_g.physical_type != BOOLEAN)
-        ? (page_type == DICTIONARY_PAGE || page_g.dict_bits_plus1 != 0) ? PLAIN_DICTIONARY : PLAIN
-        : RLE;
+    int encoding = (col_g.physical_type != BOOLEAN)
+                     ? (page_type == DICTIONARY_PAGE || page_g.dict_bits_plus1 != 0)
+                         ? PLAIN_DICTIONARY
+                         : col_g.encoding
+                     : RLE;
 #else
-    int encoding =
-      (page_type == DICTIONARY_PAGE || page_g.dict_bits_plus1 != 0) ? PLAIN_DICTIONARY : PLAIN;
+    int encoding = (page_type == DICTIONARY_PAGE || page_g.dict_bits_plus1 != 0) ? PLAIN_DICTIONARY
+                                                                                 : col_g.encoding;
 #endif
     CPW_FLD_INT32(1, page_type)
     CPW_FLD_INT32(2, uncompressed_page_size)
@@ -1321,6 +1798,23 @@ __global__ void __launch_bounds__(128) gpuEncodePageHeaders(EncPage *pages,
         CPW_FLD_STRUCT_END(5)
       }
       CPW_FLD_STRUCT_END(5)
+    } else if (page_type == DATA_PAGE_V2) {
+      // DataPageHeaderV2
+      CPW_FLD_STRUCT_BEGIN(8)
+      CPW_FLD_INT32(1, page_g.num_rows)     // num_values
+      CPW_FLD_INT32(2, page_g.num_nulls)    // num_nulls
+      CPW_FLD_INT32(3, page_g.num_rows)     // num_rows
+      CPW_FLD_INT32(4, encoding)            // encoding
+      CPW_FLD_INT32(5, page_g.levels_size)  // definition_levels_byte_length
+      CPW_FLD_INT32(6, 0)                   // repetition_levels_byte_length
+      CPW_FLD_BOOL(7, ck_g.is_compressed && HasCompressedValues(page_g))
+      // Optionally encode page-level statistics
+      if (page_stats) {
+        CPW_FLD_STRUCT_BEGIN(8)
+        p = EncodeStatistics(p, &page_stats[start_page + blockIdx.x], &col_g, fp_scratch);
+        CPW_FLD_STRUCT_END(8)
+      }
+      CPW_FLD_STRUCT_END(8)
     } else {
       // DictionaryPageHeader
       CPW_FLD_STRUCT_BEGIN(7)
@@ -1453,6 +1947,7 @@ cudaError_t InitFragmentStatistics(statistics_group *groups,
  * @param[in] num_columns Number of columns
  * @param[in] page_grstats Setup for page-level stats
  * @param[in] chunk_grstats Setup for chunk-level stats
+ * @param[in] write_v2_headers Whether to write V2 data pages
  * @param[in] stream CUDA stream to use, default 0
  *
  * @return cudaSuccess if successful, a CUDA error code otherwise
@@ -1464,11 +1959,18 @@ cudaError_t InitEncoderPages(EncColumnChunk *chunks,
                              int32_t num_columns,
                              statistics_merge_group *page_grstats,
                              statistics_merge_group *chunk_grstats,
+                             bool write_v2_headers,
                              cudaStream_t stream)
 {
   dim3 dim_grid(num_columns, num_rowgroups);  // 1 threadblock per rowgroup
-  gpuInitPages<<<dim_grid, 128, 0, stream>>>(
-    chunks, pages, col_desc, page_grstats, chunk_grstats, num_rowgroups, num_columns);
+  gpuInitPages<<<dim_grid, 128, 0, stream>>>(chunks,
+                                             pages,
+                                             col_desc,
+                                             page_grstats,
+                                             chunk_grstats,
+                                             num_rowgroups,
+                                             num_columns,
+                                             write_v2_headers);
   return cudaSuccess;
 }
 
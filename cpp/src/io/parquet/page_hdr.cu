@@ -48,6 +48,7 @@ struct byte_stream_s {
   PageType page_type;
   PageInfo page;
   ColumnChunkDesc ck;
+  bool is_compressed;
 };
 
 inline __device__ unsigned int getb(byte_stream_s *bs)
@@ -145,6 +146,12 @@ __device__ void skip_struct_field(byte_stream_s *bs, int t)
     if (t != ST_FLD_I32) return false; \
     break;
 
+#define PARQUET_FLD_BOOL(id, m)                              \
+  case id:                                                   \
+    if (t != ST_FLD_TRUE && t != ST_FLD_FALSE) return false; \
+    bs->m = (t == ST_FLD_TRUE);                              \
+    break;
+
 #define PARQUET_FLD_STRUCT(id, m)                   \
   case id:                                          \
     if (t != ST_FLD_STRUCT || !m(bs)) return false; \
@@ -171,10 +178,12 @@ PARQUET_END_STRUCT()
 
 PARQUET_BEGIN_STRUCT(gpuParseDataPageHeaderV2)
 PARQUET_FLD_INT32(1, page.num_values)
+PARQUET_FLD_INT32(2, page.num_nulls)
 PARQUET_FLD_INT32(3, page.num_rows)
 PARQUET_FLD_ENUM(4, page.encoding, Encoding);
-PARQUET_FLD_ENUM(5, page.definition_level_encoding, Encoding);
-PARQUET_FLD_ENUM(6, page.repetition_level_encoding, Encoding);
+PARQUET_FLD_INT32(5, page.lvl_bytes[0])
+PARQUET_FLD_INT32(6, page.lvl_bytes[1])
+PARQUET_FLD_BOOL(7, is_compressed)
 PARQUET_END_STRUCT()
 
 PARQUET_BEGIN_STRUCT(gpuParsePageHeader)
@@ -235,7 +244,11 @@ extern "C" __global__ void __launch_bounds__(128)
 
       if (t == 0) {
         bs->page.chunk_row += bs->page.num_rows;
-        bs->page.num_rows = 0;
+        bs->page.num_rows     = 0;
+        bs->page.num_nulls    = 0;
+        bs->page.lvl_bytes[0] = 0;
+        bs->page.lvl_bytes[1] = 0;
+        bs->is_compressed     = true;
         if (gpuParsePageHeader(bs) && bs->page.compressed_page_size >= 0) {
           switch (bs->page_type) {
             case DATA_PAGE:
@@ -244,11 +257,19 @@ extern "C" __global__ void __launch_bounds__(128)
               // -> we'll need another pass after decompression to parse the definition and
               // repetition levels to infer the correct value of num_rows
               bs->page.num_rows = bs->page.num_values;  // Assumes num_rows == num_values
-                                                        // Fall-through to V2
+              index_out         = num_dict_pages + data_page_count;
+              data_page_count++;
+              bs->page.flags = 0;
+              values_found += bs->page.num_values;
+              break;
             case DATA_PAGE_V2:
+              // Levels are RLE-encoded without a length prefix, and stored uncompressed
               index_out = num_dict_pages + data_page_count;
               data_page_count++;
-              bs->page.flags = 0;
+              bs->page.flags = PAGEINFO_FLAGS_V2;
+              if (!bs->is_compressed) { bs->page.flags |= PAGEINFO_FLAGS_UNCOMPRESSED; }
+              bs->page.definition_level_encoding = RLE;
+              bs->page.repetition_level_encoding = RLE;
               values_found += bs->page.num_values;
               break;
             case DICTIONARY_PAGE:
@@ -111,6 +111,12 @@ bool CompactProtocolReader::skip_struct_field(int t, int depth)
     if (t != ST_FLD_I32) return false; \
     break;
 
+#define PARQUET_FLD_BOOL(id, m)                              \
+  case id:                                                   \
+    if (t != ST_FLD_TRUE && t != ST_FLD_FALSE) return false; \
+    s->m = (t == ST_FLD_TRUE);                               \
+    break;
+
 #define PARQUET_FLD_INT64(id, m)                        \
   case id:                                              \
     s->m = get_i64();                                   \
@@ -123,7 +129,7 @@ bool CompactProtocolReader::skip_struct_field(int t, int depth)
       return false;                          \
     else {                                   \
       uint32_t n = get_u32();                \
-      if (n < (size_t)(m_end - m_cur)) {     \
+      if (n <= (size_t)(m_end - m_cur)) {    \
         s->m.assign((const char *)m_cur, n); \
         m_cur += n;                          \
       } else                                 \
@@ -160,6 +166,34 @@ bool CompactProtocolReader::skip_struct_field(int t, int depth)
       break;                                                   \
     }
 
+#define PARQUET_FLD_INT64_LIST(id, m)                                     \
+  case id:                                                                \
+    if (t != ST_FLD_LIST) return false;                                   \
+    {                                                                     \
+      int n;                                                              \
+      c = getb();                                                         \
+      if ((c & 0xf) < ST_FLD_I16 || (c & 0xf) > ST_FLD_I64) return false; \
+      n = c >> 4;                                                         \
+      if (n == 0xf) n = get_u32();                                        \
+      s->m.resize(n);                                                     \
+      for (int32_t i = 0; i < n; i++) s->m[i] = get_i64();                \
+      break;                                                              \
+    }
+
+#define PARQUET_FLD_BOOL_LIST(id, m)                                           \
+  case id:                                                                     \
+    if (t != ST_FLD_LIST) return false;                                        \
+    {                                                                          \
+      int n;                                                                   \
+      c = getb();                                                              \
+      if ((c & 0xf) != ST_FLD_TRUE && (c & 0xf) != ST_FLD_FALSE) return false; \
+      n = c >> 4;                                                              \
+      if (n == 0xf) n = get_u32();                                             \
+      s->m.resize(n);                                                          \
+      for (int32_t i = 0; i < n; i++) s->m[i] = (getb() == ST_FLD_TRUE);       \
+      break;                                                                   \
+    }
+
 #define PARQUET_FLD_STRING_LIST(id, m)              \
   case id:                                          \
     if (t != ST_FLD_LIST) return false;             \
@@ -253,12 +287,22 @@ PARQUET_FLD_INT64(11, dictionary_page_offset)
 PARQUET_FLD_STRUCT_BLOB(12, statistics_blob)
 PARQUET_END_STRUCT()
 
+PARQUET_BEGIN_STRUCT(Statistics)
+PARQUET_FLD_STRING(1, max)
+PARQUET_FLD_STRING(2, min)
+PARQUET_FLD_INT64(3, null_count)
+PARQUET_FLD_INT64(4, distinct_count)
+PARQUET_FLD_STRING(5, max_value)
+PARQUET_FLD_STRING(6, min_value)
+PARQUET_END_STRUCT()
+
 PARQUET_BEGIN_STRUCT(PageHeader)
 PARQUET_FLD_ENUM(1, type, PageType)
 PARQUET_FLD_INT32(2, uncompressed_page_size)
 PARQUET_FLD_INT32(3, compressed_page_size)
 PARQUET_FLD_STRUCT(5, data_page_header)
 PARQUET_FLD_STRUCT(7, dictionary_page_header)
+PARQUET_FLD_STRUCT(8, data_page_header_v2)
 PARQUET_END_STRUCT()
 
 PARQUET_BEGIN_STRUCT(DataPageHeader)
@@ -266,6 +310,7 @@ PARQUET_FLD_INT32(1, num_values)
 PARQUET_FLD_ENUM(2, encoding, Encoding);
 PARQUET_FLD_ENUM(3, definition_level_encoding, Encoding);
 PARQUET_FLD_ENUM(4, repetition_level_encoding, Encoding);
+PARQUET_FLD_STRUCT(5, statistics)
 PARQUET_END_STRUCT()
 
 PARQUET_BEGIN_STRUCT(DictionaryPageHeader)
@@ -273,11 +318,40 @@ PARQUET_FLD_INT32(1, num_values)
 PARQUET_FLD_ENUM(2, encoding, Encoding);
 PARQUET_END_STRUCT()
 
+PARQUET_BEGIN_STRUCT(DataPageHeaderV2)
+PARQUET_FLD_INT32(1, num_values)
+PARQUET_FLD_INT32(2, num_nulls)
+PARQUET_FLD_INT32(3, num_rows)
+PARQUET_FLD_ENUM(4, encoding, Encoding);
+PARQUET_FLD_INT32(5, definition_levels_byte_length)
+PARQUET_FLD_INT32(6, repetition_levels_byte_length)
+PARQUET_FLD_BOOL(7, is_compressed)
+PARQUET_FLD_STRUCT(8, statistics)
+PARQUET_END_STRUCT()
+
 PARQUET_BEGIN_STRUCT(KeyValue)
 PARQUET_FLD_STRING(1, key)
 PARQUET_FLD_STRING(2, value)
 PARQUET_END_STRUCT()
 
+PARQUET_BEGIN_STRUCT(PageLocation)
+PARQUET_FLD_INT64(1, offset)
+PARQUET_FLD_INT32(2, compressed_page_size)
+PARQUET_FLD_INT64(3, first_row_index)
+PARQUET_END_STRUCT()
+
+PARQUET_BEGIN_STRUCT(OffsetIndex)
+PARQUET_FLD_STRUCT_LIST(1, page_locations)
+PARQUET_END_STRUCT()
+
+PARQUET_BEGIN_STRUCT(ColumnIndex)
+PARQUET_FLD_BOOL_LIST(1, null_pages)
+PARQUET_FLD_STRING_LIST(2, min_values)
+PARQUET_FLD_STRING_LIST(3, max_values)
+PARQUET_FLD_ENUM(4, boundary_order, BoundaryOrder)
+PARQUET_FLD_INT64_LIST(5, null_counts)
+PARQUET_END_STRUCT()
+
 /**
  * @brief Constructs the schema from the file-level metadata
  *
@@ -394,6 +468,20 @@ int CompactProtocolReader::WalkSchema(
   for (auto i = 0; i < s->m.size(); i++) { put_int(s->m[i]); }              \
   cur_fld = id;
 
+#define CPW_FLD_INT64_LIST(id, m)                                           \
+  put_fldh(id, cur_fld, ST_FLD_LIST);                                       \
+  putb((uint8_t)((std::min(s->m.size(), (size_t)0xfu) << 4) | ST_FLD_I64)); \
+  if (s->m.size() >= 0xf) put_uint(s->m.size());                            \
+  for (auto i = 0; i < s->m.size(); i++) { put_int(s->m[i]); }              \
+  cur_fld = id;
+
+#define CPW_FLD_BOOL_LIST(id, m)                                                         \
+  put_fldh(id, cur_fld, ST_FLD_LIST);                                                    \
+  putb((uint8_t)((std::min(s->m.size(), (size_t)0xfu) << 4) | ST_FLD_TRUE));             \
+  if (s->m.size() >= 0xf) put_uint(s->m.size());                                         \
+  for (auto i = 0; i < s->m.size(); i++) { putb(s->m[i] ? ST_FLD_TRUE : ST_FLD_FALSE); } \
+  cur_fld = id;
+
 #define CPW_FLD_STRING_LIST(id, m)                                                     \
   put_fldh(id, cur_fld, ST_FLD_LIST);                                                  \
   putb((uint8_t)((std::min(s->m.size(), (size_t)0xfu) << 4) | ST_FLD_BINARY));         \
@@ -505,6 +593,24 @@ if (s->dictionary_page_offset != 0) { CPW_FLD_INT64(11, dictionary_page_offset)
 if (s->statistics_blob.size() != 0) { CPW_FLD_STRUCT_BLOB(12, statistics_blob); }
 CPW_END_STRUCT()
 
+CPW_BEGIN_STRUCT(PageLocation)
+CPW_FLD_INT64(1, offset)
+CPW_FLD_INT32(2, compressed_page_size)
+CPW_FLD_INT64(3, first_row_index)
+CPW_END_STRUCT()
+
+CPW_BEGIN_STRUCT(OffsetIndex)
+CPW_FLD_STRUCT_LIST(1, page_locations)
+CPW_END_STRUCT()
+
+CPW_BEGIN_STRUCT(ColumnIndex)
+CPW_FLD_BOOL_LIST(1, null_pages)
+CPW_FLD_STRING_LIST(2, min_values)
+CPW_FLD_STRING_LIST(3, max_values)
+CPW_FLD_INT32(4, boundary_order)
+if (s->null_counts.size() != 0) { CPW_FLD_INT64_LIST(5, null_counts) }
+CPW_END_STRUCT()
+
 }  // namespace parquet
 }  // namespace io
 }  // namespace cudf
@@ -88,6 +88,21 @@ struct ColumnMetaData {
   std::vector<uint8_t> statistics_blob;  // Encoded chunk-level statistics as binary blob
 };
 
+/**
+ * @brief Thrift-derived struct describing column chunk statistics
+ *
+ * Parsed from `ColumnMetaData::statistics_blob`. Min/max values are in the plain encoding of the
+ * column's physical type.
+ **/
+struct Statistics {
+  std::string max;              // Deprecated max value, in signed comparison order
+  std::string min;              // Deprecated min value, in signed comparison order
+  int64_t null_count     = -1;  // Number of nulls, or -1 if absent
+  int64_t distinct_count = -1;  // Number of distinct values, or -1 if absent
+  std::string max_value;        // Max value, in the column's sort order
+  std::string min_value;        // Min value, in the column's sort order
+};
+
 /**
  * @brief Thrift-derived struct describing a chunk of data for a particular
  * column
@@ -154,6 +169,24 @@ struct DataPageHeader {
   Encoding encoding                  = PLAIN;  // Encoding used for this data page
   Encoding definition_level_encoding = PLAIN;  // Encoding used for definition levels
   Encoding repetition_level_encoding = PLAIN;  // Encoding used for repetition levels
+  Statistics statistics;                       // Optional page-level statistics
+};
+
+/**
+ * @brief Thrift-derived struct describing the header for a V2 data page
+ *
+ * The repetition levels, followed by the definition levels, are stored uncompressed at the start of
+ * the page data and are not prefixed by their size.
+ **/
+struct DataPageHeaderV2 {
+  int32_t num_values                    = 0;  // Number of values, including NULLs, in this page
+  int32_t num_nulls                     = 0;  // Number of NULL values in this page
+  int32_t num_rows                      = 0;  // Number of rows in this page
+  Encoding encoding                     = PLAIN;  // Encoding used for the values
+  int32_t definition_levels_byte_length = 0;      // Size of the definition levels in bytes
+  int32_t repetition_levels_byte_length = 0;      // Size of the repetition levels in bytes
+  bool is_compressed                    = true;   // Whether the values are compressed
+  Statistics statistics;                          // Optional page-level statistics
 };
 
 /**
@@ -179,6 +212,40 @@ struct PageHeader {
   int32_t compressed_page_size   = 0;  // Compressed page size in bytes (not including the header)
   DataPageHeader data_page_header;
   DictionaryPageHeader dictionary_page_header;
+  DataPageHeaderV2 data_page_header_v2;
+};
+
+/**
+ * @brief Thrift-derived struct describing the location of a data page in the file
+ **/
+struct PageLocation {
+  int64_t offset               = 0;  // Offset of the page header from the beginning of the file
+  int32_t compressed_page_size = 0;  // Compressed page size in bytes, including the header
+  int64_t first_row_index      = 0;  // Index of the first row of the page within the row group
+};
+
+/**
+ * @brief Thrift-derived struct describing the data pages of a column chunk
+ *
+ * Written after the row groups, with its file location recorded in the column chunk. Allows
+ * reading a subset of the pages of a chunk without parsing the page headers.
+ **/
+struct OffsetIndex {
+  std::vector<PageLocation> page_locations;  // Data pages, in the order they appear in the chunk
+};
+
+/**
+ * @brief Thrift-derived struct describing the statistics of the data pages of a column chunk
+ *
+ * Each list has one entry per data page, in the order of `OffsetIndex::page_locations`. Min/max
+ * values are in the same encoding as in `Statistics`, and empty for pages with only nulls.
+ **/
+struct ColumnIndex {
+  std::vector<bool> null_pages;              // Whether each page contains only nulls
+  std::vector<std::string> min_values;       // Min value of each page
+  std::vector<std::string> max_values;       // Max value of each page
+  BoundaryOrder boundary_order = UNORDERED;  // Ordering of the min/max values across pages
+  std::vector<int64_t> null_counts;          // Number of nulls in each page, optional
 };
 
 /**
@@ -282,10 +349,15 @@ class CompactProtocolReader {
   DECL_PARQUET_STRUCT(RowGroup);
   DECL_PARQUET_STRUCT(ColumnChunk);
   DECL_PARQUET_STRUCT(ColumnMetaData);
+  DECL_PARQUET_STRUCT(Statistics);
   DECL_PARQUET_STRUCT(PageHeader);
   DECL_PARQUET_STRUCT(DataPageHeader);
   DECL_PARQUET_STRUCT(DictionaryPageHeader);
+  DECL_PARQUET_STRUCT(DataPageHeaderV2);
   DECL_PARQUET_STRUCT(KeyValue);
+  DECL_PARQUET_STRUCT(PageLocation);
+  DECL_PARQUET_STRUCT(OffsetIndex);
+  DECL_PARQUET_STRUCT(ColumnIndex);
 #undef DECL_PARQUET_STRUCT
 
  public:
@@ -357,6 +429,9 @@ class CompactProtocolWriter {
   DECL_CPW_STRUCT(KeyValue);
   DECL_CPW_STRUCT(ColumnChunk);
   DECL_CPW_STRUCT(ColumnMetaData);
+  DECL_CPW_STRUCT(PageLocation);
+  DECL_CPW_STRUCT(OffsetIndex);
+  DECL_CPW_STRUCT(ColumnIndex);
 #undef DECL_CPW_STRUCT
 
  protected:
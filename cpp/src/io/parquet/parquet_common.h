@@ -83,6 +83,7 @@ enum Encoding {
   DELTA_LENGTH_BYTE_ARRAY = 6,
   DELTA_BYTE_ARRAY        = 7,
   RLE_DICTIONARY          = 8,
+  BYTE_STREAM_SPLIT       = 9,
 };
 
 /**
@@ -118,6 +119,15 @@ enum PageType {
   DATA_PAGE_V2    = 3,
 };
 
+/**
+ * @brief Ordering of the min/max values of consecutive pages in a ColumnIndex
+ **/
+enum BoundaryOrder {
+  UNORDERED  = 0,
+  ASCENDING  = 1,
+  DESCENDING = 2,
+};
+
 /**
  * @brief Thrift compact protocol struct field types
  **/
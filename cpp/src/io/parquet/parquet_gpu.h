@@ -30,7 +30,9 @@ namespace gpu {
  * @brief Enums for the flags in the page header
  **/
 enum {
-  PAGEINFO_FLAGS_DICTIONARY = 0x01,  // Indicates a dictionary page
+  PAGEINFO_FLAGS_DICTIONARY   = 0x01,  // Indicates a dictionary page
+  PAGEINFO_FLAGS_V2           = 0x02,  // Indicates a V2 data page (levels stored uncompressed)
+  PAGEINFO_FLAGS_UNCOMPRESSED = 0x04,  // Indicates a V2 data page whose values are uncompressed
 };
 
 /**
@@ -57,8 +59,10 @@ struct PageInfo {
   uint8_t encoding;                // Encoding for data or dictionary page
   uint8_t definition_level_encoding;  // Encoding used for definition levels (data page)
   uint8_t repetition_level_encoding;  // Encoding used for repetition levels (data page)
-  int32_t valid_count;  // Count of valid (non-null) values in this page (negative values indicate
-                        // data error)
+  int32_t valid_count;   // Count of valid (non-null) values in this page (negative values indicate
+                         // data error)
+  int32_t num_nulls;     // Number of null values in this page (V2 data page)
+  int32_t lvl_bytes[2];  // Size in bytes of the definition and repetition levels (V2 data page)
 };
 
 /**
@@ -130,17 +134,27 @@ struct ColumnChunkDesc {
   int32_t ts_clock_rate;  // output timestamp clock frequency (0=default, 1000=ms, 1000000000=ns)
 };
 
+/**
+ * @brief Struct describing the conversion of a data page to the PLAIN encoding
+ **/
+struct PlainPageDesc {
+  uint8_t *data;  // Output buffer for the converted page, null to only compute its size
+  size_t size;    // Size of the converted page in bytes
+  int32_t error;  // Nonzero if the page data is not valid
+};
+
 /**
  * @brief Struct describing an encoder column
  **/
 struct EncColumnDesc : stats_column_desc {
   uint32_t *dict_index;    //!< Dictionary index [row]
   uint32_t *dict_data;     //!< Dictionary data (unique row indices)
+  uint32_t *prefix_len;    //!< DELTA_BYTE_ARRAY prefix lengths [row]
   uint8_t physical_type;   //!< physical data type
   uint8_t converted_type;  //!< logical data type
   uint8_t level_bits;  //!< bits to encode max definition (lower nibble) & repetition (upper nibble)
                        //!< levels
-  uint8_t pad;
+  uint8_t encoding;    //!< encoding of the data pages that are not dictionary-encoded
 };
 
 #define MAX_PAGE_FRAGMENT_SIZE 5000  //!< Max number of rows in a page fragment
@@ -164,7 +178,7 @@ struct EncPage {
   uint8_t *page_data;        //!< Ptr to uncompressed page
   uint8_t *compressed_data;  //!< Ptr to compressed page
   uint16_t num_fragments;    //!< Number of fragments in page
-  uint8_t page_type;         //!< Page type (0=data, 2=dictionary)
+  uint8_t page_type;         //!< Page type (0=data, 2=dictionary, 3=data V2)
   uint8_t dict_bits_plus1;   //!< 0=plain, nonzero:bits to encoding dictionary indices + 1
   uint32_t chunk_id;         //!< Index in chunk array
   uint32_t hdr_size;         //!< Size of page header
@@ -172,6 +186,8 @@ struct EncPage {
   uint32_t max_data_size;    //!< Maximum size of coded page data (excluding header)
   uint32_t start_row;        //!< First row of page
   uint32_t num_rows;         //!< Rows in page
+  uint32_t num_nulls;        //!< Null values in page (V2 data page)
+  uint32_t levels_size;      //!< Size of the uncompressed definition levels (V2 data page)
 };
 
 /// Size of hash used for building dictionaries
@@ -263,6 +279,27 @@ cudaError_t DecodePageData(PageInfo *pages,
                            size_t min_row      = 0,
                            cudaStream_t stream = (cudaStream_t)0);
 
+/**
+ * @brief Launches kernel for converting the data pages using the DELTA_BINARY_PACKED,
+ * DELTA_LENGTH_BYTE_ARRAY, DELTA_BYTE_ARRAY or BYTE_STREAM_SPLIT encodings to the PLAIN encoding
+ *
+ * When the output buffer of a page is null, only the size of the converted page is returned.
+ * Pages using other encodings are left untouched.
+ *
+ * @param[in] pages List of pages
+ * @param[in] num_pages Number of pages
+ * @param[in] chunks List of column chunks
+ * @param[in,out] plain_pages Output buffer and size of the converted pages [page]
+ * @param[in] stream CUDA stream to use, default 0
+ *
+ * @return cudaSuccess if successful, a CUDA error code otherwise
+ **/
+cudaError_t DecodeToPlainPages(const PageInfo *pages,
+                               int32_t num_pages,
+                               const ColumnChunkDesc *chunks,
+                               PlainPageDesc *plain_pages,
+                               cudaStream_t stream = (cudaStream_t)0);
+
 /**
  * @brief Launches kernel for initializing encoder page fragments
  *
@@ -315,6 +352,7 @@ cudaError_t InitFragmentStatistics(statistics_group *groups,
  * @param[in] num_columns Number of columns
  * @param[in] page_grstats Setup for page-level stats
  * @param[in] chunk_grstats Setup for chunk-level stats
+ * @param[in] write_v2_headers Whether to write V2 data pages
  * @param[in] stream CUDA stream to use, default 0
  *
  * @return cudaSuccess if successful, a CUDA error code otherwise
@@ -326,6 +364,7 @@ cudaError_t InitEncoderPages(EncColumnChunk *chunks,
                              int32_t num_columns,
                              statistics_merge_group *page_grstats  = nullptr,
                              statistics_merge_group *chunk_grstats = nullptr,
+                             bool write_v2_headers                 = false,
                              cudaStream_t stream                   = (cudaStream_t)0);
 
 /**
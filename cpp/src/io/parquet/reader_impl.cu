@@ -21,8 +21,13 @@
 
 #include "reader_impl.hpp"
 
+#include <io/comp/cpu_comp.h>
 #include <io/comp/gpuinflate.h>
+#include <io/comp/io_uncomp.h>
+#include <io/utilities/metadata_cache.hpp>
+#include <io/utilities/stats_filter.hpp>
 
+#include <cudf/null_mask.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/utilities/error.hpp>
 #include <cudf/utilities/traits.hpp>
@@ -32,7 +37,13 @@
 
 #include <algorithm>
 #include <array>
+#include <cmath>
+#include <cstring>
+#include <future>
+#include <map>
+#include <numeric>
 #include <regex>
+#include <tuple>
 
 namespace cudf {
 namespace io {
@@ -144,33 +155,112 @@ std::tuple<int32_t, int32_t, int8_t> conversion_info(type_id column_type_id,
   return std::make_tuple(type_width, clock_rate, converted_type);
 }
 
+/**
+ * @brief Decodes a plain-encoded min/max statistics value into a filter literal
+ *
+ * @return Literal of kind NONE if the value cannot be compared with filter literals
+ */
+filter_literal decode_statistics_value(std::string const &value,
+                                       parquet::Type physical,
+                                       parquet::ConvertedType logical)
+{
+  auto const read_as = [&](auto v) {
+    std::memcpy(&v, value.data(), sizeof(v));
+    return v;
+  };
+  switch (physical) {
+    case parquet::BOOLEAN:
+      if (value.size() >= 1) { return filter_literal(value[0] != 0); }
+      break;
+    case parquet::INT32:
+      if (value.size() >= sizeof(int32_t)) {
+        switch (logical) {
+          case parquet::UINT_8:
+          case parquet::UINT_16:
+          case parquet::UINT_32: return filter_literal(read_as(uint32_t{}));
+          case parquet::DECIMAL: break;
+          default: return filter_literal(read_as(int32_t{}));
+        }
+      }
+      break;
+    case parquet::INT64:
+      if (value.size() >= sizeof(int64_t) && logical != parquet::UINT_64 &&
+          logical != parquet::DECIMAL) {
+        return filter_literal(read_as(int64_t{}));
+      }
+      break;
+    case parquet::FLOAT:
+      if (value.size() >= sizeof(float) && !std::isnan(read_as(float{}))) {
+        return filter_literal(read_as(float{}));
+      }
+      break;
+    case parquet::DOUBLE:
+      if (value.size() >= sizeof(double) && !std::isnan(read_as(double{}))) {
+        return filter_literal(read_as(double{}));
+      }
+      break;
+    case parquet::BYTE_ARRAY:
+      if (logical != parquet::DECIMAL) { return filter_literal(value); }
+      break;
+    default: break;
+  }
+  return filter_literal();
+}
+
+/**
+ * @brief Reads and parses the footer of a dataset
+ *
+ * @param source Dataset source
+ * @param footer_size Set to the size of the serialized footer
+ */
+std::shared_ptr<FileMetaData const> read_file_metadata(datasource *source, size_t *footer_size)
+{
+  constexpr auto header_len = sizeof(file_header_s);
+  constexpr auto ender_len  = sizeof(file_ender_s);
+
+  const auto len           = source->size();
+  const auto header_buffer = source->get_buffer(0, header_len);
+  const auto header        = (const file_header_s *)header_buffer->data();
+  const auto ender_buffer  = source->get_buffer(len - ender_len, ender_len);
+  const auto ender         = (const file_ender_s *)ender_buffer->data();
+  CUDF_EXPECTS(len > header_len + ender_len, "Incorrect data source");
+  CUDF_EXPECTS(header->magic == PARQUET_MAGIC && ender->magic == PARQUET_MAGIC,
+               "Corrupted header or footer");
+  CUDF_EXPECTS(ender->footer_len != 0 && ender->footer_len <= (len - header_len - ender_len),
+               "Incorrect footer length");
+
+  const auto buffer = source->get_buffer(len - ender->footer_len - ender_len, ender->footer_len);
+
+  auto file_metadata = std::make_shared<FileMetaData>();
+  CompactProtocolReader cp(buffer->data(), ender->footer_len);
+  CUDF_EXPECTS(cp.read(file_metadata.get()), "Cannot parse metadata");
+  CUDF_EXPECTS(cp.InitSchema(file_metadata.get()), "Cannot initialize schema");
+  *footer_size = ender->footer_len;
+  return file_metadata;
+}
+
+/**
+ * @brief Returns the host decompression method of a Parquet compression codec
+ */
+int to_host_stream_type(parquet::Compression codec)
+{
+  switch (codec) {
+    case parquet::GZIP: return IO_UNCOMP_STREAM_TYPE_GZIP;
+    case parquet::SNAPPY: return IO_UNCOMP_STREAM_TYPE_SNAPPY;
+    case parquet::BROTLI: return IO_UNCOMP_STREAM_TYPE_BROTLI;
+    case parquet::ZSTD: return IO_UNCOMP_STREAM_TYPE_ZSTD;
+    case parquet::LZ4: return IO_UNCOMP_STREAM_TYPE_LZ4;
+    default: return IO_UNCOMP_STREAM_TYPE_INFER;
+  }
+}
+
 }  // namespace
 
 /**
  * @brief Class for parsing dataset metadata
  */
 struct metadata : public FileMetaData {
-  explicit metadata(datasource *source)
-  {
-    constexpr auto header_len = sizeof(file_header_s);
-    constexpr auto ender_len  = sizeof(file_ender_s);
-
-    const auto len           = source->size();
-    const auto header_buffer = source->get_buffer(0, header_len);
-    const auto header        = (const file_header_s *)header_buffer->data();
-    const auto ender_buffer  = source->get_buffer(len - ender_len, ender_len);
-    const auto ender         = (const file_ender_s *)ender_buffer->data();
-    CUDF_EXPECTS(len > header_len + ender_len, "Incorrect data source");
-    CUDF_EXPECTS(header->magic == PARQUET_MAGIC && ender->magic == PARQUET_MAGIC,
-                 "Corrupted header or footer");
-    CUDF_EXPECTS(ender->footer_len != 0 && ender->footer_len <= (len - header_len - ender_len),
-                 "Incorrect footer length");
-
-    const auto buffer = source->get_buffer(len - ender->footer_len - ender_len, ender->footer_len);
-    CompactProtocolReader cp(buffer->data(), ender->footer_len);
-    CUDF_EXPECTS(cp.read(this), "Cannot parse metadata");
-    CUDF_EXPECTS(cp.InitSchema(this), "Cannot initialize schema");
-  }
+  explicit metadata(FileMetaData const &file_metadata) : FileMetaData(file_metadata) {}
 
   inline int64_t get_total_rows() const { return num_rows; }
   inline int get_num_row_groups() const { return row_groups.size(); }
@@ -254,6 +344,212 @@ struct metadata : public FileMetaData {
     }
   }
 
+  /**
+   * @brief Returns the chunk of a column in a row group, or nullptr if there is none
+   *
+   * @param row_group Index of the row group
+   * @param name Name of the column
+   */
+  const ColumnChunk *find_column_chunk(size_type row_group, std::string const &name)
+  {
+    for (const auto &chunk : row_groups[row_group].columns) {
+      if (get_column_name(chunk.meta_data.path_in_schema) == name) { return &chunk; }
+    }
+    return nullptr;
+  }
+
+  /**
+   * @brief Returns the statistics of a column chunk, as recorded in the file
+   *
+   * The deprecated min/max fields are only used for column types whose sort order is signed.
+   *
+   * @param row_group Index of the row group
+   * @param name Name of the column
+   */
+  column_range_statistics get_column_statistics(size_type row_group, std::string const &name)
+  {
+    column_range_statistics stats;
+    const auto chunk = find_column_chunk(row_group, name);
+    if (chunk == nullptr || chunk->meta_data.statistics_blob.empty()) { return stats; }
+
+    const auto &col_meta = chunk->meta_data;
+    Statistics chunk_stats;
+    CompactProtocolReader cp(col_meta.statistics_blob.data(), col_meta.statistics_blob.size());
+    if (!cp.read(&chunk_stats)) { return stats; }
+
+    const auto &col_schema = schema[chunk->schema_idx];
+    if (chunk_stats.null_count >= 0) {
+      stats.has_null_count = true;
+      stats.null_count     = chunk_stats.null_count;
+    }
+    const bool is_signed = col_schema.type != BYTE_ARRAY && col_schema.type != BOOLEAN &&
+                           col_schema.converted_type != UINT_8 &&
+                           col_schema.converted_type != UINT_16 &&
+                           col_schema.converted_type != UINT_32;
+    const bool has_new_minmax = !chunk_stats.min_value.empty() || !chunk_stats.max_value.empty();
+    const auto &min = (has_new_minmax || !is_signed) ? chunk_stats.min_value : chunk_stats.min;
+    const auto &max = (has_new_minmax || !is_signed) ? chunk_stats.max_value : chunk_stats.max;
+    if (has_new_minmax || (is_signed && (!min.empty() || !max.empty()))) {
+      stats.min_value   = decode_statistics_value(min, col_schema.type, col_schema.converted_type);
+      stats.max_value   = decode_statistics_value(max, col_schema.type, col_schema.converted_type);
+      stats.has_min_max = stats.min_value.type() != filter_literal::kind::NONE &&
+                          stats.max_value.type() != filter_literal::kind::NONE;
+    }
+    return stats;
+  }
+
+  /**
+   * @brief Reads the ColumnIndex or OffsetIndex of a column chunk
+   *
+   * @param source Dataset source
+   * @param offset File offset of the index
+   * @param length Size of the index in bytes
+   * @param index Parsed index
+   *
+   * @return False if the chunk has no such index or if it cannot be parsed
+   */
+  template <typename T>
+  bool read_page_index(datasource *source, int64_t offset, int32_t length, T *index)
+  {
+    if (offset <= 0 || length <= 0 || static_cast<size_t>(offset + length) > source->size()) {
+      return false;
+    }
+    const auto buffer = source->get_buffer(offset, length);
+    CompactProtocolReader cp(buffer->data(), buffer->size());
+    return cp.read(index);
+  }
+
+  /**
+   * @brief Reads the OffsetIndex of a column chunk, checking it against the chunk's metadata
+   *
+   * @param source Dataset source
+   * @param row_group Index of the row group
+   * @param chunk Column chunk
+   * @param index Parsed index
+   *
+   * @return False if the chunk has no usable offset index
+   */
+  bool read_offset_index(datasource *source,
+                         size_type row_group,
+                         const ColumnChunk &chunk,
+                         OffsetIndex *index)
+  {
+    if (!read_page_index(source, chunk.offset_index_offset, chunk.offset_index_length, index)) {
+      return false;
+    }
+    const auto &col_meta = chunk.meta_data;
+    const int64_t chunk_start =
+      (col_meta.dictionary_page_offset != 0)
+        ? std::min(col_meta.data_page_offset, col_meta.dictionary_page_offset)
+        : col_meta.data_page_offset;
+    const int64_t chunk_end = chunk_start + col_meta.total_compressed_size;
+    const auto &pages       = index->page_locations;
+    if (pages.empty() || pages[0].first_row_index != 0) { return false; }
+    for (size_t i = 0; i < pages.size(); i++) {
+      if (pages[i].offset < chunk_start || pages[i].compressed_page_size <= 0 ||
+          pages[i].offset + pages[i].compressed_page_size > chunk_end) {
+        return false;
+      }
+      if (i > 0 && (pages[i].first_row_index <= pages[i - 1].first_row_index ||
+                    pages[i].offset < pages[i - 1].offset + pages[i - 1].compressed_page_size)) {
+        return false;
+      }
+    }
+    return pages.back().first_row_index < row_groups[row_group].num_rows;
+  }
+
+  /**
+   * @brief Returns whether any row of a row group might satisfy a filter, using the page indexes
+   *
+   * The row group is split into the row ranges delimited by the page boundaries of the filtered
+   * columns, and the filter is evaluated on each range with the statistics of the pages it falls
+   * into. Columns without page indexes use the statistics of the whole chunk instead.
+   *
+   * @param source Dataset source
+   * @param row_group Index of the row group
+   * @param filter Filter expression
+   */
+  bool row_group_pages_might_match(datasource *source,
+                                   size_type row_group,
+                                   filter_expression const &filter)
+  {
+    struct column_pages {
+      std::vector<int64_t> first_rows;
+      ColumnIndex index;
+      const SchemaElement *col_schema;
+    };
+    std::map<std::string, column_pages> indexed_columns;
+    std::vector<int64_t> boundaries;
+    for (const auto &name : get_filter_columns(filter)) {
+      const auto chunk = find_column_chunk(row_group, name);
+      OffsetIndex offsets;
+      ColumnIndex index;
+      if (chunk == nullptr || !read_offset_index(source, row_group, *chunk, &offsets) ||
+          !read_page_index(
+            source, chunk->column_index_offset, chunk->column_index_length, &index)) {
+        continue;
+      }
+      const auto num_pages = offsets.page_locations.size();
+      if (index.null_pages.size() != num_pages || index.min_values.size() != num_pages ||
+          index.max_values.size() != num_pages ||
+          (!index.null_counts.empty() && index.null_counts.size() != num_pages)) {
+        continue;
+      }
+      auto &col      = indexed_columns[name];
+      col.index      = std::move(index);
+      col.col_schema = &schema[chunk->schema_idx];
+      for (const auto &page : offsets.page_locations) {
+        col.first_rows.push_back(page.first_row_index);
+        boundaries.push_back(page.first_row_index);
+      }
+    }
+    if (indexed_columns.empty()) { return true; }
+
+    std::sort(boundaries.begin(), boundaries.end());
+    boundaries.erase(std::unique(boundaries.begin(), boundaries.end()), boundaries.end());
+    const int64_t num_rows = row_groups[row_group].num_rows;
+    for (size_t b = 0; b < boundaries.size(); b++) {
+      const auto range_start = boundaries[b];
+      const auto range_end   = (b + 1 < boundaries.size()) ? boundaries[b + 1] : num_rows;
+      const auto range_rows  = range_end - range_start;
+      auto const get_stats   = [&](std::string const &name) {
+        auto it = indexed_columns.find(name);
+        if (it == indexed_columns.end()) {
+          // Null counts of the whole chunk only tell whether the range has no nulls or only nulls
+          auto stats = get_column_statistics(row_group, name);
+          if (stats.has_null_count && stats.null_count != 0) {
+            stats.has_null_count = stats.null_count >= num_rows;
+            stats.null_count     = range_rows;
+          }
+          return stats;
+        }
+        const auto &col = it->second;
+        const auto &idx = col.index;
+        const auto page =
+          std::upper_bound(col.first_rows.begin(), col.first_rows.end(), range_start) -
+          col.first_rows.begin() - 1;
+        const auto type           = col.col_schema->type;
+        const auto converted_type = col.col_schema->converted_type;
+        column_range_statistics stats;
+        if (idx.null_pages[page]) {
+          stats.has_null_count = true;
+          stats.null_count     = range_rows;
+        } else {
+          if (!idx.null_counts.empty() && idx.null_counts[page] == 0) {
+            stats.has_null_count = true;
+          }
+          stats.min_value   = decode_statistics_value(idx.min_values[page], type, converted_type);
+          stats.max_value   = decode_statistics_value(idx.max_values[page], type, converted_type);
+          stats.has_min_max = stats.min_value.type() != filter_literal::kind::NONE &&
+                              stats.max_value.type() != filter_literal::kind::NONE;
+        }
+        return stats;
+      };
+      if (range_might_match(filter, range_rows, get_stats)) { return true; }
+    }
+    return false;
+  }
+
   /**
    * @brief Filters and reduces down to a selection of row groups
    *
@@ -344,44 +640,86 @@ struct metadata : public FileMetaData {
   }
 };
 
-void reader::impl::read_column_chunks(std::vector<rmm::device_buffer> &page_data,
-                                      hostdevice_vector<gpu::ColumnChunkDesc> &chunks,
-                                      size_t begin_chunk,
-                                      size_t end_chunk,
-                                      const std::vector<size_t> &column_chunk_offsets,
-                                      cudaStream_t stream)
+void reader::impl::read_column_chunks(
+  std::vector<rmm::device_buffer> &page_data,
+  hostdevice_vector<gpu::ColumnChunkDesc> &chunks,
+  size_t begin_chunk,
+  size_t end_chunk,
+  const std::vector<size_t> &column_chunk_offsets,
+  const std::vector<std::pair<size_t, size_t>> &dictionary_ranges,
+  cudaStream_t stream)
 {
+  using buffer_future = std::future<std::shared_ptr<arrow::Buffer>>;
+
   // Transfer chunk data, coalescing adjacent chunks
+  std::vector<std::tuple<size_t, size_t, buffer_future, buffer_future>> read_tasks;
   for (size_t chunk = begin_chunk; chunk < end_chunk;) {
+    const auto dict_size     = dictionary_ranges[chunk].second;
     const size_t io_offset   = column_chunk_offsets[chunk];
-    size_t io_size           = chunks[chunk].compressed_size;
+    size_t io_size           = chunks[chunk].compressed_size - dict_size;
     size_t next_chunk        = chunk + 1;
     const bool is_compressed = (chunks[chunk].codec != parquet::Compression::UNCOMPRESSED);
-    while (next_chunk < end_chunk) {
+    while (next_chunk < end_chunk && dict_size == 0) {
       const size_t next_offset = column_chunk_offsets[next_chunk];
       const bool is_next_compressed =
         (chunks[next_chunk].codec != parquet::Compression::UNCOMPRESSED);
-      if (next_offset != io_offset + io_size || is_next_compressed != is_compressed) {
+      if (next_offset != io_offset + io_size || is_next_compressed != is_compressed ||
+          chunks[next_chunk].start_row != chunks[chunk].start_row ||
+          dictionary_ranges[next_chunk].second != 0) {
         // Can't merge if not contiguous or mixing compressed and uncompressed
         // Not coalescing uncompressed with compressed chunks is so that compressed buffers can be
         // freed earlier (immediately after decompression stage) to limit peak memory requirements
+        // Not coalescing across row groups keeps each read small enough to overlap with others
         break;
       }
       io_size += chunks[next_chunk].compressed_size;
       next_chunk++;
     }
     if (io_size != 0) {
-      auto buffer         = _source->get_buffer(io_offset, io_size);
-      page_data[chunk]    = rmm::device_buffer(buffer->data(), buffer->size(), stream);
-      uint8_t *d_compdata = reinterpret_cast<uint8_t *>(page_data[chunk].data());
-      do {
-        chunks[chunk].compressed_data = d_compdata;
-        d_compdata += chunks[chunk].compressed_size;
-      } while (++chunk != next_chunk);
+      // Issue all the reads before waiting on any of them so they can proceed concurrently
+      read_tasks.emplace_back(
+        chunk,
+        next_chunk,
+        (dict_size != 0)
+          ? _source->get_buffer_async(dictionary_ranges[chunk].first, dict_size)
+          : buffer_future{},
+        _source->get_buffer_async(io_offset, io_size));
+    }
+    chunk = next_chunk;
+  }
+  // Host buffers may be pinned, so they must outlive the asynchronous copies
+  std::vector<std::shared_ptr<arrow::Buffer>> host_buffers;
+  host_buffers.reserve(2 * read_tasks.size());
+  for (auto &task : read_tasks) {
+    auto chunk            = std::get<0>(task);
+    const auto next_chunk = std::get<1>(task);
+    if (std::get<2>(task).valid()) {
+      // The dictionary is placed right before the remaining pages, as if none were skipped
+      const auto dict_buffer = std::get<2>(task).get();
+      const auto buffer      = std::get<3>(task).get();
+      host_buffers.emplace_back(dict_buffer);
+      host_buffers.emplace_back(buffer);
+      page_data[chunk] = rmm::device_buffer(dict_buffer->size() + buffer->size(), stream);
+      auto dst         = reinterpret_cast<uint8_t *>(page_data[chunk].data());
+      CUDA_TRY(cudaMemcpyAsync(
+        dst, dict_buffer->data(), dict_buffer->size(), cudaMemcpyHostToDevice, stream));
+      CUDA_TRY(cudaMemcpyAsync(dst + dict_buffer->size(),
+                               buffer->data(),
+                               buffer->size(),
+                               cudaMemcpyHostToDevice,
+                               stream));
     } else {
-      chunk = next_chunk;
+      host_buffers.emplace_back(std::get<3>(task).get());
+      const auto &buffer = host_buffers.back();
+      page_data[chunk]   = rmm::device_buffer(buffer->data(), buffer->size(), stream);
     }
+    uint8_t *d_compdata = reinterpret_cast<uint8_t *>(page_data[chunk].data());
+    do {
+      chunks[chunk].compressed_data = d_compdata;
+      d_compdata += chunks[chunk].compressed_size;
+    } while (++chunk != next_chunk);
   }
+  CUDA_TRY(cudaStreamSynchronize(stream));
 }
 
 size_t reader::impl::count_page_headers(hostdevice_vector<gpu::ColumnChunkDesc> &chunks,
@@ -436,21 +774,37 @@ rmm::device_buffer reader::impl::decompress_page_data(
     }
   };
 
+  // V2 data pages store their levels uncompressed ahead of the values, and only need their values
+  // decompressed if they are compressed and not all nulls
+  auto levels_size = [](const gpu::PageInfo &page) {
+    return (page.flags & gpu::PAGEINFO_FLAGS_V2) ? page.lvl_bytes[0] + page.lvl_bytes[1] : 0;
+  };
+  auto needs_decompression = [](const gpu::PageInfo &page) {
+    return !(page.flags & gpu::PAGEINFO_FLAGS_V2) ||
+           (!(page.flags & gpu::PAGEINFO_FLAGS_UNCOMPRESSED) && page.num_nulls < page.num_values);
+  };
+
   // Brotli scratch memory for decompressing
   rmm::device_vector<uint8_t> debrotli_scratch;
 
-  // Count the exact number of compressed pages
+  // Count the exact number of compressed pages, and of V2 pages with data to copy as-is
   size_t num_comp_pages    = 0;
+  size_t num_copy_pages    = 0;
   size_t total_decomp_size = 0;
-  std::array<std::pair<parquet::Compression, size_t>, 3> codecs{std::make_pair(parquet::GZIP, 0),
+  std::array<std::pair<parquet::Compression, size_t>, 5> codecs{std::make_pair(parquet::GZIP, 0),
                                                                 std::make_pair(parquet::SNAPPY, 0),
-                                                                std::make_pair(parquet::BROTLI, 0)};
+                                                                std::make_pair(parquet::BROTLI, 0),
+                                                                std::make_pair(parquet::ZSTD, 0),
+                                                                std::make_pair(parquet::LZ4, 0)};
 
   for (auto &codec : codecs) {
     for_each_codec_page(codec.first, [&](size_t page) {
       total_decomp_size += pages[page].uncompressed_page_size;
-      codec.second++;
-      num_comp_pages++;
+      if (needs_decompression(pages[page])) {
+        codec.second++;
+        num_comp_pages++;
+      }
+      if (pages[page].flags & gpu::PAGEINFO_FLAGS_V2) { num_copy_pages++; }
     });
     if (codec.first == parquet::BROTLI && codec.second > 0) {
       debrotli_scratch.resize(get_gpu_debrotli_scratch_size(codec.second));
@@ -461,29 +815,48 @@ rmm::device_buffer reader::impl::decompress_page_data(
   rmm::device_buffer decomp_pages(total_decomp_size, stream);
   hostdevice_vector<gpu_inflate_input_s> inflate_in(0, num_comp_pages, stream);
   hostdevice_vector<gpu_inflate_status_s> inflate_out(0, num_comp_pages, stream);
+  hostdevice_vector<gpu_inflate_input_s> copy_in(0, num_copy_pages, stream);
 
   size_t decomp_offset = 0;
   int32_t argc         = 0;
+  int32_t copy_count   = 0;
   for (const auto &codec : codecs) {
-    if (codec.second > 0) {
-      int32_t start_pos = argc;
+    int32_t start_pos = argc;
 
-      for_each_codec_page(codec.first, [&](size_t page) {
-        auto dst_base              = static_cast<uint8_t *>(decomp_pages.data());
-        inflate_in[argc].srcDevice = pages[page].page_data;
-        inflate_in[argc].srcSize   = pages[page].compressed_page_size;
-        inflate_in[argc].dstDevice = dst_base + decomp_offset;
-        inflate_in[argc].dstSize   = pages[page].uncompressed_page_size;
+    for_each_codec_page(codec.first, [&](size_t page) {
+      auto dst_base       = static_cast<uint8_t *>(decomp_pages.data()) + decomp_offset;
+      const auto lvl_size = levels_size(pages[page]);
+      decomp_offset += pages[page].uncompressed_page_size;
+      // Bytes at the start of the page that are copied as-is
+      int32_t copy_size = lvl_size;
+      if (needs_decompression(pages[page])) {
+        inflate_in[argc].srcDevice = pages[page].page_data + lvl_size;
+        inflate_in[argc].srcSize   = pages[page].compressed_page_size - lvl_size;
+        inflate_in[argc].dstDevice = dst_base + lvl_size;
+        inflate_in[argc].dstSize   = pages[page].uncompressed_page_size - lvl_size;
 
         inflate_out[argc].bytes_written = 0;
         inflate_out[argc].status        = static_cast<uint32_t>(-1000);
         inflate_out[argc].reserved      = 0;
-
-        pages[page].page_data = (uint8_t *)inflate_in[argc].dstDevice;
-        decomp_offset += inflate_in[argc].dstSize;
         argc++;
-      });
+      } else if (pages[page].flags & gpu::PAGEINFO_FLAGS_UNCOMPRESSED) {
+        copy_size =
+          std::min(pages[page].compressed_page_size, pages[page].uncompressed_page_size);
+      } else {
+        // All values are null, so only the levels are needed
+        pages[page].uncompressed_page_size = lvl_size;
+      }
+      if (copy_size > 0) {
+        copy_in[copy_count].srcDevice = pages[page].page_data;
+        copy_in[copy_count].srcSize   = copy_size;
+        copy_in[copy_count].dstDevice = dst_base;
+        copy_in[copy_count].dstSize   = copy_size;
+        copy_count++;
+      }
+      pages[page].page_data = dst_base;
+    });
 
+    if (argc > start_pos) {
       CUDA_TRY(cudaMemcpyAsync(inflate_in.device_ptr(start_pos),
                                inflate_in.host_ptr(start_pos),
                                sizeof(decltype(inflate_in)::value_type) * (argc - start_pos),
@@ -494,29 +867,58 @@ rmm::device_buffer reader::impl::decompress_page_data(
                                sizeof(decltype(inflate_out)::value_type) * (argc - start_pos),
                                cudaMemcpyHostToDevice,
                                stream));
-      switch (codec.first) {
-        case parquet::GZIP:
-          CUDA_TRY(gpuinflate(inflate_in.device_ptr(start_pos),
-                              inflate_out.device_ptr(start_pos),
-                              argc - start_pos,
-                              1,
-                              stream))
-          break;
-        case parquet::SNAPPY:
-          CUDA_TRY(gpu_unsnap(inflate_in.device_ptr(start_pos),
-                              inflate_out.device_ptr(start_pos),
-                              argc - start_pos,
-                              stream));
-          break;
-        case parquet::BROTLI:
-          CUDA_TRY(gpu_debrotli(inflate_in.device_ptr(start_pos),
+      // Small batches are decompressed on the host, where they do not pay for kernel launches
+      // that only fill a few blocks
+      size_t batch_comp_size = 0;
+      for (auto i = start_pos; i < argc; ++i) { batch_comp_size += inflate_in[i].srcSize; }
+      const auto host_stream_type = to_host_stream_type(codec.first);
+      if (batch_comp_size < _host_decompression_threshold &&
+          is_host_decompression_supported(host_stream_type)) {
+        CUDA_TRY(cpu_decompress(host_stream_type,
+                                inflate_in.device_ptr(start_pos),
+                                inflate_out.device_ptr(start_pos),
+                                argc - start_pos,
+                                stream));
+      } else {
+        switch (codec.first) {
+          case parquet::GZIP:
+            CUDA_TRY(gpuinflate(inflate_in.device_ptr(start_pos),
+                                inflate_out.device_ptr(start_pos),
+                                argc - start_pos,
+                                1,
+                                stream))
+            break;
+          case parquet::SNAPPY:
+            CUDA_TRY(gpu_unsnap(inflate_in.device_ptr(start_pos),
                                 inflate_out.device_ptr(start_pos),
-                                debrotli_scratch.data().get(),
-                                debrotli_scratch.size(),
                                 argc - start_pos,
                                 stream));
-          break;
-        default: CUDF_EXPECTS(false, "Unexpected decompression dispatch"); break;
+            break;
+          case parquet::BROTLI:
+            CUDA_TRY(gpu_debrotli(inflate_in.device_ptr(start_pos),
+                                  inflate_out.device_ptr(start_pos),
+                                  debrotli_scratch.data().get(),
+                                  debrotli_scratch.size(),
+                                  argc - start_pos,
+                                  stream));
+            break;
+          // No GPU decoders for these yet; the pages are decompressed on the host
+          case parquet::ZSTD:
+            CUDA_TRY(cpu_decompress(IO_UNCOMP_STREAM_TYPE_ZSTD,
+                                    inflate_in.device_ptr(start_pos),
+                                    inflate_out.device_ptr(start_pos),
+                                    argc - start_pos,
+                                    stream));
+            break;
+          case parquet::LZ4:
+            CUDA_TRY(cpu_decompress(IO_UNCOMP_STREAM_TYPE_LZ4,
+                                    inflate_in.device_ptr(start_pos),
+                                    inflate_out.device_ptr(start_pos),
+                                    argc - start_pos,
+                                    stream));
+            break;
+          default: CUDF_EXPECTS(false, "Unexpected decompression dispatch"); break;
+        }
       }
       CUDA_TRY(cudaMemcpyAsync(inflate_out.host_ptr(start_pos),
                                inflate_out.device_ptr(start_pos),
@@ -525,6 +927,14 @@ rmm::device_buffer reader::impl::decompress_page_data(
                                stream));
     }
   }
+  if (copy_count > 0) {
+    CUDA_TRY(cudaMemcpyAsync(copy_in.device_ptr(),
+                             copy_in.host_ptr(),
+                             sizeof(decltype(copy_in)::value_type) * copy_count,
+                             cudaMemcpyHostToDevice,
+                             stream));
+    CUDA_TRY(gpu_copy_uncompressed_blocks(copy_in.device_ptr(), copy_count, stream));
+  }
   CUDA_TRY(cudaStreamSynchronize(stream));
 
   // Update the page information in device memory with the updated value of
@@ -535,6 +945,83 @@ rmm::device_buffer reader::impl::decompress_page_data(
   return decomp_pages;
 }
 
+rmm::device_buffer reader::impl::decode_to_plain_pages(
+  hostdevice_vector<gpu::ColumnChunkDesc> &chunks,
+  hostdevice_vector<gpu::PageInfo> &pages,
+  cudaStream_t stream)
+{
+  auto needs_conversion = [](const gpu::PageInfo &page) {
+    return !(page.flags & gpu::PAGEINFO_FLAGS_DICTIONARY) &&
+           (page.encoding == parquet::DELTA_BINARY_PACKED ||
+            page.encoding == parquet::DELTA_LENGTH_BYTE_ARRAY ||
+            page.encoding == parquet::DELTA_BYTE_ARRAY ||
+            page.encoding == parquet::BYTE_STREAM_SPLIT);
+  };
+  if (std::none_of(pages.host_ptr(), pages.host_ptr() + pages.size(), needs_conversion)) {
+    return rmm::device_buffer{};
+  }
+
+  // First pass computes the size of the converted pages
+  hostdevice_vector<gpu::PlainPageDesc> plain_pages(pages.size(), pages.size(), stream);
+  memset(plain_pages.host_ptr(), 0, plain_pages.memory_size());
+  CUDA_TRY(cudaMemcpyAsync(plain_pages.device_ptr(),
+                           plain_pages.host_ptr(),
+                           plain_pages.memory_size(),
+                           cudaMemcpyHostToDevice,
+                           stream));
+  CUDA_TRY(gpu::DecodeToPlainPages(
+    pages.device_ptr(), pages.size(), chunks.device_ptr(), plain_pages.device_ptr(), stream));
+  CUDA_TRY(cudaMemcpyAsync(plain_pages.host_ptr(),
+                           plain_pages.device_ptr(),
+                           plain_pages.memory_size(),
+                           cudaMemcpyDeviceToHost,
+                           stream));
+  CUDA_TRY(cudaStreamSynchronize(stream));
+
+  size_t total_size = 0;
+  for (size_t i = 0; i < pages.size(); i++) {
+    CUDF_EXPECTS(plain_pages[i].error == 0, "Invalid delta or byte stream split page data");
+    if (needs_conversion(pages[i])) { total_size += plain_pages[i].size; }
+  }
+
+  // Second pass writes the converted pages
+  rmm::device_buffer plain_data(total_size, stream);
+  size_t offset = 0;
+  for (size_t i = 0; i < pages.size(); i++) {
+    if (needs_conversion(pages[i])) {
+      plain_pages[i].data = static_cast<uint8_t *>(plain_data.data()) + offset;
+      offset += plain_pages[i].size;
+    }
+  }
+  CUDA_TRY(cudaMemcpyAsync(plain_pages.device_ptr(),
+                           plain_pages.host_ptr(),
+                           plain_pages.memory_size(),
+                           cudaMemcpyHostToDevice,
+                           stream));
+  CUDA_TRY(gpu::DecodeToPlainPages(
+    pages.device_ptr(), pages.size(), chunks.device_ptr(), plain_pages.device_ptr(), stream));
+  CUDA_TRY(cudaMemcpyAsync(plain_pages.host_ptr(),
+                           plain_pages.device_ptr(),
+                           plain_pages.memory_size(),
+                           cudaMemcpyDeviceToHost,
+                           stream));
+  CUDA_TRY(cudaStreamSynchronize(stream));
+
+  // Update the page information to point to the converted data
+  for (size_t i = 0; i < pages.size(); i++) {
+    if (needs_conversion(pages[i])) {
+      CUDF_EXPECTS(plain_pages[i].error == 0, "Invalid delta or byte stream split page data");
+      pages[i].page_data              = plain_pages[i].data;
+      pages[i].uncompressed_page_size = static_cast<int32_t>(plain_pages[i].size);
+      pages[i].encoding               = parquet::PLAIN;
+    }
+  }
+  CUDA_TRY(cudaMemcpyAsync(
+    pages.device_ptr(), pages.host_ptr(), pages.memory_size(), cudaMemcpyHostToDevice, stream));
+
+  return plain_data;
+}
+
 void reader::impl::decode_page_data(hostdevice_vector<gpu::ColumnChunkDesc> &chunks,
                                     hostdevice_vector<gpu::PageInfo> &pages,
                                     size_t min_row,
@@ -598,12 +1085,17 @@ void reader::impl::decode_page_data(hostdevice_vector<gpu::ColumnChunkDesc> &chu
 }
 
 reader::impl::impl(std::unique_ptr<datasource> source,
+                   std::string const &filepath,
                    reader_options const &options,
                    rmm::mr::device_memory_resource *mr)
   : _source(std::move(source)), _mr(mr)
 {
-  // Open and parse the source dataset metadata
-  _metadata = std::make_unique<metadata>(_source.get());
+  // Open and parse the source dataset metadata, unless the footer of the file is already cached
+  const auto file_metadata = get_cached_metadata<FileMetaData>(
+    options.footer_cache.get(), "parquet", filepath, [&](size_t *footer_size) {
+      return read_file_metadata(_source.get(), footer_size);
+    });
+  _metadata = std::make_unique<metadata>(*file_metadata);
 
   // Select only columns required by the options
   _selected_columns = _metadata->select_columns(options.columns, options.use_pandas_metadata);
@@ -613,23 +1105,18 @@ reader::impl::impl(std::unique_ptr<datasource> source,
 
   // Strings may be returned as either string or categorical columns
   _strings_to_categorical = options.strings_to_categorical;
-}
 
-table_with_metadata reader::impl::read(size_type skip_rows,
-                                       size_type num_rows,
-                                       size_type row_group,
-                                       size_type max_rowgroup_count,
-                                       const size_type *row_group_indices,
-                                       cudaStream_t stream)
-{
-  std::vector<std::unique_ptr<column>> out_columns;
-  table_metadata out_metadata;
+  // Row groups are skipped based on their statistics if a filter is specified
+  _filter = options.filter;
 
-  // Select only row groups required
-  const auto selected_row_groups = _metadata->select_row_groups(
-    row_group, max_rowgroup_count, row_group_indices, skip_rows, num_rows);
+  // Codec batches with less compressed data are decompressed on the host
+  _host_decompression_threshold = options.host_decompression_threshold;
+}
 
-  // Get a list of column data types
+reader::impl::~impl() = default;
+
+std::vector<data_type> reader::impl::get_column_types() const
+{
   std::vector<data_type> column_types;
   if (_metadata->row_groups.size() != 0) {
     for (const auto &col : _selected_columns) {
@@ -643,130 +1130,334 @@ table_with_metadata reader::impl::read(size_type skip_rows,
       column_types.emplace_back(col_type);
     }
   }
-  out_columns.reserve(column_types.size());
+  return column_types;
+}
 
-  if (selected_row_groups.size() != 0 && column_types.size() != 0) {
-    // Descriptors for all the chunks that make up the selected columns
-    const auto num_columns = _selected_columns.size();
-    const auto num_chunks  = selected_row_groups.size() * num_columns;
-    hostdevice_vector<gpu::ColumnChunkDesc> chunks(0, num_chunks, stream);
-
-    // Association between each column chunk and its column
-    std::vector<int> chunk_map(num_chunks);
-
-    // Tracker for eventually deallocating compressed and uncompressed data
-    std::vector<rmm::device_buffer> page_data(num_chunks);
-
-    // Keep track of column chunk file offsets
-    std::vector<size_t> column_chunk_offsets(num_chunks);
-
-    // Initialize column chunk information
-    size_t total_decompressed_size = 0;
-    auto remaining_rows            = num_rows;
-    for (const auto &rg : selected_row_groups) {
-      const auto &row_group = _metadata->row_groups[rg.first];
-      auto row_group_start  = rg.second;
-      auto row_group_rows   = std::min<int>(remaining_rows, row_group.num_rows);
-      auto io_chunk_idx     = chunks.size();
-
-      for (size_t i = 0; i < num_columns; ++i) {
-        auto col         = _selected_columns[i];
-        auto &col_meta   = row_group.columns[col.first].meta_data;
-        auto &col_schema = _metadata->schema[row_group.columns[col.first].schema_idx];
-
-        // Spec requires each row group to contain exactly one chunk for every
-        // column. If there are too many or too few, continue with best effort
-        if (col.second != _metadata->get_column_name(col_meta.path_in_schema)) {
-          std::cerr << "Detected mismatched column chunk" << std::endl;
-          continue;
-        }
-        if (chunks.size() >= chunks.max_size()) {
-          std::cerr << "Detected too many column chunks" << std::endl;
-          continue;
-        }
+std::vector<std::string> reader::impl::get_column_names() const
+{
+  std::vector<std::string> names;
+  for (const auto &col : _selected_columns) { names.push_back(col.second); }
+  return names;
+}
 
-        int32_t type_width;
-        int32_t clock_rate;
-        int8_t converted_type;
-        std::tie(type_width, clock_rate, converted_type) =
-          conversion_info(column_types[i].id(),
-                          _timestamp_type.id(),
-                          col_schema.type,
-                          col_schema.converted_type,
-                          col_schema.type_length);
-
-        column_chunk_offsets[chunks.size()] =
-          (col_meta.dictionary_page_offset != 0)
-            ? std::min(col_meta.data_page_offset, col_meta.dictionary_page_offset)
-            : col_meta.data_page_offset;
-
-        chunks.insert(gpu::ColumnChunkDesc(col_meta.total_compressed_size,
-                                           nullptr,
-                                           col_meta.num_values,
-                                           col_schema.type,
-                                           type_width,
-                                           row_group_start,
-                                           row_group_rows,
-                                           col_schema.max_definition_level,
-                                           col_schema.max_repetition_level,
-                                           required_bits(col_schema.max_definition_level),
-                                           required_bits(col_schema.max_repetition_level),
-                                           col_meta.codec,
-                                           converted_type,
-                                           col_schema.decimal_scale,
-                                           clock_rate));
-
-        // Map each column chunk to its column index
-        chunk_map[chunks.size() - 1] = i;
-
-        if (col_meta.codec != Compression::UNCOMPRESSED) {
-          total_decompressed_size += col_meta.total_uncompressed_size;
-        }
-      }
-      // Read compressed chunk data to device memory
-      read_column_chunks(
-        page_data, chunks, io_chunk_idx, chunks.size(), column_chunk_offsets, stream);
+std::vector<bool> reader::impl::get_column_nullability() const
+{
+  std::vector<bool> nullability;
+  if (_metadata->row_groups.size() != 0) {
+    for (const auto &col : _selected_columns) {
+      const auto &col_schema =
+        _metadata->schema[_metadata->row_groups[0].columns[col.first].schema_idx];
+      nullability.push_back(col_schema.max_definition_level != 0);
+    }
+  }
+  return nullability;
+}
+
+std::map<std::string, std::string> reader::impl::get_user_data() const
+{
+  std::map<std::string, std::string> user_data;
+  for (const auto &kv : _metadata->key_value_metadata) { user_data.insert({kv.key, kv.value}); }
+  return user_data;
+}
 
-      remaining_rows -= row_group.num_rows;
+bool reader::impl::row_group_might_match(size_type row_group) const
+{
+  auto const get_stats = [&](std::string const &name) {
+    return _metadata->get_column_statistics(row_group, name);
+  };
+  return range_might_match(_filter, _metadata->row_groups[row_group].num_rows, get_stats) &&
+         _metadata->row_group_pages_might_match(_source.get(), row_group, _filter);
+}
+
+std::pair<size_t, size_t> reader::impl::estimate_row_group_size(
+  size_type row_group, const std::vector<data_type> &column_types) const
+{
+  const auto &rg     = _metadata->row_groups[row_group];
+  const auto rows    = static_cast<size_t>(rg.num_rows);
+  size_t output_size = 0;
+  size_t decomp_size = 0;
+  for (size_t i = 0; i < column_types.size(); ++i) {
+    const auto &chunk      = rg.columns[_selected_columns[i].first];
+    const auto &col_meta   = chunk.meta_data;
+    const auto &col_schema = _metadata->schema[chunk.schema_idx];
+    if (is_fixed_width(column_types[i])) {
+      output_size += size_of(column_types[i]) * rows;
+    } else {
+      // The uncompressed page data holds the characters and the length of each string
+      output_size += col_meta.total_uncompressed_size + (rows + 1) * sizeof(size_type);
+    }
+    if (col_schema.max_definition_level != 0) {
+      output_size += bitmask_allocation_size_bytes(rg.num_rows);
     }
-    assert(remaining_rows <= 0);
+    if (col_meta.codec != Compression::UNCOMPRESSED) {
+      decomp_size += col_meta.total_uncompressed_size;
+    }
+  }
+  return {output_size, decomp_size};
+}
 
-    // Process dataset chunk pages into output columns
-    const auto total_pages = count_page_headers(chunks, stream);
-    if (total_pages > 0) {
-      hostdevice_vector<gpu::PageInfo> pages(total_pages, total_pages, stream);
-      rmm::device_buffer decomp_page_data;
+size_type reader::impl::filter_row_groups(std::vector<std::pair<size_type, size_t>> &row_groups,
+                                          table_metadata &out_metadata) const
+{
+  std::vector<std::pair<size_type, size_t>> filtered_row_groups;
+  size_type filtered_rows = 0;
+  for (const auto &rg : row_groups) {
+    const auto &row_group = _metadata->row_groups[rg.first];
+    if (row_group_might_match(rg.first)) {
+      filtered_row_groups.emplace_back(rg.first, filtered_rows);
+      filtered_rows += row_group.num_rows;
+    } else {
+      out_metadata.num_filtered_row_groups++;
+      out_metadata.num_filtered_rows += row_group.num_rows;
+      for (const auto &col : _selected_columns) {
+        const auto &col_meta = row_group.columns[col.first].meta_data;
+        out_metadata.num_filtered_bytes += col_meta.total_compressed_size;
+      }
+    }
+  }
+  row_groups = std::move(filtered_row_groups);
+  return filtered_rows;
+}
 
-      decode_page_headers(chunks, pages, stream);
-      if (total_decompressed_size > 0) {
-        decomp_page_data = decompress_page_data(chunks, pages, stream);
-        // Free compressed data
-        for (size_t c = 0; c < chunks.size(); c++) {
-          if (chunks[c].codec != parquet::Compression::UNCOMPRESSED && page_data[c].size() != 0) {
-            page_data[c].resize(0);
-            page_data[c].shrink_to_fit();
-          }
-        }
+std::pair<std::vector<std::pair<size_type, size_t>>, size_type>
+reader::impl::select_filtered_row_groups(table_metadata &out_metadata) const
+{
+  size_type skip_rows = 0;
+  size_type num_rows  = -1;
+  auto row_groups     = _metadata->select_row_groups(-1, -1, nullptr, skip_rows, num_rows);
+  if (!_filter.empty()) { num_rows = filter_row_groups(row_groups, out_metadata); }
+  return {std::move(row_groups), num_rows};
+}
+
+std::unique_ptr<reader::impl::row_group_pages> reader::impl::load_row_group_pages(
+  const std::vector<std::pair<size_type, size_t>> &row_groups,
+  size_type skip_rows,
+  size_type num_rows,
+  const std::vector<data_type> &column_types,
+  const std::vector<int> &column_map,
+  size_type row_offset,
+  cudaStream_t stream)
+{
+  // Offsetting the start rows only moves the output if all the rows from the first are read
+  CUDF_EXPECTS(row_offset == 0 || skip_rows == 0, "Cannot skip rows when decoding at an offset");
+
+  // Descriptors for all the chunks that make up the selected columns
+  const auto num_columns = _selected_columns.size();
+  const auto num_chunks  = row_groups.size() * num_columns;
+  auto loaded            = std::make_unique<row_group_pages>();
+  loaded->chunks = std::make_unique<hostdevice_vector<gpu::ColumnChunkDesc>>(0, num_chunks, stream);
+  auto &chunks   = *loaded->chunks;
+
+  // Association between each column chunk and its column
+  auto &chunk_map = loaded->chunk_map;
+  chunk_map.resize(num_chunks);
+
+  // Tracker for eventually deallocating compressed and uncompressed data
+  auto &page_data = loaded->page_data;
+  page_data.resize(num_chunks);
+
+  // Keep track of column chunk file offsets
+  std::vector<size_t> column_chunk_offsets(num_chunks);
+  std::vector<std::pair<size_t, size_t>> dictionary_ranges(num_chunks);
+
+  // Initialize column chunk information
+  size_t total_decompressed_size = 0;
+  auto remaining_rows            = num_rows;
+  for (const auto &rg : row_groups) {
+    const auto &row_group = _metadata->row_groups[rg.first];
+    auto row_group_start  = rg.second;
+    auto row_group_rows   = std::min<int>(remaining_rows, row_group.num_rows);
+
+    for (size_t i = 0; i < num_columns; ++i) {
+      auto col         = _selected_columns[i];
+      auto &col_meta   = row_group.columns[col.first].meta_data;
+      auto &col_schema = _metadata->schema[row_group.columns[col.first].schema_idx];
+
+      // Spec requires each row group to contain exactly one chunk for every
+      // column. If there are too many or too few, continue with best effort
+      if (col.second != _metadata->get_column_name(col_meta.path_in_schema)) {
+        std::cerr << "Detected mismatched column chunk" << std::endl;
+        continue;
+      }
+      if (chunks.size() >= chunks.max_size()) {
+        std::cerr << "Detected too many column chunks" << std::endl;
+        continue;
       }
 
-      std::vector<column_buffer> out_buffers;
-      out_buffers.reserve(column_types.size());
-      for (size_t i = 0; i < column_types.size(); ++i) {
-        auto col = _selected_columns[i];
-        auto &col_schema =
-          _metadata->schema
-            [_metadata->row_groups[selected_row_groups[0].first].columns[col.first].schema_idx];
-        bool is_nullable = (col_schema.max_definition_level != 0);
-        out_buffers.emplace_back(column_types[i], num_rows, is_nullable, stream, _mr);
+      int32_t type_width;
+      int32_t clock_rate;
+      int8_t converted_type;
+      std::tie(type_width, clock_rate, converted_type) =
+        conversion_info(column_types[i].id(),
+                        _timestamp_type.id(),
+                        col_schema.type,
+                        col_schema.converted_type,
+                        col_schema.type_length);
+
+      column_chunk_offsets[chunks.size()] =
+        (col_meta.dictionary_page_offset != 0)
+          ? std::min(col_meta.data_page_offset, col_meta.dictionary_page_offset)
+          : col_meta.data_page_offset;
+
+      // Skip the data pages outside of the selected rows if the chunk has an offset index;
+      // only the dictionary and the remaining pages are read and decoded
+      size_t chunk_size       = col_meta.total_compressed_size;
+      size_t chunk_values     = col_meta.num_values;
+      size_t chunk_start_row  = row_group_start;
+      uint32_t chunk_num_rows = row_group_rows;
+      const int64_t rg_start  = row_group_start;
+      const int64_t rg_end    = rg_start + row_group.num_rows;
+      OffsetIndex offset_index;
+      if (col_schema.max_repetition_level == 0 &&
+          (rg_start < skip_rows || rg_end > static_cast<int64_t>(skip_rows) + num_rows) &&
+          _metadata->read_offset_index(
+            _source.get(), rg.first, row_group.columns[col.first], &offset_index)) {
+        const auto &pages    = offset_index.page_locations;
+        const auto page_rows = [&](size_t p) {
+          const auto end_row = (p + 1 < pages.size()) ? pages[p + 1].first_row_index
+                                                      : row_group.num_rows;
+          return std::make_pair(rg_start + pages[p].first_row_index, rg_start + end_row);
+        };
+        size_t first = 0;
+        size_t last  = pages.size() - 1;
+        while (first < last && page_rows(first).second <= skip_rows) { first++; }
+        while (last > first && page_rows(last).first >= skip_rows + num_rows) { last--; }
+        if (first != 0 || last != pages.size() - 1) {
+          const auto chunk_offset = column_chunk_offsets[chunks.size()];
+          const size_t dict_size  = pages[0].offset - chunk_offset;
+          dictionary_ranges[chunks.size()]    = {chunk_offset, dict_size};
+          column_chunk_offsets[chunks.size()] = pages[first].offset;
+          chunk_size = dict_size + pages[last].offset + pages[last].compressed_page_size -
+                       pages[first].offset;
+          chunk_start_row = page_rows(first).first;
+          chunk_values    = page_rows(last).second - page_rows(first).first;
+          chunk_num_rows  = static_cast<uint32_t>(chunk_values);
+        }
       }
 
-      decode_page_data(chunks, pages, skip_rows, num_rows, chunk_map, out_buffers, stream);
+      chunks.insert(gpu::ColumnChunkDesc(chunk_size,
+                                         nullptr,
+                                         chunk_values,
+                                         col_schema.type,
+                                         type_width,
+                                         chunk_start_row + row_offset,
+                                         chunk_num_rows,
+                                         col_schema.max_definition_level,
+                                         col_schema.max_repetition_level,
+                                         required_bits(col_schema.max_definition_level),
+                                         required_bits(col_schema.max_repetition_level),
+                                         col_meta.codec,
+                                         converted_type,
+                                         col_schema.decimal_scale,
+                                         clock_rate));
+
+      // Map each column chunk to its column's output buffer
+      chunk_map[chunks.size() - 1] = column_map[i];
+
+      if (col_meta.codec != Compression::UNCOMPRESSED) {
+        total_decompressed_size += col_meta.total_uncompressed_size;
+      }
+    }
 
-      for (size_t i = 0; i < column_types.size(); ++i) {
-        out_columns.emplace_back(
-          make_column(column_types[i], num_rows, out_buffers[i], stream, _mr));
+    remaining_rows -= row_group.num_rows;
+  }
+  assert(remaining_rows <= 0);
+
+  // Read compressed chunk data to device memory
+  read_column_chunks(
+    page_data, chunks, 0, chunks.size(), column_chunk_offsets, dictionary_ranges, stream);
+
+  // Process dataset chunk pages into pages ready to be decoded
+  const auto total_pages = count_page_headers(chunks, stream);
+  if (total_pages > 0) {
+    loaded->pages =
+      std::make_unique<hostdevice_vector<gpu::PageInfo>>(total_pages, total_pages, stream);
+    auto &pages = *loaded->pages;
+    rmm::device_buffer decomp_page_data;
+
+    decode_page_headers(chunks, pages, stream);
+    if (total_decompressed_size > 0) {
+      decomp_page_data = decompress_page_data(chunks, pages, stream);
+      // Free compressed data
+      for (size_t c = 0; c < chunks.size(); c++) {
+        if (chunks[c].codec != parquet::Compression::UNCOMPRESSED && page_data[c].size() != 0) {
+          page_data[c].resize(0);
+          page_data[c].shrink_to_fit();
+        }
       }
     }
+    // Delta and byte stream split encoded pages are converted to PLAIN before decoding
+    rmm::device_buffer plain_page_data = decode_to_plain_pages(chunks, pages, stream);
+
+    page_data.push_back(std::move(decomp_page_data));
+    page_data.push_back(std::move(plain_page_data));
+  }
+
+  return loaded;
+}
+
+void reader::impl::decode_row_group_pages(row_group_pages &loaded,
+                                          size_t min_row,
+                                          size_t total_rows,
+                                          std::vector<column_buffer> &out_buffers,
+                                          cudaStream_t stream)
+{
+  if (loaded.pages == nullptr) { return; }
+  auto &pages = *loaded.pages;
+
+  // Decoding crops the rows of the pages to the decoded range: restore them to decode again
+  if (loaded.undecoded_pages.empty()) {
+    loaded.undecoded_pages.assign(pages.host_ptr(), pages.host_ptr() + pages.size());
+  } else {
+    std::copy(loaded.undecoded_pages.begin(), loaded.undecoded_pages.end(), pages.host_ptr());
+    CUDA_TRY(cudaMemcpyAsync(
+      pages.device_ptr(), pages.host_ptr(), pages.memory_size(), cudaMemcpyHostToDevice, stream));
+  }
+  decode_page_data(
+    *loaded.chunks, pages, min_row, total_rows, loaded.chunk_map, out_buffers, stream);
+}
+
+std::vector<rmm::device_buffer> reader::impl::decode_row_groups(
+  const std::vector<std::pair<size_type, size_t>> &row_groups,
+  size_type skip_rows,
+  size_type num_rows,
+  const std::vector<data_type> &column_types,
+  const std::vector<int> &column_map,
+  size_type row_offset,
+  std::vector<column_buffer> &out_buffers,
+  cudaStream_t stream)
+{
+  auto loaded = load_row_group_pages(
+    row_groups, skip_rows, num_rows, column_types, column_map, row_offset, stream);
+
+  // Rows are decoded at their start row, which is offset by `row_offset` in the chunks
+  decode_row_group_pages(*loaded, skip_rows, row_offset + num_rows, out_buffers, stream);
+
+  return std::move(loaded->page_data);
+}
+
+std::vector<column_buffer> reader::impl::allocate_output_buffers(
+  const std::vector<data_type> &column_types, size_type num_rows, cudaStream_t stream) const
+{
+  const auto nullability = get_column_nullability();
+  std::vector<column_buffer> out_buffers;
+  out_buffers.reserve(column_types.size());
+  for (size_t i = 0; i < column_types.size(); ++i) {
+    out_buffers.emplace_back(column_types[i], num_rows, nullability[i], stream, _mr);
+  }
+  return out_buffers;
+}
+
+table_with_metadata reader::impl::make_table(const std::vector<data_type> &column_types,
+                                             size_type num_rows,
+                                             std::vector<column_buffer> &out_buffers,
+                                             table_metadata &&out_metadata,
+                                             cudaStream_t stream) const
+{
+  std::vector<std::unique_ptr<column>> out_columns;
+  out_columns.reserve(column_types.size());
+  for (size_t i = 0; i < out_buffers.size(); ++i) {
+    out_columns.emplace_back(make_column(column_types[i], num_rows, out_buffers[i], stream, _mr));
   }
 
   // Create empty columns as needed
@@ -780,18 +1471,235 @@ table_with_metadata reader::impl::read(size_type skip_rows,
     out_metadata.column_names[i] = _selected_columns[i].second;
   }
   // Return user metadata
-  for (const auto &kv : _metadata->key_value_metadata) {
-    out_metadata.user_data.insert({kv.key, kv.value});
-  }
+  out_metadata.user_data = get_user_data();
 
   return {std::make_unique<table>(std::move(out_columns)), std::move(out_metadata)};
 }
 
+table_with_metadata reader::impl::read(size_type skip_rows,
+                                       size_type num_rows,
+                                       size_type row_group,
+                                       size_type max_rowgroup_count,
+                                       const size_type *row_group_indices,
+                                       cudaStream_t stream)
+{
+  table_metadata out_metadata;
+
+  // Row ranges cannot be combined with a filter, as the rows a range refers to would depend on it
+  CUDF_EXPECTS(_filter.empty() || (skip_rows == 0 && num_rows == -1),
+               "Cannot read a range of rows with a filter");
+
+  // Select only row groups required
+  auto selected_row_groups = _metadata->select_row_groups(
+    row_group, max_rowgroup_count, row_group_indices, skip_rows, num_rows);
+
+  // Skip row groups in which no row can satisfy the filter, before reading any column data
+  if (!_filter.empty()) {
+    num_rows  = filter_row_groups(selected_row_groups, out_metadata);
+    skip_rows = 0;
+  }
+
+  // Get a list of column data types
+  const auto column_types = get_column_types();
+
+  // String column buffers refer to the page data until their columns are made
+  std::vector<column_buffer> out_buffers;
+  std::vector<rmm::device_buffer> page_data;
+  if (selected_row_groups.size() != 0 && column_types.size() != 0) {
+    out_buffers = allocate_output_buffers(column_types, num_rows, stream);
+    std::vector<int> column_map(column_types.size());
+    std::iota(column_map.begin(), column_map.end(), 0);
+
+    page_data = decode_row_groups(
+      selected_row_groups, skip_rows, num_rows, column_types, column_map, 0, out_buffers, stream);
+  }
+
+  return make_table(column_types, num_rows, out_buffers, std::move(out_metadata), stream);
+}
+
+bool reader::impl::row_group_has_offset_index(size_type row_group) const
+{
+  const auto &rg = _metadata->row_groups[row_group];
+  return std::all_of(_selected_columns.cbegin(), _selected_columns.cend(), [&](const auto &col) {
+    const auto &chunk = rg.columns[col.first];
+    OffsetIndex offset_index;
+    return _metadata->schema[chunk.schema_idx].max_repetition_level == 0 &&
+           _metadata->read_offset_index(_source.get(), row_group, chunk, &offset_index);
+  });
+}
+
+void reader::impl::read_chunked_begin(size_t chunk_read_limit,
+                                      size_t pass_read_limit,
+                                      cudaStream_t stream)
+{
+  // A pending read refers to the previous chunks
+  if (_next_read.valid()) { _next_read.wait(); }
+  _next_read = {};
+  _chunks.clear();
+  _next_chunk = 0;
+  _pass.reset();
+  _pass_row_group    = -1;
+  _filtered_metadata = table_metadata{};
+  _chunked_stream    = stream;
+
+  const auto column_types = get_column_types();
+  const auto exceeds      = [](size_t size, size_t limit) { return limit != 0 && size > limit; };
+  const auto splits       = [](size_t size, size_t limit) {
+    return (limit != 0) ? (size + limit - 1) / limit : 1;
+  };
+
+  // Group consecutive row groups while they fit within the limits
+  chunk_rows group;
+  size_t group_output_size = 0;
+  size_t group_decomp_size = 0;
+  auto flush_group         = [&]() {
+    if (!group.row_groups.empty()) { _chunks.push_back(std::move(group)); }
+    group             = chunk_rows{};
+    group_output_size = 0;
+    group_decomp_size = 0;
+  };
+
+  for (size_type rg = 0; rg < _metadata->get_num_row_groups(); ++rg) {
+    const auto &row_group = _metadata->row_groups[rg];
+    if (!_filter.empty() && !row_group_might_match(rg)) {
+      _filtered_metadata.num_filtered_row_groups++;
+      _filtered_metadata.num_filtered_rows += row_group.num_rows;
+      for (const auto &col : _selected_columns) {
+        const auto &col_meta = row_group.columns[col.first].meta_data;
+        _filtered_metadata.num_filtered_bytes += col_meta.total_compressed_size;
+      }
+      continue;
+    }
+
+    size_t output_size, decomp_size;
+    std::tie(output_size, decomp_size) = estimate_row_group_size(rg, column_types);
+    if (exceeds(output_size, chunk_read_limit) || exceeds(decomp_size, pass_read_limit)) {
+      // Split the row group into ranges of rows. The pages of the row group are decompressed
+      // once for all its ranges, unless they don't fit within the pass limit: then each range
+      // only reads and decompresses the pages overlapping it, located with the offset index
+      const bool skip_pages = exceeds(decomp_size, pass_read_limit);
+      CUDF_EXPECTS(!skip_pages || row_group_has_offset_index(rg),
+                   "Decompressed row group exceeds the pass read limit and has no offset index "
+                   "to read it in parts");
+      flush_group();
+      const size_type num_rows   = row_group.num_rows;
+      const size_type num_splits = static_cast<size_type>(
+        std::min<size_t>(std::max(splits(output_size, chunk_read_limit),
+                                  splits(decomp_size, pass_read_limit)),
+                         std::max(num_rows, 1)));
+      const size_type split_rows = (num_rows + num_splits - 1) / num_splits;
+      for (size_type row = 0; row < num_rows; row += split_rows) {
+        chunk_rows range;
+        range.row_group  = rg;
+        range.row_offset = row;
+        range.num_rows   = std::min(split_rows, num_rows - row);
+        range.skip_pages = skip_pages;
+        _chunks.push_back(std::move(range));
+      }
+      continue;
+    }
+    if (exceeds(group_output_size + output_size, chunk_read_limit) ||
+        exceeds(group_decomp_size + decomp_size, pass_read_limit)) {
+      flush_group();
+    }
+    group.row_groups.push_back(rg);
+    group_output_size += output_size;
+    group_decomp_size += decomp_size;
+  }
+  flush_group();
+
+  // Always return at least one, possibly empty, table with the selected columns
+  if (_chunks.empty()) { _chunks.emplace_back(); }
+}
+
+table_with_metadata reader::impl::read_chunk_rows(const chunk_rows &rows, cudaStream_t stream)
+{
+  // The filter was applied when the row groups of the chunks were selected
+  const auto column_types = get_column_types();
+  std::vector<int> column_map(column_types.size());
+  std::iota(column_map.begin(), column_map.end(), 0);
+
+  // String column buffers refer to the page data until their columns are made
+  std::vector<column_buffer> out_buffers;
+  std::vector<rmm::device_buffer> page_data;
+  size_type num_rows = 0;
+  bool release_pass  = false;
+  if (column_types.empty()) {
+    // No column selected: returns an empty table
+  } else if (!rows.row_groups.empty()) {
+    std::vector<std::pair<size_type, size_t>> row_groups;
+    for (const auto rg : rows.row_groups) {
+      row_groups.emplace_back(rg, num_rows);
+      num_rows += _metadata->row_groups[rg].num_rows;
+    }
+    out_buffers = allocate_output_buffers(column_types, num_rows, stream);
+    page_data   = decode_row_groups(
+      row_groups, 0, num_rows, column_types, column_map, 0, out_buffers, stream);
+  } else if (rows.num_rows != 0) {
+    // Ranges of rows are relative to the start of their row group
+    const std::vector<std::pair<size_type, size_t>> row_group{{rows.row_group, 0}};
+    num_rows    = rows.num_rows;
+    out_buffers = allocate_output_buffers(column_types, num_rows, stream);
+    if (rows.skip_pages) {
+      page_data = decode_row_groups(
+        row_group, rows.row_offset, num_rows, column_types, column_map, 0, out_buffers, stream);
+    } else {
+      const size_type row_group_rows = _metadata->row_groups[rows.row_group].num_rows;
+      if (_pass_row_group != rows.row_group) {
+        _pass.reset();
+        _pass = load_row_group_pages(
+          row_group, 0, row_group_rows, column_types, column_map, 0, stream);
+        _pass_row_group = rows.row_group;
+      }
+      decode_row_group_pages(*_pass, rows.row_offset, num_rows, out_buffers, stream);
+      release_pass = (rows.row_offset + num_rows >= row_group_rows);
+    }
+  }
+
+  auto result = make_table(column_types, num_rows, out_buffers, table_metadata{}, stream);
+
+  // Release the pages of a row group once its last range is decoded
+  if (release_pass) {
+    _pass.reset();
+    _pass_row_group = -1;
+  }
+  return result;
+}
+
+std::future<table_with_metadata> reader::impl::read_chunk_async(const chunk_rows &rows)
+{
+  // The worker thread starts on the default device, so it uses the caller's device explicitly
+  int device_id = 0;
+  CUDA_TRY(cudaGetDevice(&device_id));
+  return std::async(std::launch::async, [this, &rows, device_id]() {
+    CUDA_TRY(cudaSetDevice(device_id));
+    auto result = read_chunk_rows(rows, _chunked_stream);
+    CUDA_TRY(cudaStreamSynchronize(_chunked_stream));
+    return result;
+  });
+}
+
+table_with_metadata reader::impl::read_chunk()
+{
+  CUDF_EXPECTS(has_next(), "No chunk left to read");
+  if (!_next_read.valid()) { _next_read = read_chunk_async(_chunks[_next_chunk]); }
+  auto result = _next_read.get();
+  if (_next_chunk == 0) {
+    result.metadata.num_filtered_row_groups = _filtered_metadata.num_filtered_row_groups;
+    result.metadata.num_filtered_rows       = _filtered_metadata.num_filtered_rows;
+    result.metadata.num_filtered_bytes      = _filtered_metadata.num_filtered_bytes;
+  }
+  // Read the next chunk while this one is being used
+  if (++_next_chunk < _chunks.size()) { _next_read = read_chunk_async(_chunks[_next_chunk]); }
+  return result;
+}
+
 // Forward to implementation
 reader::reader(std::string filepath,
                reader_options const &options,
                rmm::mr::device_memory_resource *mr)
-  : _impl(std::make_unique<impl>(datasource::create(filepath), options, mr))
+  : _impl(std::make_unique<impl>(
+      datasource::create(filepath, options.read_method), filepath, options, mr))
 {
 }
 
@@ -800,7 +1708,7 @@ reader::reader(const char *buffer,
                size_t length,
                reader_options const &options,
                rmm::mr::device_memory_resource *mr)
-  : _impl(std::make_unique<impl>(datasource::create(buffer, length), options, mr))
+  : _impl(std::make_unique<impl>(datasource::create(buffer, length), "", options, mr))
 {
 }
 
@@ -808,7 +1716,7 @@ reader::reader(const char *buffer,
 reader::reader(std::shared_ptr<arrow::io::RandomAccessFile> file,
                reader_options const &options,
                rmm::mr::device_memory_resource *mr)
-  : _impl(std::make_unique<impl>(datasource::create(file), options, mr))
+  : _impl(std::make_unique<impl>(datasource::create(file), "", options, mr))
 {
 }
 
@@ -843,6 +1751,20 @@ table_with_metadata reader::read_rows(size_type skip_rows, size_type num_rows, c
   return _impl->read(skip_rows, (num_rows != 0) ? num_rows : -1, -1, -1, nullptr, stream);
 }
 
+// Forward to implementation
+void reader::read_chunked_begin(size_t chunk_read_limit,
+                                size_t pass_read_limit,
+                                cudaStream_t stream)
+{
+  _impl->read_chunked_begin(chunk_read_limit, pass_read_limit, stream);
+}
+
+// Forward to implementation
+bool reader::has_next() const { return _impl->has_next(); }
+
+// Forward to implementation
+table_with_metadata reader::read_chunk() { return _impl->read_chunk(); }
+
 }  // namespace parquet
 }  // namespace detail
 }  // namespace io
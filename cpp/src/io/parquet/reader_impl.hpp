@@ -30,6 +30,8 @@
 
 #include <cudf/io/readers.hpp>
 
+#include <future>
+#include <map>
 #include <memory>
 #include <string>
 #include <utility>
@@ -54,13 +56,20 @@ class reader::impl {
    * @brief Constructor from a dataset source with reader options.
    *
    * @param source Dataset source
+   * @param filepath Path of the source, used to look up its cached footer; empty if not a file
    * @param options Settings for controlling reading behavior
    * @param mr Resource to use for device memory allocation
    */
   explicit impl(std::unique_ptr<datasource> source,
+                std::string const &filepath,
                 reader_options const &options,
                 rmm::mr::device_memory_resource *mr);
 
+  /**
+   * @brief Destructor within the translation unit that defines the file metadata
+   */
+  ~impl();
+
   /**
    * @brief Read an entire set or a subset of data and returns a set of columns
    *
@@ -80,7 +89,231 @@ class reader::impl {
                            const size_type *row_group_indices,
                            cudaStream_t stream);
 
+  /**
+   * @brief Splits the selected row groups into the ranges of rows read by `read_chunk()`
+   *
+   * Row groups that don't fit within the limits are split into ranges of rows. The page data of
+   * such a row group is read and decompressed once for all its ranges, and released after the
+   * last one. If the decompressed page data doesn't fit within `pass_read_limit`, each range
+   * reads only the pages it overlaps instead, which requires an offset index.
+   *
+   * Besides the chunk being returned, the next chunk and the page data of the row group being
+   * split are held in memory while the next chunk is read.
+   *
+   * @throw cudf::logic_error if a row group needs more than `pass_read_limit` bytes of decompressed
+   * page data and has no offset index
+   *
+   * @param chunk_read_limit Maximum size in bytes of the columns of each chunk; 0 is no limit
+   * @param pass_read_limit Maximum size in bytes of the decompressed page data; 0 is no limit
+   * @param stream Stream to use for memory allocation and kernels
+   */
+  void read_chunked_begin(size_t chunk_read_limit, size_t pass_read_limit, cudaStream_t stream);
+
+  /**
+   * @brief Returns whether there are chunks left to read with `read_chunk()`
+   */
+  bool has_next() const { return _next_chunk < _chunks.size(); }
+
+  /**
+   * @brief Returns the next chunk, and starts reading the following one in the background
+   *
+   * @return The set of columns along with metadata
+   */
+  table_with_metadata read_chunk();
+
+  /**
+   * @brief Returns the names of the selected columns
+   */
+  std::vector<std::string> get_column_names() const;
+
+  /**
+   * @brief Returns the output data type of each selected column; empty if there is no row group
+   */
+  std::vector<data_type> get_column_types() const;
+
+  /**
+   * @brief Returns whether each selected column can hold nulls
+   */
+  std::vector<bool> get_column_nullability() const;
+
+  /**
+   * @brief Returns the key-value metadata of the file
+   */
+  std::map<std::string, std::string> get_user_data() const;
+
+  /**
+   * @brief Selects all the row groups in which some rows can satisfy the filter
+   *
+   * @param out_metadata Metadata receiving the counts of row groups skipped by the filter
+   *
+   * @return Selected row groups along with their first row, and their total number of rows
+   */
+  std::pair<std::vector<std::pair<size_type, size_t>>, size_type> select_filtered_row_groups(
+    table_metadata &out_metadata) const;
+
+  /**
+   * @brief Reads and decodes the selected columns of row groups into column buffers
+   *
+   * @param row_groups Row groups to read, along with their first row
+   * @param skip_rows Number of rows to skip from the start; must be 0 if `row_offset` is not
+   * @param num_rows Number of rows to read
+   * @param column_types Output data type of each selected column
+   * @param column_map Index in `out_buffers` of each selected column
+   * @param row_offset Row of the buffers at which the first row read is decoded
+   * @param out_buffers Output columns' device buffers, of at least `row_offset + num_rows` rows
+   * @param stream Stream to use for memory allocation and kernels
+   *
+   * @return Device buffers of page data, which string column buffers refer to until their
+   * columns are made
+   */
+  std::vector<rmm::device_buffer> decode_row_groups(
+    const std::vector<std::pair<size_type, size_t>> &row_groups,
+    size_type skip_rows,
+    size_type num_rows,
+    const std::vector<data_type> &column_types,
+    const std::vector<int> &column_map,
+    size_type row_offset,
+    std::vector<column_buffer> &out_buffers,
+    cudaStream_t stream);
+
  private:
+  /**
+   * @brief Rows read as one chunk by the chunked reader: either whole row groups, or a range of
+   * rows within a single row group
+   */
+  struct chunk_rows {
+    std::vector<size_type> row_groups;  // Row groups to read, if any
+    size_type row_group  = -1;          // Row group of the range otherwise
+    size_type row_offset = 0;           // First row of the range within its row group
+    size_type num_rows   = 0;           // Number of rows of the range
+    bool skip_pages      = false;       // Whether only the pages overlapping the range are read
+  };
+
+  /**
+   * @brief Page data of column chunks, read and decompressed, ready to be decoded
+   */
+  struct row_group_pages {
+    std::unique_ptr<hostdevice_vector<gpu::ColumnChunkDesc>> chunks;
+    std::unique_ptr<hostdevice_vector<gpu::PageInfo>> pages;  // Null if there is no page
+    std::vector<gpu::PageInfo> undecoded_pages;  // Page information before the first decode
+    std::vector<int> chunk_map;                  // Index of the output buffer of each chunk
+    std::vector<rmm::device_buffer> page_data;
+  };
+
+  /**
+   * @brief Removes the row groups in which no row can satisfy the filter from a selection
+   *
+   * @param row_groups Selected row groups along with their first row, updated in place
+   * @param out_metadata Metadata receiving the counts of row groups skipped by the filter
+   *
+   * @return Number of rows of the remaining row groups
+   */
+  size_type filter_row_groups(std::vector<std::pair<size_type, size_t>> &row_groups,
+                              table_metadata &out_metadata) const;
+
+  /**
+   * @brief Returns whether some rows of a row group can satisfy the filter
+   *
+   * @param row_group Index of the row group
+   */
+  bool row_group_might_match(size_type row_group) const;
+
+  /**
+   * @brief Returns whether all selected columns of a row group have an offset index locating the
+   * pages of each range of rows
+   *
+   * @param row_group Index of the row group
+   */
+  bool row_group_has_offset_index(size_type row_group) const;
+
+  /**
+   * @brief Returns the estimated size of the selected columns of a row group once decoded, and
+   * the size of their page data once decompressed
+   *
+   * @param row_group Index of the row group
+   * @param column_types Output data type of each selected column
+   */
+  std::pair<size_t, size_t> estimate_row_group_size(
+    size_type row_group, const std::vector<data_type> &column_types) const;
+
+  /**
+   * @brief Allocates the output columns' device buffers
+   *
+   * @param column_types Output data type of each selected column
+   * @param num_rows Number of rows of the buffers
+   * @param stream Stream to use for memory allocation
+   */
+  std::vector<column_buffer> allocate_output_buffers(const std::vector<data_type> &column_types,
+                                                     size_type num_rows,
+                                                     cudaStream_t stream) const;
+
+  /**
+   * @brief Makes the output table from decoded column buffers, with the columns' metadata
+   *
+   * @param column_types Output data type of each selected column
+   * @param num_rows Number of rows of the buffers
+   * @param out_buffers Decoded column buffers; empty columns are returned if there is none
+   * @param out_metadata Metadata to return along with the columns
+   * @param stream Stream to use for memory allocation and kernels
+   */
+  table_with_metadata make_table(const std::vector<data_type> &column_types,
+                                 size_type num_rows,
+                                 std::vector<column_buffer> &out_buffers,
+                                 table_metadata &&out_metadata,
+                                 cudaStream_t stream) const;
+
+  /**
+   * @brief Reads the rows of a chunk
+   *
+   * @param rows Rows of the chunk
+   * @param stream Stream to use for memory allocation and kernels
+   */
+  table_with_metadata read_chunk_rows(const chunk_rows &rows, cudaStream_t stream);
+
+  /**
+   * @brief Starts reading the rows of a chunk in the background
+   *
+   * @param rows Rows of the chunk
+   */
+  std::future<table_with_metadata> read_chunk_async(const chunk_rows &rows);
+
+  /**
+   * @brief Reads and decompresses the pages of the selected columns of row groups
+   *
+   * @param row_groups Row groups to read, along with their first row
+   * @param skip_rows Number of rows to skip from the start; with an offset index, pages before
+   * them are not read
+   * @param num_rows Number of rows to read; with an offset index, pages after them are not read
+   * @param column_types Output data type of each selected column
+   * @param column_map Index in the output buffers of each selected column
+   * @param row_offset Row of the output buffers at which the first row read is decoded
+   * @param stream Stream to use for memory allocation and kernels
+   */
+  std::unique_ptr<row_group_pages> load_row_group_pages(
+    const std::vector<std::pair<size_type, size_t>> &row_groups,
+    size_type skip_rows,
+    size_type num_rows,
+    const std::vector<data_type> &column_types,
+    const std::vector<int> &column_map,
+    size_type row_offset,
+    cudaStream_t stream);
+
+  /**
+   * @brief Decodes a range of rows from loaded pages into column buffers; the pages can be decoded
+   * again for another range
+   *
+   * @param loaded Pages to decode
+   * @param min_row First row to decode
+   * @param total_rows Number of rows to decode
+   * @param out_buffers Output columns' device buffers
+   * @param stream Stream to use for memory allocation and kernels
+   */
+  void decode_row_group_pages(row_group_pages &loaded,
+                              size_t min_row,
+                              size_t total_rows,
+                              std::vector<column_buffer> &out_buffers,
+                              cudaStream_t stream);
+
   /**
    * @brief Reads compressed page data to device memory
    *
@@ -89,6 +322,8 @@ class reader::impl {
    * @param begin_chunk Index of first column chunk to read
    * @param end_chunk Index after the last column chunk to read
    * @param column_chunk_offsets File offset for all chunks
+   * @param dictionary_ranges File offset and size of the dictionary of chunks whose first data
+   * pages are skipped, read ahead of the chunk's data; empty for other chunks
    * @param stream Stream to use for memory allocation and kernels
    *
    */
@@ -97,6 +332,7 @@ class reader::impl {
                           size_t begin_chunk,
                           size_t end_chunk,
                           const std::vector<size_t> &column_chunk_offsets,
+                          const std::vector<std::pair<size_t, size_t>> &dictionary_ranges,
                           cudaStream_t stream);
 
   /**
@@ -133,6 +369,20 @@ class reader::impl {
                                           hostdevice_vector<gpu::PageInfo> &pages,
                                           cudaStream_t stream);
 
+  /**
+   * @brief Converts the data pages using delta or byte stream split encodings to the PLAIN
+   * encoding, updating the page information to point to the converted data.
+   *
+   * @param chunks List of column chunk descriptors
+   * @param pages List of page information
+   * @param stream Stream to use for memory allocation and kernels
+   *
+   * @return Device buffer to converted page data
+   */
+  rmm::device_buffer decode_to_plain_pages(hostdevice_vector<gpu::ColumnChunkDesc> &chunks,
+                                           hostdevice_vector<gpu::PageInfo> &pages,
+                                           cudaStream_t stream);
+
   /**
    * @brief Converts the page data and outputs to columns.
    *
@@ -160,6 +410,18 @@ class reader::impl {
   std::vector<std::pair<int, std::string>> _selected_columns;
   bool _strings_to_categorical = false;
   data_type _timestamp_type{type_id::EMPTY};
+  filter_expression _filter;
+  size_t _host_decompression_threshold = 0;
+
+  // Chunked reading state; the pending read is declared last so that it completes before the
+  // state it uses is destroyed
+  std::vector<chunk_rows> _chunks;
+  size_t _next_chunk = 0;
+  table_metadata _filtered_metadata;
+  cudaStream_t _chunked_stream = 0;
+  std::unique_ptr<row_group_pages> _pass;  // Pages of the row group whose ranges are being read
+  size_type _pass_row_group = -1;
+  std::future<table_with_metadata> _next_read;
 };
 
 }  // namespace parquet
@@ -21,6 +21,9 @@
 
 #include "writer_impl.hpp"
 
+#include <io/comp/cpu_comp.h>
+#include <io/comp/io_uncomp.h>
+
 #include <cudf/null_mask.hpp>
 #include <cudf/strings/strings_column_view.hpp>
 
@@ -53,6 +56,11 @@ parquet::Compression to_parquet_compression(compression_type compression)
   switch (compression) {
     case compression_type::AUTO:
     case compression_type::SNAPPY: return parquet::Compression::SNAPPY;
+    case compression_type::ZSTD:
+      CUDF_EXPECTS(is_host_compression_supported(IO_UNCOMP_STREAM_TYPE_ZSTD),
+                   "ZSTD compression is not available in this build");
+      return parquet::Compression::ZSTD;
+    case compression_type::LZ4: return parquet::Compression::LZ4;
     case compression_type::NONE: return parquet::Compression::UNCOMPRESSED;
     default:
       CUDF_EXPECTS(false, "Unsupported compression type");
@@ -60,6 +68,37 @@ parquet::Compression to_parquet_compression(compression_type compression)
   }
 }
 
+/**
+ * @brief Function that translates GDF column encoding to the parquet encoding of data pages that
+ * are not dictionary-encoded
+ **/
+parquet::Encoding to_parquet_encoding(column_encoding encoding, parquet::Type physical_type)
+{
+  switch (encoding) {
+    case column_encoding::AUTO:
+    case column_encoding::PLAIN: return parquet::Encoding::PLAIN;
+    case column_encoding::DELTA_BINARY_PACKED:
+      CUDF_EXPECTS(physical_type == parquet::Type::INT32 || physical_type == parquet::Type::INT64,
+                   "DELTA_BINARY_PACKED encoding requires an integer column");
+      return parquet::Encoding::DELTA_BINARY_PACKED;
+    case column_encoding::DELTA_LENGTH_BYTE_ARRAY:
+      CUDF_EXPECTS(physical_type == parquet::Type::BYTE_ARRAY,
+                   "DELTA_LENGTH_BYTE_ARRAY encoding requires a string column");
+      return parquet::Encoding::DELTA_LENGTH_BYTE_ARRAY;
+    case column_encoding::DELTA_BYTE_ARRAY:
+      CUDF_EXPECTS(physical_type == parquet::Type::BYTE_ARRAY,
+                   "DELTA_BYTE_ARRAY encoding requires a string column");
+      return parquet::Encoding::DELTA_BYTE_ARRAY;
+    case column_encoding::BYTE_STREAM_SPLIT:
+      CUDF_EXPECTS(physical_type == parquet::Type::FLOAT || physical_type == parquet::Type::DOUBLE,
+                   "BYTE_STREAM_SPLIT encoding requires a floating-point column");
+      return parquet::Encoding::BYTE_STREAM_SPLIT;
+    default:
+      CUDF_EXPECTS(false, "Unsupported column encoding");
+      return parquet::Encoding::PLAIN;
+  }
+}
+
 }  // namespace
 
 /**
@@ -237,6 +276,13 @@ class parquet_column_view {
     return _dictionary_used;
   }
 
+  // DELTA_BYTE_ARRAY management
+  uint32_t *get_prefix_lengths()
+  {
+    return (_prefix_len.size()) ? _prefix_len.data().get() : nullptr;
+  }
+  void alloc_prefix_lengths(size_t max_num_rows) { _prefix_len.resize(max_num_rows); }
+
  private:
   // Identifier within set of columns
   size_t _id        = 0;
@@ -260,6 +306,9 @@ class parquet_column_view {
   rmm::device_vector<uint32_t> _dict_data;
   rmm::device_vector<uint32_t> _dict_index;
 
+  // Prefix lengths, computed by the first of the DELTA_BYTE_ARRAY passes over a page
+  rmm::device_vector<uint32_t> _prefix_len;
+
   // String-related members
   rmm::device_buffer _indexes;
 };
@@ -334,6 +383,7 @@ void writer::impl::build_chunk_dictionaries(hostdevice_vector<gpu::EncColumnChun
                                  num_columns,
                                  nullptr,
                                  nullptr,
+                                 write_v2_headers_,
                                  stream));
   CUDA_TRY(cudaMemcpyAsync(
     chunks.host_ptr(), chunks.device_ptr(), chunks.memory_size(), cudaMemcpyDeviceToHost, stream));
@@ -362,6 +412,7 @@ void writer::impl::init_encoder_pages(hostdevice_vector<gpu::EncColumnChunk> &ch
     num_columns,
     (num_stats_bfr) ? page_stats_mrg.data().get() : nullptr,
     (num_stats_bfr > num_pages) ? page_stats_mrg.data().get() + num_pages : nullptr,
+    write_v2_headers_,
     stream));
   if (num_stats_bfr > 0) {
     CUDA_TRY(MergeColumnStatistics(
@@ -396,6 +447,15 @@ void writer::impl::encode_pages(hostdevice_vector<gpu::EncColumnChunk> &chunks,
     case parquet::Compression::SNAPPY:
       CUDA_TRY(gpu_snap(comp_in, comp_out, pages_in_batch, stream));
       break;
+    // No GPU encoders for these yet; the pages are compressed on the host
+    case parquet::Compression::ZSTD:
+      CUDA_TRY(cpu_compress(IO_UNCOMP_STREAM_TYPE_ZSTD, comp_in, comp_out, pages_in_batch, stream));
+      break;
+    case parquet::Compression::LZ4:
+      // Hadoop framing, which is what other Parquet implementations expect for LZ4
+      CUDA_TRY(
+        cpu_compress(IO_UNCOMP_STREAM_TYPE_LZ4_HADOOP, comp_in, comp_out, pages_in_batch, stream));
+      break;
     default: break;
   }
   // TBD: Not clear if the official spec actually allows dynamically turning off compression at the
@@ -426,12 +486,78 @@ void writer::impl::encode_pages(hostdevice_vector<gpu::EncColumnChunk> &chunks,
   CUDA_TRY(cudaStreamSynchronize(stream));
 }
 
+void writer::impl::build_page_indexes(const gpu::EncColumnChunk &ck,
+                                      const gpu::EncPage *ck_pages,
+                                      const uint8_t *dev_bfr,
+                                      Type physical_type,
+                                      size_t chunk_offset,
+                                      OffsetIndex &offset_index,
+                                      ColumnIndex &column_index,
+                                      cudaStream_t stream)
+{
+  // Pages are stored back-to-back in the chunk, each header followed by its data
+  std::vector<std::pair<size_t, uint32_t>> page_headers;
+  size_t bfr_pos = ck.ck_stat_size;
+  for (uint32_t p = 0; p < ck.num_pages; p++) {
+    const auto &page       = ck_pages[p];
+    const uint32_t page_sz = page.hdr_size + page.max_data_size;
+    if (page.page_type == DATA_PAGE || page.page_type == DATA_PAGE_V2) {
+      offset_index.page_locations.push_back(
+        {static_cast<int64_t>(chunk_offset + bfr_pos - ck.ck_stat_size),
+         static_cast<int32_t>(page_sz),
+         static_cast<int64_t>(page.start_row - ck.start_row)});
+      page_headers.emplace_back(bfr_pos, page.hdr_size);
+    }
+    bfr_pos += page_sz;
+  }
+  if (stats_granularity_ != statistics_freq::STATISTICS_PAGE || page_headers.empty()) { return; }
+
+  // Page-level statistics are only available encoded in the page headers
+  size_t headers_size = 0;
+  for (const auto &hdr : page_headers) { headers_size += hdr.second; }
+  std::vector<uint8_t> headers(headers_size);
+  for (size_t p = 0, pos = 0; p < page_headers.size(); pos += page_headers[p++].second) {
+    CUDA_TRY(cudaMemcpyAsync(headers.data() + pos,
+                             dev_bfr + page_headers[p].first,
+                             page_headers[p].second,
+                             cudaMemcpyDeviceToHost,
+                             stream));
+  }
+  CUDA_TRY(cudaStreamSynchronize(stream));
+
+  ColumnIndex index;
+  const uint8_t *hdr_data = headers.data();
+  for (uint32_t p = 0, data_page = 0; p < ck.num_pages; p++) {
+    if (ck_pages[p].page_type == DICTIONARY_PAGE) { continue; }
+    const auto hdr_size = page_headers[data_page++].second;
+    PageHeader hdr;
+    CompactProtocolReader cp(hdr_data, hdr_size);
+    hdr_data += hdr_size;
+    if (!cp.read(&hdr)) { return; }
+    const auto &stats = (hdr.type == DATA_PAGE_V2) ? hdr.data_page_header_v2.statistics
+                                                   : hdr.data_page_header.statistics;
+    if (stats.null_count < 0) { return; }
+    const bool has_min_max =
+      physical_type == BYTE_ARRAY || !stats.min_value.empty() || !stats.max_value.empty();
+    const bool null_page = stats.null_count == static_cast<int64_t>(ck_pages[p].num_rows);
+    // Every page that isn't all nulls must have a min and a max value
+    if (!null_page && !has_min_max) { return; }
+    index.null_pages.push_back(null_page);
+    index.min_values.push_back(null_page ? std::string() : stats.min_value);
+    index.max_values.push_back(null_page ? std::string() : stats.max_value);
+    index.null_counts.push_back(stats.null_count);
+  }
+  column_index = std::move(index);
+}
+
 writer::impl::impl(std::unique_ptr<data_sink> sink,
                    writer_options const &options,
                    rmm::mr::device_memory_resource *mr)
   : _mr(mr),
     compression_(to_parquet_compression(options.compression)),
     stats_granularity_(options.stats_granularity),
+    column_encodings_(options.column_encodings),
+    write_v2_headers_(options.write_v2_headers),
     out_sink_(std::move(sink))
 {
 }
@@ -548,6 +674,8 @@ void writer::impl::write_chunked(table_view const &table, pq_chunked_state &stat
 
   // Initialize column description
   hostdevice_vector<gpu::EncColumnDesc> col_desc(num_columns);
+  std::vector<column_encoding> column_encodings(column_encodings_);
+  column_encodings.resize(num_columns, column_encoding::AUTO);
 
   // setup gpu column description.
   // applicable to only this _write_chunked() call
@@ -559,7 +687,10 @@ void writer::impl::write_chunked(table_view const &table, pq_chunked_state &stat
     desc->valid_map_base   = col.nulls();
     desc->stats_dtype      = col.stats_type();
     desc->ts_scale         = col.ts_scale();
-    if (state.md.schema[1 + i].type != BOOLEAN && state.md.schema[1 + i].type != UNDEFINED_TYPE) {
+    desc->encoding         = to_parquet_encoding(column_encodings[i], state.md.schema[1 + i].type);
+    // Dictionary encoding is only considered for columns without a requested encoding
+    if (column_encodings[i] == column_encoding::AUTO && state.md.schema[1 + i].type != BOOLEAN &&
+        state.md.schema[1 + i].type != UNDEFINED_TYPE) {
       col.alloc_dictionary(num_rows);
       desc->dict_index = col.get_dict_index();
       desc->dict_data  = col.get_dict_data();
@@ -567,6 +698,8 @@ void writer::impl::write_chunked(table_view const &table, pq_chunked_state &stat
       desc->dict_data  = nullptr;
       desc->dict_index = nullptr;
     }
+    if (desc->encoding == Encoding::DELTA_BYTE_ARRAY) { col.alloc_prefix_lengths(num_rows); }
+    desc->prefix_len     = col.get_prefix_lengths();
     desc->num_rows       = col.data_count();
     desc->physical_type  = static_cast<uint8_t>(state.md.schema[1 + i].type);
     desc->converted_type = static_cast<uint8_t>(state.md.schema[1 + i].converted_type);
@@ -616,6 +749,9 @@ void writer::impl::write_chunked(table_view const &table, pq_chunked_state &stat
     }
   }
 
+  state.offset_indexes.resize(state.md.row_groups.size(), std::vector<OffsetIndex>(num_columns));
+  state.column_indexes.resize(state.md.row_groups.size(), std::vector<ColumnIndex>(num_columns));
+
   // Allocate column chunks and gather fragment statistics
   rmm::device_vector<statistics_chunk> frag_stats;
   if (stats_granularity_ != statistics_freq::STATISTICS_NONE) {
@@ -680,7 +816,8 @@ void writer::impl::write_chunked(table_view const &table, pq_chunked_state &stat
       }
       ck->has_dictionary                                           = dict_enable;
       state.md.row_groups[global_r].columns[i].meta_data.type      = state.md.schema[1 + i].type;
-      state.md.row_groups[global_r].columns[i].meta_data.encodings = {PLAIN, RLE};
+      state.md.row_groups[global_r].columns[i].meta_data.encodings = {
+        static_cast<Encoding>(col_desc[i].encoding), RLE};
       if (dict_enable) {
         state.md.row_groups[global_r].columns[i].meta_data.encodings.push_back(PLAIN_DICTIONARY);
       }
@@ -819,6 +956,14 @@ void writer::impl::write_chunked(table_view const &table, pq_chunked_state &stat
       (stats_granularity_ != statistics_freq::STATISTICS_NONE) ? page_stats.data().get() + num_pages
                                                                : nullptr,
       state.stream);
+    // Page sizes and row ranges, needed for the page indexes
+    std::vector<gpu::EncPage> batch_pages(pages_in_batch);
+    CUDA_TRY(cudaMemcpyAsync(batch_pages.data(),
+                             pages.data().get() + first_page_in_batch,
+                             pages_in_batch * sizeof(gpu::EncPage),
+                             cudaMemcpyDeviceToHost,
+                             state.stream));
+    CUDA_TRY(cudaStreamSynchronize(state.stream));
     for (; r < rnext; r++, global_r++) {
       for (auto i = 0; i < num_columns; i++) {
         gpu::EncColumnChunk *ck = &chunks[r * num_columns + i];
@@ -862,6 +1007,14 @@ void writer::impl::write_chunked(table_view const &table, pq_chunked_state &stat
                    ck->ck_stat_size);
           }
         }
+        build_page_indexes(*ck,
+                           &batch_pages[ck->first_page - first_page_in_batch],
+                           dev_bfr,
+                           state.md.schema[1 + i].type,
+                           state.current_chunk_offset,
+                           state.offset_indexes[global_r][i],
+                           state.column_indexes[global_r][i],
+                           state.stream);
         state.md.row_groups[global_r].total_byte_size += ck->compressed_size;
         state.md.row_groups[global_r].columns[i].meta_data.data_page_offset =
           state.current_chunk_offset + ((ck->has_dictionary) ? ck->dictionary_size : 0);
@@ -881,6 +1034,30 @@ std::unique_ptr<std::vector<uint8_t>> writer::impl::write_chunked_end(
 {
   CompactProtocolWriter cpw(&buffer_);
   file_ender_s fendr;
+
+  // Page indexes go between the last row group and the footer, all column indexes first
+  buffer_.resize(0);
+  for (size_t r = 0; r < state.column_indexes.size(); r++) {
+    for (size_t i = 0; i < state.column_indexes[r].size(); i++) {
+      if (state.column_indexes[r][i].null_pages.empty()) { continue; }
+      auto &chunk               = state.md.row_groups[r].columns[i];
+      chunk.column_index_offset = state.current_chunk_offset + buffer_.size();
+      chunk.column_index_length = cpw.write(&state.column_indexes[r][i]);
+    }
+  }
+  for (size_t r = 0; r < state.offset_indexes.size(); r++) {
+    for (size_t i = 0; i < state.offset_indexes[r].size(); i++) {
+      if (state.offset_indexes[r][i].page_locations.empty()) { continue; }
+      auto &chunk               = state.md.row_groups[r].columns[i];
+      chunk.offset_index_offset = state.current_chunk_offset + buffer_.size();
+      chunk.offset_index_length = cpw.write(&state.offset_indexes[r][i]);
+    }
+  }
+  if (buffer_.size() != 0) {
+    out_sink_->host_write(buffer_.data(), buffer_.size());
+    state.current_chunk_offset += buffer_.size();
+  }
+
   buffer_.resize(0);
   fendr.footer_len = static_cast<uint32_t>(cpw.write(&state.md));
   fendr.magic      = PARQUET_MAGIC;
@@ -942,7 +1119,11 @@ void writer::write_chunked(table_view const &table, pq_chunked_state &state)
 }
 
 // Forward to implementation
-void writer::write_chunked_end(pq_chunked_state &state) { _impl->write_chunked_end(state); }
+std::unique_ptr<std::vector<uint8_t>> writer::write_chunked_end(
+  pq_chunked_state &state, bool return_filemetadata, const std::string &metadata_out_file_path)
+{
+  return _impl->write_chunked_end(state, return_filemetadata, metadata_out_file_path);
+}
 
 std::unique_ptr<std::vector<uint8_t>> writer::merge_rowgroup_metadata(
   const std::vector<std::unique_ptr<std::vector<uint8_t>>> &metadata_list)
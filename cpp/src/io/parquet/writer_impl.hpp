@@ -221,6 +221,26 @@ class writer::impl {
                     const statistics_chunk* page_stats,
                     const statistics_chunk* chunk_stats,
                     cudaStream_t stream);
+  /**
+   * @brief Build the page indexes of an encoded column chunk
+   *
+   * @param ck Encoded column chunk
+   * @param ck_pages Host copy of the chunk's encoder pages
+   * @param dev_bfr Device buffer holding the chunk's statistics followed by its pages
+   * @param physical_type Physical type of the column
+   * @param chunk_offset File offset of the chunk
+   * @param offset_index Offset index of the chunk
+   * @param column_index Column index of the chunk, left empty without page-level statistics
+   * @param stream Stream to use for memory allocation and kernels
+   **/
+  void build_page_indexes(const gpu::EncColumnChunk& ck,
+                          const gpu::EncPage* ck_pages,
+                          const uint8_t* dev_bfr,
+                          Type physical_type,
+                          size_t chunk_offset,
+                          OffsetIndex& offset_index,
+                          ColumnIndex& column_index,
+                          cudaStream_t stream);
 
  private:
   // TODO : figure out if we want to keep this. It is currently unused.
@@ -231,6 +251,8 @@ class writer::impl {
   size_t target_page_size_           = DEFAULT_TARGET_PAGE_SIZE;
   Compression compression_           = Compression::UNCOMPRESSED;
   statistics_freq stats_granularity_ = statistics_freq::STATISTICS_NONE;
+  std::vector<column_encoding> column_encodings_;
+  bool write_v2_headers_ = false;
 
   std::vector<uint8_t> buffer_;
   std::unique_ptr<data_sink> out_sink_;
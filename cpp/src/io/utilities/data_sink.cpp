@@ -14,38 +14,199 @@
  * limitations under the License.
  */
 
-#include <fstream>
+#include <fcntl.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <future>
+#include <mutex>
 
 #include <cudf/io/data_sink.hpp>
 #include <cudf/utilities/error.hpp>
 
+#include "thread_pool.hpp"
+
 namespace cudf {
 namespace io {
 /**
  * @brief Implementation class for storing data into a local file.
  *
+ * Writes are copied into large page-aligned buffers that are written to the file once full, so
+ * the many small writes issued by the writers (headers, index streams, footers) reach the file as
+ * a few large ones. Writes larger than a buffer are issued together with the buffered data in a
+ * single `pwritev()` call without an extra copy. With a background flusher, full buffers are
+ * written from a separate thread while the caller keeps filling the next one.
  */
 class file_sink : public data_sink {
+  static constexpr size_t buffer_size         = 4 << 20;
+  static constexpr size_t buffer_alignment    = 4096;
+  static constexpr size_t max_pending_flushes = 4;
+  using buffer_ptr = std::unique_ptr<uint8_t, decltype(&std::free)>;
+
  public:
-  explicit file_sink(std::string const& filepath)
+  explicit file_sink(std::string const& filepath, bool background_flush)
+    : current_(allocate_buffer())
   {
-    outfile_.open(filepath, std::ios::out | std::ios::binary | std::ios::trunc);
-    CUDF_EXPECTS(outfile_.is_open(), "Cannot open output file");
+    fd_ = open(filepath.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0666);
+    CUDF_EXPECTS(fd_ != -1, "Cannot open output file");
+    if (background_flush) { flusher_ = std::make_unique<detail::thread_pool>(1); }
   }
 
-  virtual ~file_sink() { flush(); }
+  virtual ~file_sink()
+  {
+    try {
+      flush();
+    } catch (...) {
+      // Destructors must not throw; callers that care about errors call flush() explicitly
+    }
+    flusher_.reset();
+    close(fd_);
+  }
 
   void host_write(void const* data, size_t size) override
   {
-    outfile_.write(reinterpret_cast<char const*>(data), size);
+    auto src = static_cast<uint8_t const*>(data);
+    bytes_written_ += size;
+
+    if (flusher_ == nullptr && current_size_ + size >= buffer_size) {
+      // Write the buffered data and the new data with one call, without copying the latter
+      iovec iov[2] = {{current_.get(), current_size_}, {const_cast<uint8_t*>(src), size}};
+      write_vectored(iov, 2, file_offset_);
+      file_offset_ += current_size_ + size;
+      current_size_ = 0;
+      return;
+    }
+
+    while (size != 0) {
+      auto const count = std::min(size, buffer_size - current_size_);
+      std::memcpy(current_.get() + current_size_, src, count);
+      current_size_ += count;
+      src += count;
+      size -= count;
+      if (current_size_ == buffer_size) { flush_current(); }
+    }
   }
 
-  void flush() override { outfile_.flush(); }
+  void flush() override
+  {
+    flush_current();
+    while (!pending_.empty()) { retire_oldest(); }
+  }
+
+  size_t bytes_written() override { return bytes_written_; }
 
-  size_t bytes_written() override { return outfile_.tellp(); }
+  sink_flush_statistics flush_statistics() const override
+  {
+    std::lock_guard<std::mutex> lock(stats_mutex_);
+    return stats_;
+  }
 
  private:
-  std::ofstream outfile_;
+  static buffer_ptr allocate_buffer()
+  {
+    void* ptr = nullptr;
+    CUDF_EXPECTS(posix_memalign(&ptr, buffer_alignment, buffer_size) == 0,
+                 "Cannot allocate file sink buffer");
+    return buffer_ptr(static_cast<uint8_t*>(ptr), &std::free);
+  }
+
+  /**
+   * @brief Writes the given buffers at `offset`, retrying on interrupts and partial writes.
+   */
+  void write_vectored(iovec* iov, int iovcnt, size_t offset)
+  {
+    auto const start = std::chrono::steady_clock::now();
+    size_t total     = 0;
+    while (iovcnt != 0) {
+      auto const written = pwritev(fd_, iov, iovcnt, offset);
+      if (written == -1 && errno == EINTR) { continue; }
+      CUDF_EXPECTS(written > 0, "Cannot write to output file");
+      offset += written;
+      total += written;
+      // Skip the fully written buffers and advance into the partially written one
+      for (size_t remaining = written; remaining != 0;) {
+        auto const count = std::min(remaining, iov->iov_len);
+        iov->iov_base    = static_cast<uint8_t*>(iov->iov_base) + count;
+        iov->iov_len -= count;
+        remaining -= count;
+        if (iov->iov_len == 0) {
+          ++iov;
+          --iovcnt;
+        }
+      }
+      while (iovcnt != 0 && iov->iov_len == 0) {
+        ++iov;
+        --iovcnt;
+      }
+    }
+    std::chrono::duration<double, std::milli> const elapsed =
+      std::chrono::steady_clock::now() - start;
+
+    std::lock_guard<std::mutex> lock(stats_mutex_);
+    stats_.num_flushes += 1;
+    stats_.bytes_flushed += total;
+    stats_.total_latency_ms += elapsed.count();
+    stats_.max_latency_ms = std::max(stats_.max_latency_ms, elapsed.count());
+  }
+
+  /**
+   * @brief Writes out the current buffer, or hands it to the background flusher.
+   */
+  void flush_current()
+  {
+    if (current_size_ == 0) { return; }
+    if (flusher_ == nullptr) {
+      iovec iov{current_.get(), current_size_};
+      write_vectored(&iov, 1, file_offset_);
+    } else {
+      // Bound the number of buffers in flight; the caller waits on the disk beyond that
+      if (pending_.size() >= max_pending_flushes) { retire_oldest(); }
+      auto const data   = current_.get();
+      auto const size   = current_size_;
+      auto const offset = file_offset_;
+      auto result       = flusher_->submit([this, data, size, offset] {
+        iovec iov{data, size};
+        write_vectored(&iov, 1, offset);
+      });
+      pending_.emplace_back(std::move(current_), std::move(result));
+      if (free_buffers_.empty()) {
+        current_ = allocate_buffer();
+      } else {
+        current_ = std::move(free_buffers_.back());
+        free_buffers_.pop_back();
+      }
+    }
+    file_offset_ += current_size_;
+    current_size_ = 0;
+  }
+
+  /**
+   * @brief Waits for the oldest background write and recycles its buffer.
+   */
+  void retire_oldest()
+  {
+    auto pending = std::move(pending_.front());
+    pending_.pop_front();
+    free_buffers_.push_back(std::move(pending.first));
+    pending.second.get();
+  }
+
+  int fd_               = -1;
+  size_t bytes_written_ = 0;
+  size_t file_offset_   = 0;
+  buffer_ptr current_;
+  size_t current_size_ = 0;
+  std::deque<std::pair<buffer_ptr, std::future<void>>> pending_;
+  std::vector<buffer_ptr> free_buffers_;
+  std::unique_ptr<detail::thread_pool> flusher_;
+  mutable std::mutex stats_mutex_;
+  sink_flush_statistics stats_;
 };
 
 /**
@@ -120,13 +281,15 @@ class user_sink_wrapper : public data_sink {
 
   size_t bytes_written() override { return user_sink->bytes_written(); }
 
+  sink_flush_statistics flush_statistics() const override { return user_sink->flush_statistics(); }
+
  private:
   cudf::io::data_sink* const user_sink;
 };
 
-std::unique_ptr<data_sink> data_sink::create(const std::string& filepath)
+std::unique_ptr<data_sink> data_sink::create(const std::string& filepath, bool background_flush)
 {
-  return std::make_unique<file_sink>(filepath);
+  return std::make_unique<file_sink>(filepath, background_flush);
 }
 
 std::unique_ptr<data_sink> data_sink::create(std::vector<char>* buffer)
@@ -15,7 +15,9 @@
  */
 
 #include "datasource.hpp"
+#include "thread_pool.hpp"
 
+#include <errno.h>
 #include <fcntl.h>
 #include <sys/mman.h>
 #include <sys/stat.h>
@@ -24,8 +26,164 @@
 
 #include <cudf/utilities/error.hpp>
 
+#include <cuda_runtime.h>
+
+#include <mutex>
+#include <tuple>
+#include <vector>
+
 namespace cudf {
 namespace io {
+namespace {
+/**
+ * @brief Arrow buffer that keeps the allocation it points into alive
+ **/
+template <typename Owner>
+class owning_buffer : public arrow::Buffer {
+ public:
+  owning_buffer(Owner owner, const uint8_t *data, size_t size)
+    : arrow::Buffer(data, size), owner_(std::move(owner))
+  {
+  }
+
+ private:
+  Owner owner_;
+};
+
+/**
+ * @brief Pool of reusable page-aligned, pinned host buffers used for direct IO
+ *
+ * Buffers are handed out with at least the requested capacity and are returned to the pool once
+ * the last reference to them is dropped. Up to `max_cached_bytes` of idle buffers are retained.
+ **/
+class bounce_buffer_pool : public std::enable_shared_from_this<bounce_buffer_pool> {
+ public:
+  static constexpr size_t alignment   = 4096;
+  static constexpr size_t granularity = 1 << 20;
+
+  explicit bounce_buffer_pool(size_t max_cached_bytes) : max_cached_bytes_(max_cached_bytes) {}
+
+  ~bounce_buffer_pool()
+  {
+    for (auto const &block : free_blocks_) { deallocate(block.first); }
+  }
+
+  /**
+   * @brief Returns a buffer of at least `size` bytes
+   **/
+  std::shared_ptr<uint8_t> acquire(size_t size)
+  {
+    const size_t capacity =
+      std::max<size_t>(1, (size + granularity - 1) / granularity) * granularity;
+    uint8_t *data         = nullptr;
+    size_t block_size     = 0;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto best = free_blocks_.end();
+      for (auto it = free_blocks_.begin(); it != free_blocks_.end(); ++it) {
+        if (it->second >= capacity && (best == free_blocks_.end() || it->second < best->second)) {
+          best = it;
+        }
+      }
+      if (best != free_blocks_.end()) {
+        std::tie(data, block_size) = *best;
+        cached_bytes_ -= block_size;
+        free_blocks_.erase(best);
+      }
+    }
+    if (data == nullptr) {
+      void *ptr = nullptr;
+      CUDF_EXPECTS(posix_memalign(&ptr, alignment, capacity) == 0, "Cannot allocate IO buffer");
+      if (cudaHostRegister(ptr, capacity, cudaHostRegisterDefault) != cudaSuccess) {
+        free(ptr);
+        CUDF_FAIL("Cannot pin IO buffer");
+      }
+      data       = static_cast<uint8_t *>(ptr);
+      block_size = capacity;
+    }
+    auto self = shared_from_this();
+    return std::shared_ptr<uint8_t>(
+      data, [self, block_size](uint8_t *data) { self->release(data, block_size); });
+  }
+
+ private:
+  void release(uint8_t *data, size_t size)
+  {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (cached_bytes_ + size <= max_cached_bytes_) {
+        free_blocks_.emplace_back(data, size);
+        cached_bytes_ += size;
+        return;
+      }
+    }
+    deallocate(data);
+  }
+
+  static void deallocate(uint8_t *data)
+  {
+    cudaHostUnregister(data);
+    free(data);
+  }
+
+  const size_t max_cached_bytes_;
+  size_t cached_bytes_ = 0;
+  std::vector<std::pair<uint8_t *, size_t>> free_blocks_;
+  std::mutex mutex_;
+};
+
+/**
+ * @brief Returns the process-wide pool of bounce buffers, so that they're reused across readers
+ **/
+std::shared_ptr<bounce_buffer_pool> get_bounce_buffer_pool()
+{
+  static auto pool = std::make_shared<bounce_buffer_pool>(size_t{256} << 20);
+  return pool;
+}
+
+/**
+ * @brief Reads up to `size` bytes starting at `offset`, retrying on short reads
+ *
+ * @return Number of bytes read; less than `size` only if the end of the file is reached
+ **/
+size_t pread_fully(int fd, uint8_t *dst, size_t size, size_t offset)
+{
+  size_t total = 0;
+  while (total < size) {
+    const auto bytes = pread(fd, dst + total, size - total, offset + total);
+    if (bytes == -1 && errno == EINTR) { continue; }
+    CUDF_EXPECTS(bytes != -1, "Cannot read file data");
+    if (bytes == 0) { break; }
+    total += bytes;
+  }
+  return total;
+}
+
+struct file_wrapper {
+  int fd = -1;
+  explicit file_wrapper(const char *filepath, int flags = O_RDONLY) : fd(open(filepath, flags))
+  {
+    // Some file systems (e.g. tmpfs) do not support direct IO; use regular reads there
+    if (fd == -1 && (flags & O_DIRECT) && errno == EINVAL) {
+      fd = open(filepath, flags & ~O_DIRECT);
+    }
+  }
+  ~file_wrapper()
+  {
+    if (fd != -1) { close(fd); }
+  }
+
+  size_t size() const
+  {
+    struct stat st {
+    };
+    CUDF_EXPECTS(fstat(fd, &st) != -1, "Cannot query file size");
+    return static_cast<size_t>(st.st_size);
+  }
+};
+
+}  // namespace
+
 /**
  * @brief Implementation class for reading from an Apache Arrow file. The file
  * could be a memory-mapped file or other implementation supported by Arrow.
@@ -58,30 +216,27 @@ class arrow_io_source : public datasource {
  *
  * Unlike Arrow's memory mapped IO class, this implementation allows memory
  * mapping a subset of the file where the starting offset may not be zero.
+ * Asynchronous requests are prefetched by a small pool of read-ahead threads.
  **/
 class memory_mapped_source : public datasource {
-  struct file_wrapper {
-    const int fd = -1;
-    explicit file_wrapper(const char *filepath) : fd(open(filepath, O_RDONLY)) {}
-    ~file_wrapper() { close(fd); }
-  };
-
  public:
-  explicit memory_mapped_source(const char *filepath, size_t offset, size_t size)
+  explicit memory_mapped_source(const char *filepath,
+                                size_t offset,
+                                size_t size,
+                                size_t read_ahead_depth)
+    : file_(filepath),
+      read_ahead_(std::make_unique<detail::thread_pool>(read_ahead_depth, read_ahead_depth))
   {
-    auto file = file_wrapper(filepath);
-    CUDF_EXPECTS(file.fd != -1, "Cannot open file");
-
-    struct stat st {
-    };
-    CUDF_EXPECTS(fstat(file.fd, &st) != -1, "Cannot query file size");
-    file_size_ = static_cast<size_t>(st.st_size);
+    CUDF_EXPECTS(file_.fd != -1, "Cannot open file");
 
-    if (file_size_ != 0) { map(file.fd, offset, size); }
+    file_size_ = file_.size();
+    if (file_size_ != 0) { map(file_.fd, offset, size); }
   }
 
   virtual ~memory_mapped_source()
   {
+    // Outstanding read-ahead requests reference the mapping
+    read_ahead_.reset();
     if (map_addr_ != nullptr) { munmap(map_addr_, map_size_); }
   }
 
@@ -94,6 +249,28 @@ class memory_mapped_source : public datasource {
     return arrow::Buffer::Wrap(static_cast<uint8_t *>(map_addr_) + (offset - map_offset_), size);
   }
 
+  std::future<std::shared_ptr<arrow::Buffer>> get_buffer_async(size_t offset, size_t size) override
+  {
+    auto buffer = get_buffer(offset, size);
+    if (buffer->size() == 0) { return datasource::get_buffer_async(offset, 0); }
+
+    // Let the kernel start reading the range into the page cache right away; the worker then
+    // faults in the mapping so that the caller doesn't block on page faults when consuming it
+    posix_fadvise(file_.fd, offset, buffer->size(), POSIX_FADV_WILLNEED);
+    return read_ahead_->submit([buffer]() {
+      const size_t page_size = sysconf(_SC_PAGESIZE);
+      const auto data        = buffer->data();
+      const auto aligned     = reinterpret_cast<uintptr_t>(data) & ~(page_size - 1);
+      madvise(reinterpret_cast<void *>(aligned),
+              buffer->size() + (reinterpret_cast<uintptr_t>(data) - aligned),
+              MADV_WILLNEED);
+      for (size_t pos = 0; pos < static_cast<size_t>(buffer->size()); pos += page_size) {
+        static_cast<void>(*static_cast<volatile const uint8_t *>(data + pos));
+      }
+      return buffer;
+    });
+  }
+
   size_t size() const override { return file_size_; }
 
  private:
@@ -121,18 +298,107 @@ class memory_mapped_source : public datasource {
   }
 
  private:
+  file_wrapper file_;
   size_t file_size_  = 0;
   void *map_addr_    = nullptr;
   size_t map_size_   = 0;
   size_t map_offset_ = 0;
+  std::unique_ptr<detail::thread_pool> read_ahead_;
+};
+
+/**
+ * @brief Implementation class for reading from a file with `pread()` calls.
+ *
+ * With direct IO, reads bypass the page cache: the requested range is widened to the required
+ * alignment and read into a pinned bounce buffer, which is returned without any further copy so
+ * that it can be transferred to device memory directly.
+ **/
+class file_source : public datasource {
+ public:
+  explicit file_source(const char *filepath, bool direct_io, size_t read_ahead_depth)
+    : file_(filepath, direct_io ? (O_RDONLY | O_DIRECT) : O_RDONLY),
+      direct_io_(direct_io),
+      read_ahead_(std::make_unique<detail::thread_pool>(read_ahead_depth, read_ahead_depth))
+  {
+    CUDF_EXPECTS(file_.fd != -1, "Cannot open file");
+    file_size_ = file_.size();
+    if (direct_io_) { bounce_buffers_ = get_bounce_buffer_pool(); }
+  }
+
+  virtual ~file_source()
+  {
+    // Outstanding read-ahead requests reference the file
+    read_ahead_.reset();
+  }
+
+  const std::shared_ptr<arrow::Buffer> get_buffer(size_t offset, size_t size) override
+  {
+    return read(offset, size);
+  }
+
+  std::future<std::shared_ptr<arrow::Buffer>> get_buffer_async(size_t offset, size_t size) override
+  {
+    return read_ahead_->submit([this, offset, size]() { return read(offset, size); });
+  }
+
+  size_t size() const override { return file_size_; }
+
+ private:
+  std::shared_ptr<arrow::Buffer> read(size_t offset, size_t size)
+  {
+    CUDF_EXPECTS(offset <= file_size_, "Offset is past end of file");
+    size = std::min(size, file_size_ - offset);
+
+    if (direct_io_) {
+      constexpr auto alignment  = bounce_buffer_pool::alignment;
+      const auto aligned_offset = offset & ~(alignment - 1);
+      const auto aligned_size =
+        ((offset + size + alignment - 1) & ~(alignment - 1)) - aligned_offset;
+      auto block       = bounce_buffers_->acquire(aligned_size);
+      const auto bytes = pread_fully(file_.fd, block.get(), aligned_size, aligned_offset);
+      CUDF_EXPECTS(bytes >= (offset - aligned_offset) + size, "Cannot read file data");
+      const auto data = block.get() + (offset - aligned_offset);
+      return std::make_shared<owning_buffer<std::shared_ptr<uint8_t>>>(
+        std::move(block), data, size);
+    } else {
+      auto block       = std::unique_ptr<uint8_t[]>(new uint8_t[std::max<size_t>(size, 1)]);
+      const auto bytes = pread_fully(file_.fd, block.get(), size, offset);
+      const auto data  = block.get();
+      return std::make_shared<owning_buffer<std::unique_ptr<uint8_t[]>>>(
+        std::move(block), data, bytes);
+    }
+  }
+
+ private:
+  file_wrapper file_;
+  size_t file_size_ = 0;
+  const bool direct_io_;
+  std::shared_ptr<bounce_buffer_pool> bounce_buffers_;
+  std::unique_ptr<detail::thread_pool> read_ahead_;
 };
 
 std::unique_ptr<datasource> datasource::create(const std::string filepath,
                                                size_t offset,
-                                               size_t size)
+                                               size_t size,
+                                               size_t read_ahead_depth)
 {
   // Use our own memory mapping implementation for direct file reads
-  return std::make_unique<memory_mapped_source>(filepath.c_str(), offset, size);
+  return std::make_unique<memory_mapped_source>(
+    filepath.c_str(), offset, size, std::max<size_t>(read_ahead_depth, 1));
+}
+
+std::unique_ptr<datasource> datasource::create(const std::string filepath,
+                                               file_read_method method,
+                                               size_t read_ahead_depth)
+{
+  read_ahead_depth = std::max<size_t>(read_ahead_depth, 1);
+  switch (method) {
+    case file_read_method::PREAD:
+      return std::make_unique<file_source>(filepath.c_str(), false, read_ahead_depth);
+    case file_read_method::DIRECT:
+      return std::make_unique<file_source>(filepath.c_str(), true, read_ahead_depth);
+    default: return create(filepath, 0, 0, read_ahead_depth);
+  }
 }
 
 std::unique_ptr<datasource> datasource::create(const char *data, size_t length)
@@ -21,7 +21,10 @@
 #include <arrow/io/interfaces.h>
 #include <arrow/io/memory.h>
 
+#include <cudf/io/types.hpp>
+
 #include <algorithm>
+#include <future>
 #include <memory>
 #include <string>
 
@@ -32,16 +35,32 @@ namespace io {
  **/
 class datasource {
  public:
+  /// Default number of concurrent read-ahead requests for file sources
+  static constexpr size_t default_read_ahead_depth = 4;
+
   /**
    * @brief Create a source from a file path
    *
    * @param[in] filepath Path to the file to use
    * @param[in] offset Bytes from the start of the file
    * @param[in] size Bytes from the offset; use zero for entire file
+   * @param[in] read_ahead_depth Max number of in-flight `get_buffer_async` reads
+   **/
+  static std::unique_ptr<datasource> create(const std::string filepath,
+                                            size_t offset           = 0,
+                                            size_t size             = 0,
+                                            size_t read_ahead_depth = default_read_ahead_depth);
+
+  /**
+   * @brief Create a source from a file path, using the given method for reading
+   *
+   * @param[in] filepath Path to the file to use
+   * @param[in] method Whether to memory map the file, use buffered reads, or use direct IO
+   * @param[in] read_ahead_depth Max number of in-flight `get_buffer_async` reads
    **/
   static std::unique_ptr<datasource> create(const std::string filepath,
-                                            size_t offset = 0,
-                                            size_t size   = 0);
+                                            file_read_method method,
+                                            size_t read_ahead_depth = default_read_ahead_depth);
 
   /**
    * @brief Create a source from a memory buffer
@@ -72,6 +91,25 @@ class datasource {
    **/
   virtual const std::shared_ptr<arrow::Buffer> get_buffer(size_t offset, size_t size) = 0;
 
+  /**
+   * @brief Starts reading a subset of data from the source without waiting for it
+   *
+   * Callers are expected to issue all the requests they know about up front and only then wait
+   * on the returned futures, so that the IO for each request can overlap with the others and
+   * with any host-side work done in between. The default implementation reads synchronously.
+   *
+   * @param[in] offset Bytes from the start
+   * @param[in] size Bytes to read
+   *
+   * @return std::future<std::shared_ptr<arrow::Buffer>> The data buffer, once available
+   **/
+  virtual std::future<std::shared_ptr<arrow::Buffer>> get_buffer_async(size_t offset, size_t size)
+  {
+    std::promise<std::shared_ptr<arrow::Buffer>> result;
+    result.set_value(get_buffer(offset, size));
+    return result.get_future();
+  }
+
   /**
    * @brief Returns the size of the data in the source
    *
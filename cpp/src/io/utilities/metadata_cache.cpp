@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "metadata_cache.hpp"
+
+#include <sys/stat.h>
+
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+
+namespace cudf {
+namespace io {
+/**
+ * @brief Implementation of the footer cache, as a list in least recently used order indexed by key
+ */
+class metadata_cache::impl {
+  struct entry {
+    std::string key;
+    std::shared_ptr<void const> value;
+    size_t size;
+  };
+
+ public:
+  explicit impl(size_t max_bytes) : max_bytes_(max_bytes) {}
+
+  std::shared_ptr<void const> find(std::string const &key)
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto const it = index_.find(key);
+    if (it == index_.end()) {
+      misses_++;
+      return nullptr;
+    }
+    hits_++;
+    entries_.splice(entries_.begin(), entries_, it->second);
+    return it->second->value;
+  }
+
+  void insert(std::string const &key, std::shared_ptr<void const> value, size_t size)
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto const it = index_.find(key);
+    if (it != index_.end()) { erase(it->second); }
+    if (size > max_bytes_) { return; }
+    while (size_bytes_ + size > max_bytes_) { erase(std::prev(entries_.end())); }
+    entries_.push_front(entry{key, std::move(value), size});
+    index_[key] = entries_.begin();
+    size_bytes_ += size;
+  }
+
+  void clear()
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    entries_.clear();
+    index_.clear();
+    size_bytes_ = 0;
+  }
+
+  size_t hits() const
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return hits_;
+  }
+
+  size_t misses() const
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return misses_;
+  }
+
+  size_t num_entries() const
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return entries_.size();
+  }
+
+  size_t size_bytes() const
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return size_bytes_;
+  }
+
+  size_t max_bytes() const { return max_bytes_; }
+
+ private:
+  void erase(std::list<entry>::iterator it)
+  {
+    size_bytes_ -= it->size;
+    index_.erase(it->key);
+    entries_.erase(it);
+  }
+
+  const size_t max_bytes_;
+  size_t size_bytes_ = 0;
+  size_t hits_       = 0;
+  size_t misses_     = 0;
+  std::list<entry> entries_;
+  std::unordered_map<std::string, std::list<entry>::iterator> index_;
+  mutable std::mutex mutex_;
+};
+
+metadata_cache::metadata_cache(size_t max_bytes) : _impl(std::make_unique<impl>(max_bytes)) {}
+
+metadata_cache::~metadata_cache() = default;
+
+std::shared_ptr<void const> metadata_cache::find(std::string const &key)
+{
+  return _impl->find(key);
+}
+
+void metadata_cache::insert(std::string const &key, std::shared_ptr<void const> value, size_t size)
+{
+  _impl->insert(key, std::move(value), size);
+}
+
+void metadata_cache::clear() { _impl->clear(); }
+
+size_t metadata_cache::hits() const { return _impl->hits(); }
+
+size_t metadata_cache::misses() const { return _impl->misses(); }
+
+size_t metadata_cache::num_entries() const { return _impl->num_entries(); }
+
+size_t metadata_cache::size_bytes() const { return _impl->size_bytes(); }
+
+size_t metadata_cache::max_bytes() const { return _impl->max_bytes(); }
+
+namespace detail {
+std::string metadata_cache_key(std::string const &format, std::string const &filepath)
+{
+  struct stat st;
+  if (filepath.empty() || stat(filepath.c_str(), &st) != 0) { return {}; }
+  return format + '\n' + filepath + '\n' + std::to_string(st.st_size) + '\n' +
+         std::to_string(st.st_mtim.tv_sec) + '.' + std::to_string(st.st_mtim.tv_nsec);
+}
+
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
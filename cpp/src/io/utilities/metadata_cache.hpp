@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file metadata_cache.hpp
+ * @brief cuDF-IO helpers for reusing the parsed footers of files across readers
+ */
+
+#pragma once
+
+#include <cudf/io/metadata_cache.hpp>
+
+#include <memory>
+#include <string>
+
+namespace cudf {
+namespace io {
+namespace detail {
+/**
+ * @brief Gives the readers access to the type-erased lookup and insertion of a metadata cache
+ */
+struct metadata_cache_access {
+  static std::shared_ptr<void const> find(metadata_cache &cache, std::string const &key)
+  {
+    return cache.find(key);
+  }
+
+  static void insert(metadata_cache &cache,
+                     std::string const &key,
+                     std::shared_ptr<void const> value,
+                     size_t size)
+  {
+    cache.insert(key, std::move(value), size);
+  }
+};
+
+/**
+ * @brief Returns the key identifying a version of a file in a metadata cache
+ *
+ * @param format Name of the file format, so that different parsed types never share a key
+ * @param filepath Path to the file
+ *
+ * @return Key made of the format, path, size and modification time; empty if the file cannot be
+ * stat'ed
+ */
+std::string metadata_cache_key(std::string const &format, std::string const &filepath);
+
+/**
+ * @brief Returns the parsed footer of a file from a cache, parsing and caching it on a miss
+ *
+ * @param cache Cache to use; the footer is always parsed if null
+ * @param format Name of the file format
+ * @param filepath Path to the file; the footer is always parsed if empty
+ * @param parse Function returning the parsed footer and setting its approximate size in bytes
+ *
+ * @return The parsed footer
+ */
+template <typename T, typename Parser>
+std::shared_ptr<T const> get_cached_metadata(metadata_cache *cache,
+                                             std::string const &format,
+                                             std::string const &filepath,
+                                             Parser &&parse)
+{
+  size_t size    = 0;
+  const auto key = (cache != nullptr) ? metadata_cache_key(format, filepath) : std::string{};
+  if (key.empty()) { return parse(&size); }
+
+  if (auto cached = metadata_cache_access::find(*cache, key)) {
+    return std::static_pointer_cast<T const>(cached);
+  }
+  std::shared_ptr<T const> parsed = parse(&size);
+  metadata_cache_access::insert(*cache, key, parsed, size);
+  return parsed;
+}
+
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
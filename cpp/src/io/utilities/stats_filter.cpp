@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "stats_filter.hpp"
+
+#include <cudf/utilities/error.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+namespace cudf {
+namespace io {
+namespace detail {
+namespace {
+bool is_numeric(filter_literal const &v)
+{
+  return v.type() == filter_literal::kind::INTEGER || v.type() == filter_literal::kind::FLOAT;
+}
+
+double as_double(filter_literal const &v)
+{
+  return (v.type() == filter_literal::kind::INTEGER) ? static_cast<double>(v.int_value())
+                                                     : v.float_value();
+}
+
+/**
+ * @brief Three-way comparison of two literals
+ *
+ * @return False if the literals are not comparable (different kinds, or NaN)
+ */
+bool compare_literals(filter_literal const &lhs, filter_literal const &rhs, int &result)
+{
+  if (lhs.type() == filter_literal::kind::INTEGER && rhs.type() == filter_literal::kind::INTEGER) {
+    result = (lhs.int_value() < rhs.int_value()) ? -1 : (lhs.int_value() > rhs.int_value()) ? 1 : 0;
+    return true;
+  }
+  if (is_numeric(lhs) && is_numeric(rhs)) {
+    auto const l = as_double(lhs);
+    auto const r = as_double(rhs);
+    if (std::isnan(l) || std::isnan(r)) { return false; }
+    result = (l < r) ? -1 : (l > r) ? 1 : 0;
+    return true;
+  }
+  if (lhs.type() == filter_literal::kind::STRING && rhs.type() == filter_literal::kind::STRING) {
+    // std::string compares bytes as unsigned, matching the Parquet and ORC statistics order
+    auto const cmp = lhs.string_value().compare(rhs.string_value());
+    result         = (cmp < 0) ? -1 : (cmp > 0) ? 1 : 0;
+    return true;
+  }
+  return false;
+}
+
+}  // namespace
+
+bool range_might_match(filter_expression const &expr,
+                       int64_t num_rows,
+                       column_statistics_lookup const &get_stats)
+{
+  if (expr.empty()) { return true; }
+
+  switch (expr.op()) {
+    case filter_op::AND:
+    case filter_op::OR: {
+      CUDF_EXPECTS(expr.lhs() != nullptr && expr.rhs() != nullptr,
+                   "AND/OR filter expressions require two sub-expressions");
+      auto const lhs = range_might_match(*expr.lhs(), num_rows, get_stats);
+      if (expr.op() == filter_op::AND && !lhs) { return false; }
+      if (expr.op() == filter_op::OR && lhs) { return true; }
+      return range_might_match(*expr.rhs(), num_rows, get_stats);
+    }
+    default: break;
+  }
+
+  auto const stats = get_stats(expr.column());
+  switch (expr.op()) {
+    case filter_op::IS_NULL: return !stats.has_null_count || stats.null_count > 0;
+    case filter_op::IS_NOT_NULL: return !stats.has_null_count || stats.null_count < num_rows;
+    default: break;
+  }
+
+  // Comparisons are false for null values, so a range of only nulls never matches
+  if (stats.has_null_count && stats.null_count >= num_rows) { return false; }
+  int cmp_min = 0;
+  int cmp_max = 0;
+  if (!stats.has_min_max || !compare_literals(stats.min_value, expr.value(), cmp_min) ||
+      !compare_literals(stats.max_value, expr.value(), cmp_max)) {
+    return true;
+  }
+  switch (expr.op()) {
+    case filter_op::EQUAL: return cmp_min <= 0 && cmp_max >= 0;
+    case filter_op::NOT_EQUAL: return cmp_min != 0 || cmp_max != 0;
+    case filter_op::LESS: return cmp_min < 0;
+    case filter_op::LESS_EQUAL: return cmp_min <= 0;
+    case filter_op::GREATER: return cmp_max > 0;
+    case filter_op::GREATER_EQUAL: return cmp_max >= 0;
+    default: CUDF_FAIL("Unsupported filter operator");
+  }
+}
+
+std::vector<std::string> get_filter_columns(filter_expression const &expr)
+{
+  std::vector<std::string> columns;
+  if (expr.empty()) { return columns; }
+  if (expr.op() == filter_op::AND || expr.op() == filter_op::OR) {
+    CUDF_EXPECTS(expr.lhs() != nullptr && expr.rhs() != nullptr,
+                 "AND/OR filter expressions require two sub-expressions");
+    columns = get_filter_columns(*expr.lhs());
+    for (auto &name : get_filter_columns(*expr.rhs())) {
+      if (std::find(columns.begin(), columns.end(), name) == columns.end()) {
+        columns.push_back(std::move(name));
+      }
+    }
+  } else {
+    columns.push_back(expr.column());
+  }
+  return columns;
+}
+
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file stats_filter.hpp
+ * @brief cuDF-IO evaluation of reader filter expressions against column statistics
+ */
+
+#pragma once
+
+#include <cudf/io/types.hpp>
+
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace cudf {
+namespace io {
+namespace detail {
+/**
+ * @brief Statistics of one column over a range of rows, such as a row group or a stripe
+ *
+ * Min/max values are decoded into literals of the same kind a filter would compare them with.
+ */
+struct column_range_statistics {
+  bool has_null_count = false;
+  int64_t null_count  = 0;
+  bool has_min_max    = false;
+  filter_literal min_value;
+  filter_literal max_value;
+};
+
+/**
+ * @brief Returns the statistics of a column by name; default-constructed if unknown
+ */
+using column_statistics_lookup = std::function<column_range_statistics(std::string const &)>;
+
+/**
+ * @brief Returns whether any row in a range of rows might satisfy a filter expression
+ *
+ * Only returns false when the statistics prove that no row matches; missing or incomparable
+ * statistics never cause a range to be skipped. Comparisons with null values are false.
+ *
+ * @param expr Filter expression
+ * @param num_rows Number of rows in the range
+ * @param get_stats Lookup for the statistics of the columns in the range
+ *
+ * @return False if no row of the range can match, true otherwise
+ */
+bool range_might_match(filter_expression const &expr,
+                       int64_t num_rows,
+                       column_statistics_lookup const &get_stats);
+
+/**
+ * @brief Returns the names of the columns referenced by a filter expression, without duplicates
+ *
+ * @param expr Filter expression
+ */
+std::vector<std::string> get_filter_columns(filter_expression const &expr);
+
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
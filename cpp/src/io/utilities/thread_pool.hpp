@@ -0,0 +1,174 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace cudf {
+namespace io {
+namespace detail {
+/**
+ * @brief A fixed-size pool of host worker threads with an optionally bounded task queue.
+ *
+ * Worker threads are only started on the first call to `submit()`, so objects that own a pool
+ * but never use it do not pay for thread creation. When `max_queued` is non-zero, `submit()`
+ * blocks the caller while that many tasks are already waiting to be picked up by a worker.
+ **/
+class thread_pool {
+ public:
+  /**
+   * @brief Constructs a pool with the given number of threads and queue bound.
+   *
+   * @param num_threads Number of worker threads; zero selects the hardware concurrency
+   * @param max_queued Maximum number of tasks waiting for a worker; zero is unbounded
+   **/
+  explicit thread_pool(size_t num_threads = 0, size_t max_queued = 0)
+    : _num_threads(num_threads != 0 ? num_threads
+                                    : std::max<size_t>(1, std::thread::hardware_concurrency())),
+      _max_queued(max_queued)
+  {
+  }
+
+  thread_pool(thread_pool const &) = delete;
+  thread_pool &operator=(thread_pool const &) = delete;
+
+  ~thread_pool()
+  {
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      _stopping = true;
+    }
+    _task_available.notify_all();
+    _slot_available.notify_all();
+    for (auto &worker : _workers) { worker.join(); }
+  }
+
+  /**
+   * @brief Returns the number of worker threads in the pool.
+   **/
+  size_t size() const noexcept { return _num_threads; }
+
+  /**
+   * @brief Enqueues a callable for execution on a worker thread.
+   *
+   * Exceptions thrown by the callable are propagated through the returned future.
+   *
+   * @param func Callable taking no arguments
+   *
+   * @return Future holding the callable's result
+   **/
+  template <typename F, typename R = typename std::result_of<F()>::type>
+  std::future<R> submit(F &&func)
+  {
+    auto task   = std::make_shared<std::packaged_task<R()>>(std::forward<F>(func));
+    auto result = task->get_future();
+    {
+      std::unique_lock<std::mutex> lock(_mutex);
+      if (_workers.empty()) { start_workers(); }
+      _slot_available.wait(
+        lock, [this] { return _stopping || _max_queued == 0 || _tasks.size() < _max_queued; });
+      _tasks.emplace_back([task]() { (*task)(); });
+    }
+    _task_available.notify_one();
+    return result;
+  }
+
+ private:
+  void start_workers()
+  {
+    _workers.reserve(_num_threads);
+    for (size_t i = 0; i < _num_threads; ++i) {
+      _workers.emplace_back([this] {
+        while (true) {
+          std::function<void()> task;
+          {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _task_available.wait(lock, [this] { return _stopping || !_tasks.empty(); });
+            if (_tasks.empty()) { return; }
+            task = std::move(_tasks.front());
+            _tasks.pop_front();
+          }
+          _slot_available.notify_one();
+          task();
+        }
+      });
+    }
+  }
+
+  size_t const _num_threads;
+  size_t const _max_queued;
+  bool _stopping = false;
+  std::mutex _mutex;
+  std::condition_variable _task_available;
+  std::condition_variable _slot_available;
+  std::deque<std::function<void()>> _tasks;
+  std::vector<std::thread> _workers;
+};
+
+/**
+ * @brief Calls `func(state, i)` for every `i` in [0, count) on a pool and waits for completion.
+ *
+ * Each worker task pulls indices from a shared counter, so items of uneven cost balance out across
+ * threads. `make_state()` is called once per worker task, for per-thread scratch objects such as
+ * codec contexts.
+ *
+ * @param pool Pool to run on
+ * @param count Number of items
+ * @param make_state Callable returning the per-task state
+ * @param func Callable taking the per-task state and an item index
+ **/
+template <typename MakeState, typename F>
+void parallel_for(thread_pool &pool, size_t count, MakeState const &make_state, F const &func)
+{
+  std::atomic<size_t> next_item{0};
+  auto worker = [&]() {
+    auto state = make_state();
+    for (size_t i = next_item++; i < count; i = next_item++) { func(state, i); }
+  };
+  std::vector<std::future<void>> tasks;
+  for (size_t t = 0; t < std::min(pool.size(), count); ++t) {
+    tasks.emplace_back(pool.submit(worker));
+  }
+  // Every task references local state, so wait for all of them before surfacing any error
+  for (auto &task : tasks) { task.wait(); }
+  for (auto &task : tasks) { task.get(); }
+}
+
+/**
+ * @brief Returns the process-wide pool used for CPU-bound host work such as (de)compression.
+ *
+ * Tasks submitted to this pool must not wait on other tasks of the same pool.
+ **/
+inline thread_pool &get_host_worker_pool()
+{
+  static thread_pool pool;
+  return pool;
+}
+
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
@@ -0,0 +1,489 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/search.hpp>
+#include <cudf/detail/sorting.hpp>
+#include <cudf/detail/utilities/release_assert.cuh>
+#include <cudf/table/table_device_view.cuh>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <join/conditional_join.hpp>
+#include <join/sort_merge_join.hpp>
+
+#include <rmm/thrust_rmm_allocator.h>
+#include <thrust/for_each.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/reduce.h>
+#include <thrust/scan.h>
+#include <thrust/transform.h>
+
+#include <algorithm>
+
+namespace cudf {
+join_predicate join_predicate::compare(size_type left_column,
+                                       join_comparator op,
+                                       size_type right_column,
+                                       double offset)
+{
+  join_predicate predicate;
+  predicate._nodes.push_back({node_kind::COMPARE, left_column, op, right_column, offset});
+  return predicate;
+}
+
+join_predicate join_predicate::band(size_type left_column,
+                                    size_type right_column,
+                                    double lower_offset,
+                                    double upper_offset)
+{
+  return logical_and(
+    compare(left_column, join_comparator::GREATER_EQUAL, right_column, lower_offset),
+    compare(left_column, join_comparator::LESS_EQUAL, right_column, upper_offset));
+}
+
+join_predicate join_predicate::logical_and(join_predicate const& lhs, join_predicate const& rhs)
+{
+  join_predicate predicate{lhs};
+  predicate._nodes.insert(predicate._nodes.end(), rhs._nodes.begin(), rhs._nodes.end());
+  predicate._nodes.push_back({node_kind::AND, 0, join_comparator::EQUAL, 0, 0.0});
+  return predicate;
+}
+
+join_predicate join_predicate::logical_or(join_predicate const& lhs, join_predicate const& rhs)
+{
+  join_predicate predicate{lhs};
+  predicate._nodes.insert(predicate._nodes.end(), rhs._nodes.begin(), rhs._nodes.end());
+  predicate._nodes.push_back({node_kind::OR, 0, join_comparator::EQUAL, 0, 0.0});
+  return predicate;
+}
+
+namespace detail {
+namespace {
+/// Maximum number of operands pending while evaluating a predicate
+constexpr int max_predicate_depth{16};
+
+/**
+ * @brief Converts the elements of a column type to the type in which predicates compare them:
+ * `double` for floating point types, and `int64_t` for integral and timestamp types
+ */
+template <typename T, typename Enable = void>
+struct predicate_value {
+  static constexpr bool is_supported = false;
+};
+
+template <typename T>
+struct predicate_value<T, std::enable_if_t<std::is_floating_point<T>::value>> {
+  using type                         = double;
+  static constexpr bool is_supported = true;
+  CUDA_HOST_DEVICE_CALLABLE static type get(T element) { return static_cast<type>(element); }
+};
+
+template <typename T>
+struct predicate_value<T, std::enable_if_t<std::is_integral<T>::value>> {
+  using type                         = int64_t;
+  static constexpr bool is_supported = true;
+  CUDA_HOST_DEVICE_CALLABLE static type get(T element) { return static_cast<type>(element); }
+};
+
+template <typename T>
+struct predicate_value<T, std::enable_if_t<cudf::is_timestamp<T>()>> {
+  using type                         = int64_t;
+  static constexpr bool is_supported = true;
+  CUDA_HOST_DEVICE_CALLABLE static type get(T element)
+  {
+    return static_cast<type>(element.time_since_epoch().count());
+  }
+};
+
+struct is_supported_fn {
+  template <typename T>
+  bool operator()() const
+  {
+    return predicate_value<T>::is_supported;
+  }
+};
+
+template <typename T>
+__device__ bool compare_values(T lhs, join_comparator op, T rhs)
+{
+  switch (op) {
+    case join_comparator::EQUAL: return lhs == rhs;
+    case join_comparator::NOT_EQUAL: return lhs != rhs;
+    case join_comparator::LESS: return lhs < rhs;
+    case join_comparator::LESS_EQUAL: return lhs <= rhs;
+    case join_comparator::GREATER: return lhs > rhs;
+    case join_comparator::GREATER_EQUAL: return lhs >= rhs;
+  }
+  return false;
+}
+
+struct compare_elements_fn {
+  template <typename T, std::enable_if_t<predicate_value<T>::is_supported>* = nullptr>
+  __device__ bool operator()(column_device_view const& left,
+                             size_type left_index,
+                             column_device_view const& right,
+                             size_type right_index,
+                             join_comparator op,
+                             double offset) const
+  {
+    using value = predicate_value<T>;
+    return compare_values(
+      value::get(left.element<T>(left_index)),
+      op,
+      value::get(right.element<T>(right_index)) + static_cast<typename value::type>(offset));
+  }
+
+  template <typename T, std::enable_if_t<not predicate_value<T>::is_supported>* = nullptr>
+  __device__ bool operator()(column_device_view const&,
+                             size_type,
+                             column_device_view const&,
+                             size_type,
+                             join_comparator,
+                             double) const
+  {
+    release_assert(false && "Unsupported join predicate column data type");
+    return false;
+  }
+};
+
+/**
+ * @brief Evaluates a predicate, given by its nodes in postfix order, on a pair of rows
+ */
+struct predicate_evaluator {
+  table_device_view left;
+  table_device_view right;
+  join_predicate::node const* nodes;
+  size_type num_nodes;
+
+  __device__ bool operator()(size_type left_index, size_type right_index) const
+  {
+    bool operands[max_predicate_depth];
+    int top = 0;
+    for (size_type i = 0; i < num_nodes; ++i) {
+      auto const& node = nodes[i];
+      if (node.kind == join_predicate::node_kind::COMPARE) {
+        auto const& left_column  = left.column(node.left_column);
+        auto const& right_column = right.column(node.right_column);
+        operands[top++] = left_column.is_valid(left_index) && right_column.is_valid(right_index) &&
+                          type_dispatcher(left_column.type(),
+                                          compare_elements_fn{},
+                                          left_column,
+                                          left_index,
+                                          right_column,
+                                          right_index,
+                                          node.op,
+                                          node.offset);
+      } else {
+        bool const rhs = operands[--top];
+        operands[top - 1] = (node.kind == join_predicate::node_kind::AND)
+                              ? (operands[top - 1] && rhs)
+                              : (operands[top - 1] || rhs);
+      }
+    }
+    return operands[0];
+  }
+};
+
+void validate_predicate(table_view const& left,
+                        table_view const& right,
+                        join_predicate const& predicate)
+{
+  auto const& nodes = predicate.nodes();
+  CUDF_EXPECTS(not nodes.empty(), "Join predicate is empty");
+  int depth     = 0;
+  int max_depth = 0;
+  for (auto const& node : nodes) {
+    if (node.kind != join_predicate::node_kind::COMPARE) {
+      --depth;
+      continue;
+    }
+    CUDF_EXPECTS(node.left_column >= 0 && node.left_column < left.num_columns(),
+                 "Join predicate left column index out of bounds");
+    CUDF_EXPECTS(node.right_column >= 0 && node.right_column < right.num_columns(),
+                 "Join predicate right column index out of bounds");
+    auto const type = left.column(node.left_column).type();
+    CUDF_EXPECTS(type == right.column(node.right_column).type(),
+                 "Mismatch in join predicate column data types");
+    CUDF_EXPECTS(type_dispatcher(type, is_supported_fn{}),
+                 "Unsupported join predicate column data type");
+    max_depth = std::max(max_depth, ++depth);
+  }
+  CUDF_EXPECTS(max_depth <= max_predicate_depth, "Join predicate is nested too deeply");
+}
+
+/**
+ * @brief Computes the join by evaluating the predicate on every pair of rows: once to count the
+ * matches of every left row, and once to write them at their output offsets
+ */
+VectorPair nested_loop_join_indices(table_view const& left,
+                                    table_view const& right,
+                                    join_predicate const& predicate,
+                                    join_kind JoinKind,
+                                    cudaStream_t stream)
+{
+  auto d_left  = table_device_view::create(left, stream);
+  auto d_right = table_device_view::create(right, stream);
+  rmm::device_vector<join_predicate::node> d_nodes(predicate.nodes());
+  predicate_evaluator const evaluator{
+    *d_left, *d_right, d_nodes.data().get(), static_cast<size_type>(d_nodes.size())};
+
+  // Left joins always have an entry in the output
+  bool const is_left_join{JoinKind == join_kind::LEFT_JOIN};
+  const size_type left_num_rows{left.num_rows()};
+  const size_type right_num_rows{right.num_rows()};
+  rmm::device_vector<size_type> output_offsets(left_num_rows);
+  thrust::transform(rmm::exec_policy(stream)->on(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(left_num_rows),
+                    output_offsets.begin(),
+                    [evaluator, right_num_rows, is_left_join] __device__(size_type left_index) {
+                      size_type count = 0;
+                      for (size_type right_index = 0; right_index < right_num_rows;
+                           ++right_index) {
+                        if (evaluator(left_index, right_index)) { ++count; }
+                      }
+                      return (is_left_join && (0 == count)) ? 1 : count;
+                    });
+
+  int64_t const join_size = thrust::reduce(rmm::exec_policy(stream)->on(stream),
+                                           output_offsets.begin(),
+                                           output_offsets.end(),
+                                           int64_t{0});
+  CUDF_EXPECTS(join_size < MAX_JOIN_SIZE, "Join output size is too big");
+  thrust::exclusive_scan(rmm::exec_policy(stream)->on(stream),
+                         output_offsets.begin(),
+                         output_offsets.end(),
+                         output_offsets.begin());
+
+  rmm::device_vector<size_type> left_indices(join_size);
+  rmm::device_vector<size_type> right_indices(join_size);
+
+  size_type const* d_offsets = output_offsets.data().get();
+  size_type* d_left_indices  = left_indices.data().get();
+  size_type* d_right_indices = right_indices.data().get();
+  thrust::for_each_n(
+    rmm::exec_policy(stream)->on(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    left_num_rows,
+    [evaluator, right_num_rows, is_left_join, d_offsets, d_left_indices, d_right_indices]
+    __device__(size_type left_index) {
+      size_type output_index = d_offsets[left_index];
+      for (size_type right_index = 0; right_index < right_num_rows; ++right_index) {
+        if (evaluator(left_index, right_index)) {
+          d_left_indices[output_index]  = left_index;
+          d_right_indices[output_index] = right_index;
+          ++output_index;
+        }
+      }
+      if (is_left_join && (output_index == d_offsets[left_index])) {
+        d_left_indices[output_index]  = left_index;
+        d_right_indices[output_index] = JoinNoneValue;
+      }
+    });
+
+  return std::make_pair(std::move(left_indices), std::move(right_indices));
+}
+
+/**
+ * @brief Returns the comparisons of a predicate that binary searches of one sorted column can
+ * answer: a single comparison other than NOT_EQUAL, or the AND of two such comparisons of the
+ * same pair of columns. Returns no comparisons for any other predicate.
+ */
+std::vector<join_predicate::node> get_range_comparisons(join_predicate const& predicate)
+{
+  auto const& nodes        = predicate.nodes();
+  auto is_range_comparison = [](join_predicate::node const& node) {
+    return (node.kind == join_predicate::node_kind::COMPARE) &&
+           (node.op != join_comparator::NOT_EQUAL);
+  };
+  if ((nodes.size() == 1) && is_range_comparison(nodes[0])) { return nodes; }
+  if ((nodes.size() == 3) && is_range_comparison(nodes[0]) && is_range_comparison(nodes[1]) &&
+      (nodes[2].kind == join_predicate::node_kind::AND) &&
+      (nodes[0].left_column == nodes[1].left_column) &&
+      (nodes[0].right_column == nodes[1].right_column)) {
+    return {nodes[0], nodes[1]};
+  }
+  return {};
+}
+
+/**
+ * @brief Makes a column of the elements of `input`, converted to the type in which predicates
+ * compare them, minus `offset`. Row `i` of the result is taken from row `gather_map[i]` of
+ * `input`, or from row `i` if `gather_map` is nullptr.
+ */
+struct make_search_values_fn {
+  template <typename T, std::enable_if_t<predicate_value<T>::is_supported>* = nullptr>
+  std::unique_ptr<column> operator()(column_view const& input,
+                                     size_type const* gather_map,
+                                     size_type size,
+                                     double offset,
+                                     cudaStream_t stream) const
+  {
+    using value_type = typename predicate_value<T>::type;
+    auto result      = make_numeric_column(
+      data_type(type_to_id<value_type>()), size, mask_state::UNALLOCATED, stream);
+    auto d_input            = column_device_view::create(input, stream);
+    auto const value_offset = static_cast<value_type>(offset);
+    thrust::transform(rmm::exec_policy(stream)->on(stream),
+                      thrust::make_counting_iterator<size_type>(0),
+                      thrust::make_counting_iterator<size_type>(size),
+                      result->mutable_view().begin<value_type>(),
+                      [input_view = *d_input, gather_map, value_offset] __device__(size_type i) {
+                        size_type const row = (gather_map != nullptr) ? gather_map[i] : i;
+                        return predicate_value<T>::get(input_view.element<T>(row)) - value_offset;
+                      });
+    return result;
+  }
+
+  template <typename T, std::enable_if_t<not predicate_value<T>::is_supported>* = nullptr>
+  std::unique_ptr<column> operator()(
+    column_view const&, size_type const*, size_type, double, cudaStream_t) const
+  {
+    CUDF_FAIL("Unsupported join predicate column data type");
+  }
+};
+
+/**
+ * @brief Computes the join of comparisons of one pair of columns by sorting the right column and
+ * binary searching the range of sorted right rows that matches every left row
+ */
+VectorPair range_join_indices(table_view const& left,
+                              table_view const& right,
+                              std::vector<join_predicate::node> const& comparisons,
+                              join_kind JoinKind,
+                              cudaStream_t stream)
+{
+  column_view const left_key  = left.column(comparisons.front().left_column);
+  column_view const right_key = right.column(comparisons.front().right_column);
+  const size_type left_num_rows{left.num_rows()};
+
+  // Null right rows sort first and are left out of the searched values, since they match nothing
+  size_type const right_null_count = right_key.null_count();
+  size_type const num_searched     = right_key.size() - right_null_count;
+  rmm::device_vector<size_type> range_begin(left_num_rows, 0);
+  rmm::device_vector<size_type> range_end(left_num_rows, num_searched);
+  std::unique_ptr<column> right_order;
+  if (num_searched > 0) {
+    right_order = detail::sorted_order(
+      table_view{{right_key}}, {}, {}, rmm::mr::get_default_resource(), stream);
+    auto searched = type_dispatcher(right_key.type(),
+                                    make_search_values_fn{},
+                                    right_key,
+                                    right_order->view().data<size_type>() + right_null_count,
+                                    num_searched,
+                                    0.0,
+                                    stream);
+    table_view const searched_table{{searched->view()}};
+
+    for (auto const& comparison : comparisons) {
+      // `left <op> right + offset` bounds the sorted right values by `left - offset`
+      auto values = type_dispatcher(left_key.type(),
+                                    make_search_values_fn{},
+                                    left_key,
+                                    nullptr,
+                                    left_num_rows,
+                                    comparison.offset,
+                                    stream);
+      table_view const values_table{{values->view()}};
+      auto search = [&](bool find_lower) {
+        return find_lower ? detail::lower_bound(searched_table,
+                                                values_table,
+                                                {},
+                                                {},
+                                                rmm::mr::get_default_resource(),
+                                                stream)
+                          : detail::upper_bound(searched_table,
+                                                values_table,
+                                                {},
+                                                {},
+                                                rmm::mr::get_default_resource(),
+                                                stream);
+      };
+
+      auto const op = comparison.op;
+      if (op == join_comparator::EQUAL || op == join_comparator::LESS ||
+          op == join_comparator::LESS_EQUAL) {
+        // right == v and right >= v begin at the lower bound of v, right > v at its upper bound
+        auto bound = search(op != join_comparator::LESS);
+        thrust::transform(rmm::exec_policy(stream)->on(stream),
+                          range_begin.begin(),
+                          range_begin.end(),
+                          bound->view().begin<size_type>(),
+                          range_begin.begin(),
+                          thrust::maximum<size_type>());
+      }
+      if (op == join_comparator::EQUAL || op == join_comparator::GREATER ||
+          op == join_comparator::GREATER_EQUAL) {
+        // right == v and right <= v end at the upper bound of v, right < v at its lower bound
+        auto bound = search(op == join_comparator::GREATER);
+        thrust::transform(rmm::exec_policy(stream)->on(stream),
+                          range_end.begin(),
+                          range_end.end(),
+                          bound->view().begin<size_type>(),
+                          range_end.begin(),
+                          thrust::minimum<size_type>());
+      }
+    }
+
+    // Null left rows match nothing
+    if (left_key.has_nulls()) {
+      auto d_left_key          = column_device_view::create(left_key, stream);
+      size_type const* d_begin = range_begin.data().get();
+      size_type* d_end         = range_end.data().get();
+      thrust::for_each_n(rmm::exec_policy(stream)->on(stream),
+                         thrust::make_counting_iterator<size_type>(0),
+                         left_num_rows,
+                         [key = *d_left_key, d_begin, d_end] __device__(size_type i) {
+                           if (key.is_null(i)) { d_end[i] = d_begin[i]; }
+                         });
+    }
+  }
+
+  return get_match_range_indices(
+    range_begin.data().get(),
+    range_end.data().get(),
+    left_num_rows,
+    right_order ? right_order->view().data<size_type>() + right_null_count : nullptr,
+    JoinKind,
+    stream);
+}
+
+}  // namespace
+
+VectorPair conditional_join_indices(table_view const& left,
+                                    table_view const& right,
+                                    join_predicate const& predicate,
+                                    join_kind JoinKind,
+                                    cudaStream_t stream)
+{
+  CUDF_EXPECTS((JoinKind == join_kind::INNER_JOIN) || (JoinKind == join_kind::LEFT_JOIN),
+               "Unsupported join type");
+  validate_predicate(left, right, predicate);
+
+  auto const comparisons = get_range_comparisons(predicate);
+  if (not comparisons.empty()) {
+    return range_join_indices(left, right, comparisons, JoinKind, stream);
+  }
+  return nested_loop_join_indices(left, right, predicate, JoinKind, stream);
+}
+
+}  // namespace detail
+
+}  // namespace cudf
@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/join.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+
+#include <join/join_common_utils.hpp>
+
+namespace cudf {
+namespace detail {
+/* --------------------------------------------------------------------------*/
+/**
+ * @brief  Computes the join of two tables on a predicate over their rows, and
+ * returns the output indices of the left and right tables.
+ *
+ * A predicate made of a single comparison other than NOT_EQUAL, or of the AND
+ * of two such comparisons of the same pair of columns, is answered with
+ * binary searches of the sorted right column. Any other predicate is evaluated
+ * on every pair of rows. Either way the output is allocated at its exact size
+ * and ordered by left row.
+ *
+ * @throws cudf::logic_error if JoinKind is not INNER_JOIN or LEFT_JOIN
+ * @throws cudf::logic_error if `predicate` refers to a column that does not
+ * exist, or compares columns of different or unsupported types
+ * @throws cudf::logic_error if the join output size exceeds MAX_JOIN_SIZE
+ *
+ * @param left  The left table
+ * @param right The right table
+ * @param predicate The predicate over a row of `left` and a row of `right`
+ * @param JoinKind The type of join to be performed
+ * @param stream stream on which all memory allocations and copies
+ * will be performed
+ *
+ * @returns Join output indices vector pair
+ */
+/* ----------------------------------------------------------------------------*/
+VectorPair conditional_join_indices(table_view const& left,
+                                    table_view const& right,
+                                    join_predicate const& predicate,
+                                    join_kind JoinKind,
+                                    cudaStream_t stream);
+
+}  // namespace detail
+
+}  // namespace cudf
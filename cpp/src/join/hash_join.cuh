@@ -16,6 +16,7 @@
 #pragma once
 
 #include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/join.hpp>
 #include <cudf/scalar/scalar.hpp>
 #include <cudf/scalar/scalar_device_view.cuh>
 #include <cudf/table/table.hpp>
@@ -25,6 +26,8 @@
 #include <join/join_common_utils.hpp>
 #include <join/join_kernels.cuh>
 
+#include <functional>
+
 namespace cudf {
 namespace detail {
 /* --------------------------------------------------------------------------*/
@@ -181,44 +184,21 @@ get_trivial_left_join_indices(table_view const& left, cudaStream_t stream)
 
 /* --------------------------------------------------------------------------*/
 /**
- * @brief  Computes the join operation between two tables and returns the
- * output indices of left and right table as a combined table
+ * @brief  Builds a hash table over the rows of the build table that maps the
+ * hash value of every row to its row index.
  *
- * @param left  Table of left columns to join
- * @param right Table of right  columns to join
- * @param flip_join_indices Flag that indicates whether the left and right
- * tables have been flipped, meaning the output indices should also be flipped.
+ * @throws cudf::logic_error if a row could not be inserted into the hash table
+ *
+ * @param build_table Table of columns to build the hash table from
  * @param stream stream on which all memory allocations and copies
  * will be performed
- * @tparam join_kind The type of join to be performed
  *
- * @returns Join output indices vector pair
+ * @returns Hash table built from `build_table`
  */
 /* ----------------------------------------------------------------------------*/
-template <join_kind JoinKind>
-std::enable_if_t<(JoinKind != join_kind::FULL_JOIN),
-                 std::pair<rmm::device_vector<size_type>, rmm::device_vector<size_type>>>
-get_base_hash_join_indices(table_view const& left,
-                           table_view const& right,
-                           bool flip_join_indices,
-                           cudaStream_t stream)
+inline auto build_join_hash_table(table_device_view build_table, cudaStream_t stream)
 {
-  // The `right` table is always used for building the hash map. We want to build the hash map
-  // on the smaller table. Thus, if `left` is smaller than `right`, swap `left/right`.
-  if ((JoinKind == join_kind::INNER_JOIN) && (right.num_rows() > left.num_rows())) {
-    return get_base_hash_join_indices<JoinKind>(right, left, true, stream);
-  }
-  // Trivial left join case - exit early
-  if ((JoinKind == join_kind::LEFT_JOIN) && (right.num_rows() == 0)) {
-    return get_trivial_left_join_indices(left, stream);
-  }
-
-  auto build_table = table_device_view::create(right, stream);
-  const size_type build_table_num_rows{build_table->num_rows()};
-
-  // Probe with the left table
-  auto probe_table = table_device_view::create(left, stream);
-
+  const size_type build_table_num_rows{build_table.num_rows()};
   size_t const hash_table_size = compute_hash_table_size(build_table_num_rows);
 
   auto hash_table = multimap_type::create(hash_table_size,
@@ -230,7 +210,7 @@ get_base_hash_join_indices(table_view const& left,
 
   // build the hash table
   if (build_table_num_rows > 0) {
-    row_hash hash_build{*build_table};
+    row_hash hash_build{build_table};
     rmm::device_scalar<int> failure(0, stream);
     constexpr int block_size{DEFAULT_JOIN_BLOCK_SIZE};
     detail::grid_1d config(build_table_num_rows, block_size);
@@ -240,8 +220,123 @@ get_base_hash_join_indices(table_view const& left,
     if (failure.value() == 1) { CUDF_FAIL("Hash Table insert failure."); }
   }
 
+  return hash_table;
+}
+
+/* --------------------------------------------------------------------------*/
+/**
+ * @brief  Probes a hash table with the rows of the probe table in two phases,
+ * allocating exactly the size of the join output.
+ *
+ * The first phase counts the output rows of every probe row, and after a scan
+ * of the counts, the second phase writes the output of every probe row at its
+ * offset. The output is ordered by probe row.
+ *
+ * @throws cudf::logic_error if the join output size exceeds MAX_JOIN_SIZE
+ *
+ * @param build_table Table the hash table was built from
+ * @param probe_table Table of columns to probe the hash table with
+ * @param hash_table Hash table built from `build_table`
+ * @param flip_join_indices Flag that indicates whether the output indices
+ * should be returned as (build, probe) rather than (probe, build).
+ * @param stream stream on which all memory allocations and copies
+ * will be performed
+ * @tparam join_kind The type of join to be performed
+ *
+ * @returns Join output indices vector pair
+ */
+/* ----------------------------------------------------------------------------*/
+template <join_kind JoinKind>
+std::pair<rmm::device_vector<size_type>, rmm::device_vector<size_type>>
+probe_join_hash_table_exact(table_device_view build_table,
+                            table_device_view probe_table,
+                            multimap_type const& hash_table,
+                            bool flip_join_indices,
+                            cudaStream_t stream)
+{
+  const size_type probe_table_num_rows{probe_table.num_rows()};
+  // An empty probe table has no output, and a grid of no blocks cannot be launched
+  if (0 == probe_table_num_rows) {
+    return std::make_pair(rmm::device_vector<size_type>{}, rmm::device_vector<size_type>{});
+  }
+
+  row_hash hash_probe{probe_table};
+  row_equality equality{probe_table, build_table};
+  constexpr int block_size{DEFAULT_JOIN_BLOCK_SIZE};
+  detail::grid_1d config(probe_table_num_rows, block_size);
+
+  // Count the output rows of every probe row, then turn the counts into output offsets
+  rmm::device_vector<size_type> output_offsets(probe_table_num_rows);
+  compute_join_match_counts<JoinKind, multimap_type>
+    <<<config.num_blocks, config.num_threads_per_block, 0, stream>>>(
+      hash_table, hash_probe, equality, probe_table_num_rows, output_offsets.data().get());
+  CHECK_CUDA(stream);
+
+  int64_t const join_size = thrust::reduce(rmm::exec_policy(stream)->on(stream),
+                                           output_offsets.begin(),
+                                           output_offsets.end(),
+                                           int64_t{0});
+  CUDF_EXPECTS(join_size < MAX_JOIN_SIZE, "Join output size is too big");
+  thrust::exclusive_scan(rmm::exec_policy(stream)->on(stream),
+                         output_offsets.begin(),
+                         output_offsets.end(),
+                         output_offsets.begin());
+
+  rmm::device_vector<size_type> left_indices(join_size);
+  rmm::device_vector<size_type> right_indices(join_size);
+  if (join_size > 0) {
+    write_join_output_at_offsets<JoinKind, multimap_type>
+      <<<config.num_blocks, config.num_threads_per_block, 0, stream>>>(
+        hash_table,
+        hash_probe,
+        equality,
+        probe_table_num_rows,
+        output_offsets.data().get(),
+        left_indices.data().get(),
+        right_indices.data().get(),
+        flip_join_indices);
+    CHECK_CUDA(stream);
+  }
+  return std::make_pair(std::move(left_indices), std::move(right_indices));
+}
+
+/* --------------------------------------------------------------------------*/
+/**
+ * @brief  Probes a hash table built by `build_join_hash_table` with the rows
+ * of the probe table and returns the output indices of the probe and build
+ * tables.
+ *
+ * @param build_table Table the hash table was built from
+ * @param probe_table Table of columns to probe the hash table with
+ * @param hash_table Hash table built from `build_table`
+ * @param flip_join_indices Flag that indicates whether the output indices
+ * should be returned as (build, probe) rather than (probe, build).
+ * @param output_size Whether the output is allocated from an estimate of its
+ * size or from an exact count of the matches
+ * @param stream stream on which all memory allocations and copies
+ * will be performed
+ * @tparam join_kind The type of join to be performed
+ *
+ * @returns Join output indices vector pair
+ */
+/* ----------------------------------------------------------------------------*/
+template <join_kind JoinKind>
+std::enable_if_t<(JoinKind != join_kind::FULL_JOIN),
+                 std::pair<rmm::device_vector<size_type>, rmm::device_vector<size_type>>>
+probe_join_hash_table(table_device_view build_table,
+                      table_device_view probe_table,
+                      multimap_type const& hash_table,
+                      bool flip_join_indices,
+                      join_output_size output_size,
+                      cudaStream_t stream)
+{
+  if (output_size == join_output_size::EXACT) {
+    return probe_join_hash_table_exact<JoinKind>(
+      build_table, probe_table, hash_table, flip_join_indices, stream);
+  }
+
   size_type estimated_size = estimate_join_output_size<JoinKind, multimap_type>(
-    *build_table, *probe_table, *hash_table, stream);
+    build_table, probe_table, hash_table, stream);
 
   // If the estimated output size is zero, return immediately
   if (estimated_size == 0) {
@@ -263,18 +358,18 @@ get_base_hash_join_indices(table_view const& left,
     right_indices.resize(estimated_size);
 
     constexpr int block_size{DEFAULT_JOIN_BLOCK_SIZE};
-    detail::grid_1d config(probe_table->num_rows(), block_size);
+    detail::grid_1d config(probe_table.num_rows(), block_size);
     write_index.set_value(0);
 
-    row_hash hash_probe{*probe_table};
-    row_equality equality{*probe_table, *build_table};
+    row_hash hash_probe{probe_table};
+    row_equality equality{probe_table, build_table};
     probe_hash_table<JoinKind, multimap_type, hash_value_type, block_size, DEFAULT_JOIN_CACHE_SIZE>
-      <<<config.num_blocks, config.num_threads_per_block, 0, stream>>>(*hash_table,
-                                                                       *build_table,
-                                                                       *probe_table,
+      <<<config.num_blocks, config.num_threads_per_block, 0, stream>>>(hash_table,
+                                                                       build_table,
+                                                                       probe_table,
                                                                        hash_probe,
                                                                        equality,
-                                                                       probe_table->num_rows(),
+                                                                       probe_table.num_rows(),
                                                                        left_indices.data().get(),
                                                                        right_indices.data().get(),
                                                                        write_index.data(),
@@ -293,6 +388,121 @@ get_base_hash_join_indices(table_view const& left,
   return std::make_pair(std::move(left_indices), std::move(right_indices));
 }
 
+/* --------------------------------------------------------------------------*/
+/**
+ * @brief  Computes the join operation between two tables and returns the
+ * output indices of left and right table as a combined table
+ *
+ * @param left  Table of left columns to join
+ * @param right Table of right  columns to join
+ * @param flip_join_indices Flag that indicates whether the left and right
+ * tables have been flipped, meaning the output indices should also be flipped.
+ * @param output_size Whether the output is allocated from an estimate of its
+ * size or from an exact count of the matches
+ * @param stream stream on which all memory allocations and copies
+ * will be performed
+ * @tparam join_kind The type of join to be performed
+ *
+ * @returns Join output indices vector pair
+ */
+/* ----------------------------------------------------------------------------*/
+template <join_kind JoinKind>
+std::enable_if_t<(JoinKind != join_kind::FULL_JOIN),
+                 std::pair<rmm::device_vector<size_type>, rmm::device_vector<size_type>>>
+get_base_hash_join_indices(table_view const& left,
+                           table_view const& right,
+                           bool flip_join_indices,
+                           join_output_size output_size,
+                           cudaStream_t stream)
+{
+  // The `right` table is always used for building the hash map. We want to build the hash map
+  // on the smaller table. Thus, if `left` is smaller than `right`, swap `left/right`.
+  if ((JoinKind == join_kind::INNER_JOIN) && (right.num_rows() > left.num_rows())) {
+    return get_base_hash_join_indices<JoinKind>(right, left, true, output_size, stream);
+  }
+  // Trivial left join case - exit early
+  if ((JoinKind == join_kind::LEFT_JOIN) && (right.num_rows() == 0)) {
+    return get_trivial_left_join_indices(left, stream);
+  }
+
+  auto build_table = table_device_view::create(right, stream);
+
+  // Probe with the left table
+  auto probe_table = table_device_view::create(left, stream);
+
+  auto hash_table = build_join_hash_table(*build_table, stream);
+
+  return probe_join_hash_table<JoinKind>(
+    *build_table, *probe_table, *hash_table, flip_join_indices, output_size, stream);
+}
+
 }  // namespace detail
 
+/**
+ * @brief Implementation of `cudf::hash_join`, holding the hash table of the build table.
+ */
+class hash_join::impl {
+ public:
+  impl() = delete;
+  ~impl() = default;
+  impl(impl const&) = delete;
+  impl& operator=(impl const&) = delete;
+
+  impl(table_view const& build, std::vector<size_type> const& build_on, cudaStream_t stream = 0);
+
+  std::pair<std::unique_ptr<column>, std::unique_ptr<column>> inner_join_indices(
+    table_view const& probe,
+    std::vector<size_type> const& probe_on,
+    join_output_size output_size,
+    rmm::mr::device_memory_resource* mr,
+    cudaStream_t stream = 0) const;
+
+  std::pair<std::unique_ptr<column>, std::unique_ptr<column>> left_join_indices(
+    table_view const& probe,
+    std::vector<size_type> const& probe_on,
+    join_output_size output_size,
+    rmm::mr::device_memory_resource* mr,
+    cudaStream_t stream = 0) const;
+
+  std::pair<std::unique_ptr<column>, std::unique_ptr<column>> full_join_indices(
+    table_view const& probe,
+    std::vector<size_type> const& probe_on,
+    join_output_size output_size,
+    rmm::mr::device_memory_resource* mr,
+    cudaStream_t stream = 0) const;
+
+  std::unique_ptr<column> left_semi_join_indices(table_view const& probe,
+                                                 std::vector<size_type> const& probe_on,
+                                                 rmm::mr::device_memory_resource* mr,
+                                                 cudaStream_t stream = 0) const;
+
+  std::unique_ptr<column> left_anti_join_indices(table_view const& probe,
+                                                 std::vector<size_type> const& probe_on,
+                                                 rmm::mr::device_memory_resource* mr,
+                                                 cudaStream_t stream = 0) const;
+
+ private:
+  /**
+   * @brief Validates `probe_on` against the build table and returns the selected probe columns
+   */
+  table_view select_probe_columns(table_view const& probe,
+                                  std::vector<size_type> const& probe_on) const;
+
+  template <detail::join_kind JoinKind>
+  detail::VectorPair compute_join_indices(table_view const& probe,
+                                          std::vector<size_type> const& probe_on,
+                                          join_output_size output_size,
+                                          cudaStream_t stream) const;
+
+  template <detail::join_kind JoinKind>
+  std::unique_ptr<column> compute_semi_anti_join_indices(table_view const& probe,
+                                                         std::vector<size_type> const& probe_on,
+                                                         rmm::mr::device_memory_resource* mr,
+                                                         cudaStream_t stream) const;
+
+  table_view _build_selected;
+  std::unique_ptr<table_device_view, std::function<void(table_device_view*)>> _build_view;
+  std::unique_ptr<detail::multimap_type, std::function<void(detail::multimap_type*)>> _hash_table;
+};
+
 }  // namespace cudf
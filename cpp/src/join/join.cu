@@ -13,6 +13,7 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include <cudf/column/column_factories.hpp>
 #include <cudf/copying.hpp>
 #include <cudf/detail/concatenate.cuh>
 #include <cudf/detail/gather.cuh>
@@ -23,8 +24,10 @@
 #include <cudf/table/table_view.hpp>
 #include <cudf/utilities/error.hpp>
 
+#include <join/conditional_join.hpp>
 #include <join/hash_join.cuh>
 #include <join/join_common_utils.hpp>
+#include <join/sort_merge_join.hpp>
 
 namespace cudf {
 namespace detail {
@@ -191,6 +194,8 @@ get_left_join_indices_complement(rmm::device_vector<size_type>& right_indices,
  *
  * @param left  Table of left columns to join
  * @param right Table of right  columns to join
+ * @param options The join algorithm, how its output is allocated, and whether
+ * the rows of `right` are sorted in ascending order with nulls first
  * @param stream stream on which all memory allocations and copies
  * will be performed
  * @tparam join_kind The type of join to be performed
@@ -200,7 +205,10 @@ get_left_join_indices_complement(rmm::device_vector<size_type>& right_indices,
 /* ----------------------------------------------------------------------------*/
 template <join_kind JoinKind>
 std::pair<rmm::device_vector<size_type>, rmm::device_vector<size_type>> get_base_join_indices(
-  table_view const& left, table_view const& right, cudaStream_t stream)
+  table_view const& left,
+  table_view const& right,
+  join_options const& options,
+  cudaStream_t stream)
 {
   CUDF_EXPECTS(0 != left.num_columns(), "Selected left dataset is empty");
   CUDF_EXPECTS(0 != right.num_columns(), "Selected right dataset is empty");
@@ -213,7 +221,13 @@ std::pair<rmm::device_vector<size_type>, rmm::device_vector<size_type>> get_base
 
   constexpr join_kind BaseJoinKind =
     (JoinKind == join_kind::FULL_JOIN) ? join_kind::LEFT_JOIN : JoinKind;
-  return get_base_hash_join_indices<BaseJoinKind>(left, right, false, stream);
+  bool const use_sort_merge =
+    (options.algorithm == join_algorithm::SORT_MERGE) ||
+    ((options.algorithm == join_algorithm::AUTO) && (options.keys_are_sorted == sorted::YES));
+  if (use_sort_merge) {
+    return sort_merge_join_indices(left, right, BaseJoinKind, options.keys_are_sorted, stream);
+  }
+  return get_base_hash_join_indices<BaseJoinKind>(left, right, false, options.output_size, stream);
 }
 
 /* --------------------------------------------------------------------------*/
@@ -392,6 +406,9 @@ std::unique_ptr<table> construct_join_output_df(
  * full join.
  * Else, for every column in `left_on` and `right_on`, an output column will
  * be produced.
+ * @param options The join algorithm, how its output is allocated, and whether
+ * the `right_on` columns of `right` are sorted in ascending order with nulls
+ * first
  * @param mr The memory resource that will be used for allocating
  * the device memory for the new table
  * @param stream Optional, stream on which all memory allocations and copies
@@ -411,6 +428,7 @@ std::unique_ptr<table> join_call_compute_df(
   std::vector<size_type> const& left_on,
   std::vector<size_type> const& right_on,
   std::vector<std::pair<size_type, size_type>> const& columns_in_common,
+  join_options const& options,
   rmm::mr::device_memory_resource* mr,
   cudaStream_t stream = 0)
 {
@@ -438,25 +456,344 @@ std::unique_ptr<table> join_call_compute_df(
   }
 
   auto joined_indices =
-    get_base_join_indices<JoinKind>(left.select(left_on), right.select(right_on), stream);
+    get_base_join_indices<JoinKind>(left.select(left_on), right.select(right_on), options, stream);
 
   return construct_join_output_df<JoinKind>(
     left, right, joined_indices, columns_in_common, mr, stream);
 }
 
+/**
+ * @brief Copies a vector of join indices into a new `size_type` column
+ */
+std::unique_ptr<column> make_join_index_column(rmm::device_vector<size_type>::const_iterator begin,
+                                               rmm::device_vector<size_type>::const_iterator end,
+                                               rmm::mr::device_memory_resource* mr,
+                                               cudaStream_t stream)
+{
+  auto result = make_numeric_column(data_type(type_to_id<size_type>()),
+                                    static_cast<size_type>(end - begin),
+                                    mask_state::UNALLOCATED,
+                                    stream,
+                                    mr);
+  thrust::copy(
+    rmm::exec_policy(stream)->on(stream), begin, end, result->mutable_view().begin<size_type>());
+  return result;
+}
+
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> make_join_index_columns(
+  VectorPair const& joined_indices, rmm::mr::device_memory_resource* mr, cudaStream_t stream)
+{
+  return std::make_pair(
+    make_join_index_column(joined_indices.first.begin(), joined_indices.first.end(), mr, stream),
+    make_join_index_column(
+      joined_indices.second.begin(), joined_indices.second.end(), mr, stream));
+}
+
+/* --------------------------------------------------------------------------*/
+/**
+ * @brief  Computes the row indices of the join of `left` and `right` on the
+ * columns given in `left_on` and `right_on`, without gathering any columns.
+ *
+ * @throws cudf::logic_error
+ * If number of elements in `left_on` or `right_on` mismatch.
+ * If number of columns in either `left` or `right` table is 0 or exceeds
+ * MAX_JOIN_SIZE
+ *
+ * @param left The left table
+ * @param right The right table
+ * @param left_on The column's indices from `left` to join on.
+ * @param right_on The column's indices from `right` to join on.
+ * @param options The join algorithm, how its output is allocated, and whether
+ * the `right_on` columns of `right` are sorted in ascending order with nulls
+ * first
+ * @param stream stream on which all memory allocations and copies
+ * will be performed
+ *
+ * @tparam join_kind The type of join to be performed
+ *
+ * @returns Join output indices vector pair. For a full join, the indices of
+ * the left join are followed by the indices of the unmatched right rows.
+ */
+/* ----------------------------------------------------------------------------*/
+template <join_kind JoinKind>
+VectorPair join_call_compute_indices(table_view const& left,
+                                     table_view const& right,
+                                     std::vector<size_type> const& left_on,
+                                     std::vector<size_type> const& right_on,
+                                     join_options const& options,
+                                     cudaStream_t stream)
+{
+  CUDF_EXPECTS(0 != left.num_columns(), "Left table is empty");
+  CUDF_EXPECTS(0 != right.num_columns(), "Right table is empty");
+  CUDF_EXPECTS(left.num_rows() < MAX_JOIN_SIZE, "Left column size is too big");
+  CUDF_EXPECTS(right.num_rows() < MAX_JOIN_SIZE, "Right column size is too big");
+
+  CUDF_EXPECTS(left_on.size() == right_on.size(), "Mismatch in number of columns to be joined on");
+
+  if (is_trivial_join(left, right, left_on, right_on, JoinKind)) { return VectorPair{}; }
+
+  auto joined_indices =
+    get_base_join_indices<JoinKind>(left.select(left_on), right.select(right_on), options, stream);
+
+  if (join_kind::FULL_JOIN == JoinKind) {
+    auto complement_indices = get_left_join_indices_complement(
+      joined_indices.second, left.num_rows(), right.num_rows(), stream);
+    joined_indices = concatenate_vector_pairs(joined_indices, complement_indices);
+  }
+  return joined_indices;
+}
+
+/* --------------------------------------------------------------------------*/
+/**
+ * @brief  Computes the row indices of the join of `left` and `right` on a
+ * predicate over their rows.
+ *
+ * @throws cudf::logic_error if `predicate` refers to a column that does not
+ * exist, or compares columns of different or unsupported types
+ *
+ * @param left The left table
+ * @param right The right table
+ * @param predicate The predicate over a row of `left` and a row of `right`
+ * @param stream stream on which all memory allocations and copies
+ * will be performed
+ *
+ * @tparam join_kind The type of join to be performed
+ *
+ * @returns Join output indices vector pair. For a full join, the indices of
+ * the left join are followed by the indices of the unmatched right rows.
+ */
+/* ----------------------------------------------------------------------------*/
+template <join_kind JoinKind>
+VectorPair conditional_join_call_compute_indices(table_view const& left,
+                                                 table_view const& right,
+                                                 join_predicate const& predicate,
+                                                 cudaStream_t stream)
+{
+  CUDF_EXPECTS(left.num_rows() < MAX_JOIN_SIZE, "Left column size is too big");
+  CUDF_EXPECTS(right.num_rows() < MAX_JOIN_SIZE, "Right column size is too big");
+
+  constexpr join_kind BaseJoinKind =
+    (JoinKind == join_kind::FULL_JOIN) ? join_kind::LEFT_JOIN : JoinKind;
+  auto joined_indices = conditional_join_indices(left, right, predicate, BaseJoinKind, stream);
+
+  if (join_kind::FULL_JOIN == JoinKind) {
+    auto complement_indices = get_left_join_indices_complement(
+      joined_indices.second, left.num_rows(), right.num_rows(), stream);
+    joined_indices = concatenate_vector_pairs(joined_indices, complement_indices);
+  }
+  return joined_indices;
+}
+
+std::unique_ptr<table> gather_join_columns(table_view const& left,
+                                           table_view const& right,
+                                           column_view const& left_indices,
+                                           column_view const& right_indices,
+                                           std::vector<size_type> const& left_columns,
+                                           std::vector<size_type> const& right_columns,
+                                           rmm::mr::device_memory_resource* mr,
+                                           cudaStream_t stream)
+{
+  CUDF_EXPECTS(left_indices.size() == right_indices.size(),
+               "Mismatch between sizes of join index columns");
+  CUDF_EXPECTS(left_indices.type().id() == type_to_id<size_type>() &&
+                 right_indices.type().id() == type_to_id<size_type>(),
+               "Join index columns must be of type size_type");
+
+  // Indices of -1 denote rows without a match, which are gathered as nulls
+  bool const nullify_out_of_bounds{true};
+  auto left_table  = detail::gather(left.select(left_columns),
+                                   left_indices.begin<size_type>(),
+                                   left_indices.end<size_type>(),
+                                   nullify_out_of_bounds,
+                                   mr,
+                                   stream);
+  auto right_table = detail::gather(right.select(right_columns),
+                                   right_indices.begin<size_type>(),
+                                   right_indices.end<size_type>(),
+                                   nullify_out_of_bounds,
+                                   mr,
+                                   stream);
+
+  auto joined_columns         = left_table->release();
+  auto right_columns_gathered = right_table->release();
+  joined_columns.insert(joined_columns.end(),
+                        std::make_move_iterator(right_columns_gathered.begin()),
+                        std::make_move_iterator(right_columns_gathered.end()));
+  return std::make_unique<table>(std::move(joined_columns));
+}
+
 }  // namespace detail
 
+hash_join::impl::impl(table_view const& build,
+                      std::vector<size_type> const& build_on,
+                      cudaStream_t stream)
+{
+  CUDF_EXPECTS(0 != build.num_columns(), "Hash join build table is empty");
+  CUDF_EXPECTS(not build_on.empty(), "No columns to join on");
+  CUDF_EXPECTS(build.num_rows() < detail::MAX_JOIN_SIZE, "Build column size is too big");
+
+  _build_selected = build.select(build_on);
+  _build_view     = table_device_view::create(_build_selected, stream);
+  _hash_table     = detail::build_join_hash_table(*_build_view, stream);
+}
+
+table_view hash_join::impl::select_probe_columns(table_view const& probe,
+                                                 std::vector<size_type> const& probe_on) const
+{
+  CUDF_EXPECTS(0 != probe.num_columns(), "Hash join probe table is empty");
+  CUDF_EXPECTS(probe.num_rows() < detail::MAX_JOIN_SIZE, "Probe column size is too big");
+  CUDF_EXPECTS(probe_on.size() == static_cast<size_t>(_build_selected.num_columns()),
+               "Mismatch in number of columns to be joined on");
+
+  auto probe_selected = probe.select(probe_on);
+  CUDF_EXPECTS(std::equal(std::cbegin(probe_selected),
+                          std::cend(probe_selected),
+                          std::cbegin(_build_selected),
+                          std::cend(_build_selected),
+                          [](const auto& p, const auto& b) { return p.type() == b.type(); }),
+               "Mismatch in joining column data types");
+  return probe_selected;
+}
+
+template <detail::join_kind JoinKind>
+detail::VectorPair hash_join::impl::compute_join_indices(table_view const& probe,
+                                                         std::vector<size_type> const& probe_on,
+                                                         join_output_size output_size,
+                                                         cudaStream_t stream) const
+{
+  auto probe_selected = select_probe_columns(probe, probe_on);
+
+  constexpr detail::join_kind BaseJoinKind =
+    (JoinKind == detail::join_kind::FULL_JOIN) ? detail::join_kind::LEFT_JOIN : JoinKind;
+
+  detail::VectorPair joined_indices;
+  if ((0 != probe_selected.num_rows()) && (0 != _build_selected.num_rows())) {
+    auto probe_view = table_device_view::create(probe_selected, stream);
+    joined_indices  = detail::probe_join_hash_table<BaseJoinKind>(
+      *_build_view, *probe_view, *_hash_table, false, output_size, stream);
+  } else if ((BaseJoinKind == detail::join_kind::LEFT_JOIN) &&
+             (0 != probe_selected.num_rows())) {
+    // Trivial left join case - every probe row is unmatched
+    joined_indices = detail::get_trivial_left_join_indices(probe_selected, stream);
+  }
+
+  if (JoinKind == detail::join_kind::FULL_JOIN) {
+    auto complement_indices = detail::get_left_join_indices_complement(
+      joined_indices.second, probe_selected.num_rows(), _build_selected.num_rows(), stream);
+    joined_indices = detail::concatenate_vector_pairs(joined_indices, complement_indices);
+  }
+  return joined_indices;
+}
+
+template <detail::join_kind JoinKind>
+std::unique_ptr<column> hash_join::impl::compute_semi_anti_join_indices(
+  table_view const& probe,
+  std::vector<size_type> const& probe_on,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream) const
+{
+  auto probe_selected = select_probe_columns(probe, probe_on);
+
+  // For semi join we want a match to be found, for anti join we want no match
+  bool const join_type_boolean = (JoinKind == detail::join_kind::LEFT_SEMI_JOIN);
+
+  rmm::device_vector<size_type> gather_map(probe_selected.num_rows());
+  auto gather_map_end = gather_map.begin();
+  if (0 == _build_selected.num_rows()) {
+    if (not join_type_boolean) {
+      thrust::sequence(
+        rmm::exec_policy(stream)->on(stream), gather_map.begin(), gather_map.end(), 0);
+      gather_map_end = gather_map.end();
+    }
+  } else if (0 != probe_selected.num_rows()) {
+    auto probe_view = table_device_view::create(probe_selected, stream);
+    detail::probe_row_matches<detail::multimap_type> matches{
+      *_hash_table,
+      detail::row_hash{*probe_view},
+      detail::row_equality{*probe_view, *_build_view},
+      join_type_boolean};
+    gather_map_end =
+      thrust::copy_if(rmm::exec_policy(stream)->on(stream),
+                      thrust::make_counting_iterator<size_type>(0),
+                      thrust::make_counting_iterator<size_type>(probe_selected.num_rows()),
+                      gather_map.begin(),
+                      matches);
+  }
+
+  return detail::make_join_index_column(gather_map.begin(), gather_map_end, mr, stream);
+}
+
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> hash_join::impl::inner_join_indices(
+  table_view const& probe,
+  std::vector<size_type> const& probe_on,
+  join_output_size output_size,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream) const
+{
+  return detail::make_join_index_columns(
+    compute_join_indices<detail::join_kind::INNER_JOIN>(probe, probe_on, output_size, stream),
+    mr,
+    stream);
+}
+
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> hash_join::impl::left_join_indices(
+  table_view const& probe,
+  std::vector<size_type> const& probe_on,
+  join_output_size output_size,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream) const
+{
+  return detail::make_join_index_columns(
+    compute_join_indices<detail::join_kind::LEFT_JOIN>(probe, probe_on, output_size, stream),
+    mr,
+    stream);
+}
+
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> hash_join::impl::full_join_indices(
+  table_view const& probe,
+  std::vector<size_type> const& probe_on,
+  join_output_size output_size,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream) const
+{
+  return detail::make_join_index_columns(
+    compute_join_indices<detail::join_kind::FULL_JOIN>(probe, probe_on, output_size, stream),
+    mr,
+    stream);
+}
+
+std::unique_ptr<column> hash_join::impl::left_semi_join_indices(
+  table_view const& probe,
+  std::vector<size_type> const& probe_on,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream) const
+{
+  return compute_semi_anti_join_indices<detail::join_kind::LEFT_SEMI_JOIN>(
+    probe, probe_on, mr, stream);
+}
+
+std::unique_ptr<column> hash_join::impl::left_anti_join_indices(
+  table_view const& probe,
+  std::vector<size_type> const& probe_on,
+  rmm::mr::device_memory_resource* mr,
+  cudaStream_t stream) const
+{
+  return compute_semi_anti_join_indices<detail::join_kind::LEFT_ANTI_JOIN>(
+    probe, probe_on, mr, stream);
+}
+
 std::unique_ptr<table> inner_join(
   table_view const& left,
   table_view const& right,
   std::vector<size_type> const& left_on,
   std::vector<size_type> const& right_on,
   std::vector<std::pair<size_type, size_type>> const& columns_in_common,
+  join_options const& options,
   rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
   return detail::join_call_compute_df<::cudf::detail::join_kind::INNER_JOIN>(
-    left, right, left_on, right_on, columns_in_common, mr);
+    left, right, left_on, right_on, columns_in_common, options, mr);
 }
 
 std::unique_ptr<table> left_join(
@@ -465,11 +802,12 @@ std::unique_ptr<table> left_join(
   std::vector<size_type> const& left_on,
   std::vector<size_type> const& right_on,
   std::vector<std::pair<size_type, size_type>> const& columns_in_common,
+  join_options const& options,
   rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
   return detail::join_call_compute_df<::cudf::detail::join_kind::LEFT_JOIN>(
-    left, right, left_on, right_on, columns_in_common, mr);
+    left, right, left_on, right_on, columns_in_common, options, mr);
 }
 
 std::unique_ptr<table> full_join(
@@ -478,11 +816,169 @@ std::unique_ptr<table> full_join(
   std::vector<size_type> const& left_on,
   std::vector<size_type> const& right_on,
   std::vector<std::pair<size_type, size_type>> const& columns_in_common,
+  join_options const& options,
   rmm::mr::device_memory_resource* mr)
 {
   CUDF_FUNC_RANGE();
   return detail::join_call_compute_df<::cudf::detail::join_kind::FULL_JOIN>(
-    left, right, left_on, right_on, columns_in_common, mr);
+    left, right, left_on, right_on, columns_in_common, options, mr);
+}
+
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> inner_join_indices(
+  table_view const& left,
+  table_view const& right,
+  std::vector<size_type> const& left_on,
+  std::vector<size_type> const& right_on,
+  join_options const& options,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::make_join_index_columns(
+    detail::join_call_compute_indices<detail::join_kind::INNER_JOIN>(
+      left, right, left_on, right_on, options, 0),
+    mr,
+    0);
+}
+
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> left_join_indices(
+  table_view const& left,
+  table_view const& right,
+  std::vector<size_type> const& left_on,
+  std::vector<size_type> const& right_on,
+  join_options const& options,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::make_join_index_columns(
+    detail::join_call_compute_indices<detail::join_kind::LEFT_JOIN>(
+      left, right, left_on, right_on, options, 0),
+    mr,
+    0);
+}
+
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> full_join_indices(
+  table_view const& left,
+  table_view const& right,
+  std::vector<size_type> const& left_on,
+  std::vector<size_type> const& right_on,
+  join_options const& options,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::make_join_index_columns(
+    detail::join_call_compute_indices<detail::join_kind::FULL_JOIN>(
+      left, right, left_on, right_on, options, 0),
+    mr,
+    0);
+}
+
+std::unique_ptr<table> gather_join_columns(table_view const& left,
+                                           table_view const& right,
+                                           column_view const& left_indices,
+                                           column_view const& right_indices,
+                                           std::vector<size_type> const& left_columns,
+                                           std::vector<size_type> const& right_columns,
+                                           rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::gather_join_columns(
+    left, right, left_indices, right_indices, left_columns, right_columns, mr, 0);
+}
+
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> conditional_inner_join_indices(
+  table_view const& left,
+  table_view const& right,
+  join_predicate const& predicate,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::make_join_index_columns(
+    detail::conditional_join_call_compute_indices<detail::join_kind::INNER_JOIN>(
+      left, right, predicate, 0),
+    mr,
+    0);
+}
+
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> conditional_left_join_indices(
+  table_view const& left,
+  table_view const& right,
+  join_predicate const& predicate,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::make_join_index_columns(
+    detail::conditional_join_call_compute_indices<detail::join_kind::LEFT_JOIN>(
+      left, right, predicate, 0),
+    mr,
+    0);
+}
+
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> conditional_full_join_indices(
+  table_view const& left,
+  table_view const& right,
+  join_predicate const& predicate,
+  rmm::mr::device_memory_resource* mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::make_join_index_columns(
+    detail::conditional_join_call_compute_indices<detail::join_kind::FULL_JOIN>(
+      left, right, predicate, 0),
+    mr,
+    0);
+}
+
+hash_join::hash_join(table_view const& build, std::vector<size_type> const& build_on)
+  : _impl{std::make_unique<impl const>(build, build_on)}
+{
+  CUDF_FUNC_RANGE();
+}
+
+hash_join::~hash_join() = default;
+
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> hash_join::inner_join_indices(
+  table_view const& probe,
+  std::vector<size_type> const& probe_on,
+  join_options const& options,
+  rmm::mr::device_memory_resource* mr) const
+{
+  CUDF_FUNC_RANGE();
+  return _impl->inner_join_indices(probe, probe_on, options.output_size, mr);
+}
+
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> hash_join::left_join_indices(
+  table_view const& probe,
+  std::vector<size_type> const& probe_on,
+  join_options const& options,
+  rmm::mr::device_memory_resource* mr) const
+{
+  CUDF_FUNC_RANGE();
+  return _impl->left_join_indices(probe, probe_on, options.output_size, mr);
+}
+
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> hash_join::full_join_indices(
+  table_view const& probe,
+  std::vector<size_type> const& probe_on,
+  join_options const& options,
+  rmm::mr::device_memory_resource* mr) const
+{
+  CUDF_FUNC_RANGE();
+  return _impl->full_join_indices(probe, probe_on, options.output_size, mr);
+}
+
+std::unique_ptr<column> hash_join::left_semi_join_indices(table_view const& probe,
+                                                          std::vector<size_type> const& probe_on,
+                                                          rmm::mr::device_memory_resource* mr) const
+{
+  CUDF_FUNC_RANGE();
+  return _impl->left_semi_join_indices(probe, probe_on, mr);
+}
+
+std::unique_ptr<column> hash_join::left_anti_join_indices(table_view const& probe,
+                                                          std::vector<size_type> const& probe_on,
+                                                          rmm::mr::device_memory_resource* mr) const
+{
+  CUDF_FUNC_RANGE();
+  return _impl->left_anti_join_indices(probe, probe_on, mr);
 }
 
 }  // namespace cudf
@@ -88,6 +88,56 @@ __global__ void build_hash_table(multimap_type multi_map,
   }
 }
 
+/* --------------------------------------------------------------------------*/
+/**
+ * @brief  Functor that checks whether a row of the probe table matches any row
+ * of the build table in the hash table.
+ *
+ * @tparam multimap_type The type of the hash table
+ */
+/* ----------------------------------------------------------------------------*/
+template <typename multimap_type>
+class probe_row_matches {
+ public:
+  probe_row_matches(multimap_type multi_map,
+                    row_hash hash_probe,
+                    row_equality check_row_equality,
+                    bool expected)
+    : _multi_map{multi_map},
+      _hash_probe{hash_probe},
+      _check_row_equality{check_row_equality},
+      _expected{expected}
+  {
+  }
+
+  /**
+   * @brief Returns `expected` if the probe row has a match in the build table
+   */
+  __device__ bool operator()(size_type probe_row_index) const
+  {
+    const auto unused_key = _multi_map.get_unused_key();
+    const auto end        = _multi_map.end();
+
+    const hash_value_type probe_row_hash_value{_hash_probe(probe_row_index)};
+    auto found = _multi_map.find(probe_row_hash_value, true, probe_row_hash_value);
+
+    bool found_match = false;
+    while (!found_match && (end != found) && (unused_key != found->first)) {
+      found_match = (found->first == probe_row_hash_value) &&
+                    _check_row_equality(probe_row_index, found->second);
+      // Continue searching until you hit an empty hash map entry, wrapping around at the end
+      if (end == ++found) found = _multi_map.begin();
+    }
+    return found_match == _expected;
+  }
+
+ private:
+  multimap_type _multi_map;
+  row_hash _hash_probe;
+  row_equality _check_row_equality;
+  bool _expected;
+};
+
 /* --------------------------------------------------------------------------*/
 /**
 * @brief  Computes the output size of joining the probe table to the build table
@@ -185,6 +235,139 @@ __global__ void compute_join_output_size(multimap_type multi_map,
   if (threadIdx.x == 0) atomicAdd(output_size, block_counter);
 }
 
+/* --------------------------------------------------------------------------*/
+/**
+ * @brief  Calls `on_match(build_row_index)` for every row of the build table
+ * that matches a row of the probe table.
+ *
+ * @param[in] multi_map The hash table built on the build table
+ * @param[in] hash_probe Row hasher for the probe table
+ * @param[in] check_row_equality Row comparator between the probe and build tables
+ * @param[in] probe_row_index The probe row to find the matches of
+ * @param[in] on_match Callable invoked with the index of every matching build row
+ * @tparam multimap_type The datatype of the hash table
+ *
+ */
+/* ----------------------------------------------------------------------------*/
+template <typename multimap_type, typename MatchFunc>
+__device__ void for_each_matching_row(multimap_type const& multi_map,
+                                      row_hash const& hash_probe,
+                                      row_equality const& check_row_equality,
+                                      const cudf::size_type probe_row_index,
+                                      MatchFunc& on_match)
+{
+  const auto unused_key = multi_map.get_unused_key();
+  const auto end        = multi_map.end();
+
+  const hash_value_type probe_row_hash_value{hash_probe(probe_row_index)};
+  auto found = multi_map.find(probe_row_hash_value, true, probe_row_hash_value);
+
+  // Continue searching for matching rows until you hit an empty hash map entry
+  while ((end != found) && (unused_key != found->first)) {
+    if ((found->first == probe_row_hash_value) &&
+        check_row_equality(probe_row_index, found->second)) {
+      on_match(found->second);
+    }
+    // If you hit the end of the hash map, wrap around to the beginning
+    if (end == ++found) found = multi_map.begin();
+  }
+}
+
+/* --------------------------------------------------------------------------*/
+/**
+ * @brief  Counts the number of output rows of every probe row, the first
+ * phase of a join whose output is sized exactly.
+ *
+ * @param[in] multi_map The hash table built on the build table
+ * @param[in] hash_probe Row hasher for the probe table
+ * @param[in] check_row_equality Row comparator between the probe and build tables
+ * @param[in] probe_table_num_rows The number of rows in the probe table
+ * @param[out] match_counts The number of output rows of every probe row
+ * @tparam JoinKind The type of join to be performed
+ * @tparam multimap_type The datatype of the hash table
+ *
+ */
+/* ----------------------------------------------------------------------------*/
+template <join_kind JoinKind, typename multimap_type>
+__global__ void compute_join_match_counts(multimap_type multi_map,
+                                          row_hash hash_probe,
+                                          row_equality check_row_equality,
+                                          const cudf::size_type probe_table_num_rows,
+                                          size_type* match_counts)
+{
+  const cudf::size_type start_idx = threadIdx.x + blockIdx.x * blockDim.x;
+  const cudf::size_type stride    = blockDim.x * gridDim.x;
+
+  for (cudf::size_type probe_row_index = start_idx; probe_row_index < probe_table_num_rows;
+       probe_row_index += stride) {
+    size_type count{0};
+    auto count_match = [&count](size_type) { ++count; };
+    for_each_matching_row(multi_map, hash_probe, check_row_equality, probe_row_index, count_match);
+
+    // Left joins always have an entry in the output
+    if ((JoinKind == join_kind::LEFT_JOIN) && (0 == count)) { count = 1; }
+    match_counts[probe_row_index] = count;
+  }
+}
+
+/* --------------------------------------------------------------------------*/
+/**
+ * @brief  Writes the output of every probe row at its offset, the second phase
+ * of a join whose output is sized exactly.
+ *
+ * @param[in] multi_map The hash table built on the build table
+ * @param[in] hash_probe Row hasher for the probe table
+ * @param[in] check_row_equality Row comparator between the probe and build tables
+ * @param[in] probe_table_num_rows The number of rows in the probe table
+ * @param[in] output_offsets Exclusive scan of the match counts of the probe rows
+ * @param[out] join_output_l The left result of the join operation
+ * @param[out] join_output_r The right result of the join operation
+ * @param[in] flip_results Flag that indicates whether the left and right
+ * results should be swapped
+ * @tparam JoinKind The type of join to be performed
+ * @tparam multimap_type The datatype of the hash table
+ *
+ */
+/* ----------------------------------------------------------------------------*/
+template <join_kind JoinKind, typename multimap_type>
+__global__ void write_join_output_at_offsets(multimap_type multi_map,
+                                             row_hash hash_probe,
+                                             row_equality check_row_equality,
+                                             const cudf::size_type probe_table_num_rows,
+                                             size_type const* output_offsets,
+                                             size_type* join_output_l,
+                                             size_type* join_output_r,
+                                             bool flip_results)
+{
+  size_type *output_l = join_output_l, *output_r = join_output_r;
+
+  if (flip_results) {
+    output_l = join_output_r;
+    output_r = join_output_l;
+  }
+
+  const cudf::size_type start_idx = threadIdx.x + blockIdx.x * blockDim.x;
+  const cudf::size_type stride    = blockDim.x * gridDim.x;
+
+  for (cudf::size_type probe_row_index = start_idx; probe_row_index < probe_table_num_rows;
+       probe_row_index += stride) {
+    const size_type begin{output_offsets[probe_row_index]};
+    size_type offset{begin};
+    auto write_match = [&](size_type build_row_index) {
+      output_l[offset] = probe_row_index;
+      output_r[offset] = build_row_index;
+      ++offset;
+    };
+    for_each_matching_row(multi_map, hash_probe, check_row_equality, probe_row_index, write_match);
+
+    // If performing a LEFT join and no match was found, insert a Null into the output
+    if ((JoinKind == join_kind::LEFT_JOIN) && (begin == offset)) {
+      output_l[offset] = probe_row_index;
+      output_r[offset] = static_cast<size_type>(JoinNoneValue);
+    }
+  }
+}
+
 template <int num_warps, cudf::size_type output_cache_size>
 __device__ void flush_output_cache(const unsigned int activemask,
                                    const cudf::size_type max_size,
@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <cudf/column/column.hpp>
+#include <cudf/detail/gather.hpp>
+#include <cudf/detail/search.hpp>
+#include <cudf/detail/sorting.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <join/sort_merge_join.hpp>
+
+#include <rmm/thrust_rmm_allocator.h>
+#include <thrust/binary_search.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/reduce.h>
+#include <thrust/scan.h>
+#include <thrust/transform.h>
+
+namespace cudf {
+namespace detail {
+VectorPair get_match_range_indices(size_type const* range_begin,
+                                   size_type const* range_end,
+                                   size_type left_num_rows,
+                                   size_type const* right_order,
+                                   join_kind JoinKind,
+                                   cudaStream_t stream)
+{
+  // Left joins always have an entry in the output
+  bool const is_left_join{JoinKind == join_kind::LEFT_JOIN};
+  rmm::device_vector<size_type> output_offsets(left_num_rows);
+  thrust::transform(rmm::exec_policy(stream)->on(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(left_num_rows),
+                    output_offsets.begin(),
+                    [range_begin, range_end, is_left_join] __device__(size_type i) {
+                      size_type const count = range_end[i] - range_begin[i];
+                      return (count > 0) ? count : (is_left_join ? 1 : 0);
+                    });
+
+  int64_t const join_size = thrust::reduce(rmm::exec_policy(stream)->on(stream),
+                                           output_offsets.begin(),
+                                           output_offsets.end(),
+                                           int64_t{0});
+  CUDF_EXPECTS(join_size < MAX_JOIN_SIZE, "Join output size is too big");
+  thrust::exclusive_scan(rmm::exec_policy(stream)->on(stream),
+                         output_offsets.begin(),
+                         output_offsets.end(),
+                         output_offsets.begin());
+
+  rmm::device_vector<size_type> left_indices(join_size);
+  rmm::device_vector<size_type> right_indices(join_size);
+
+  // Every output row finds its left row with a binary search of the output offsets, which
+  // balances the work across left rows with many matches
+  size_type const* d_offsets = output_offsets.data().get();
+  size_type* d_left_indices  = left_indices.data().get();
+  size_type* d_right_indices = right_indices.data().get();
+  thrust::for_each_n(
+    rmm::exec_policy(stream)->on(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    join_size,
+    [d_offsets, range_begin, range_end, right_order, d_left_indices, d_right_indices, left_num_rows]
+    __device__(size_type output_index) {
+      size_type const left_index =
+        thrust::upper_bound(thrust::seq, d_offsets, d_offsets + left_num_rows, output_index) -
+        d_offsets - 1;
+      size_type const sorted_index =
+        range_begin[left_index] + (output_index - d_offsets[left_index]);
+      d_left_indices[output_index] = left_index;
+      if (sorted_index < range_end[left_index]) {
+        d_right_indices[output_index] =
+          (right_order != nullptr) ? right_order[sorted_index] : sorted_index;
+      } else {
+        d_right_indices[output_index] = JoinNoneValue;
+      }
+    });
+
+  return std::make_pair(std::move(left_indices), std::move(right_indices));
+}
+
+VectorPair sort_merge_join_indices(table_view const& left,
+                                   table_view const& right,
+                                   join_kind JoinKind,
+                                   sorted right_is_sorted,
+                                   cudaStream_t stream)
+{
+  CUDF_EXPECTS((JoinKind == join_kind::INNER_JOIN) || (JoinKind == join_kind::LEFT_JOIN),
+               "Unsupported join type");
+  CUDF_EXPECTS(std::equal(std::cbegin(left),
+                          std::cend(left),
+                          std::cbegin(right),
+                          std::cend(right),
+                          [](const auto& l, const auto& r) { return l.type() == r.type(); }),
+               "Mismatch in joining column data types");
+
+  // The binary searches need the right rows in ascending order
+  std::unique_ptr<column> right_order;
+  std::unique_ptr<table> sorted_right_table;
+  table_view sorted_right{right};
+  if ((right_is_sorted == sorted::NO) && (right.num_rows() > 0)) {
+    right_order = detail::sorted_order(right, {}, {}, rmm::mr::get_default_resource(), stream);
+    sorted_right_table = detail::gather(
+      right, right_order->view(), false, false, false, rmm::mr::get_default_resource(), stream);
+    sorted_right = sorted_right_table->view();
+  }
+
+  // The matches of every left row are the right rows in [lower, upper)
+  auto lower =
+    detail::lower_bound(sorted_right, left, {}, {}, rmm::mr::get_default_resource(), stream);
+  auto upper =
+    detail::upper_bound(sorted_right, left, {}, {}, rmm::mr::get_default_resource(), stream);
+
+  return get_match_range_indices(lower->view().data<size_type>(),
+                                 upper->view().data<size_type>(),
+                                 left.num_rows(),
+                                 right_order ? right_order->view().data<size_type>() : nullptr,
+                                 JoinKind,
+                                 stream);
+}
+
+}  // namespace detail
+
+}  // namespace cudf
@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+
+#include <join/join_common_utils.hpp>
+
+namespace cudf {
+namespace detail {
+/* --------------------------------------------------------------------------*/
+/**
+ * @brief  Returns the output indices of a join in which the matches of every
+ * left row are a range of rows of the right table in sorted order.
+ *
+ * The output is allocated at its exact size and ordered by left row. Left rows
+ * with an empty range, including ranges whose end precedes their beginning,
+ * have no match.
+ *
+ * @throws cudf::logic_error if the join output size exceeds MAX_JOIN_SIZE
+ *
+ * @param range_begin Device pointer to the first sorted right row matching
+ * every left row
+ * @param range_end Device pointer to one past the last sorted right row
+ * matching every left row
+ * @param left_num_rows Number of rows of the left table
+ * @param right_order Device pointer to the right row index of every sorted
+ * position, or nullptr if the right table is already sorted
+ * @param JoinKind The type of join to be performed, INNER_JOIN or LEFT_JOIN
+ * @param stream stream on which all memory allocations and copies
+ * will be performed
+ *
+ * @returns Join output indices vector pair
+ */
+/* ----------------------------------------------------------------------------*/
+VectorPair get_match_range_indices(size_type const* range_begin,
+                                   size_type const* range_end,
+                                   size_type left_num_rows,
+                                   size_type const* right_order,
+                                   join_kind JoinKind,
+                                   cudaStream_t stream);
+
+/* --------------------------------------------------------------------------*/
+/**
+ * @brief  Computes the join operation between two tables with binary searches
+ * of the `left` rows in the sorted `right` rows, and returns the output
+ * indices of the left and right tables.
+ *
+ * A sort-merge join needs no hash table. The output is allocated at its exact
+ * size and ordered by left row.
+ *
+ * @throws cudf::logic_error if JoinKind is not INNER_JOIN or LEFT_JOIN
+ * @throws cudf::logic_error if the join output size exceeds MAX_JOIN_SIZE
+ *
+ * @param left  Table of left columns to join
+ * @param right Table of right columns to join
+ * @param JoinKind The type of join to be performed
+ * @param right_is_sorted Whether the rows of `right` are already sorted in
+ * ascending order with nulls before other values, as produced by
+ * `cudf::sort` with default arguments. If not, `right` is sorted first.
+ * @param stream stream on which all memory allocations and copies
+ * will be performed
+ *
+ * @returns Join output indices vector pair
+ */
+/* ----------------------------------------------------------------------------*/
+VectorPair sort_merge_join_indices(table_view const& left,
+                                   table_view const& right,
+                                   join_kind JoinKind,
+                                   sorted right_is_sorted,
+                                   cudaStream_t stream);
+
+}  // namespace detail
+
+}  // namespace cudf
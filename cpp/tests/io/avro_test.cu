@@ -0,0 +1,246 @@
+/*
+ * Copyright (c) 2020, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tests/utilities/base_fixture.hpp>
+#include <tests/utilities/column_utilities.hpp>
+#include <tests/utilities/column_wrapper.hpp>
+#include <tests/utilities/cudf_gtest.hpp>
+
+#include <cudf/io/functions.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <zlib.h>
+
+#include <algorithm>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace cudf_io = cudf::io;
+
+// Global environment for temporary files
+auto const temp_env = static_cast<cudf::test::TempDirTestEnvironment*>(
+  ::testing::AddGlobalTestEnvironment(new cudf::test::TempDirTestEnvironment));
+
+namespace {
+void put_long(std::vector<uint8_t>& out, int64_t value)
+{
+  auto zigzag = (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63);
+  while (zigzag >= 0x80) {
+    out.push_back(static_cast<uint8_t>(zigzag | 0x80));
+    zigzag >>= 7;
+  }
+  out.push_back(static_cast<uint8_t>(zigzag));
+}
+
+void put_string(std::vector<uint8_t>& out, std::string const& str)
+{
+  put_long(out, str.size());
+  out.insert(out.end(), str.begin(), str.end());
+}
+
+std::vector<uint8_t> deflate_block(std::vector<uint8_t> const& block)
+{
+  std::vector<uint8_t> compressed(compressBound(block.size()));
+  z_stream strm{};
+  CUDF_EXPECTS(deflateInit2(&strm, 6, Z_DEFLATED, -15, 8, Z_DEFAULT_STRATEGY) == Z_OK,
+               "deflateInit2 failed");
+  strm.next_in   = const_cast<uint8_t*>(block.data());
+  strm.avail_in  = block.size();
+  strm.next_out  = compressed.data();
+  strm.avail_out = compressed.size();
+  CUDF_EXPECTS(deflate(&strm, Z_FINISH) == Z_STREAM_END, "deflate failed");
+  compressed.resize(strm.total_out);
+  deflateEnd(&strm);
+  return compressed;
+}
+
+std::string const id_name_schema =
+  "{\"type\":\"record\",\"name\":\"test\",\"fields\":["
+  "{\"name\":\"id\",\"type\":\"long\"},{\"name\":\"name\",\"type\":\"string\"}]}";
+
+/**
+ * @brief Writes an Avro container file holding rows [`first_row`, `first_row + num_rows`) of the
+ * "id"/"name" schema, in blocks of `rows_per_block` rows
+ */
+void write_avro_file(std::string const& filepath,
+                     int64_t first_row,
+                     int64_t num_rows,
+                     int64_t rows_per_block,
+                     std::string const& codec  = "null",
+                     std::string const& schema = id_name_schema)
+{
+  std::vector<uint8_t> header{'O', 'b', 'j', 1};
+  put_long(header, 2);
+  put_string(header, "avro.codec");
+  put_string(header, codec);
+  put_string(header, "avro.schema");
+  put_string(header, schema);
+  put_long(header, 0);
+  std::vector<uint8_t> const sync_marker(16, 0x5a);
+  header.insert(header.end(), sync_marker.begin(), sync_marker.end());
+
+  std::ofstream outfile(filepath, std::ofstream::out | std::ofstream::binary);
+  outfile.write(reinterpret_cast<const char*>(header.data()), header.size());
+
+  for (int64_t row = first_row; row < first_row + num_rows; row += rows_per_block) {
+    auto const block_rows = std::min(rows_per_block, first_row + num_rows - row);
+    std::vector<uint8_t> block;
+    for (int64_t r = row; r < row + block_rows; ++r) {
+      put_long(block, r);
+      put_string(block, "row" + std::to_string(r));
+    }
+    auto const payload = (codec == "deflate") ? deflate_block(block) : block;
+    std::vector<uint8_t> block_header;
+    put_long(block_header, block_rows);
+    put_long(block_header, payload.size());
+    outfile.write(reinterpret_cast<const char*>(block_header.data()), block_header.size());
+    outfile.write(reinterpret_cast<const char*>(payload.data()), payload.size());
+    outfile.write(reinterpret_cast<const char*>(sync_marker.data()), sync_marker.size());
+  }
+}
+
+/**
+ * @brief Writes one file per entry of `file_rows`, continuing the row numbering across the files
+ */
+std::vector<std::string> write_avro_files(std::string const& name,
+                                          std::vector<int64_t> const& file_rows,
+                                          int64_t rows_per_block,
+                                          std::string const& codec = "null")
+{
+  std::vector<std::string> filepaths;
+  int64_t first_row = 0;
+  for (size_t i = 0; i < file_rows.size(); ++i) {
+    filepaths.push_back(temp_env->get_temp_filepath(name + std::to_string(i) + ".avro"));
+    write_avro_file(filepaths.back(), first_row, file_rows[i], rows_per_block, codec);
+    first_row += file_rows[i];
+  }
+  return filepaths;
+}
+
+/**
+ * @brief Checks that `result` holds rows [`first_row`, `first_row + num_rows`) of the files
+ */
+void expect_rows(cudf::table_view const& result, int64_t first_row, int64_t num_rows)
+{
+  std::vector<int64_t> ids;
+  std::vector<std::string> names;
+  for (int64_t r = first_row; r < first_row + num_rows; ++r) {
+    ids.push_back(r);
+    names.push_back("row" + std::to_string(r));
+  }
+  cudf::test::fixed_width_column_wrapper<int64_t> id_col(ids.begin(), ids.end());
+  cudf::test::strings_column_wrapper name_col(names.begin(), names.end());
+
+  ASSERT_EQ(result.num_columns(), 2);
+  cudf::test::expect_columns_equal(result.column(0), id_col);
+  cudf::test::expect_columns_equal(result.column(1), name_col);
+}
+}  // namespace
+
+struct AvroReaderTest : public cudf::test::BaseFixture {
+};
+
+TEST_F(AvroReaderTest, MultipleFiles)
+{
+  auto const filepaths = write_avro_files("AvroMultipleFiles", {10, 7, 13}, 4);
+
+  cudf_io::read_avro_args in_args;
+  in_args.filepaths = filepaths;
+  auto result       = cudf_io::read_avro(in_args);
+
+  EXPECT_EQ(result.metadata.column_names, std::vector<std::string>({"id", "name"}));
+  expect_rows(result.tbl->view(), 0, 30);
+}
+
+TEST_F(AvroReaderTest, MultipleFilesSkipRows)
+{
+  auto const filepaths = write_avro_files("AvroMultipleFilesSkipRows", {10, 7, 13}, 4);
+
+  // Starts inside a block of the first file and ends inside a block of the last one
+  {
+    cudf_io::read_avro_args in_args;
+    in_args.filepaths = filepaths;
+    in_args.skip_rows = 6;
+    in_args.num_rows  = 16;
+    auto result       = cudf_io::read_avro(in_args);
+    expect_rows(result.tbl->view(), 6, 16);
+  }
+  // Skips the whole first file and reads to the end
+  {
+    cudf_io::read_avro_args in_args;
+    in_args.filepaths = filepaths;
+    in_args.skip_rows = 10;
+    auto result       = cudf_io::read_avro(in_args);
+    expect_rows(result.tbl->view(), 10, 20);
+  }
+  // Stays inside the second file
+  {
+    cudf_io::read_avro_args in_args;
+    in_args.filepaths = filepaths;
+    in_args.skip_rows = 11;
+    in_args.num_rows  = 5;
+    auto result       = cudf_io::read_avro(in_args);
+    expect_rows(result.tbl->view(), 11, 5);
+  }
+}
+
+TEST_F(AvroReaderTest, MultipleFilesDeflate)
+{
+  auto const filepaths = write_avro_files("AvroMultipleFilesDeflate", {9, 12, 5}, 5, "deflate");
+
+  {
+    cudf_io::read_avro_args in_args;
+    in_args.filepaths = filepaths;
+    auto result       = cudf_io::read_avro(in_args);
+    expect_rows(result.tbl->view(), 0, 26);
+  }
+  {
+    cudf_io::read_avro_args in_args;
+    in_args.filepaths = filepaths;
+    in_args.skip_rows = 7;
+    in_args.num_rows  = 16;
+    auto result       = cudf_io::read_avro(in_args);
+    expect_rows(result.tbl->view(), 7, 16);
+  }
+}
+
+TEST_F(AvroReaderTest, MultipleFilesMismatch)
+{
+  auto const first_file = temp_env->get_temp_filepath("AvroMismatch0.avro");
+  write_avro_file(first_file, 0, 8, 4);
+
+  // Same column names with a different type
+  auto const schema_file = temp_env->get_temp_filepath("AvroMismatchSchema.avro");
+  write_avro_file(schema_file,
+                  8,
+                  8,
+                  4,
+                  "null",
+                  "{\"type\":\"record\",\"name\":\"test\",\"fields\":["
+                  "{\"name\":\"id\",\"type\":\"int\"},{\"name\":\"name\",\"type\":\"string\"}]}");
+  cudf_io::read_avro_args schema_args;
+  schema_args.filepaths = {first_file, schema_file};
+  EXPECT_THROW(cudf_io::read_avro(schema_args), cudf::logic_error);
+
+  auto const codec_file = temp_env->get_temp_filepath("AvroMismatchCodec.avro");
+  write_avro_file(codec_file, 8, 8, 4, "deflate");
+  cudf_io::read_avro_args codec_args;
+  codec_args.filepaths = {first_file, codec_file};
+  EXPECT_THROW(cudf_io::read_avro(codec_args), cudf::logic_error);
+}
@@ -14,9 +14,15 @@
  * limitations under the License.
  */
 
+#include <io/comp/cpu_comp.h>
 #include <io/comp/gpuinflate.h>
+#include <io/comp/io_uncomp.h>
+#include <io/comp/unbz2.h>
 #include <tests/utilities/base_fixture.hpp>
 
+#include <zlib.h>
+
+#include <string>
 #include <vector>
 
 #include <rmm/thrust_rmm_allocator.h>
@@ -123,6 +129,30 @@ struct BrotliDecompressTest : public DecompressTest<BrotliDecompressTest> {
   }
 };
 
+/**
+ * @brief Test fixture for host decompression
+ **/
+struct HostDecompressTest : public cudf::test::BaseFixture {
+  std::vector<uint8_t> vector_from_string(const char* str) const
+  {
+    return std::vector<uint8_t>(reinterpret_cast<const uint8_t*>(str),
+                                reinterpret_cast<const uint8_t*>(str) + strlen(str));
+  }
+
+  void Decompress(int stream_type,
+                  std::vector<uint8_t>* decompressed,
+                  const uint8_t* compressed,
+                  size_t compressed_size)
+  {
+    cudf::io::gpu_inflate_input_s args{
+      compressed, compressed_size, decompressed->data(), decompressed->size()};
+    cudf::io::gpu_inflate_status_s stat{};
+    cudf::io::host_decompress_batch(stream_type, &args, &stat, 1);
+    ASSERT_EQ(stat.status, 0u);
+    ASSERT_EQ(stat.bytes_written, decompressed->size());
+  }
+};
+
 TEST_F(GzipDecompressTest, HelloWorld)
 {
   constexpr char uncompressed[]  = "hello world";
@@ -171,4 +201,365 @@ TEST_F(BrotliDecompressTest, HelloWorld)
   EXPECT_EQ(output, input);
 }
 
+TEST_F(HostDecompressTest, GzipHelloWorld)
+{
+  constexpr char uncompressed[]  = "hello world";
+  constexpr uint8_t compressed[] = {
+    0x1f, 0x8b, 0x8,  0x0,  0x9,  0x63, 0x99, 0x5c, 0x2,  0xff, 0xcb, 0x48, 0xcd, 0xc9, 0xc9, 0x57,
+    0x28, 0xcf, 0x2f, 0xca, 0x49, 0x1,  0x0,  0x85, 0x11, 0x4a, 0xd,  0xb,  0x0,  0x0,  0x0};
+
+  std::vector<uint8_t> input = vector_from_string(uncompressed);
+  std::vector<uint8_t> output(input.size());
+  Decompress(cudf::io::IO_UNCOMP_STREAM_TYPE_GZIP, &output, compressed, sizeof(compressed));
+  EXPECT_EQ(output, input);
+}
+
+TEST_F(HostDecompressTest, SnappyHelloWorld)
+{
+  constexpr char uncompressed[]  = "hello world";
+  constexpr uint8_t compressed[] = {
+    0xb, 0x28, 0x68, 0x65, 0x6c, 0x6c, 0x6f, 0x20, 0x77, 0x6f, 0x72, 0x6c, 0x64};
+
+  std::vector<uint8_t> input = vector_from_string(uncompressed);
+  std::vector<uint8_t> output(input.size());
+  Decompress(cudf::io::IO_UNCOMP_STREAM_TYPE_SNAPPY, &output, compressed, sizeof(compressed));
+  EXPECT_EQ(output, input);
+}
+
+#ifdef CUDF_WITH_BROTLI
+TEST_F(HostDecompressTest, BrotliHelloWorld)
+{
+  constexpr char uncompressed[]  = "hello world";
+  constexpr uint8_t compressed[] = {
+    0xb, 0x5, 0x80, 0x68, 0x65, 0x6c, 0x6c, 0x6f, 0x20, 0x77, 0x6f, 0x72, 0x6c, 0x64, 0x3};
+
+  std::vector<uint8_t> input = vector_from_string(uncompressed);
+  std::vector<uint8_t> output(input.size());
+  Decompress(cudf::io::IO_UNCOMP_STREAM_TYPE_BROTLI, &output, compressed, sizeof(compressed));
+  EXPECT_EQ(output, input);
+}
+#endif
+
+TEST_F(HostDecompressTest, LZ4HelloWorld)
+{
+  constexpr char uncompressed[]  = "hello world";
+  constexpr uint8_t compressed[] = {
+    0xb0, 0x68, 0x65, 0x6c, 0x6c, 0x6f, 0x20, 0x77, 0x6f, 0x72, 0x6c, 0x64};
+
+  std::vector<uint8_t> input = vector_from_string(uncompressed);
+  std::vector<uint8_t> output(input.size());
+  Decompress(cudf::io::IO_UNCOMP_STREAM_TYPE_LZ4, &output, compressed, sizeof(compressed));
+  EXPECT_EQ(output, input);
+}
+
+TEST_F(HostDecompressTest, LZ4HadoopHelloWorld)
+{
+  constexpr char uncompressed[]  = "hello world";
+  constexpr uint8_t compressed[] = {0x0,  0x0,  0x0,  0xb,  0x0,  0x0,  0x0,  0xc,  0xb0, 0x68,
+                                    0x65, 0x6c, 0x6c, 0x6f, 0x20, 0x77, 0x6f, 0x72, 0x6c, 0x64};
+
+  std::vector<uint8_t> input = vector_from_string(uncompressed);
+  std::vector<uint8_t> output(input.size());
+  Decompress(cudf::io::IO_UNCOMP_STREAM_TYPE_LZ4, &output, compressed, sizeof(compressed));
+  EXPECT_EQ(output, input);
+}
+
+TEST_F(HostDecompressTest, LZ4RoundTrip)
+{
+  std::vector<uint8_t> input;
+  for (int i = 0; i < 10000; i++) {
+    auto const text = std::to_string(i % 100) + ",";
+    input.insert(input.end(), text.begin(), text.end());
+  }
+
+  for (auto stream_type :
+       {cudf::io::IO_UNCOMP_STREAM_TYPE_LZ4, cudf::io::IO_UNCOMP_STREAM_TYPE_LZ4_HADOOP}) {
+    std::vector<uint8_t> compressed(input.size());
+    cudf::io::gpu_inflate_input_s args{
+      input.data(), input.size(), compressed.data(), compressed.size()};
+    cudf::io::gpu_inflate_status_s stat{};
+    cudf::io::host_compress_batch(stream_type, &args, &stat, 1);
+    ASSERT_EQ(stat.status, 0u);
+    EXPECT_LT(stat.bytes_written, input.size() / 4);
+
+    std::vector<uint8_t> output(input.size());
+    Decompress(stream_type, &output, compressed.data(), stat.bytes_written);
+    EXPECT_EQ(output, input);
+  }
+}
+
+TEST_F(HostDecompressTest, InvalidSnappyBatch)
+{
+  constexpr uint8_t valid[] = {
+    0xb, 0x28, 0x68, 0x65, 0x6c, 0x6c, 0x6f, 0x20, 0x77, 0x6f, 0x72, 0x6c, 0x64};
+  constexpr uint8_t truncated[] = {0xb, 0x28, 0x68, 0x65};
+
+  std::vector<uint8_t> outputs[2]         = {std::vector<uint8_t>(11), std::vector<uint8_t>(11)};
+  cudf::io::gpu_inflate_input_s args[2]   = {{valid, sizeof(valid), outputs[0].data(), 11},
+                                           {truncated, sizeof(truncated), outputs[1].data(), 11}};
+  cudf::io::gpu_inflate_status_s stats[2] = {};
+  cudf::io::host_decompress_batch(cudf::io::IO_UNCOMP_STREAM_TYPE_SNAPPY, args, stats, 2);
+  EXPECT_EQ(stats[0].status, 0u);
+  EXPECT_EQ(stats[0].bytes_written, 11u);
+  EXPECT_NE(stats[1].status, 0u);
+}
+
+TEST_F(HostDecompressTest, MultiMemberGzip)
+{
+  constexpr char uncompressed[] = "hello worldhello world";
+  constexpr uint8_t member[]    = {
+    0x1f, 0x8b, 0x8,  0x0,  0x9,  0x63, 0x99, 0x5c, 0x2,  0xff, 0xcb, 0x48, 0xcd, 0xc9, 0xc9, 0x57,
+    0x28, 0xcf, 0x2f, 0xca, 0x49, 0x1,  0x0,  0x85, 0x11, 0x4a, 0xd,  0xb,  0x0,  0x0,  0x0};
+
+  std::vector<uint8_t> compressed(member, member + sizeof(member));
+  compressed.insert(compressed.end(), member, member + sizeof(member));
+
+  std::vector<char> output;
+  cudf::io::io_uncompress_single_h2d(
+    compressed.data(), compressed.size(), cudf::io::IO_UNCOMP_STREAM_TYPE_GZIP, output);
+  EXPECT_EQ(std::string(output.begin(), output.end()), uncompressed);
+}
+
+namespace {
+void put_le(std::vector<uint8_t>& out, uint32_t value, int num_bytes)
+{
+  for (int i = 0; i < num_bytes; ++i) { out.push_back(static_cast<uint8_t>(value >> (8 * i))); }
+}
+
+std::vector<uint8_t> raw_deflate(std::string const& data)
+{
+  std::vector<uint8_t> compressed(compressBound(data.size()));
+  z_stream strm{};
+  EXPECT_EQ(deflateInit2(&strm, 6, Z_DEFLATED, -15, 8, Z_DEFAULT_STRATEGY), Z_OK);
+  strm.next_in   = reinterpret_cast<Bytef*>(const_cast<char*>(data.data()));
+  strm.avail_in  = data.size();
+  strm.next_out  = compressed.data();
+  strm.avail_out = compressed.size();
+  EXPECT_EQ(deflate(&strm, Z_FINISH), Z_STREAM_END);
+  compressed.resize(strm.total_out);
+  deflateEnd(&strm);
+  return compressed;
+}
+
+uint32_t crc32_of(std::string const& data)
+{
+  return crc32(0, reinterpret_cast<const Bytef*>(data.data()), data.size());
+}
+
+/**
+ * @brief Appends a gzip member; BGZF members record their total size in a "BC" extra subfield
+ */
+void put_gzip_member(std::vector<uint8_t>& out, std::string const& data, bool bgzf)
+{
+  auto const payload = raw_deflate(data);
+  auto const start   = out.size();
+  out.insert(out.end(), {0x1f, 0x8b, 0x08, static_cast<uint8_t>(bgzf ? 0x04 : 0x00)});
+  out.insert(out.end(), {0, 0, 0, 0, 0, 0xff});
+  if (bgzf) {
+    put_le(out, 6, 2);
+    out.insert(out.end(), {'B', 'C', 2, 0});
+    put_le(out, 12 + 6 + payload.size() + 8 - 1, 2);
+  }
+  out.insert(out.end(), payload.begin(), payload.end());
+  put_le(out, crc32_of(data), 4);
+  put_le(out, data.size(), 4);
+  if (bgzf) { EXPECT_EQ(out.size() - start, 12 + 6 + payload.size() + 8); }
+}
+
+/**
+ * @brief Returns a zip archive holding one deflated entry per element of `entries`, named after
+ * the corresponding element of `names` if given
+ */
+std::vector<uint8_t> make_zip(std::vector<std::string> const& entries,
+                              std::vector<std::string> const& names = {})
+{
+  std::vector<uint8_t> archive;
+  std::vector<uint8_t> cdir;
+  for (size_t i = 0; i < entries.size(); ++i) {
+    auto const payload = raw_deflate(entries[i]);
+    auto const name    = (i < names.size()) ? names[i] : "entry" + std::to_string(i);
+    auto const hdr_ofs = archive.size();
+    put_le(archive, 0x04034b50, 4);
+    put_le(archive, 20, 2);  // version needed to extract
+    put_le(archive, 0, 2);   // flags
+    put_le(archive, 8, 2);   // deflate
+    put_le(archive, 0, 4);   // time and date
+    put_le(archive, crc32_of(entries[i]), 4);
+    put_le(archive, payload.size(), 4);
+    put_le(archive, entries[i].size(), 4);
+    put_le(archive, name.size(), 2);
+    put_le(archive, 0, 2);  // extra field length
+    archive.insert(archive.end(), name.begin(), name.end());
+    archive.insert(archive.end(), payload.begin(), payload.end());
+
+    put_le(cdir, 0x02014b50, 4);
+    put_le(cdir, 20, 2);  // version made by
+    put_le(cdir, 20, 2);  // version needed to extract
+    put_le(cdir, 0, 2);   // flags
+    put_le(cdir, 8, 2);   // deflate
+    put_le(cdir, 0, 4);   // time and date
+    put_le(cdir, crc32_of(entries[i]), 4);
+    put_le(cdir, payload.size(), 4);
+    put_le(cdir, entries[i].size(), 4);
+    put_le(cdir, name.size(), 2);
+    put_le(cdir, 0, 2);  // extra field length
+    put_le(cdir, 0, 2);  // comment length
+    put_le(cdir, 0, 2);  // disk number
+    put_le(cdir, 0, 2);  // internal attributes
+    put_le(cdir, 0, 4);  // external attributes
+    put_le(cdir, hdr_ofs, 4);
+    cdir.insert(cdir.end(), name.begin(), name.end());
+  }
+  auto const cdir_offset = archive.size();
+  archive.insert(archive.end(), cdir.begin(), cdir.end());
+  put_le(archive, 0x06054b50, 4);
+  put_le(archive, 0, 2);  // disk number
+  put_le(archive, 0, 2);  // disk with the central directory
+  put_le(archive, entries.size(), 2);
+  put_le(archive, entries.size(), 2);
+  put_le(archive, cdir.size(), 4);
+  put_le(archive, cdir_offset, 4);
+  put_le(archive, 0, 2);  // comment length
+  return archive;
+}
+
+std::string uncompress(std::vector<uint8_t> const& compressed,
+                       int stream_type,
+                       bool all_zip_entries = false)
+{
+  std::vector<char> output;
+  cudf::io::io_uncompress_single_h2d(
+    compressed.data(), compressed.size(), stream_type, output, all_zip_entries);
+  return std::string(output.begin(), output.end());
+}
+
+/**
+ * @brief Returns distinct contents for each of the `count` members or entries of an archive
+ */
+std::vector<std::string> make_segments(int count)
+{
+  std::vector<std::string> segments;
+  for (int i = 0; i < count; ++i) {
+    std::string segment;
+    for (int line = 0; line < 10 + i; ++line) {
+      segment += "segment " + std::to_string(i) + " line " + std::to_string(line) + "\n";
+    }
+    segments.push_back(segment);
+  }
+  return segments;
+}
+}  // namespace
+
+TEST_F(HostDecompressTest, BgzfMembersMatchSerial)
+{
+  // More members than the number of members inflated concurrently
+  auto const segments = make_segments(100);
+  std::string expected;
+  std::vector<uint8_t> bgzf;
+  std::vector<uint8_t> gzip;
+  for (auto const& segment : segments) {
+    expected += segment;
+    put_gzip_member(bgzf, segment, true);
+    put_gzip_member(gzip, segment, false);
+  }
+
+  // Members without the BGZF size subfield are inflated one after another
+  auto const serial = uncompress(gzip, cudf::io::IO_UNCOMP_STREAM_TYPE_GZIP);
+  EXPECT_EQ(serial, expected);
+  EXPECT_EQ(uncompress(bgzf, cudf::io::IO_UNCOMP_STREAM_TYPE_GZIP), serial);
+  EXPECT_EQ(uncompress(bgzf, cudf::io::IO_UNCOMP_STREAM_TYPE_INFER), serial);
+}
+
+TEST_F(HostDecompressTest, MultiEntryZipMatchesSerial)
+{
+  auto const segments = make_segments(40);
+  std::string serial;
+  for (auto const& segment : segments) {
+    // Single-entry archives are inflated without the thread pool
+    serial += uncompress(make_zip({segment}), cudf::io::IO_UNCOMP_STREAM_TYPE_ZIP);
+  }
+  std::string expected;
+  for (auto const& segment : segments) { expected += segment; }
+  EXPECT_EQ(serial, expected);
+
+  auto const archive = make_zip(segments);
+  EXPECT_EQ(uncompress(archive, cudf::io::IO_UNCOMP_STREAM_TYPE_ZIP, true), serial);
+  EXPECT_EQ(uncompress(archive, cudf::io::IO_UNCOMP_STREAM_TYPE_INFER, true), serial);
+}
+
+TEST_F(HostDecompressTest, ZipSkipsResourceForks)
+{
+  std::string const data = "a,b\n1,2\n3,4\n";
+  // Binary AppleDouble header, as stored by the macOS archiver
+  std::string const fork("\x00\x05\x16\x07\x00\x02\x00\x00Mac OS X        ", 24);
+  auto const archive = make_zip(
+    {"", fork, data, fork}, {"data/", "__MACOSX/data/._data.csv", "data/data.csv", "__MACOSX/."});
+
+  EXPECT_EQ(uncompress(archive, cudf::io::IO_UNCOMP_STREAM_TYPE_ZIP), data);
+  EXPECT_EQ(uncompress(archive, cudf::io::IO_UNCOMP_STREAM_TYPE_INFER), data);
+  EXPECT_EQ(uncompress(archive, cudf::io::IO_UNCOMP_STREAM_TYPE_ZIP, true), data);
+}
+
+TEST_F(HostDecompressTest, ZipReadsFirstEntry)
+{
+  std::string const first  = "a,b\n1,2\n";
+  std::string const second = "a,b\n3,4\n";
+  auto const archive       = make_zip({first, second}, {"first.csv", "second.csv"});
+
+  // Further entries are often unrelated files, so they are only read on request
+  EXPECT_EQ(uncompress(archive, cudf::io::IO_UNCOMP_STREAM_TYPE_ZIP), first);
+  EXPECT_EQ(uncompress(archive, cudf::io::IO_UNCOMP_STREAM_TYPE_INFER), first);
+  EXPECT_EQ(uncompress(archive, cudf::io::IO_UNCOMP_STREAM_TYPE_ZIP, true), first + second);
+}
+
+TEST_F(HostDecompressTest, Bzip2BlocksMatchSerial)
+{
+  // 240000 bytes of "hello world\n" compressed with `bzip2 -1`, which splits them into 3 blocks
+  constexpr uint8_t compressed[] = {
+    0x42, 0x5a, 0x68, 0x31, 0x31, 0x41, 0x59, 0x26, 0x53, 0x59, 0x6c, 0xdc, 0x6a, 0x4,  0x0,  0x51,
+    0x5c, 0xd1, 0x80, 0x0,  0x10, 0x40, 0x0,  0x6,  0x44, 0x90, 0x80, 0x20, 0x0,  0x90, 0x20, 0xc9,
+    0x88, 0xa,  0x55, 0xc,  0xd1, 0x3d, 0xa4, 0x20, 0x61, 0x42, 0x6,  0x52, 0x10, 0x30, 0xa1, 0x3,
+    0x54, 0x84, 0xe,  0x14, 0x20, 0x70, 0xa1, 0x3,  0x42, 0x84, 0xe,  0x94, 0x20, 0x61, 0x42, 0x7,
+    0x4a, 0x10, 0x3f, 0x31, 0x41, 0x59, 0x26, 0x53, 0x59, 0xaa, 0xe9, 0x84, 0xb6, 0x0,  0x61, 0xa3,
+    0xd1, 0x80, 0x0,  0x10, 0x40, 0x0,  0x6,  0x44, 0x90, 0x80, 0x20, 0x0,  0x90, 0x20, 0xc9, 0x88,
+    0xa,  0x55, 0xd,  0x3c, 0xa3, 0xb2, 0x84, 0xc,  0x28, 0x40, 0xc2, 0x84, 0xc,  0x28, 0x40, 0xe1,
+    0x42, 0x6,  0xd2, 0x10, 0x33, 0x4a, 0x10, 0x3d, 0x14, 0x20, 0x7d, 0x48, 0x40, 0xda, 0x42, 0x7,
+    0x29, 0x8,  0x1f, 0x98, 0xa0, 0xac, 0x93, 0x29, 0xac, 0xa7, 0xb0, 0x52, 0x41, 0x80, 0x23, 0xd7,
+    0x68, 0xc0, 0x0,  0x8,  0x20, 0x0,  0x3,  0x22, 0x48, 0x40, 0x10, 0x0,  0x38, 0x20, 0xc9, 0x88,
+    0xa,  0x55, 0xc,  0xd1, 0x3d, 0x88, 0x25, 0x82, 0x9,  0x64, 0x41, 0x2c, 0x10, 0x4b, 0x42, 0x9,
+    0x72, 0x20, 0x97, 0x4,  0x12, 0xd0, 0x41, 0x2e, 0xc4, 0x12, 0xc8, 0x82, 0x5b, 0xe8, 0x82, 0x5f,
+    0x8b, 0xb9, 0x22, 0x9c, 0x28, 0x48, 0x54, 0xe1, 0x2,  0xff, 0x80};
+
+  std::string expected;
+  for (int i = 0; i < 20000; ++i) { expected += "hello world\n"; }
+
+  // Decode the whole stream at once, as done when the blocks can't be located
+  std::vector<char> serial(expected.size() + 4096);
+  size_t serial_len = serial.size();
+  ASSERT_EQ(cudf::io::cpu_bz2_uncompress(compressed,
+                                         sizeof(compressed),
+                                         reinterpret_cast<uint8_t*>(serial.data()),
+                                         &serial_len),
+            0);
+  serial.resize(serial_len);
+  EXPECT_EQ(std::string(serial.begin(), serial.end()), expected);
+
+  std::vector<uint8_t> const input(compressed, compressed + sizeof(compressed));
+  EXPECT_EQ(uncompress(input, cudf::io::IO_UNCOMP_STREAM_TYPE_BZIP2), expected);
+  EXPECT_EQ(uncompress(input, cudf::io::IO_UNCOMP_STREAM_TYPE_INFER), expected);
+
+  // Each block is passed on separately, in order
+  std::vector<std::string> blocks;
+  cudf::io::io_uncompress_segments(
+    input.data(),
+    input.size(),
+    cudf::io::IO_UNCOMP_STREAM_TYPE_BZIP2,
+    false,
+    [&blocks](std::vector<char>&& block) { blocks.emplace_back(block.begin(), block.end()); });
+  EXPECT_EQ(blocks.size(), 3u);
+  std::string concatenated;
+  for (auto const& block : blocks) { concatenated += block; }
+  EXPECT_EQ(concatenated, expected);
+}
+
 CUDF_TEST_PROGRAM_MAIN()
@@ -708,6 +708,58 @@ TEST_F(CsvReaderTest, ByteRangeStrings)
   expect_column_data_equal(std::vector<std::string>{"c"}, view.column(0));
 }
 
+TEST_F(CsvReaderTest, SplitByteRangesQuotedNewlines)
+{
+  auto filepath = temp_env->get_temp_dir() + "SplitByteRangesQuotedNewlines.csv";
+  {
+    std::ofstream outfile(filepath, std::ofstream::out);
+    outfile << "id,text,value\n";
+    for (int i = 0; i < 1000; ++i) {
+      // Every other row embeds terminators and delimiters within a quoted field
+      outfile << i << ",";
+      if (i % 2 == 0) {
+        outfile << "\"line " << i << "\nnext, \"\"quoted\"\"\n\"";
+      } else {
+        outfile << "plain" << i;
+      }
+      outfile << "," << i * 0.5 << "\n";
+    }
+  }
+
+  cudf_io::read_csv_args in_args{cudf_io::source_info{filepath}};
+  auto const expected = cudf_io::read_csv(in_args);
+  ASSERT_EQ(1000, expected.tbl->num_rows());
+
+  in_args.num_byte_ranges = 7;
+  auto const result       = cudf_io::read_csv(in_args);
+
+  EXPECT_EQ(expected.metadata.column_names, result.metadata.column_names);
+  cudf::test::expect_tables_equal(expected.tbl->view(), result.tbl->view());
+}
+
+TEST_F(CsvReaderTest, SplitByteRangesNullColumn)
+{
+  auto filepath = temp_env->get_temp_dir() + "SplitByteRangesNullColumn.csv";
+  {
+    // The second column only has values in the second half of the rows
+    std::ofstream outfile(filepath, std::ofstream::out);
+    outfile << "id,value\n";
+    for (int i = 0; i < 1000; ++i) {
+      outfile << i << ",";
+      if (i >= 500) { outfile << i * 0.5; }
+      outfile << "\n";
+    }
+  }
+
+  cudf_io::read_csv_args in_args{cudf_io::source_info{filepath}};
+  auto const expected = cudf_io::read_csv(in_args);
+  ASSERT_EQ(cudf::type_id::FLOAT64, expected.tbl->get_column(1).type().id());
+
+  in_args.num_byte_ranges = 4;
+  auto const result       = cudf_io::read_csv(in_args);
+  cudf::test::expect_tables_equal(expected.tbl->view(), result.tbl->view());
+}
+
 TEST_F(CsvReaderTest, BlanksAndComments)
 {
   auto filepath = temp_env->get_temp_dir() + "BlanksAndComments.csv";
@@ -1074,4 +1126,24 @@ TEST_F(CsvReaderTest, EmptyFileWithWriter)
   EXPECT_THROW(write_csv_helper(filepath, empty_table, false), cudf::logic_error);
 }
 
+TEST_F(CsvReaderTest, ManyChunksWithWriter)
+{
+  auto filepath = temp_env->get_temp_dir() + "ManyChunksWithWriter.csv";
+
+  // A multiple of the 8-row chunk size, so that every chunk is full
+  constexpr cudf::size_type num_rows = 1000;
+  auto values = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i * 3; });
+  auto int_column = column_wrapper<int32_t>(values, values + num_rows);
+  cudf::table_view input_table(std::vector<cudf::column_view>{int_column});
+
+  write_csv_helper(filepath, input_table, false);
+
+  cudf_io::read_csv_args in_args{cudf_io::source_info{filepath}};
+  in_args.dtype  = {"int32"};
+  in_args.header = -1;
+  auto result    = cudf_io::read_csv(in_args);
+
+  cudf::test::expect_tables_equivalent(input_table, result.tbl->view());
+}
+
 CUDF_TEST_PROGRAM_MAIN()
@@ -546,4 +546,57 @@ TEST_F(JsonReaderTest, StringInference)
   EXPECT_EQ(result.tbl->get_column(0).type().id(), cudf::STRING);
 }
 
+TEST_F(JsonReaderTest, FlattenNestedObjects)
+{
+  std::string buffer =
+    "{\"a\": 1, \"b\": {\"c\": \"x\", \"d\": {\"e\": 1.5}}, \"f\": [1, {\"g\": 2}]}\n"
+    "{\"a\": 2, \"b\": {\"c\": \"y\"}, \"f\": []}\n"
+    "{\"f\": [3], \"b\": {\"d\": {\"e\": 2.5}, \"c\": \"z\"}, \"a\": 3}\n";
+  cudf_io::read_json_args in_args{cudf_io::source_info{buffer.c_str(), buffer.size()}};
+  in_args.lines                       = true;
+  in_args.flatten_nested              = true;
+  cudf_io::table_with_metadata result = cudf_io::read_json(in_args);
+
+  ASSERT_EQ(result.tbl->num_columns(), 4);
+  EXPECT_EQ(result.metadata.column_names[0], "a");
+  EXPECT_EQ(result.metadata.column_names[1], "b.c");
+  EXPECT_EQ(result.metadata.column_names[2], "b.d.e");
+  EXPECT_EQ(result.metadata.column_names[3], "f");
+
+  EXPECT_EQ(result.tbl->get_column(0).type().id(), cudf::INT64);
+  EXPECT_EQ(result.tbl->get_column(1).type().id(), cudf::STRING);
+  EXPECT_EQ(result.tbl->get_column(2).type().id(), cudf::FLOAT64);
+  EXPECT_EQ(result.tbl->get_column(3).type().id(), cudf::STRING);
+
+  auto validity = cudf::test::make_counting_transform_iterator(0, [](auto i) { return true; });
+
+  cudf::test::expect_columns_equal(result.tbl->get_column(0), int64_wrapper{{1, 2, 3}, validity});
+  cudf::test::expect_columns_equal(result.tbl->get_column(1),
+                                   cudf::test::strings_column_wrapper({"x", "y", "z"}));
+  cudf::test::expect_columns_equal(result.tbl->get_column(2),
+                                   float64_wrapper{{1.5, 0., 2.5}, {true, false, true}});
+  cudf::test::expect_columns_equal(
+    result.tbl->get_column(3),
+    cudf::test::strings_column_wrapper({"[1, {\"g\": 2}]", "[]", "[3]"}));
+}
+
+TEST_F(JsonReaderTest, FlattenNestedEscapedQuotes)
+{
+  // A string ending with an escaped backslash ends at the next quote
+  std::string buffer =
+    "{\"p\": \"C:\\\\\", \"q\": {\"r\": 1}}\n"
+    "{\"p\": \"say \\\"hi\\\"\", \"q\": {\"r\": 2}}\n";
+  cudf_io::read_json_args in_args{cudf_io::source_info{buffer.c_str(), buffer.size()}};
+  in_args.lines                       = true;
+  in_args.flatten_nested              = true;
+  cudf_io::table_with_metadata result = cudf_io::read_json(in_args);
+
+  ASSERT_EQ(result.tbl->num_columns(), 2);
+  EXPECT_EQ(result.metadata.column_names[0], "p");
+  EXPECT_EQ(result.metadata.column_names[1], "q.r");
+
+  auto validity = cudf::test::make_counting_transform_iterator(0, [](auto i) { return true; });
+  cudf::test::expect_columns_equal(result.tbl->get_column(1), int64_wrapper{{1, 2}, validity});
+}
+
 CUDF_TEST_PROGRAM_MAIN()
@@ -110,6 +110,14 @@ struct OrcChunkedWriterNumericTypeTest : public OrcChunkedWriterTest {
 // Declare typed test cases
 TYPED_TEST_CASE(OrcChunkedWriterNumericTypeTest, cudf::test::NumericTypes);
 
+// Base test fixture for reader tests
+struct OrcReaderTest : public cudf::test::BaseFixture {
+};
+
+// Base test fixture for chunked reader tests
+struct OrcChunkedReaderTest : public cudf::test::BaseFixture {
+};
+
 namespace {
 // Generates a vector of uniform random values of type T
 template <typename T>
@@ -142,6 +150,79 @@ void expect_tables_equal(cudf::table_view const& lhs, cudf::table_view const& rh
   while (result != rhs.end()) { cudf::test::expect_columns_equal(*expected++, *result++); }
 }
 
+// ORC file written by pyarrow (Apache ORC C++ writer), with statistics in its row index entries.
+// Column "a" holds the int64 values 0 to 7999 in two stripes of 4000 rows, each made of four row
+// groups of 1000 rows. Written with:
+//   writer = pyarrow.orc.ORCWriter(path, compression="uncompressed", row_index_stride=1000,
+//                                  stripe_size=1024, batch_size=4000)
+//   for s in range(2):
+//     writer.write(pyarrow.table({"a": pyarrow.array(range(s * 4000, (s + 1) * 4000),
+//                                                    pyarrow.int64())}))
+std::vector<uint8_t> const row_index_stats_orc{
+  0x4f, 0x52, 0x43, 0x0a, 0x07, 0x12, 0x05, 0x08, 0xe8, 0x07, 0x50, 0x00,
+  0x0a, 0x07, 0x12, 0x05, 0x08, 0xe8, 0x07, 0x50, 0x00, 0x0a, 0x07, 0x12,
+  0x05, 0x08, 0xe8, 0x07, 0x50, 0x00, 0x0a, 0x07, 0x12, 0x05, 0x08, 0xe8,
+  0x07, 0x50, 0x00, 0x0a, 0x16, 0x0a, 0x02, 0x00, 0x00, 0x12, 0x10, 0x08,
+  0xe8, 0x07, 0x12, 0x09, 0x08, 0x00, 0x10, 0xce, 0x0f, 0x18, 0xd8, 0xfc,
+  0x3c, 0x50, 0x00, 0x0a, 0x19, 0x0a, 0x03, 0x04, 0xe8, 0x03, 0x12, 0x12,
+  0x08, 0xe8, 0x07, 0x12, 0x0b, 0x08, 0xd0, 0x0f, 0x10, 0x9e, 0x1f, 0x18,
+  0xd8, 0x85, 0xb7, 0x01, 0x50, 0x00, 0x0a, 0x19, 0x0a, 0x03, 0x0e, 0xd0,
+  0x03, 0x12, 0x12, 0x08, 0xe8, 0x07, 0x12, 0x0b, 0x08, 0xa0, 0x1f, 0x10,
+  0xee, 0x2e, 0x18, 0xd8, 0x8e, 0xb1, 0x02, 0x50, 0x00, 0x0a, 0x19, 0x0a,
+  0x03, 0x18, 0xb8, 0x03, 0x12, 0x12, 0x08, 0xe8, 0x07, 0x12, 0x0b, 0x08,
+  0xf0, 0x2e, 0x10, 0xbe, 0x3e, 0x18, 0xd8, 0x97, 0xab, 0x03, 0x50, 0x00,
+  0xc1, 0xff, 0x00, 0x02, 0xc1, 0xff, 0x80, 0x08, 0x02, 0xc1, 0xff, 0x80,
+  0x10, 0x02, 0xc1, 0xff, 0x80, 0x18, 0x02, 0xc1, 0xff, 0x80, 0x20, 0x02,
+  0xc1, 0xff, 0x80, 0x28, 0x02, 0xc1, 0xff, 0x80, 0x30, 0x02, 0xc1, 0x9f,
+  0x80, 0x38, 0x02, 0x0a, 0x06, 0x08, 0x06, 0x10, 0x00, 0x18, 0x24, 0x0a,
+  0x06, 0x08, 0x06, 0x10, 0x01, 0x18, 0x69, 0x0a, 0x06, 0x08, 0x01, 0x10,
+  0x01, 0x18, 0x27, 0x12, 0x04, 0x08, 0x00, 0x10, 0x00, 0x12, 0x04, 0x08,
+  0x02, 0x10, 0x00, 0x1a, 0x03, 0x47, 0x4d, 0x54, 0x0a, 0x07, 0x12, 0x05,
+  0x08, 0xe8, 0x07, 0x50, 0x00, 0x0a, 0x07, 0x12, 0x05, 0x08, 0xe8, 0x07,
+  0x50, 0x00, 0x0a, 0x07, 0x12, 0x05, 0x08, 0xe8, 0x07, 0x50, 0x00, 0x0a,
+  0x07, 0x12, 0x05, 0x08, 0xe8, 0x07, 0x50, 0x00, 0x0a, 0x18, 0x0a, 0x02,
+  0x00, 0x00, 0x12, 0x12, 0x08, 0xe8, 0x07, 0x12, 0x0b, 0x08, 0xc0, 0x3e,
+  0x10, 0x8e, 0x4e, 0x18, 0xd8, 0xa0, 0xa5, 0x04, 0x50, 0x00, 0x0a, 0x19,
+  0x0a, 0x03, 0x05, 0xe8, 0x03, 0x12, 0x12, 0x08, 0xe8, 0x07, 0x12, 0x0b,
+  0x08, 0x90, 0x4e, 0x10, 0xde, 0x5d, 0x18, 0xd8, 0xa9, 0x9f, 0x05, 0x50,
+  0x00, 0x0a, 0x19, 0x0a, 0x03, 0x0f, 0xd0, 0x03, 0x12, 0x12, 0x08, 0xe8,
+  0x07, 0x12, 0x0b, 0x08, 0xe0, 0x5d, 0x10, 0xae, 0x6d, 0x18, 0xd8, 0xb2,
+  0x99, 0x06, 0x50, 0x00, 0x0a, 0x19, 0x0a, 0x03, 0x19, 0xb8, 0x03, 0x12,
+  0x12, 0x08, 0xe8, 0x07, 0x12, 0x0b, 0x08, 0xb0, 0x6d, 0x10, 0xfe, 0x7c,
+  0x18, 0xd8, 0xbb, 0x93, 0x07, 0x50, 0x00, 0xc1, 0xff, 0xc0, 0x3e, 0x02,
+  0xc1, 0xff, 0xc0, 0x46, 0x02, 0xc1, 0xff, 0xc0, 0x4e, 0x02, 0xc1, 0xff,
+  0xc0, 0x56, 0x02, 0xc1, 0xff, 0xc0, 0x5e, 0x02, 0xc1, 0xff, 0xc0, 0x66,
+  0x02, 0xc1, 0xff, 0xc0, 0x6e, 0x02, 0xc1, 0x9f, 0xc0, 0x76, 0x02, 0x0a,
+  0x06, 0x08, 0x06, 0x10, 0x00, 0x18, 0x24, 0x0a, 0x06, 0x08, 0x06, 0x10,
+  0x01, 0x18, 0x6b, 0x0a, 0x06, 0x08, 0x01, 0x10, 0x01, 0x18, 0x28, 0x12,
+  0x04, 0x08, 0x00, 0x10, 0x00, 0x12, 0x04, 0x08, 0x02, 0x10, 0x00, 0x1a,
+  0x03, 0x47, 0x4d, 0x54, 0x0a, 0x1a, 0x0a, 0x05, 0x08, 0xa0, 0x1f, 0x50,
+  0x00, 0x0a, 0x11, 0x08, 0xa0, 0x1f, 0x12, 0x0a, 0x08, 0x00, 0x10, 0xbe,
+  0x3e, 0x18, 0xe0, 0xa8, 0xd0, 0x07, 0x50, 0x00, 0x0a, 0x1b, 0x0a, 0x05,
+  0x08, 0xa0, 0x1f, 0x50, 0x00, 0x0a, 0x12, 0x08, 0xa0, 0x1f, 0x12, 0x0b,
+  0x08, 0xc0, 0x3e, 0x10, 0xfe, 0x7c, 0x18, 0xe0, 0xb8, 0xf1, 0x16, 0x50,
+  0x00, 0x08, 0x03, 0x10, 0xbd, 0x03, 0x1a, 0x0c, 0x08, 0x03, 0x10, 0x8d,
+  0x01, 0x18, 0x27, 0x20, 0x29, 0x28, 0xa0, 0x1f, 0x1a, 0x0d, 0x08, 0xe0,
+  0x01, 0x10, 0x8f, 0x01, 0x18, 0x28, 0x20, 0x29, 0x28, 0xa0, 0x1f, 0x22,
+  0x0e, 0x08, 0x0c, 0x12, 0x01, 0x01, 0x1a, 0x01, 0x61, 0x20, 0x00, 0x28,
+  0x00, 0x30, 0x00, 0x22, 0x08, 0x08, 0x04, 0x20, 0x00, 0x28, 0x00, 0x30,
+  0x00, 0x30, 0xc0, 0x3e, 0x3a, 0x05, 0x08, 0xc0, 0x3e, 0x50, 0x00, 0x3a,
+  0x11, 0x08, 0xc0, 0x3e, 0x12, 0x0a, 0x08, 0x00, 0x10, 0xfe, 0x7c, 0x18,
+  0xc0, 0xe1, 0xc1, 0x1e, 0x50, 0x00, 0x40, 0xe8, 0x07, 0x48, 0x01, 0x62,
+  0x05, 0x32, 0x2e, 0x32, 0x2e, 0x32, 0x08, 0x65, 0x10, 0x00, 0x18, 0x80,
+  0x80, 0x04, 0x22, 0x02, 0x00, 0x0c, 0x28, 0x39, 0x30, 0x06, 0x82, 0xf4,
+  0x03, 0x03, 0x4f, 0x52, 0x43, 0x17};
+
+// Returns a column holding the values of "a" in the given ranges of rows of the file above
+std::unique_ptr<column> row_index_stats_rows(std::vector<std::pair<int64_t, int64_t>> const& ranges)
+{
+  std::vector<int64_t> values;
+  for (auto const& range : ranges) {
+    for (auto i = range.first; i < range.second; ++i) { values.push_back(i); }
+  }
+  return column_wrapper<int64_t>(values.begin(), values.end()).release();
+}
+
 }  // namespace
 
 TYPED_TEST(OrcWriterNumericTypeTest, SingleColumn)
@@ -396,6 +477,22 @@ TEST_F(OrcWriterTest, Strings)
   EXPECT_EQ(expected_metadata.column_names, result.metadata.column_names);
 }
 
+TEST_F(OrcWriterTest, BackgroundFlush)
+{
+  srand(31337);
+  auto expected = create_random_fixed_table<int>(4, 1024 * 1024, true);
+
+  auto filepath = temp_env->get_temp_filepath("OrcBackgroundFlush.orc");
+  cudf_io::write_orc_args out_args{cudf_io::sink_info{filepath}, expected->view()};
+  out_args.background_flush = true;
+  cudf_io::write_orc(out_args);
+
+  cudf_io::read_orc_args in_args{cudf_io::source_info{filepath}};
+  auto result = cudf_io::read_orc(in_args);
+
+  expect_tables_equal(expected->view(), result.tbl->view());
+}
+
 TEST_F(OrcWriterTest, HostBuffer)
 {
   constexpr auto num_rows = 100 << 10;
@@ -425,6 +522,101 @@ TEST_F(OrcWriterTest, HostBuffer)
   EXPECT_EQ(expected_metadata.column_names, result.metadata.column_names);
 }
 
+TEST_F(OrcWriterTest, FooterCache)
+{
+  srand(31337);
+  auto table1 = create_random_fixed_table<int>(8, 1000, true);
+  auto table2 = create_random_fixed_table<int>(8, 2000, true);
+
+  auto filepath = temp_env->get_temp_filepath("FooterCache.orc");
+  cudf_io::write_orc_args args{cudf_io::sink_info{filepath}, *table1};
+  cudf_io::write_orc(args);
+
+  auto cache = std::make_shared<cudf_io::metadata_cache>();
+  cudf_io::read_orc_args read_args{cudf_io::source_info{filepath}};
+  read_args.footer_cache = cache;
+  for (int i = 0; i < 3; ++i) {
+    auto result = cudf_io::read_orc(read_args);
+    expect_tables_equal(*result.tbl, *table1);
+  }
+  EXPECT_EQ(1u, cache->misses());
+  EXPECT_EQ(2u, cache->hits());
+
+  // A rewritten file is parsed again
+  cudf_io::write_orc_args args2{cudf_io::sink_info{filepath}, *table2};
+  cudf_io::write_orc(args2);
+  auto result = cudf_io::read_orc(read_args);
+  expect_tables_equal(*result.tbl, *table2);
+  EXPECT_EQ(2u, cache->misses());
+  EXPECT_EQ(2u, cache->num_entries());
+
+  // Buffers are never cached
+  std::vector<char> out_buffer;
+  cudf_io::write_orc_args out_args{cudf_io::sink_info(&out_buffer), *table1};
+  cudf_io::write_orc(out_args);
+  cudf_io::read_orc_args in_args{cudf_io::source_info(out_buffer.data(), out_buffer.size())};
+  in_args.footer_cache = cache;
+  cudf_io::read_orc(in_args);
+  EXPECT_EQ(2u, cache->misses());
+  EXPECT_EQ(2u, cache->hits());
+}
+
+TEST_F(OrcWriterTest, HostCodecs)
+{
+  constexpr auto num_rows = 100000;
+
+  auto sequence = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 1000; });
+  auto validity = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 7; });
+  column_wrapper<int32_t> col0{sequence, sequence + num_rows, validity};
+  column_wrapper<double> col1{sequence, sequence + num_rows};
+  std::vector<std::unique_ptr<column>> cols;
+  cols.push_back(col0.release());
+  cols.push_back(col1.release());
+  const auto expected = std::make_unique<table>(std::move(cols));
+
+  std::vector<cudf_io::compression_type> codecs{cudf_io::compression_type::LZ4};
+#ifdef CUDF_WITH_ZSTD
+  codecs.push_back(cudf_io::compression_type::ZSTD);
+#endif
+  for (auto codec : codecs) {
+    auto filepath = temp_env->get_temp_filepath("HostCodecs.orc");
+    cudf_io::write_orc_args out_args{cudf_io::sink_info{filepath}, expected->view()};
+    out_args.compression = codec;
+    cudf_io::write_orc(out_args);
+
+    cudf_io::read_orc_args in_args{cudf_io::source_info{filepath}};
+    const auto result = cudf_io::read_orc(in_args);
+
+    expect_tables_equal(expected->view(), result.tbl->view());
+  }
+}
+
+TEST_F(OrcWriterTest, HostDecompression)
+{
+  constexpr auto num_rows = 10000;
+
+  auto sequence = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 100; });
+  auto validity = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 7; });
+  column_wrapper<int64_t> col0{sequence, sequence + num_rows, validity};
+  column_wrapper<float> col1{sequence, sequence + num_rows};
+  std::vector<std::unique_ptr<column>> cols;
+  cols.push_back(col0.release());
+  cols.push_back(col1.release());
+  const auto expected = std::make_unique<table>(std::move(cols));
+
+  auto filepath = temp_env->get_temp_filepath("HostDecompression.orc");
+  cudf_io::write_orc_args out_args{cudf_io::sink_info{filepath}, expected->view()};
+  out_args.compression = cudf_io::compression_type::SNAPPY;
+  cudf_io::write_orc(out_args);
+
+  // The whole file is below the threshold, so its streams are decompressed on the host
+  cudf_io::read_orc_args in_args{cudf_io::source_info{filepath}};
+  in_args.host_decompression_threshold = 1 << 30;
+  const auto result                    = cudf_io::read_orc(in_args);
+
+  expect_tables_equal(expected->view(), result.tbl->view());
+}
+
 TEST_F(OrcChunkedWriterTest, SingleTable)
 {
   srand(31337);
@@ -611,6 +803,216 @@ TEST_F(OrcChunkedWriterTest, ReadStripesError)
   EXPECT_THROW(cudf_io::read_orc(read_args), cudf::logic_error);
 }
 
+TEST_F(OrcChunkedWriterTest, FilterStripes)
+{
+  // Three stripes with disjoint ranges of values in the first column
+  std::vector<std::unique_ptr<table>> tables;
+  for (int i = 0; i < 3; ++i) {
+    auto values   = cudf::test::make_counting_transform_iterator(i * 100, [](auto j) { return j; });
+    auto validity = cudf::test::make_counting_transform_iterator(0, [](auto j) { return j % 5; });
+    auto labels   = cudf::test::make_counting_transform_iterator(0, [i](auto) { return i; });
+    column_wrapper<int32_t> col0{values, values + 100, validity};
+    column_wrapper<int64_t> col1{labels, labels + 100};
+    std::vector<std::unique_ptr<column>> cols;
+    cols.push_back(col0.release());
+    cols.push_back(col1.release());
+    tables.push_back(std::make_unique<table>(std::move(cols)));
+  }
+
+  auto filepath = temp_env->get_temp_filepath("ChunkedFilterStripes.orc");
+  cudf_io::write_orc_chunked_args args{cudf_io::sink_info{filepath}};
+  auto state = cudf_io::write_orc_chunked_begin(args);
+  for (auto const& tbl : tables) { cudf_io::write_orc_chunked(*tbl, state); }
+  cudf_io::write_orc_chunked_end(state);
+
+  cudf_io::read_orc_args read_args{cudf_io::source_info{filepath}};
+  read_args.filter = {"_col0", cudf_io::filter_op::GREATER_EQUAL, 250};
+  auto result      = cudf_io::read_orc(read_args);
+  expect_tables_equal(*result.tbl, *tables[2]);
+  EXPECT_EQ(2, result.metadata.num_filtered_row_groups);
+  EXPECT_EQ(200u, result.metadata.num_filtered_rows);
+  EXPECT_GT(result.metadata.num_filtered_bytes, 0u);
+
+  read_args.filter = {{"_col0", cudf_io::filter_op::LESS, 50},
+                      cudf_io::filter_op::OR,
+                      {"_col1", cudf_io::filter_op::EQUAL, 2}};
+  result           = cudf_io::read_orc(read_args);
+  expect_tables_equal(*result.tbl, *cudf::concatenate({*tables[0], *tables[2]}));
+  EXPECT_EQ(1, result.metadata.num_filtered_row_groups);
+
+  read_args.filter = {{"_col0", cudf_io::filter_op::GREATER, 150.5},
+                      cudf_io::filter_op::AND,
+                      {"_col1", cudf_io::filter_op::EQUAL, 0}};
+  result           = cudf_io::read_orc(read_args);
+  EXPECT_EQ(0, result.tbl->num_rows());
+  EXPECT_EQ(2, result.tbl->num_columns());
+  EXPECT_EQ(3, result.metadata.num_filtered_row_groups);
+
+  // Filters only skip the stripes of the selected ones that cannot match
+  read_args.filter      = {"_col1", cudf_io::filter_op::NOT_EQUAL, 1};
+  read_args.stripe_list = {1, 2};
+  result                = cudf_io::read_orc(read_args);
+  expect_tables_equal(*result.tbl, *tables[2]);
+  EXPECT_EQ(1, result.metadata.num_filtered_row_groups);
+  read_args.stripe_list.clear();
+
+  // Unknown columns never cause stripes to be skipped
+  read_args.filter = {"missing", cudf_io::filter_op::EQUAL, 1};
+  result           = cudf_io::read_orc(read_args);
+  EXPECT_EQ(300, result.tbl->num_rows());
+  EXPECT_EQ(0, result.metadata.num_filtered_row_groups);
+
+  read_args.filter = {"_col1", cudf_io::filter_op::IS_NULL};
+  result           = cudf_io::read_orc(read_args);
+  EXPECT_EQ(0, result.tbl->num_rows());
+
+  // Row ranges cannot be combined with a filter
+  read_args.skip_rows = 10;
+  EXPECT_THROW(cudf_io::read_orc(read_args), cudf::logic_error);
+}
+
+TEST_F(OrcReaderTest, FilterRowGroups)
+{
+  cudf_io::read_orc_args read_args{
+    cudf_io::source_info{reinterpret_cast<const char*>(row_index_stats_orc.data()),
+                         row_index_stats_orc.size()}};
+
+  // The second stripe is skipped, and the first and last row groups of the first one
+  read_args.filter = {{"a", cudf_io::filter_op::GREATER_EQUAL, 1500},
+                      cudf_io::filter_op::AND,
+                      {"a", cudf_io::filter_op::LESS, 2500}};
+  auto result      = cudf_io::read_orc(read_args);
+  cudf::test::expect_columns_equal(result.tbl->get_column(0),
+                                   *row_index_stats_rows({{1000, 3000}}));
+  EXPECT_EQ(1, result.metadata.num_filtered_row_groups);
+  EXPECT_EQ(6000u, result.metadata.num_filtered_rows);
+
+  // The trailing row groups of the first stripe and the leading ones of the second are skipped
+  read_args.filter = {{"a", cudf_io::filter_op::LESS, 1000},
+                      cudf_io::filter_op::OR,
+                      {"a", cudf_io::filter_op::GREATER_EQUAL, 7500}};
+  result           = cudf_io::read_orc(read_args);
+  cudf::test::expect_columns_equal(result.tbl->get_column(0),
+                                   *row_index_stats_rows({{0, 1000}, {7000, 8000}}));
+  EXPECT_EQ(0, result.metadata.num_filtered_row_groups);
+  EXPECT_EQ(6000u, result.metadata.num_filtered_rows);
+
+  // Rows kept at the end of a stripe and at the start of the next one are read together
+  read_args.filter = {{"a", cudf_io::filter_op::GREATER_EQUAL, 3500},
+                      cudf_io::filter_op::AND,
+                      {"a", cudf_io::filter_op::LESS, 4500}};
+  result           = cudf_io::read_orc(read_args);
+  cudf::test::expect_columns_equal(result.tbl->get_column(0),
+                                   *row_index_stats_rows({{3000, 5000}}));
+  EXPECT_EQ(6000u, result.metadata.num_filtered_rows);
+}
+
+TEST_F(OrcChunkedReaderTest, ReadLimits)
+{
+  // Three stripes of 10000 rows, each taking about 250KB to read
+  constexpr int num_rows = 10000;
+  std::vector<std::unique_ptr<table>> tables;
+  for (int i = 0; i < 3; ++i) {
+    auto values =
+      cudf::test::make_counting_transform_iterator(i * num_rows, [](auto j) { return j; });
+    auto validity = cudf::test::make_counting_transform_iterator(0, [](auto j) { return j % 7; });
+    column_wrapper<int32_t> col0{values, values + num_rows, validity};
+    column_wrapper<int64_t> col1{values, values + num_rows};
+    std::vector<std::unique_ptr<column>> cols;
+    cols.push_back(col0.release());
+    cols.push_back(col1.release());
+    tables.push_back(std::make_unique<table>(std::move(cols)));
+  }
+
+  auto filepath = temp_env->get_temp_filepath("ChunkedReadLimits.orc");
+  cudf_io::write_orc_chunked_args args{cudf_io::sink_info{filepath}};
+  auto state = cudf_io::write_orc_chunked_begin(args);
+  for (auto const& tbl : tables) { cudf_io::write_orc_chunked(*tbl, state); }
+  cudf_io::write_orc_chunked_end(state);
+
+  cudf_io::read_orc_chunked_args read_args{cudf_io::source_info{filepath}};
+  auto read_chunks = [&](size_t limit) {
+    read_args.chunk_read_limit = limit;
+    auto read_state            = cudf_io::read_orc_chunked_begin(read_args);
+    std::vector<cudf_io::table_with_metadata> results;
+    while (cudf_io::read_orc_chunked_has_next(read_state)) {
+      results.push_back(cudf_io::read_orc_chunked(read_state));
+    }
+    EXPECT_THROW(cudf_io::read_orc_chunked(read_state), cudf::logic_error);
+    return results;
+  };
+
+  auto results = read_chunks(0);
+  ASSERT_EQ(1u, results.size());
+  expect_tables_equal(*results[0].tbl, *cudf::concatenate({*tables[0], *tables[1], *tables[2]}));
+
+  // Stripes that do not fit together are read separately, even if each exceeds the limit
+  for (size_t limit : {1, 300000, 600000}) {
+    results = read_chunks(limit);
+    ASSERT_EQ(3u, results.size());
+    for (size_t i = 0; i < results.size(); ++i) {
+      expect_tables_equal(*results[i].tbl, *tables[i]);
+    }
+  }
+
+  // Each table gets half of the limit, as the next one is read while it is being used
+  results = read_chunks(1200000);
+  ASSERT_EQ(2u, results.size());
+  expect_tables_equal(*results[0].tbl, *cudf::concatenate({*tables[0], *tables[1]}));
+  expect_tables_equal(*results[1].tbl, *tables[2]);
+
+  // Stripes skipped by the filter are counted with the first table
+  read_args.filter = {"_col1", cudf_io::filter_op::GREATER_EQUAL, 2 * num_rows};
+  results          = read_chunks(300000);
+  ASSERT_EQ(1u, results.size());
+  expect_tables_equal(*results[0].tbl, *tables[2]);
+  EXPECT_EQ(2, results[0].metadata.num_filtered_row_groups);
+  EXPECT_EQ(2u * num_rows, results[0].metadata.num_filtered_rows);
+
+  // A single empty table is returned if no stripe can match
+  read_args.filter = {"_col1", cudf_io::filter_op::LESS, 0};
+  results          = read_chunks(300000);
+  ASSERT_EQ(1u, results.size());
+  EXPECT_EQ(0, results[0].tbl->num_rows());
+  EXPECT_EQ(2, results[0].tbl->num_columns());
+  EXPECT_EQ(3, results[0].metadata.num_filtered_row_groups);
+}
+
+TEST_F(OrcChunkedReaderTest, FilterRowGroups)
+{
+  cudf_io::read_orc_chunked_args read_args{
+    cudf_io::source_info{reinterpret_cast<const char*>(row_index_stats_orc.data()),
+                         row_index_stats_orc.size()}};
+  auto const read_chunks = [&]() {
+    std::vector<cudf_io::table_with_metadata> results;
+    auto read_state = cudf_io::read_orc_chunked_begin(read_args);
+    while (cudf_io::read_orc_chunked_has_next(read_state)) {
+      results.push_back(cudf_io::read_orc_chunked(read_state));
+    }
+    return results;
+  };
+
+  // Rows skipped between the kept row groups of two stripes split them into separate tables
+  read_args.filter = {{"a", cudf_io::filter_op::LESS, 1000},
+                      cudf_io::filter_op::OR,
+                      {"a", cudf_io::filter_op::GREATER_EQUAL, 7500}};
+  auto results     = read_chunks();
+  ASSERT_EQ(2u, results.size());
+  cudf::test::expect_columns_equal(results[0].tbl->get_column(0),
+                                   *row_index_stats_rows({{0, 1000}}));
+  cudf::test::expect_columns_equal(results[1].tbl->get_column(0),
+                                   *row_index_stats_rows({{7000, 8000}}));
+  EXPECT_EQ(6000u, results[0].metadata.num_filtered_rows);
+
+  read_args.filter = {{"a", cudf_io::filter_op::GREATER_EQUAL, 3500},
+                      cudf_io::filter_op::AND,
+                      {"a", cudf_io::filter_op::LESS, 4500}};
+  results          = read_chunks();
+  ASSERT_EQ(1u, results.size());
+  cudf::test::expect_columns_equal(results[0].tbl->get_column(0),
+                                   *row_index_stats_rows({{3000, 5000}}));
+}
+
 TYPED_TEST(OrcChunkedWriterNumericTypeTest, UnalignedSize)
 {
   // write out two 31 row tables and make sure they get
@@ -21,6 +21,7 @@
 #include <tests/utilities/type_lists.hpp>
 
 #include <cudf/concatenate.hpp>
+#include <cudf/copying.hpp>
 #include <cudf/io/data_sink.hpp>
 #include <cudf/io/functions.hpp>
 #include <cudf/strings/string_view.cuh>
@@ -28,6 +29,8 @@
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
 
+#include <sys/stat.h>
+
 #include <fstream>
 #include <type_traits>
 
@@ -123,6 +126,22 @@ TYPED_TEST_CASE(ParquetWriterTimestampTypeTest, SupportedTimestampTypes);
 struct ParquetChunkedWriterTest : public cudf::test::BaseFixture {
 };
 
+// Base test fixture for reader tests
+struct ParquetReaderTest : public cudf::test::BaseFixture {
+};
+
+// Base test fixture for chunked reader tests
+struct ParquetChunkedReaderTest : public cudf::test::BaseFixture {
+};
+
+// Base test fixture for dataset reader tests
+struct ParquetDatasetReaderTest : public cudf::test::BaseFixture {
+};
+
+// Base test fixture for dataset writer tests
+struct ParquetDatasetWriterTest : public cudf::test::BaseFixture {
+};
+
 // Typed test fixture for numeric type tests
 template <typename T>
 struct ParquetChunkedWriterNumericTypeTest : public ParquetChunkedWriterTest {
@@ -164,6 +183,157 @@ void expect_tables_equal(cudf::table_view const& lhs, cudf::table_view const& rh
   while (result != rhs.end()) { cudf::test::expect_columns_equal(*expected++, *result++); }
 }
 
+// Parquet file written by pyarrow (Apache Arrow C++ writer) with the DELTA_BINARY_PACKED,
+// DELTA_BYTE_ARRAY and BYTE_STREAM_SPLIT encodings; 150 rows in one row group. Written with:
+//   n = 150
+//   table = pyarrow.table({
+//     "i32": pyarrow.array([None if i % 7 == 0 else (i * 37) % 1000 - 500 for i in range(n)],
+//                          pyarrow.int32()),
+//     "i64": pyarrow.array([(1 << 40) + i * i for i in range(n)], pyarrow.int64()),
+//     "s": [None if i % 11 == 0 else "prefix_" + str(i // 3) + "x" * (i % 5) for i in range(n)],
+//     "f": pyarrow.array([i * 0.25 for i in range(n)], pyarrow.float32()),
+//     "d": [None if i % 5 == 0 else i * -1.5 for i in range(n)]})
+//   pyarrow.parquet.write_table(table, path, use_dictionary=False, compression="SNAPPY",
+//     write_statistics=False, store_schema=False, write_page_index=False,
+//     column_encoding={"i32": "DELTA_BINARY_PACKED", "i64": "DELTA_BINARY_PACKED",
+//                      "s": "DELTA_BYTE_ARRAY", "f": "BYTE_STREAM_SPLIT",
+//                      "d": "BYTE_STREAM_SPLIT"})
+std::vector<uint8_t> const column_encodings_parquet{
+  0x50, 0x41, 0x52, 0x31, 0x15, 0x00, 0x15, 0xaa, 0x03, 0x15, 0xda, 0x01,
+  0x2c, 0x15, 0xac, 0x02, 0x15, 0x0a, 0x15, 0x06, 0x15, 0x06, 0x1c, 0x00,
+  0x00, 0x00, 0xd5, 0x01, 0x2c, 0x14, 0x00, 0x00, 0x00, 0x27, 0x7e, 0xbf,
+  0xdf, 0xef, 0xf7, 0xfb, 0xfd, 0x1d, 0x07, 0x60, 0x37, 0x80, 0x01, 0x04,
+  0x80, 0x01, 0x9d, 0x07, 0x85, 0x0f, 0x0b, 0x0b, 0x0b, 0x0b, 0xe8, 0x43,
+  0x1f, 0xfa, 0xd0, 0x87, 0xbe, 0x06, 0xa2, 0x0f, 0x7d, 0x01, 0x0b, 0x44,
+  0x1a, 0x88, 0x3e, 0xf4, 0xa1, 0x0f, 0x7d, 0xe8, 0x6b, 0x20, 0xfa, 0xd0,
+  0x87, 0x3e, 0xf4, 0xa1, 0xaf, 0x04, 0x01, 0x16, 0x66, 0x21, 0x00, 0x08,
+  0x01, 0xa0, 0x81, 0x72, 0x21, 0x00, 0x08, 0x00, 0xa0, 0xaf, 0x6e, 0x21,
+  0x00, 0x0c, 0x07, 0x00, 0xf4, 0xa1, 0x6e, 0x21, 0x00, 0x04, 0x00, 0x80,
+  0x01, 0x84, 0x2c, 0x81, 0xe8, 0x43, 0x1f, 0xfa, 0xd0, 0x87, 0xbe, 0x06,
+  0xa2, 0x0f, 0x00, 0x15, 0x00, 0x15, 0xae, 0x03, 0x15, 0xe4, 0x02, 0x2c,
+  0x15, 0xac, 0x02, 0x15, 0x0a, 0x15, 0x06, 0x15, 0x06, 0x1c, 0x00, 0x00,
+  0x00, 0xd7, 0x01, 0x30, 0x03, 0x00, 0x00, 0x00, 0xac, 0x02, 0x01, 0x80,
+  0x02, 0x04, 0x96, 0x01, 0x80, 0x01, 0x01, 0xf0, 0x9a, 0x40, 0x02, 0x07,
+  0x08, 0x09, 0x00, 0x00, 0x01, 0xc1, 0x80, 0x50, 0x30, 0x1c, 0x10, 0x09,
+  0xc5, 0x82, 0xd1, 0x70, 0x3c, 0x20, 0x11, 0xc9, 0x84, 0x52, 0xb1, 0x5c,
+  0x30, 0x19, 0xcd, 0x86, 0xd3, 0xf1, 0x7c, 0x40, 0x21, 0xd1, 0x88, 0x54,
+  0x32, 0x9d, 0x50, 0x29, 0xd5, 0x8a, 0xd5, 0x72, 0xbd, 0x60, 0x31, 0xd9,
+  0x8c, 0x56, 0xb3, 0xdd, 0x70, 0x39, 0xdd, 0x8e, 0xd7, 0xf3, 0xfd, 0x80,
+  0x82, 0x84, 0x86, 0x88, 0x8a, 0x8c, 0x8e, 0x90, 0x92, 0x94, 0x96, 0x98,
+  0x9a, 0x9c, 0x9e, 0xa0, 0xa2, 0xa4, 0xa6, 0xa8, 0xaa, 0xac, 0xae, 0xb0,
+  0xb2, 0xb4, 0xb6, 0xb8, 0xba, 0xbc, 0xbe, 0xc0, 0xc2, 0xc4, 0xc6, 0xc8,
+  0xca, 0xcc, 0xce, 0xd0, 0xd2, 0xd4, 0xd6, 0xd8, 0xda, 0xdc, 0xde, 0xe0,
+  0xe2, 0xe4, 0xe6, 0xe8, 0xea, 0xec, 0xee, 0xf0, 0xf2, 0xf4, 0xf6, 0xf8,
+  0xfa, 0xfc, 0xfe, 0x00, 0x05, 0x12, 0x34, 0x88, 0x50, 0x21, 0x43, 0x87,
+  0x10, 0x25, 0x52, 0xb4, 0x88, 0x51, 0x23, 0x47, 0x8f, 0x20, 0x45, 0x92,
+  0x34, 0x89, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x05, 0x00, 0x15,
+  0x00, 0x15, 0x88, 0x07, 0x15, 0xc6, 0x04, 0x2c, 0x15, 0xac, 0x02, 0x15,
+  0x0e, 0x15, 0x06, 0x15, 0x06, 0x1c, 0x00, 0x00, 0x00, 0xc4, 0x03, 0x24,
+  0x1c, 0x00, 0x00, 0x00, 0x07, 0xfe, 0xf7, 0xbf, 0x12, 0x01, 0x52, 0x06,
+  0x00, 0xd8, 0x03, 0x80, 0x01, 0x04, 0x88, 0x01, 0x00, 0x09, 0x04, 0x04,
+  0x04, 0x04, 0x3e, 0x29, 0x74, 0x26, 0x46, 0x68, 0x61, 0x36, 0x29, 0x74,
+  0x63, 0x45, 0x68, 0x71, 0x36, 0x46, 0x67, 0x62, 0x45, 0x28, 0x66, 0x93,
+  0x42, 0x67, 0x72, 0x83, 0x06, 0x67, 0x93, 0x42, 0x28, 0x56, 0x84, 0x16,
+  0x46, 0x29, 0x74, 0x26, 0x56, 0x84, 0x71, 0x36, 0x29, 0x09, 0x29, 0x5c,
+  0x19, 0x67, 0x62, 0x45, 0x68, 0x70, 0x94, 0x42, 0x67, 0x62, 0x45, 0x19,
+  0x66, 0x93, 0x42, 0x03, 0x03, 0x00, 0x00, 0x00, 0xc4, 0x94, 0x0e, 0x00,
+  0x11, 0x01, 0x00, 0x80, 0x01, 0x5c, 0x04, 0x12, 0x0f, 0x01, 0x5c, 0xf0,
+  0x49, 0xb0, 0x75, 0x7a, 0xc8, 0xb3, 0x86, 0x88, 0xb8, 0x75, 0x8a, 0x3b,
+  0xa9, 0x86, 0x79, 0xc8, 0xa3, 0x87, 0x3c, 0xa9, 0x86, 0x88, 0x5b, 0xa7,
+  0x87, 0x3c, 0x6b, 0x98, 0x87, 0x5b, 0xb7, 0xc6, 0x93, 0x6a, 0x88, 0xb8,
+  0x75, 0x7a, 0xc8, 0x93, 0x7a, 0x78, 0xb8, 0x75, 0x7a, 0x88, 0xa8, 0x86,
+  0x88, 0xb8, 0x95, 0x87, 0x3c, 0xa9, 0x86, 0x89, 0x5a, 0xa7, 0x87, 0x3c,
+  0xb9, 0x85, 0x88, 0x5b, 0xa7, 0x09, 0x04, 0x00, 0x00, 0x00, 0x94, 0x60,
+  0x37, 0x05, 0x00, 0x11, 0x5d, 0x58, 0x00, 0x00, 0x00, 0x70, 0x72, 0x65,
+  0x66, 0x69, 0x78, 0x5f, 0x30, 0x78, 0x78, 0x31, 0x78, 0x78, 0x78, 0x78,
+  0x32, 0x78, 0x78, 0x78, 0x33, 0x01, 0x09, 0x00, 0x34, 0x01, 0x05, 0x0c,
+  0x35, 0x78, 0x78, 0x36, 0x01, 0x08, 0x14, 0x37, 0x78, 0x78, 0x78, 0x38,
+  0x78, 0x01, 0x01, 0x00, 0x39, 0x01, 0x05, 0x00, 0x31, 0x42, 0x2e, 0x00,
+  0x05, 0x2f, 0x42, 0x2e, 0x00, 0x05, 0x2d, 0x00, 0x32, 0x56, 0x2d, 0x00,
+  0x04, 0x78, 0x35, 0x52, 0x5b, 0x00, 0x00, 0x33, 0x36, 0x2e, 0x00, 0x6e,
+  0x86, 0x00, 0x00, 0x34, 0x36, 0x2b, 0x00, 0x01, 0x01, 0x3e, 0x2f, 0x00,
+  0x28, 0x38, 0x78, 0x78, 0x78, 0x78, 0x78, 0x39, 0x78, 0x78, 0x78, 0x78,
+  0x15, 0x00, 0x15, 0xbe, 0x09, 0x15, 0xa2, 0x03, 0x2c, 0x15, 0xac, 0x02,
+  0x15, 0x12, 0x15, 0x06, 0x15, 0x06, 0x1c, 0x00, 0x00, 0x00, 0xdf, 0x04,
+  0x1c, 0x03, 0x00, 0x00, 0x00, 0xac, 0x02, 0x01, 0x00, 0xfe, 0x01, 0x00,
+  0xfe, 0x01, 0x00, 0xfe, 0x01, 0x00, 0xfe, 0x01, 0x00, 0xae, 0x01, 0x00,
+  0xf0, 0xa4, 0x80, 0x00, 0x40, 0x80, 0xa0, 0xc0, 0xe0, 0x00, 0x10, 0x20,
+  0x30, 0x40, 0x50, 0x60, 0x70, 0x80, 0x88, 0x90, 0x98, 0xa0, 0xa8, 0xb0,
+  0xb8, 0xc0, 0xc8, 0xd0, 0xd8, 0xe0, 0xe8, 0xf0, 0xf8, 0x00, 0x04, 0x08,
+  0x0c, 0x10, 0x14, 0x18, 0x1c, 0x20, 0x24, 0x28, 0x2c, 0x30, 0x34, 0x38,
+  0x3c, 0x40, 0x44, 0x48, 0x4c, 0x50, 0x54, 0x58, 0x5c, 0x60, 0x64, 0x68,
+  0x6c, 0x70, 0x74, 0x78, 0x7c, 0x80, 0x82, 0x84, 0x86, 0x88, 0x8a, 0x8c,
+  0x8e, 0x90, 0x92, 0x94, 0x96, 0x98, 0x9a, 0x9c, 0x9e, 0xa0, 0xa2, 0xa4,
+  0xa6, 0xa8, 0xaa, 0xac, 0xae, 0xb0, 0xb2, 0xb4, 0xb6, 0xb8, 0xba, 0xbc,
+  0xbe, 0xc0, 0xc2, 0xc4, 0xc6, 0xc8, 0xca, 0xcc, 0xce, 0xd0, 0xd2, 0xd4,
+  0xd6, 0xd8, 0xda, 0xdc, 0xde, 0xe0, 0xe2, 0xe4, 0xe6, 0xe8, 0xea, 0xec,
+  0xee, 0xf0, 0xf2, 0xf4, 0xf6, 0xf8, 0xfa, 0xfc, 0xfe, 0x00, 0x01, 0x02,
+  0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e,
+  0x0f, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x00, 0x3e, 0x3f, 0x3f, 0x3f,
+  0x3f, 0x3f, 0x3f, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x3e,
+  0x05, 0x00, 0x00, 0x41, 0xfe, 0x01, 0x00, 0x7a, 0x01, 0x00, 0x00, 0x42,
+  0x52, 0x01, 0x00, 0x15, 0x00, 0x15, 0xb0, 0x0f, 0x15, 0xde, 0x04, 0x2c,
+  0x15, 0xac, 0x02, 0x15, 0x12, 0x15, 0x06, 0x15, 0x06, 0x1c, 0x00, 0x00,
+  0x00, 0xd8, 0x07, 0x24, 0x14, 0x00, 0x00, 0x00, 0x27, 0xde, 0x7b, 0xef,
+  0xbd, 0xf7, 0x32, 0x05, 0x00, 0x04, 0x3d, 0x00, 0xfe, 0x01, 0x00, 0xfe,
+  0x01, 0x00, 0xfe, 0x01, 0x00, 0xfe, 0x01, 0x00, 0xfe, 0x01, 0x00, 0xfe,
+  0x01, 0x00, 0xfe, 0x01, 0x00, 0xfe, 0x01, 0x00, 0xfe, 0x01, 0x00, 0x7a,
+  0x01, 0x00, 0xf0, 0xf5, 0x80, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 0x80,
+  0x80, 0x80, 0x40, 0x00, 0x80, 0x40, 0x00, 0xc0, 0x40, 0x00, 0xc0, 0x80,
+  0x00, 0xc0, 0x80, 0x40, 0xc0, 0x80, 0x20, 0x80, 0x40, 0xa0, 0x00, 0x60,
+  0x20, 0x80, 0xe0, 0x40, 0x00, 0x60, 0xc0, 0x20, 0xe0, 0x40, 0xa0, 0x00,
+  0xc0, 0x20, 0x80, 0xe0, 0xa0, 0x00, 0x60, 0xc0, 0x80, 0xe0, 0x40, 0xa0,
+  0x60, 0xc0, 0x20, 0x80, 0x20, 0x50, 0x80, 0xb0, 0x10, 0x40, 0x70, 0xa0,
+  0x00, 0x30, 0x60, 0x90, 0xf0, 0x20, 0x50, 0x80, 0xe0, 0x10, 0x40, 0x70,
+  0xd0, 0x00, 0x30, 0x60, 0xc0, 0xf0, 0x20, 0x50, 0xb0, 0xe0, 0x10, 0x40,
+  0xa0, 0xd0, 0x00, 0x30, 0x90, 0xc0, 0xf0, 0x20, 0x80, 0xb0, 0xe0, 0x10,
+  0x70, 0xa0, 0xd0, 0x00, 0x60, 0x90, 0xc0, 0xf0, 0xf8, 0x08, 0x12, 0x18,
+  0x22, 0x25, 0x28, 0x2b, 0x30, 0x32, 0x33, 0x35, 0x38, 0x39, 0x3b, 0x3c,
+  0x3f, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x45, 0x47, 0x48, 0x48, 0x49,
+  0x4b, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f, 0x50, 0x50, 0x51, 0x51, 0x52, 0x52,
+  0x53, 0x53, 0x53, 0x54, 0x55, 0x55, 0x55, 0x56, 0x56, 0x57, 0x57, 0x58,
+  0x58, 0x59, 0x59, 0x59, 0x5a, 0x5b, 0x5b, 0x5b, 0x5c, 0x5c, 0x5d, 0x5d,
+  0x5e, 0x5e, 0x5f, 0x5f, 0x60, 0x60, 0x60, 0x60, 0x61, 0x61, 0x61, 0x61,
+  0x62, 0x62, 0x62, 0x62, 0x62, 0x63, 0x63, 0x63, 0x63, 0x64, 0x64, 0x64,
+  0x64, 0x65, 0x65, 0x65, 0x65, 0x65, 0x66, 0x66, 0x66, 0x66, 0x67, 0x67,
+  0x67, 0x67, 0x68, 0x68, 0x68, 0x68, 0x68, 0x69, 0x69, 0x69, 0x69, 0x6a,
+  0x6a, 0x6a, 0x6a, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0xbf, 0xc0, 0xc0, 0xc0,
+  0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xfe, 0x08,
+  0x00, 0xa6, 0x08, 0x00, 0x15, 0x04, 0x19, 0x6c, 0x35, 0x00, 0x18, 0x06,
+  0x73, 0x63, 0x68, 0x65, 0x6d, 0x61, 0x15, 0x0a, 0x00, 0x15, 0x02, 0x25,
+  0x02, 0x18, 0x03, 0x69, 0x33, 0x32, 0x00, 0x15, 0x04, 0x25, 0x02, 0x18,
+  0x03, 0x69, 0x36, 0x34, 0x00, 0x15, 0x0c, 0x25, 0x02, 0x18, 0x01, 0x73,
+  0x25, 0x00, 0x4c, 0x1c, 0x00, 0x00, 0x00, 0x15, 0x08, 0x25, 0x02, 0x18,
+  0x01, 0x66, 0x00, 0x15, 0x0a, 0x25, 0x02, 0x18, 0x01, 0x64, 0x00, 0x16,
+  0xac, 0x02, 0x19, 0x1c, 0x19, 0x5c, 0x26, 0x00, 0x1c, 0x15, 0x02, 0x19,
+  0x25, 0x06, 0x0a, 0x19, 0x18, 0x03, 0x69, 0x33, 0x32, 0x15, 0x02, 0x16,
+  0xac, 0x02, 0x16, 0xd6, 0x03, 0x16, 0x86, 0x02, 0x26, 0x08, 0x49, 0x1c,
+  0x15, 0x00, 0x15, 0x0a, 0x15, 0x02, 0x00, 0x3c, 0x29, 0x06, 0x19, 0x26,
+  0x2c, 0x80, 0x02, 0x00, 0x00, 0x00, 0x26, 0x00, 0x1c, 0x15, 0x04, 0x19,
+  0x25, 0x06, 0x0a, 0x19, 0x18, 0x03, 0x69, 0x36, 0x34, 0x15, 0x02, 0x16,
+  0xac, 0x02, 0x16, 0xda, 0x03, 0x16, 0x90, 0x03, 0x26, 0x8e, 0x02, 0x49,
+  0x1c, 0x15, 0x00, 0x15, 0x0a, 0x15, 0x02, 0x00, 0x3c, 0x29, 0x06, 0x19,
+  0x26, 0x00, 0xac, 0x02, 0x00, 0x00, 0x00, 0x26, 0x00, 0x1c, 0x15, 0x0c,
+  0x19, 0x25, 0x06, 0x0e, 0x19, 0x18, 0x01, 0x73, 0x15, 0x02, 0x16, 0xac,
+  0x02, 0x16, 0xb4, 0x07, 0x16, 0xf2, 0x04, 0x26, 0x9e, 0x05, 0x49, 0x1c,
+  0x15, 0x00, 0x15, 0x0e, 0x15, 0x02, 0x00, 0x3c, 0x16, 0xc0, 0x14, 0x19,
+  0x06, 0x19, 0x26, 0x1c, 0x90, 0x02, 0x00, 0x00, 0x00, 0x26, 0x00, 0x1c,
+  0x15, 0x08, 0x19, 0x25, 0x06, 0x12, 0x19, 0x18, 0x01, 0x66, 0x15, 0x02,
+  0x16, 0xac, 0x02, 0x16, 0xea, 0x09, 0x16, 0xce, 0x03, 0x26, 0x90, 0x0a,
+  0x49, 0x1c, 0x15, 0x00, 0x15, 0x12, 0x15, 0x02, 0x00, 0x3c, 0x29, 0x06,
+  0x19, 0x26, 0x00, 0xac, 0x02, 0x00, 0x00, 0x00, 0x26, 0x00, 0x1c, 0x15,
+  0x0a, 0x19, 0x25, 0x06, 0x12, 0x19, 0x18, 0x01, 0x64, 0x15, 0x02, 0x16,
+  0xac, 0x02, 0x16, 0xdc, 0x0f, 0x16, 0x8a, 0x05, 0x26, 0xde, 0x0d, 0x49,
+  0x1c, 0x15, 0x00, 0x15, 0x12, 0x15, 0x02, 0x00, 0x3c, 0x29, 0x06, 0x19,
+  0x26, 0x3c, 0xf0, 0x01, 0x00, 0x00, 0x00, 0x16, 0xaa, 0x28, 0x16, 0xac,
+  0x02, 0x26, 0x08, 0x16, 0xe0, 0x12, 0x00, 0x28, 0x20, 0x70, 0x61, 0x72,
+  0x71, 0x75, 0x65, 0x74, 0x2d, 0x63, 0x70, 0x70, 0x2d, 0x61, 0x72, 0x72,
+  0x6f, 0x77, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x32,
+  0x36, 0x2e, 0x30, 0x2e, 0x30, 0x19, 0x5c, 0x1c, 0x00, 0x00, 0x1c, 0x00,
+  0x00, 0x1c, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x7b,
+  0x01, 0x00, 0x00, 0x50, 0x41, 0x52, 0x31
+};
+
 }  // namespace
 
 TYPED_TEST(ParquetWriterNumericTypeTest, SingleColumn)
@@ -502,6 +672,294 @@ TEST_F(ParquetWriterTest, NonNullable)
   expect_tables_equal(*result.tbl, *expected);
 }
 
+TEST_F(ParquetWriterTest, ReadMethods)
+{
+  srand(31337);
+  auto expected = create_random_fixed_table<int>(4, 4 * 1024 * 1024, true);
+
+  auto filepath = temp_env->get_temp_filepath("ReadMethods.parquet");
+  cudf_io::write_parquet_args args{cudf_io::sink_info{filepath}, *expected};
+  cudf_io::write_parquet(args);
+
+  for (auto method : {cudf_io::file_read_method::MMAP,
+                      cudf_io::file_read_method::PREAD,
+                      cudf_io::file_read_method::DIRECT}) {
+    cudf_io::read_parquet_args read_args{cudf_io::source_info{filepath}};
+    read_args.read_method = method;
+    auto result           = cudf_io::read_parquet(read_args);
+
+    expect_tables_equal(*result.tbl, *expected);
+  }
+}
+
+TEST_F(ParquetWriterTest, FooterCache)
+{
+  srand(31337);
+  auto table1 = create_random_fixed_table<int>(8, 1000, true);
+  auto table2 = create_random_fixed_table<int>(8, 2000, true);
+
+  auto filepath = temp_env->get_temp_filepath("FooterCache.parquet");
+  cudf_io::write_parquet_args args{cudf_io::sink_info{filepath}, *table1};
+  cudf_io::write_parquet(args);
+
+  auto cache = std::make_shared<cudf_io::metadata_cache>();
+  cudf_io::read_parquet_args read_args{cudf_io::source_info{filepath}};
+  read_args.footer_cache = cache;
+  for (int i = 0; i < 3; ++i) {
+    auto result = cudf_io::read_parquet(read_args);
+    expect_tables_equal(*result.tbl, *table1);
+  }
+  EXPECT_EQ(1u, cache->misses());
+  EXPECT_EQ(2u, cache->hits());
+  EXPECT_EQ(1u, cache->num_entries());
+  EXPECT_GT(cache->size_bytes(), 0u);
+
+  // A rewritten file is parsed again
+  cudf_io::write_parquet_args args2{cudf_io::sink_info{filepath}, *table2};
+  cudf_io::write_parquet(args2);
+  auto result = cudf_io::read_parquet(read_args);
+  expect_tables_equal(*result.tbl, *table2);
+  EXPECT_EQ(2u, cache->misses());
+
+  // Footers larger than the budget are not cached
+  read_args.footer_cache = std::make_shared<cudf_io::metadata_cache>(1);
+  cudf_io::read_parquet(read_args);
+  cudf_io::read_parquet(read_args);
+  EXPECT_EQ(0u, read_args.footer_cache->hits());
+  EXPECT_EQ(0u, read_args.footer_cache->num_entries());
+}
+
+TEST_F(ParquetWriterTest, FileSinkBackgroundFlush)
+{
+  srand(31337);
+  auto expected = create_random_fixed_table<int>(4, 4 * 1024 * 1024, true);
+
+  auto filepath = temp_env->get_temp_filepath("FileSinkBackgroundFlush.parquet");
+  auto sink     = cudf::io::data_sink::create(filepath, true);
+  cudf_io::write_parquet_args args{cudf_io::sink_info{sink.get()}, *expected};
+  cudf_io::write_parquet(args);
+
+  auto const stats = sink->flush_statistics();
+  EXPECT_EQ(stats.bytes_flushed, sink->bytes_written());
+  EXPECT_GT(stats.num_flushes, 0u);
+
+  cudf_io::read_parquet_args read_args{cudf_io::source_info{filepath}};
+  auto result = cudf_io::read_parquet(read_args);
+
+  expect_tables_equal(*result.tbl, *expected);
+
+  // The writer creates a background-flushing sink for a file path on request
+  auto args_filepath = temp_env->get_temp_filepath("FileSinkBackgroundFlushArgs.parquet");
+  cudf_io::write_parquet_args path_args{cudf_io::sink_info{args_filepath}, *expected};
+  path_args.background_flush = true;
+  cudf_io::write_parquet(path_args);
+
+  cudf_io::read_parquet_args path_read_args{cudf_io::source_info{args_filepath}};
+  auto path_result = cudf_io::read_parquet(path_read_args);
+
+  expect_tables_equal(*path_result.tbl, *expected);
+}
+
+TEST_F(ParquetWriterTest, HostCodecs)
+{
+  constexpr auto num_rows = 100000;
+
+  auto sequence = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 1000; });
+  auto validity = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 7; });
+  column_wrapper<int32_t> col0{sequence, sequence + num_rows, validity};
+  column_wrapper<double> col1{sequence, sequence + num_rows};
+  std::vector<std::unique_ptr<column>> cols;
+  cols.push_back(col0.release());
+  cols.push_back(col1.release());
+  auto expected = std::make_unique<table>(std::move(cols));
+
+  std::vector<cudf_io::compression_type> codecs{cudf_io::compression_type::LZ4};
+#ifdef CUDF_WITH_ZSTD
+  codecs.push_back(cudf_io::compression_type::ZSTD);
+#endif
+  for (auto codec : codecs) {
+    auto filepath = temp_env->get_temp_filepath("HostCodecs.parquet");
+    cudf_io::write_parquet_args out_args{cudf_io::sink_info{filepath}, expected->view()};
+    out_args.compression = codec;
+    cudf_io::write_parquet(out_args);
+
+    cudf_io::read_parquet_args in_args{cudf_io::source_info{filepath}};
+    auto result = cudf_io::read_parquet(in_args);
+
+    expect_tables_equal(expected->view(), result.tbl->view());
+  }
+}
+
+TEST_F(ParquetWriterTest, ColumnEncodings)
+{
+  constexpr auto num_rows = 10000;
+
+  auto col0_data = random_values<int32_t>(num_rows);
+  auto col1_data = cudf::test::make_counting_transform_iterator(
+    0, [](auto i) { return int64_t{1} << 40 | (i * 37) % 1000; });
+  auto col4_data = random_values<float>(num_rows);
+  auto col5_data = random_values<double>(num_rows);
+  auto strings   = cudf::test::make_counting_transform_iterator(
+    0, [](auto i) { return "prefix_" + std::to_string(i / 3) + std::string(i % 5, 'x'); });
+  auto validity = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 7; });
+
+  column_wrapper<int32_t> col0{col0_data.begin(), col0_data.end(), validity};
+  column_wrapper<int64_t> col1{col1_data, col1_data + num_rows};
+  column_wrapper<cudf::string_view> col2{strings, strings + num_rows, validity};
+  column_wrapper<cudf::string_view> col3{strings, strings + num_rows};
+  column_wrapper<float> col4{col4_data.begin(), col4_data.end(), validity};
+  column_wrapper<double> col5{col5_data.begin(), col5_data.end()};
+
+  std::vector<std::unique_ptr<column>> cols;
+  cols.push_back(col0.release());
+  cols.push_back(col1.release());
+  cols.push_back(col2.release());
+  cols.push_back(col3.release());
+  cols.push_back(col4.release());
+  cols.push_back(col5.release());
+  auto expected = std::make_unique<table>(std::move(cols));
+
+  auto filepath = temp_env->get_temp_filepath("ColumnEncodings.parquet");
+  cudf_io::write_parquet_args out_args{cudf_io::sink_info{filepath}, expected->view()};
+  out_args.column_encodings = {cudf_io::column_encoding::DELTA_BINARY_PACKED,
+                               cudf_io::column_encoding::DELTA_BINARY_PACKED,
+                               cudf_io::column_encoding::DELTA_LENGTH_BYTE_ARRAY,
+                               cudf_io::column_encoding::DELTA_BYTE_ARRAY,
+                               cudf_io::column_encoding::BYTE_STREAM_SPLIT,
+                               cudf_io::column_encoding::BYTE_STREAM_SPLIT};
+  cudf_io::write_parquet(out_args);
+
+  cudf_io::read_parquet_args in_args{cudf_io::source_info{filepath}};
+  auto result = cudf_io::read_parquet(in_args);
+
+  expect_tables_equal(expected->view(), result.tbl->view());
+}
+
+TEST_F(ParquetWriterTest, ColumnEncodingsUnsupportedType)
+{
+  auto sequence = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i; });
+  column_wrapper<double> col{sequence, sequence + 100};
+  std::vector<std::unique_ptr<column>> cols;
+  cols.push_back(col.release());
+  auto expected = std::make_unique<table>(std::move(cols));
+
+  auto filepath = temp_env->get_temp_filepath("ColumnEncodingsUnsupportedType.parquet");
+  cudf_io::write_parquet_args out_args{cudf_io::sink_info{filepath}, expected->view()};
+  out_args.column_encodings = {cudf_io::column_encoding::DELTA_BINARY_PACKED};
+  EXPECT_THROW(cudf_io::write_parquet(out_args), cudf::logic_error);
+}
+
+TEST_F(ParquetWriterTest, V2DataPages)
+{
+  constexpr auto num_rows = 50000;
+
+  auto col0_data = random_values<int32_t>(num_rows);
+  auto col1_data = random_values<int64_t>(num_rows);
+  auto col2_data = random_values<double>(num_rows);
+  auto strings   = cudf::test::make_counting_transform_iterator(
+    0, [](auto i) { return "string_" + std::to_string(i % 100); });
+  auto validity  = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 5; });
+  auto all_nulls = cudf::test::make_counting_transform_iterator(0, [](auto) { return false; });
+
+  column_wrapper<int32_t> col0{col0_data.begin(), col0_data.end(), validity};
+  column_wrapper<int64_t> col1{col1_data.begin(), col1_data.end()};
+  column_wrapper<double> col2{col2_data.begin(), col2_data.end(), all_nulls};
+  column_wrapper<cudf::string_view> col3{strings, strings + num_rows, validity};
+
+  std::vector<std::unique_ptr<column>> cols;
+  cols.push_back(col0.release());
+  cols.push_back(col1.release());
+  cols.push_back(col2.release());
+  cols.push_back(col3.release());
+  auto expected = std::make_unique<table>(std::move(cols));
+
+  for (auto codec : {cudf_io::compression_type::NONE, cudf_io::compression_type::SNAPPY}) {
+    auto filepath = temp_env->get_temp_filepath("V2DataPages.parquet");
+    cudf_io::write_parquet_args out_args{cudf_io::sink_info{filepath}, expected->view()};
+    out_args.compression      = codec;
+    out_args.stats_level      = cudf_io::statistics_freq::STATISTICS_PAGE;
+    out_args.write_v2_headers = true;
+    // Without a dictionary, the pages of the all-null column have no values to compress
+    out_args.column_encodings = {cudf_io::column_encoding::AUTO,
+                                 cudf_io::column_encoding::AUTO,
+                                 cudf_io::column_encoding::PLAIN,
+                                 cudf_io::column_encoding::AUTO};
+    cudf_io::write_parquet(out_args);
+
+    cudf_io::read_parquet_args in_args{cudf_io::source_info{filepath}};
+    auto result = cudf_io::read_parquet(in_args);
+
+    expect_tables_equal(expected->view(), result.tbl->view());
+  }
+}
+
+TEST_F(ParquetWriterTest, V2DeltaPagesAllNulls)
+{
+  constexpr auto num_rows = 20000;
+
+  auto col0_data = random_values<int64_t>(num_rows);
+  auto strings   = cudf::test::make_counting_transform_iterator(
+    0, [](auto i) { return "string_" + std::to_string(i % 100); });
+  auto all_nulls = cudf::test::make_counting_transform_iterator(0, [](auto) { return false; });
+
+  column_wrapper<int64_t> col0{col0_data.begin(), col0_data.end(), all_nulls};
+  column_wrapper<cudf::string_view> col1{strings, strings + num_rows, all_nulls};
+  column_wrapper<int64_t> col2{col0_data.begin(), col0_data.end()};
+
+  std::vector<std::unique_ptr<column>> cols;
+  cols.push_back(col0.release());
+  cols.push_back(col1.release());
+  cols.push_back(col2.release());
+  auto expected = std::make_unique<table>(std::move(cols));
+
+  for (auto codec : {cudf_io::compression_type::SNAPPY, cudf_io::compression_type::ZSTD}) {
+    auto filepath = temp_env->get_temp_filepath("V2DeltaPagesAllNulls.parquet");
+    cudf_io::write_parquet_args out_args{cudf_io::sink_info{filepath}, expected->view()};
+    out_args.compression      = codec;
+    out_args.write_v2_headers = true;
+    // The delta encoded pages of the all-null columns still carry the headers of their streams
+    out_args.column_encodings = {cudf_io::column_encoding::DELTA_BINARY_PACKED,
+                                 cudf_io::column_encoding::DELTA_BYTE_ARRAY,
+                                 cudf_io::column_encoding::DELTA_BINARY_PACKED};
+    cudf_io::write_parquet(out_args);
+
+    cudf_io::read_parquet_args in_args{cudf_io::source_info{filepath}};
+    auto result = cudf_io::read_parquet(in_args);
+
+    expect_tables_equal(expected->view(), result.tbl->view());
+  }
+}
+
+TEST_F(ParquetWriterTest, HostDecompression)
+{
+  constexpr auto num_rows = 10000;
+
+  auto col0_data = random_values<int64_t>(num_rows);
+  auto strings   = cudf::test::make_counting_transform_iterator(
+    0, [](auto i) { return "string_" + std::to_string(i % 100); });
+  auto validity = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 5; });
+
+  column_wrapper<int64_t> col0{col0_data.begin(), col0_data.end(), validity};
+  column_wrapper<cudf::string_view> col1{strings, strings + num_rows};
+
+  std::vector<std::unique_ptr<column>> cols;
+  cols.push_back(col0.release());
+  cols.push_back(col1.release());
+  auto expected = std::make_unique<table>(std::move(cols));
+
+  auto filepath = temp_env->get_temp_filepath("HostDecompression.parquet");
+  cudf_io::write_parquet_args out_args{cudf_io::sink_info{filepath}, expected->view()};
+  out_args.compression = cudf_io::compression_type::SNAPPY;
+  cudf_io::write_parquet(out_args);
+
+  // Every page is below the threshold, so they are all decompressed on the host
+  cudf_io::read_parquet_args in_args{cudf_io::source_info{filepath}};
+  in_args.host_decompression_threshold = 1 << 30;
+  auto result                          = cudf_io::read_parquet(in_args);
+
+  expect_tables_equal(expected->view(), result.tbl->view());
+}
+
 // custom data sink that supports device writes. uses plain file io.
 class custom_test_data_sink : public cudf::io::data_sink {
  public:
@@ -778,6 +1236,410 @@ TEST_F(ParquetChunkedWriterTest, ReadRowGroupsError)
   EXPECT_THROW(cudf_io::read_parquet(read_args), cudf::logic_error);
 }
 
+TEST_F(ParquetChunkedWriterTest, FilterRowGroups)
+{
+  // Three row groups with disjoint ranges of values in the first column
+  std::vector<std::unique_ptr<table>> tables;
+  for (int i = 0; i < 3; ++i) {
+    auto values   = cudf::test::make_counting_transform_iterator(i * 100, [](auto j) { return j; });
+    auto validity = cudf::test::make_counting_transform_iterator(0, [](auto j) { return j % 5; });
+    auto labels   = cudf::test::make_counting_transform_iterator(0, [i](auto) { return i; });
+    column_wrapper<int32_t> col0{values, values + 100, validity};
+    column_wrapper<int64_t> col1{labels, labels + 100};
+    std::vector<std::unique_ptr<column>> cols;
+    cols.push_back(col0.release());
+    cols.push_back(col1.release());
+    tables.push_back(std::make_unique<table>(std::move(cols)));
+  }
+
+  auto filepath = temp_env->get_temp_filepath("ChunkedFilterRowGroups.parquet");
+  cudf_io::write_parquet_chunked_args args{cudf_io::sink_info{filepath}};
+  auto state = cudf_io::write_parquet_chunked_begin(args);
+  for (auto const& tbl : tables) { cudf_io::write_parquet_chunked(*tbl, state); }
+  cudf_io::write_parquet_chunked_end(state);
+
+  cudf_io::read_parquet_args read_args{cudf_io::source_info{filepath}};
+  read_args.filter = {"_col0", cudf_io::filter_op::GREATER_EQUAL, 250};
+  auto result      = cudf_io::read_parquet(read_args);
+  expect_tables_equal(*result.tbl, *tables[2]);
+  EXPECT_EQ(2, result.metadata.num_filtered_row_groups);
+  EXPECT_GT(result.metadata.num_filtered_bytes, 0u);
+
+  read_args.filter = {{"_col0", cudf_io::filter_op::LESS, 50},
+                      cudf_io::filter_op::OR,
+                      {"_col1", cudf_io::filter_op::EQUAL, 2}};
+  result           = cudf_io::read_parquet(read_args);
+  expect_tables_equal(*result.tbl, *cudf::concatenate({*tables[0], *tables[2]}));
+  EXPECT_EQ(1, result.metadata.num_filtered_row_groups);
+
+  read_args.filter = {{"_col0", cudf_io::filter_op::GREATER, 150.5},
+                      cudf_io::filter_op::AND,
+                      {"_col1", cudf_io::filter_op::EQUAL, 0}};
+  result           = cudf_io::read_parquet(read_args);
+  EXPECT_EQ(0, result.tbl->num_rows());
+  EXPECT_EQ(2, result.tbl->num_columns());
+  EXPECT_EQ(3, result.metadata.num_filtered_row_groups);
+
+  // Columns without statistics or unknown columns never cause row groups to be skipped
+  read_args.filter = {"missing", cudf_io::filter_op::EQUAL, 1};
+  result           = cudf_io::read_parquet(read_args);
+  EXPECT_EQ(300, result.tbl->num_rows());
+  EXPECT_EQ(0, result.metadata.num_filtered_row_groups);
+
+  read_args.filter = {"_col0", cudf_io::filter_op::IS_NULL};
+  result           = cudf_io::read_parquet(read_args);
+  EXPECT_EQ(300, result.tbl->num_rows());
+  read_args.filter = {"_col1", cudf_io::filter_op::IS_NULL};
+  result           = cudf_io::read_parquet(read_args);
+  EXPECT_EQ(0, result.tbl->num_rows());
+
+  // Row ranges cannot be combined with a filter
+  read_args.skip_rows = 10;
+  EXPECT_THROW(cudf_io::read_parquet(read_args), cudf::logic_error);
+}
+
+TEST_F(ParquetChunkedWriterTest, PageIndexes)
+{
+  // Enough rows for each column chunk to span several pages; the first column is ascending and
+  // the second descending, so only the first and last pages of each can match the filter below
+  constexpr cudf::size_type num_rows = 400000;
+  auto ascending  = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i; });
+  auto descending = cudf::test::make_counting_transform_iterator(
+    0, [](auto i) { return static_cast<int32_t>(num_rows - 1 - i); });
+  column_wrapper<int64_t> col0{ascending, ascending + num_rows};
+  column_wrapper<int32_t> col1{descending, descending + num_rows};
+  std::vector<std::unique_ptr<column>> cols;
+  cols.push_back(col0.release());
+  cols.push_back(col1.release());
+  auto expected = std::make_unique<table>(std::move(cols));
+
+  auto filepath = temp_env->get_temp_filepath("ChunkedPageIndexes.parquet");
+  cudf_io::write_parquet_chunked_args args{cudf_io::sink_info{filepath},
+                                           nullptr,
+                                           cudf_io::compression_type::NONE,
+                                           cudf_io::statistics_freq::STATISTICS_PAGE};
+  auto state = cudf_io::write_parquet_chunked_begin(args);
+  cudf_io::write_parquet_chunked(*expected, state);
+  cudf_io::write_parquet_chunked_end(state);
+
+  // Row ranges only read the overlapping pages of each chunk
+  cudf_io::read_parquet_args read_args{cudf_io::source_info{filepath}};
+  for (auto const& range : std::vector<std::pair<cudf::size_type, cudf::size_type>>{
+         {0, 10}, {1, 5000}, {131000, 2000}, {200000, 150000}, {num_rows - 7, 7}}) {
+    read_args.skip_rows = range.first;
+    read_args.num_rows  = range.second;
+    auto result         = cudf_io::read_parquet(read_args);
+    auto expected_range =
+      cudf::slice(*expected, {range.first, range.first + range.second}).front();
+    expect_tables_equal(*result.tbl, expected_range);
+  }
+
+  // No page holds values below 1000 in both columns
+  read_args = cudf_io::read_parquet_args{cudf_io::source_info{filepath}};
+
+  read_args.filter = {{"_col0", cudf_io::filter_op::LESS, 1000},
+                      cudf_io::filter_op::AND,
+                      {"_col1", cudf_io::filter_op::LESS, 1000}};
+  auto result      = cudf_io::read_parquet(read_args);
+  EXPECT_EQ(0, result.tbl->num_rows());
+  EXPECT_EQ(1, result.metadata.num_filtered_row_groups);
+
+  read_args.filter = {{"_col0", cudf_io::filter_op::LESS, 1000},
+                      cudf_io::filter_op::AND,
+                      {"_col1", cudf_io::filter_op::GREATER, num_rows - 1000}};
+  result           = cudf_io::read_parquet(read_args);
+  expect_tables_equal(*result.tbl, *expected);
+  EXPECT_EQ(0, result.metadata.num_filtered_row_groups);
+}
+
+TEST_F(ParquetReaderTest, ForeignColumnEncodings)
+{
+  constexpr auto num_rows = 150;
+
+  auto i32_data = cudf::test::make_counting_transform_iterator(
+    0, [](auto i) { return static_cast<int32_t>((i * 37) % 1000 - 500); });
+  auto i64_data = cudf::test::make_counting_transform_iterator(
+    0, [](auto i) { return (int64_t{1} << 40) + int64_t{i} * i; });
+  auto str_data = cudf::test::make_counting_transform_iterator(
+    0, [](auto i) { return "prefix_" + std::to_string(i / 3) + std::string(i % 5, 'x'); });
+  auto flt_data = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i * 0.25f; });
+  auto dbl_data = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i * -1.5; });
+
+  auto i32_valid =
+    cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 7 != 0; });
+  auto str_valid =
+    cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 11 != 0; });
+  auto dbl_valid =
+    cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 5 != 0; });
+
+  column_wrapper<int32_t> i32_col{i32_data, i32_data + num_rows, i32_valid};
+  column_wrapper<int64_t> i64_col{i64_data, i64_data + num_rows};
+  column_wrapper<cudf::string_view> str_col{str_data, str_data + num_rows, str_valid};
+  column_wrapper<float> flt_col{flt_data, flt_data + num_rows};
+  column_wrapper<double> dbl_col{dbl_data, dbl_data + num_rows, dbl_valid};
+
+  cudf_io::read_parquet_args in_args{
+    cudf_io::source_info{reinterpret_cast<const char*>(column_encodings_parquet.data()),
+                         column_encodings_parquet.size()}};
+  auto result = cudf_io::read_parquet(in_args);
+
+  EXPECT_EQ(result.metadata.column_names, std::vector<std::string>({"i32", "i64", "s", "f", "d"}));
+  expect_tables_equal(cudf::table_view{{i32_col, i64_col, str_col, flt_col, dbl_col}},
+                      result.tbl->view());
+}
+
+TEST_F(ParquetChunkedReaderTest, ReadLimits)
+{
+  // Three row groups of about 120KB of decoded columns each
+  constexpr cudf::size_type num_rows = 10000;
+  std::vector<std::unique_ptr<table>> tables;
+  for (int i = 0; i < 3; ++i) {
+    auto values =
+      cudf::test::make_counting_transform_iterator(i * num_rows, [](auto j) { return j; });
+    auto validity = cudf::test::make_counting_transform_iterator(0, [](auto j) { return j % 5; });
+    column_wrapper<int32_t> col0{values, values + num_rows, validity};
+    column_wrapper<int64_t> col1{values, values + num_rows};
+    std::vector<std::unique_ptr<column>> cols;
+    cols.push_back(col0.release());
+    cols.push_back(col1.release());
+    tables.push_back(std::make_unique<table>(std::move(cols)));
+  }
+  auto expected = cudf::concatenate({*tables[0], *tables[1], *tables[2]});
+
+  auto filepath = temp_env->get_temp_filepath("ChunkedReadLimits.parquet");
+  cudf_io::write_parquet_chunked_args args{cudf_io::sink_info{filepath}};
+  args.compression = cudf_io::compression_type::SNAPPY;
+  args.stats_level = cudf_io::statistics_freq::STATISTICS_PAGE;
+  auto state       = cudf_io::write_parquet_chunked_begin(args);
+  for (auto const& tbl : tables) { cudf_io::write_parquet_chunked(*tbl, state); }
+  cudf_io::write_parquet_chunked_end(state);
+
+  auto read_chunks = [&](cudf_io::read_parquet_chunked_args const& read_args) {
+    std::vector<std::unique_ptr<table>> chunks;
+    auto read_state = cudf_io::read_parquet_chunked_begin(read_args);
+    while (cudf_io::read_parquet_chunked_has_next(read_state)) {
+      chunks.push_back(std::move(cudf_io::read_parquet_chunked(read_state).tbl));
+    }
+    EXPECT_THROW(cudf_io::read_parquet_chunked(read_state), cudf::logic_error);
+    return chunks;
+  };
+  auto concatenate_chunks = [](std::vector<std::unique_ptr<table>> const& chunks) {
+    std::vector<cudf::table_view> views;
+    for (auto const& chunk : chunks) { views.push_back(chunk->view()); }
+    return cudf::concatenate(views);
+  };
+
+  // No limit: a single table
+  cudf_io::read_parquet_chunked_args read_args{cudf_io::source_info{filepath}};
+  auto chunks = read_chunks(read_args);
+  ASSERT_EQ(1u, chunks.size());
+  expect_tables_equal(*chunks[0], *expected);
+
+  // One row group per table
+  read_args.chunk_read_limit = 150000;
+  chunks                     = read_chunks(read_args);
+  ASSERT_EQ(3u, chunks.size());
+  for (size_t i = 0; i < chunks.size(); ++i) { expect_tables_equal(*chunks[i], *tables[i]); }
+
+  // Row groups split into ranges of rows
+  read_args.chunk_read_limit = 50000;
+  chunks                     = read_chunks(read_args);
+  ASSERT_EQ(9u, chunks.size());
+  for (auto const& chunk : chunks) { EXPECT_LE(chunk->num_rows(), (num_rows + 2) / 3); }
+  expect_tables_equal(*concatenate_chunks(chunks), *expected);
+
+  // The decompressed page data of one row group per table
+  read_args.chunk_read_limit = 0;
+  read_args.pass_read_limit  = 150000;
+  chunks                     = read_chunks(read_args);
+  ASSERT_EQ(3u, chunks.size());
+  for (size_t i = 0; i < chunks.size(); ++i) { expect_tables_equal(*chunks[i], *tables[i]); }
+
+  // Row groups split into ranges of rows to limit the decompressed page data
+  read_args.pass_read_limit = 50000;
+  chunks                    = read_chunks(read_args);
+  ASSERT_GT(chunks.size(), 3u);
+  expect_tables_equal(*concatenate_chunks(chunks), *expected);
+  read_args.pass_read_limit = 0;
+
+  // Row groups skipped by a filter are counted in the metadata of the first table
+  read_args.chunk_read_limit = 0;
+  read_args.filter           = {"_col1", cudf_io::filter_op::GREATER_EQUAL, 2 * num_rows};
+  auto read_state            = cudf_io::read_parquet_chunked_begin(read_args);
+  auto result                = cudf_io::read_parquet_chunked(read_state);
+  expect_tables_equal(*result.tbl, *tables[2]);
+  EXPECT_EQ(2, result.metadata.num_filtered_row_groups);
+  EXPECT_FALSE(cudf_io::read_parquet_chunked_has_next(read_state));
+
+  // Ranges of rows of the row groups selected by the filter
+  read_args.chunk_read_limit = 50000;
+  chunks                     = read_chunks(read_args);
+  ASSERT_EQ(3u, chunks.size());
+  expect_tables_equal(*concatenate_chunks(chunks), *tables[2]);
+  read_args.chunk_read_limit = 0;
+
+  // No matching row group: a single empty table
+  read_args.filter = {"_col1", cudf_io::filter_op::LESS, 0};
+  chunks           = read_chunks(read_args);
+  ASSERT_EQ(1u, chunks.size());
+  EXPECT_EQ(0, chunks[0]->num_rows());
+  EXPECT_EQ(2, chunks[0]->num_columns());
+}
+
+TEST_F(ParquetDatasetReaderTest, HivePartitions)
+{
+  // Two partitions, whose files have different sets of columns
+  auto const root = temp_env->get_temp_filepath("Dataset");
+  for (auto const& dir : {root, root + "/year=2019", root + "/year=2020"}) {
+    ASSERT_EQ(0, mkdir(dir.c_str(), 0755));
+  }
+
+  auto values   = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i; });
+  auto validity = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i % 3; });
+  column_wrapper<int32_t> a0{values, values + 10};
+  column_wrapper<int64_t> b0{values, values + 10, validity};
+  column_wrapper<int32_t> a1{values + 10, values + 15};
+  cudf_io::table_metadata metadata0;
+  metadata0.column_names = {"a", "b"};
+  cudf_io::table_metadata metadata1;
+  metadata1.column_names = {"a"};
+  cudf_io::write_parquet_args args0{cudf_io::sink_info{root + "/year=2019/part-0.parquet"},
+                                    table_view{{a0, b0}},
+                                    &metadata0};
+  cudf_io::write_parquet(args0);
+  cudf_io::write_parquet_args args1{
+    cudf_io::sink_info{root + "/year=2020/part-0.parquet"}, table_view{{a1}}, &metadata1};
+  cudf_io::write_parquet(args1);
+  std::ofstream(root + "/_SUCCESS");
+
+  // Rows of the file without column `b` are null
+  auto b_values   = cudf::test::make_counting_transform_iterator(0, [](auto i) { return i; });
+  auto b_validity = cudf::test::make_counting_transform_iterator(
+    0, [](auto i) { return i < 10 && i % 3 != 0; });
+  auto years = cudf::test::make_counting_transform_iterator(
+    0, [](auto i) { return i < 10 ? 2019 : 2020; });
+  column_wrapper<int32_t> expected_a{values, values + 15};
+  column_wrapper<int64_t> expected_b{b_values, b_values + 15, b_validity};
+  column_wrapper<int64_t> expected_year{years, years + 15};
+
+  cudf_io::read_parquet_dataset_args read_args;
+  read_args.directory = root;
+  auto result         = cudf_io::read_parquet_dataset(read_args);
+  expect_tables_equal(*result.tbl, table_view{{expected_a, expected_b, expected_year}});
+  EXPECT_EQ(std::vector<std::string>({"a", "b", "year"}), result.metadata.column_names);
+
+  // Files are skipped by their partition values, but their columns are still returned
+  read_args.filter = {"year", cudf_io::filter_op::GREATER_EQUAL, 2020};
+  result           = cudf_io::read_parquet_dataset(read_args);
+  EXPECT_EQ(std::vector<std::string>({"a", "b", "year"}), result.metadata.column_names);
+  expect_columns_equal(result.tbl->get_column(0), a1);
+  EXPECT_EQ(5, result.tbl->num_rows());
+  EXPECT_EQ(5, result.tbl->get_column(1).null_count());
+
+  // Selected columns are returned in order, including partition columns
+  read_args.filter  = {};
+  read_args.columns = {"year", "a"};
+  result            = cudf_io::read_parquet_dataset(read_args);
+  expect_tables_equal(*result.tbl, table_view{{expected_year, expected_a}});
+
+  // Files listed explicitly, without partitions
+  cudf_io::read_parquet_dataset_args list_args{
+    {root + "/year=2020/part-0.parquet", root + "/year=2019/part-0.parquet"}};
+  list_args.hive_partitioning = false;
+  result                      = cudf_io::read_parquet_dataset(list_args);
+  EXPECT_EQ(std::vector<std::string>({"a", "b"}), result.metadata.column_names);
+  EXPECT_EQ(15, result.tbl->num_rows());
+  EXPECT_EQ(5 + 4, result.tbl->get_column(1).null_count());
+
+  // Columns must have the same type in every file
+  column_wrapper<double> mismatched{values, values + 5};
+  cudf_io::write_parquet_args args2{
+    cudf_io::sink_info{root + "/year=2020/part-1.parquet"}, table_view{{mismatched}}, &metadata1};
+  cudf_io::write_parquet(args2);
+  read_args.columns.clear();
+  EXPECT_THROW(cudf_io::read_parquet_dataset(read_args), cudf::logic_error);
+}
+
+TEST_F(ParquetDatasetReaderTest, Strings)
+{
+  // The strings of each file are kept once the page data of the file is released
+  std::vector<const char*> strings0{"alpha", "", "gamma", "delta"};
+  std::vector<const char*> strings1{"epsilon", "zeta", "", "theta", "iota"};
+  cudf::test::strings_column_wrapper col0(strings0.begin(), strings0.end(), {1, 1, 0, 1});
+  cudf::test::strings_column_wrapper col1(strings1.begin(), strings1.end(), {1, 0, 1, 1, 1});
+  cudf_io::table_metadata metadata;
+  metadata.column_names = {"s"};
+  std::vector<std::string> filepaths;
+  for (auto const& col : {&col0, &col1}) {
+    auto const name = "DatasetStrings" + std::to_string(filepaths.size()) + ".parquet";
+    filepaths.push_back(temp_env->get_temp_filepath(name));
+    cudf_io::write_parquet_args args{
+      cudf_io::sink_info{filepaths.back()}, table_view{{*col}}, &metadata};
+    cudf_io::write_parquet(args);
+  }
+
+  std::vector<const char*> expected_strings(strings0);
+  expected_strings.insert(expected_strings.end(), strings1.begin(), strings1.end());
+  cudf::test::strings_column_wrapper expected(
+    expected_strings.begin(), expected_strings.end(), {1, 1, 0, 1, 1, 0, 1, 1, 1});
+
+  cudf_io::read_parquet_dataset_args read_args{filepaths};
+  read_args.hive_partitioning = false;
+  auto result                 = cudf_io::read_parquet_dataset(read_args);
+  ASSERT_EQ(1, result.tbl->num_columns());
+  expect_columns_equal(result.tbl->get_column(0), expected);
+}
+
+TEST_F(ParquetDatasetWriterTest, HivePartitions)
+{
+  column_wrapper<int32_t> keys{{1, 2, 1, 0, 2, 1}, {1, 1, 1, 0, 1, 1}};
+  column_wrapper<int64_t> values{10, 20, 11, 30, 21, 12};
+  column_wrapper<cudf::string_view> names{"a", "b", "c", "d", "e", "f"};
+  table_view tbl{{keys, values, names}};
+  cudf_io::table_metadata_with_nullability metadata;
+  metadata.column_names = {"key", "value", "name"};
+
+  // A single open file: each partition of the second table goes to a new file
+  auto const root = temp_env->get_temp_filepath("PartitionedWrite");
+  cudf_io::write_parquet_dataset_args args{root, {0}};
+  args.metadata       = &metadata;
+  args.max_open_files = 1;
+  auto state          = cudf_io::write_parquet_dataset_begin(args);
+  cudf_io::write_parquet_dataset(tbl, state);
+  cudf_io::write_parquet_dataset(tbl, state);
+  cudf_io::write_parquet_dataset_end(state);
+
+  for (auto const& dir : {"key=1", "key=2", "key=__HIVE_DEFAULT_PARTITION__"}) {
+    for (auto const& file : {"/part-0.parquet", "/part-1.parquet"}) {
+      EXPECT_TRUE(std::ifstream(root + "/" + dir + file).good());
+    }
+  }
+  EXPECT_TRUE(std::ifstream(root + "/_metadata").good());
+
+  // Rows of each partition keep their order; the partition column is only in the paths
+  cudf_io::read_parquet_args read_args{cudf_io::source_info{root + "/key=1/part-1.parquet"}};
+  auto result = cudf_io::read_parquet(read_args);
+  column_wrapper<int64_t> expected_values{10, 11, 12};
+  column_wrapper<cudf::string_view> expected_names{"a", "c", "f"};
+  expect_tables_equal(*result.tbl, table_view{{expected_values, expected_names}});
+  EXPECT_EQ(std::vector<std::string>({"value", "name"}), result.metadata.column_names);
+
+  cudf_io::read_parquet_dataset_args dataset_args;
+  dataset_args.directory = root;
+  auto dataset           = cudf_io::read_parquet_dataset(dataset_args);
+  EXPECT_EQ(12, dataset.tbl->num_rows());
+  EXPECT_EQ(std::vector<std::string>({"value", "name", "key"}), dataset.metadata.column_names);
+  EXPECT_EQ(2, dataset.tbl->get_column(2).null_count());
+
+  // Partition columns must be integers or strings
+  column_wrapper<double> doubles{1.0, 2.0, 1.0, 0.0, 2.0, 1.0};
+  cudf_io::write_parquet_dataset_args double_args{
+    temp_env->get_temp_filepath("PartitionedWriteDoubles"), {0}};
+  auto double_state = cudf_io::write_parquet_dataset_begin(double_args);
+  EXPECT_THROW(cudf_io::write_parquet_dataset(table_view{{doubles, values}}, double_state),
+               cudf::logic_error);
+}
+
 TYPED_TEST(ParquetChunkedWriterNumericTypeTest, UnalignedSize)
 {
   // write out two 31 row tables and make sure they get
@@ -683,4 +683,261 @@ TEST_F(JoinTest, InnerJoinCornerCase)
   cudf::test::expect_tables_equal(*sorted_gold, *sorted_result);
 }
 
+TEST_F(JoinTest, HashJoinReusedAcrossProbes)
+{
+  column_wrapper<int32_t> build_col{{1, 2, 3, 2}};
+  cudf::table_view build({build_col});
+  cudf::hash_join joiner(build, {0});
+
+  auto sorted_indices = [](auto const& result) {
+    cudf::table_view indices({result.first->view(), result.second->view()});
+    return cudf::gather(indices, *cudf::sorted_order(indices));
+  };
+
+  column_wrapper<int32_t> probe0_col{{0, 1, 2}};
+  cudf::table_view probe0({probe0_col});
+
+  {
+    column_wrapper<int32_t> probe_gold{{1, 2, 2}};
+    column_wrapper<int32_t> build_gold{{0, 1, 3}};
+    auto result = sorted_indices(joiner.inner_join_indices(probe0, {0}));
+    cudf::test::expect_tables_equal(cudf::table_view({probe_gold, build_gold}), *result);
+  }
+  {
+    column_wrapper<int32_t> probe_gold{{0, 1, 2, 2}};
+    column_wrapper<int32_t> build_gold{{-1, 0, 1, 3}};
+    auto result = sorted_indices(joiner.left_join_indices(probe0, {0}));
+    cudf::test::expect_tables_equal(cudf::table_view({probe_gold, build_gold}), *result);
+  }
+  {
+    column_wrapper<int32_t> probe_gold{{-1, 0, 1, 2, 2}};
+    column_wrapper<int32_t> build_gold{{2, -1, 0, 1, 3}};
+    auto result = sorted_indices(joiner.full_join_indices(probe0, {0}));
+    cudf::test::expect_tables_equal(cudf::table_view({probe_gold, build_gold}), *result);
+  }
+  cudf::test::expect_columns_equal(*joiner.left_semi_join_indices(probe0, {0}),
+                                   column_wrapper<int32_t>{{1, 2}});
+  cudf::test::expect_columns_equal(*joiner.left_anti_join_indices(probe0, {0}),
+                                   column_wrapper<int32_t>{{0}});
+
+  column_wrapper<int32_t> probe1_col{{3, 5}};
+  cudf::table_view probe1({probe1_col});
+  {
+    column_wrapper<int32_t> probe_gold{{0}};
+    column_wrapper<int32_t> build_gold{{2}};
+    auto result = sorted_indices(joiner.inner_join_indices(probe1, {0}));
+    cudf::test::expect_tables_equal(cudf::table_view({probe_gold, build_gold}), *result);
+  }
+  cudf::test::expect_columns_equal(*joiner.left_anti_join_indices(probe1, {0}),
+                                   column_wrapper<int32_t>{{1}});
+
+  column_wrapper<int64_t> mismatched_col{{1, 2}};
+  cudf::table_view mismatched({mismatched_col});
+  EXPECT_THROW(joiner.inner_join_indices(mismatched, {0}), cudf::logic_error);
+}
+
+TEST_F(JoinTest, HashJoinLeftJoinIndicesGather)
+{
+  column_wrapper<int32_t> build_col0{{1, 2, 3}};
+  column_wrapper<int32_t> build_col1{{10, 20, 30}};
+  cudf::table_view build({build_col0, build_col1});
+  cudf::hash_join joiner(build, {0});
+
+  column_wrapper<int32_t> probe_col0{{0, 1, 2, 5}};
+  column_wrapper<int32_t> probe_col1{{4, 5, 6, 7}};
+  cudf::table_view probe({probe_col0, probe_col1});
+
+  // Unmatched probe rows gather nulls from the build table, not its last row
+  auto indices = joiner.left_join_indices(probe, {0});
+  auto result =
+    cudf::gather_join_columns(probe, build, *indices.first, *indices.second, {0, 1}, {1});
+  auto sorted_result = cudf::gather(result->view(), *cudf::sorted_order(result->view()));
+
+  column_wrapper<int32_t> col_gold_0{{0, 1, 2, 5}};
+  column_wrapper<int32_t> col_gold_1{{4, 5, 6, 7}};
+  column_wrapper<int32_t> col_gold_2{{0, 10, 20, 0}, {0, 1, 1, 0}};
+  cudf::test::expect_tables_equal(cudf::table_view({col_gold_0, col_gold_1, col_gold_2}),
+                                  *sorted_result);
+}
+
+TEST_F(JoinTest, LeftJoinIndicesGatherRequestedColumns)
+{
+  column_wrapper<int32_t> col0_0{{0, 1, 2}};
+  column_wrapper<int32_t> col0_1{{5, 6, 7}};
+  column_wrapper<int32_t> col1_0{{1, 2, 3}};
+  column_wrapper<int32_t> col1_1{{8, 9, 10}};
+  cudf::table_view t0({col0_0, col0_1});
+  cudf::table_view t1({col1_0, col1_1});
+
+  auto indices = cudf::left_join_indices(t0, t1, {0}, {0});
+  {
+    cudf::table_view indices_view({indices.first->view(), indices.second->view()});
+    auto sorted_indices = cudf::gather(indices_view, *cudf::sorted_order(indices_view));
+    column_wrapper<int32_t> left_gold{{0, 1, 2}};
+    column_wrapper<int32_t> right_gold{{-1, 0, 1}};
+    cudf::test::expect_tables_equal(cudf::table_view({left_gold, right_gold}), *sorted_indices);
+  }
+
+  auto result = cudf::gather_join_columns(t0, t1, *indices.first, *indices.second, {1}, {1});
+  EXPECT_EQ(result->num_columns(), 2);
+  auto sorted_result = cudf::gather(result->view(), *cudf::sorted_order(result->view()));
+
+  column_wrapper<int32_t> col_gold_0{{5, 6, 7}};
+  column_wrapper<int32_t> col_gold_1{{0, 8, 9}, {0, 1, 1}};
+  cudf::test::expect_tables_equal(cudf::table_view({col_gold_0, col_gold_1}), *sorted_result);
+}
+
+TEST_F(JoinTest, ExactOutputSizeDuplicateKeys)
+{
+  column_wrapper<int32_t> col0_0{{0, 0, 0, 1, 1, 2, 3}};
+  column_wrapper<int32_t> col0_1{{1, 2, 3, 4, 5, 6, 7}};
+  column_wrapper<int32_t> col1_0{{0, 0, 1, 1, 1, 4}};
+  column_wrapper<int32_t> col1_1{{8, 9, 10, 11, 12, 13}};
+  cudf::table_view t0({col0_0, col0_1});
+  cudf::table_view t1({col1_0, col1_1});
+
+  auto sorted = [](cudf::table_view const& result) {
+    return cudf::gather(result, *cudf::sorted_order(result));
+  };
+
+  cudf::join_options exact;
+  exact.output_size = cudf::join_output_size::EXACT;
+
+  auto inner_estimate = cudf::inner_join(t0, t1, {0}, {0}, {{0, 0}});
+  auto inner_exact    = cudf::inner_join(t0, t1, {0}, {0}, {{0, 0}}, exact);
+  EXPECT_EQ(inner_exact->num_rows(), 12);
+  cudf::test::expect_tables_equal(*sorted(*inner_estimate), *sorted(*inner_exact));
+
+  auto left_estimate = cudf::left_join(t0, t1, {0}, {0}, {{0, 0}});
+  auto left_exact    = cudf::left_join(t0, t1, {0}, {0}, {{0, 0}}, exact);
+  EXPECT_EQ(left_exact->num_rows(), 14);
+  cudf::test::expect_tables_equal(*sorted(*left_estimate), *sorted(*left_exact));
+
+  auto full_estimate = cudf::full_join(t0, t1, {0}, {0}, {{0, 0}});
+  auto full_exact    = cudf::full_join(t0, t1, {0}, {0}, {{0, 0}}, exact);
+  EXPECT_EQ(full_exact->num_rows(), 15);
+  cudf::test::expect_tables_equal(*sorted(*full_estimate), *sorted(*full_exact));
+
+  // An empty left table probes nothing, and every right row is in the full join
+  column_wrapper<int32_t> empty_col0;
+  column_wrapper<int32_t> empty_col1;
+  cudf::table_view empty({empty_col0, empty_col1});
+  auto empty_full_estimate = cudf::full_join(empty, t1, {0}, {0}, {{0, 0}});
+  auto empty_full_exact    = cudf::full_join(empty, t1, {0}, {0}, {{0, 0}}, exact);
+  EXPECT_EQ(empty_full_exact->num_rows(), 6);
+  cudf::test::expect_tables_equal(*sorted(*empty_full_estimate), *sorted(*empty_full_exact));
+  auto empty_indices = cudf::full_join_indices(empty, t1, {0}, {0}, exact);
+  EXPECT_EQ(empty_indices.first->size(), 6);
+
+  // The exact output is ordered by probe row
+  cudf::hash_join joiner(t1, {0});
+  auto indices = joiner.left_join_indices(t0, {0}, exact);
+  column_wrapper<int32_t> probe_gold{{0, 0, 1, 1, 2, 2, 3, 3, 3, 4, 4, 4, 5, 6}};
+  cudf::test::expect_columns_equal(*indices.first, probe_gold);
+}
+
+TEST_F(JoinTest, SortMergeJoinMatchesHashJoin)
+{
+  column_wrapper<int32_t> col0_0{{3, 1, 0, 1, 5, 0, 2}};
+  strcol_wrapper col0_1({"s0", "s1", "s2", "s3", "s4", "s5", "s6"});
+  column_wrapper<int32_t> col1_0{{1, 4, 0, 1, 0, 1}};
+  column_wrapper<int32_t> col1_1{{8, 9, 10, 11, 12, 13}};
+  cudf::table_view t0({col0_0, col0_1});
+  cudf::table_view t1({col1_0, col1_1});
+
+  auto sorted = [](cudf::table_view const& result) {
+    return cudf::gather(result, *cudf::sorted_order(result));
+  };
+  cudf::join_options hash;
+  hash.algorithm = cudf::join_algorithm::HASH;
+  cudf::join_options sort_merge;
+  sort_merge.algorithm = cudf::join_algorithm::SORT_MERGE;
+
+  auto inner_hash = cudf::inner_join(t0, t1, {0}, {0}, {{0, 0}}, hash);
+  auto inner_sort = cudf::inner_join(t0, t1, {0}, {0}, {{0, 0}}, sort_merge);
+  EXPECT_EQ(inner_sort->num_rows(), 10);
+  cudf::test::expect_tables_equal(*sorted(*inner_hash), *sorted(*inner_sort));
+
+  auto left_hash = cudf::left_join(t0, t1, {0}, {0}, {{0, 0}}, hash);
+  auto left_sort = cudf::left_join(t0, t1, {0}, {0}, {{0, 0}}, sort_merge);
+  EXPECT_EQ(left_sort->num_rows(), 13);
+  cudf::test::expect_tables_equal(*sorted(*left_hash), *sorted(*left_sort));
+
+  auto full_hash = cudf::full_join(t0, t1, {0}, {0}, {{0, 0}}, hash);
+  auto full_sort = cudf::full_join(t0, t1, {0}, {0}, {{0, 0}}, sort_merge);
+  EXPECT_EQ(full_sort->num_rows(), 14);
+  cudf::test::expect_tables_equal(*sorted(*full_hash), *sorted(*full_sort));
+
+  // Right keys flagged sorted select the sort-merge join by default and skip sorting
+  auto sorted_t1 = cudf::sort_by_key(t1, cudf::table_view({col1_0}));
+  cudf::join_options sorted_keys;
+  sorted_keys.keys_are_sorted = cudf::sorted::YES;
+
+  auto indices = cudf::left_join_indices(t0, *sorted_t1, {0}, {0}, sorted_keys);
+  column_wrapper<int32_t> left_gold{{0, 1, 1, 1, 2, 2, 3, 3, 3, 4, 5, 5, 6}};
+  column_wrapper<int32_t> right_gold{{-1, 2, 3, 4, 0, 1, 2, 3, 4, -1, 0, 1, -1}};
+  cudf::test::expect_columns_equal(*indices.first, left_gold);
+  cudf::test::expect_columns_equal(*indices.second, right_gold);
+}
+
+TEST_F(JoinTest, ConditionalBandJoin)
+{
+  column_wrapper<int32_t> col0_0{{0, 10, 20, 35}, {1, 1, 1, 0}};
+  column_wrapper<int32_t> col1_0{{1, 12, 30, 11, 10}, {1, 1, 1, 1, 0}};
+  cudf::table_view t0({col0_0});
+  cudf::table_view t1({col1_0});
+
+  auto sorted = [](auto const& indices) {
+    cudf::table_view indices_view({indices.first->view(), indices.second->view()});
+    return cudf::gather(indices_view, *cudf::sorted_order(indices_view));
+  };
+
+  // left[0] BETWEEN right[0] - 2 AND right[0] + 2, answered with binary searches
+  auto const band = cudf::join_predicate::band(0, 0, -2, 2);
+  {
+    column_wrapper<int32_t> left_gold{{0, 1, 1}};
+    column_wrapper<int32_t> right_gold{{0, 1, 3}};
+    cudf::test::expect_tables_equal(cudf::table_view({left_gold, right_gold}),
+                                    *sorted(cudf::conditional_inner_join_indices(t0, t1, band)));
+  }
+
+  column_wrapper<int32_t> left_gold{{0, 1, 1, 2, 3}};
+  column_wrapper<int32_t> right_gold{{0, 1, 3, -1, -1}};
+  cudf::test::expect_tables_equal(cudf::table_view({left_gold, right_gold}),
+                                  *sorted(cudf::conditional_left_join_indices(t0, t1, band)));
+
+  // The same band with a clause that never holds is evaluated on every pair of rows
+  auto const never = cudf::join_predicate::compare(0, cudf::join_comparator::EQUAL, 0, 1000);
+  auto const band_or_never = cudf::join_predicate::logical_or(band, never);
+  cudf::test::expect_tables_equal(
+    cudf::table_view({left_gold, right_gold}),
+    *sorted(cudf::conditional_left_join_indices(t0, t1, band_or_never)));
+}
+
+TEST_F(JoinTest, ConditionalFullJoinMixedPredicate)
+{
+  column_wrapper<int32_t> col0_0{{1, 2, 3}};
+  column_wrapper<int64_t> col0_1{{10, 20, 30}};
+  column_wrapper<int32_t> col1_0{{1, 2, 5}};
+  column_wrapper<int64_t> col1_1{{15, 15, 15}};
+  column_wrapper<float> col1_2{{1, 2, 5}};
+  cudf::table_view t0({col0_0, col0_1});
+  cudf::table_view t1({col1_0, col1_1, col1_2});
+
+  // left[0] == right[0] AND left[1] < right[1]
+  auto const predicate = cudf::join_predicate::logical_and(
+    cudf::join_predicate::compare(0, cudf::join_comparator::EQUAL, 0),
+    cudf::join_predicate::compare(1, cudf::join_comparator::LESS, 1));
+  auto indices = cudf::conditional_full_join_indices(t0, t1, predicate);
+
+  cudf::table_view indices_view({indices.first->view(), indices.second->view()});
+  auto sorted_indices = cudf::gather(indices_view, *cudf::sorted_order(indices_view));
+  column_wrapper<int32_t> left_gold{{-1, -1, 0, 1, 2}};
+  column_wrapper<int32_t> right_gold{{1, 2, 0, -1, -1}};
+  cudf::test::expect_tables_equal(cudf::table_view({left_gold, right_gold}), *sorted_indices);
+
+  auto const mismatched = cudf::join_predicate::compare(0, cudf::join_comparator::LESS, 2);
+  EXPECT_THROW(cudf::conditional_inner_join_indices(t0, t1, mismatched), cudf::logic_error);
+}
+
 CUDF_TEST_PROGRAM_MAIN()